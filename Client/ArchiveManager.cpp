@@ -0,0 +1,80 @@
+#include "pch.h"
+#include "ArchiveManager.h"
+#include "Logger.h"
+
+namespace Resource
+{
+    ArchiveManager& ArchiveManager::Instance()
+    {
+        static ArchiveManager instance;
+        return instance;
+    }
+
+    bool ArchiveManager::Mount(const std::string& path)
+    {
+        auto archive = std::make_shared<AssetArchive>();
+        if (!archive->Open(path)) {
+            return false;
+        }
+
+        std::unique_lock<std::shared_mutex> lock(m_mutex);
+        m_archives.push_back(std::move(archive));
+        return true;
+    }
+
+    void ArchiveManager::Unmount(const std::string& path)
+    {
+        //   AssetData       
+        std::unique_lock<std::shared_mutex> lock(m_mutex);
+        std::erase_if(m_archives, [&](const std::shared_ptr<AssetArchive>& archive) {
+            return archive->GetPath() == path;
+            });
+    }
+
+    void ArchiveManager::UnmountAll()
+    {
+        std::unique_lock<std::shared_mutex> lock(m_mutex);
+        m_archives.clear();
+    }
+
+    AssetData ArchiveManager::Find(std::string_view path) const
+    {
+        AssetData asset;
+        ArchiveItem item;
+        {
+            std::shared_lock<std::shared_mutex> lock(m_mutex);
+            for (auto it = m_archives.rbegin(); it != m_archives.rend() && !item; ++it) {
+                item = (*it)->Find(path);
+                if (item) {
+                    asset.archive = *it;
+                }
+            }
+        }
+
+        if (!item) {
+            return {};
+        }
+
+        //   ׸  ״ 
+        if (!item.compressed) {
+            asset.bytes = item.bytes;
+            return asset;
+        }
+
+        //  ׸     ( ۿ)
+        auto buffer = std::make_shared<std::vector<uint8_t>>(static_cast<size_t>(item.rawSize));
+        if (!AssetArchive::Read(item, *buffer)) {
+            Logger::Instance().Error("  : {}", path);
+            return {};
+        }
+        asset.bytes = *buffer;
+        asset.decoded = std::move(buffer);
+        return asset;
+    }
+
+    size_t ArchiveManager::GetMountCount() const
+    {
+        std::shared_lock<std::shared_mutex> lock(m_mutex);
+        return m_archives.size();
+    }
+}
@@ -0,0 +1,43 @@
+#pragma once
+#include "pch.h"
+#include "AssetArchive.h"
+
+namespace Resource
+{
+    // Ű ã  Ʈ - ϴ  Ű  
+    //  ׸  ۸ Բ  
+    struct AssetData {
+        std::shared_ptr<const AssetArchive> archive;
+        std::shared_ptr<const std::vector<uint8_t>> decoded;
+        std::span<const uint8_t> bytes;
+
+        explicit operator bool() const { return archive != nullptr; }
+        const uint8_t* data() const { return bytes.data(); }
+        size_t size() const { return bytes.size(); }
+    };
+
+    // Ʈ Ű  (߿ Ʈ Ű 켱)
+    class ArchiveManager {
+    public:
+        static ArchiveManager& Instance();
+
+        bool Mount(const std::string& path);
+        void Unmount(const std::string& path);
+        void UnmountAll();
+
+        // Ʈ Ű  ȸ (  AssetData)
+        AssetData Find(std::string_view path) const;
+
+        size_t GetMountCount() const;
+
+    private:
+        ArchiveManager() = default;
+        ~ArchiveManager() = default;
+
+        ArchiveManager(const ArchiveManager&) = delete;
+        ArchiveManager& operator=(const ArchiveManager&) = delete;
+
+        mutable std::shared_mutex m_mutex;
+        std::vector<std::shared_ptr<AssetArchive>> m_archives;
+    };
+}
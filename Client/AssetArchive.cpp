@@ -0,0 +1,149 @@
+#include "pch.h"
+#include "AssetArchive.h"
+#include "ResourceCache.h"
+#include "BlockCodec.h"
+#include "Logger.h"
+
+namespace Resource
+{
+    AssetArchive::~AssetArchive()
+    {
+        Close();
+    }
+
+    bool AssetArchive::Open(const std::string& path)
+    {
+        Close();
+        m_path = path;
+
+        if (!m_view.Open(path, true)) {
+            Logger::Instance().Error("Ű    ϴ: {}", path);
+            return false;
+        }
+        if (m_view.GetSize() < sizeof(ArchiveFormat::Header)) {
+            Logger::Instance().Error("߸ Ű ũ: {}", path);
+            Close();
+            return false;
+        }
+
+        m_base = m_view.GetData();
+        m_size = m_view.GetSize();
+
+        m_header = reinterpret_cast<const ArchiveFormat::Header*>(m_base);
+        m_entries = reinterpret_cast<const ArchiveFormat::Entry*>(m_base + m_header->tocOffset);
+
+        if (!Validate()) {
+            Logger::Instance().Error("ջ Ű: {}", path);
+            Close();
+            return false;
+        }
+
+        Logger::Instance().Debug("Ű : {} ({} ׸, {} bytes)", path, GetEntryCount(), m_size);
+        return true;
+    }
+
+    void AssetArchive::Close()
+    {
+        m_view.Close();
+        m_base = nullptr;
+        m_header = nullptr;
+        m_entries = nullptr;
+        m_size = 0;
+    }
+
+    ArchiveItem AssetArchive::Find(std::string_view path) const
+    {
+        if (!m_entries) return {};
+
+        const std::string normalized = NormalizePath(path);
+        const uint64_t hash = HashPath(normalized);
+
+        const auto* begin = m_entries;
+        const auto* end = m_entries + m_header->entryCount;
+        const auto* it = std::lower_bound(begin, end, hash,
+            [](const ArchiveFormat::Entry& entry, uint64_t value) { return entry.pathHash < value; });
+
+        // ؽ 浹  ̸ 
+        for (; it != end && it->pathHash == hash; ++it) {
+            if (GetName(*it) == normalized) {
+                return GetItem(*it);
+            }
+        }
+        return {};
+    }
+
+    bool AssetArchive::Read(const ArchiveItem& item, std::span<uint8_t> dest)
+    {
+        if (!item || dest.size() != item.rawSize) {
+            return false;
+        }
+
+        if (!item.compressed) {
+            std::memcpy(dest.data(), item.bytes.data(), item.bytes.size());
+            return true;
+        }
+        return BlockCodec::Decompress(item.bytes, dest);
+    }
+
+    std::string AssetArchive::NormalizePath(std::string_view path)
+    {
+        std::string result;
+        result.reserve(path.size());
+
+        for (char c : path) {
+            if (c == '\\') c = '/';
+            result.push_back(static_cast<char>(std::tolower(static_cast<unsigned char>(c))));
+        }
+
+        while (result.starts_with("./")) {
+            result.erase(0, 2);
+        }
+        return result;
+    }
+
+    uint64_t AssetArchive::HashPath(std::string_view normalizedPath)
+    {
+        return ResourceKeyBuilder().Add(normalizedPath).Get();
+    }
+
+    bool AssetArchive::Validate() const
+    {
+        const auto& header = *m_header;
+        if (header.magic != ArchiveFormat::Magic || header.version != ArchiveFormat::Version) {
+            return false;
+        }
+
+        const uint64_t tocEnd = header.tocOffset +
+            static_cast<uint64_t>(header.entryCount) * sizeof(ArchiveFormat::Entry);
+        if (header.tocOffset < sizeof(ArchiveFormat::Header) || tocEnd > m_size ||
+            header.namesOffset < tocEnd || header.namesOffset > m_size) {
+            return false;
+        }
+
+        //  ĵǾ ְ    ȿ ִ   Ȯ
+        for (uint32_t i = 0; i < header.entryCount; ++i) {
+            const auto& entry = m_entries[i];
+            if (i > 0 && m_entries[i - 1].pathHash > entry.pathHash) return false;
+            if (entry.offset > m_size || entry.size > m_size - entry.offset) return false;
+            if (!(entry.flags & ArchiveFormat::EntryCompressed) && entry.size != entry.rawSize) return false;
+            if (header.namesOffset + entry.nameOffset + entry.nameLength > m_size) return false;
+        }
+        return true;
+    }
+
+    std::string_view AssetArchive::GetName(const ArchiveFormat::Entry& entry) const
+    {
+        return std::string_view(
+            reinterpret_cast<const char*>(m_base + m_header->namesOffset + entry.nameOffset),
+            entry.nameLength);
+    }
+
+    ArchiveItem AssetArchive::GetItem(const ArchiveFormat::Entry& entry) const
+    {
+        ArchiveItem item;
+        item.bytes = std::span<const uint8_t>(m_base + entry.offset, static_cast<size_t>(entry.size));
+        item.rawSize = entry.rawSize;
+        item.compressed = (entry.flags & ArchiveFormat::EntryCompressed) != 0;
+        return item;
+    }
+}
@@ -0,0 +1,102 @@
+#pragma once
+#include "pch.h"
+#include "MappedFile.h"
+
+namespace Resource
+{
+    // Ű  ̾ƿ
+    // [ArchiveHeader][ArchiveEntry x entryCount (ؽ )][̸ ̺][ĵ ̷ε...]
+    //   ʿ  ־   ѵ  ǵ帲
+    namespace ArchiveFormat
+    {
+        constexpr uint32_t Magic = 0x314B4150;     // "PAK1"
+        constexpr uint32_t Version = 2;
+        constexpr uint32_t DefaultAlignment = 4096; //   
+
+        struct Header {
+            uint32_t magic;
+            uint32_t version;
+            uint32_t entryCount;
+            uint32_t alignment;
+            uint64_t tocOffset;
+            uint64_t namesOffset;
+        };
+        static_assert(sizeof(Header) == 32);
+
+        enum EntryFlags : uint16_t {
+            EntryCompressed = 1 << 0    // ̷ε尡 BlockCodec Ʈ
+        };
+
+        struct Entry {
+            uint64_t pathHash;      // ȭ  ؽ
+            uint64_t offset;        //    ̷ε ġ
+            uint64_t size;          //  ̷ε ũ
+            uint64_t rawSize;       //    ũ
+            uint32_t nameOffset;    // ̸ ̺  ġ
+            uint16_t nameLength;
+            uint16_t flags;
+        };
+        static_assert(sizeof(Entry) == 40);
+    }
+
+    // Ű ׸ - bytes   Ŵ (   Ʈ)
+    struct ArchiveItem {
+        std::span<const uint8_t> bytes;
+        uint64_t rawSize = 0;
+        bool compressed = false;
+
+        explicit operator bool() const { return bytes.data() != nullptr; }
+    };
+
+    // ޸   б   Ű
+    //   ׸  ״ ϹǷ 簡 
+    class AssetArchive {
+    public:
+        AssetArchive() = default;
+        ~AssetArchive();
+
+        //  
+        AssetArchive(const AssetArchive&) = delete;
+        AssetArchive& operator=(const AssetArchive&) = delete;
+
+        bool Open(const std::string& path);
+        void Close();
+
+        bool IsOpen() const { return m_base != nullptr; }
+        const std::string& GetPath() const { return m_path; }
+        size_t GetEntryCount() const { return m_header ? m_header->entryCount : 0; }
+        size_t GetMappedSize() const { return m_size; }
+
+        // η ׸ ȸ (  ׸)
+        ArchiveItem Find(std::string_view path) const;
+        bool Contains(std::string_view path) const { return static_cast<bool>(Find(path)); }
+
+        // ׸  dest  ( ׸   ). dest ũ rawSize ƾ 
+        static bool Read(const ArchiveItem& item, std::span<uint8_t> dest);
+
+        //  Ʈ ȸ - fn(name, item)
+        template<typename Fn>
+        void ForEach(Fn&& fn) const {
+            for (size_t i = 0; i < GetEntryCount(); ++i) {
+                fn(GetName(m_entries[i]), GetItem(m_entries[i]));
+            }
+        }
+
+        // ҹڿ ڸ   ("./Texture\\A.dds" -> "texture/a.dds")
+        static std::string NormalizePath(std::string_view path);
+        static uint64_t HashPath(std::string_view normalizedPath);
+
+    private:
+        bool Validate() const;
+        std::string_view GetName(const ArchiveFormat::Entry& entry) const;
+        ArchiveItem GetItem(const ArchiveFormat::Entry& entry) const;
+
+        std::string m_path;
+        MappedFile m_view;
+        const uint8_t* m_base = nullptr;
+        size_t m_size = 0;
+
+        const ArchiveFormat::Header* m_header = nullptr;
+        const ArchiveFormat::Entry* m_entries = nullptr;
+    };
+}
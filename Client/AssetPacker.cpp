@@ -0,0 +1,334 @@
+#include "pch.h"
+#include "AssetPacker.h"
+#include "BlockCodec.h"
+#include "Logger.h"
+
+namespace Resource
+{
+    namespace
+    {
+        struct PackItem {
+            std::string name;               // ȭ  
+            std::filesystem::path source;
+            uint64_t hash = 0;
+            uint64_t size = 0;          //  ũ
+            uint64_t rawSize = 0;
+            uint64_t offset = 0;
+            uint32_t nameOffset = 0;
+            uint16_t flags = 0;
+        };
+
+        //      ũ  ״ 
+        constexpr double MaxCompressedRatio = 0.95;
+
+        uint64_t AlignUp(uint64_t value, uint64_t alignment) {
+            return (value + alignment - 1) / alignment * alignment;
+        }
+
+        //  Ʈ о   ǵ帮 
+        uint64_t Checksum(const uint8_t* data, size_t size) {
+            uint64_t sum = 0;
+            for (size_t i = 0; i < size; ++i) {
+                sum += data[i];
+            }
+            return sum;
+        }
+
+        bool ReadFile(const std::filesystem::path& path, std::vector<uint8_t>& data) {
+            std::ifstream in(path, std::ios::binary | std::ios::ate);
+            if (!in) return false;
+            data.resize(static_cast<size_t>(in.tellg()));
+            in.seekg(0);
+            in.read(reinterpret_cast<char*>(data.data()), data.size());
+            return static_cast<size_t>(in.gcount()) == data.size();
+        }
+
+        double ToMBps(size_t bytes, double ms) {
+            return ms > 0.0 ? (bytes / (1024.0 * 1024.0)) / (ms / 1000.0) : 0.0;
+        }
+    }
+
+    bool AssetPacker::Pack(const std::string& rootDir, const std::vector<std::string>& files,
+        const std::string& outputPath, int compressionLevel, uint32_t alignment)
+    {
+        if (alignment == 0 || (alignment & (alignment - 1)) != 0) {
+            Logger::Instance().Error("  2 ŵ̾ մϴ: {}", alignment);
+            return false;
+        }
+
+        const std::filesystem::path root(rootDir);
+        std::vector<PackItem> items;
+        items.reserve(files.size());
+
+        uint64_t namesSize = 0;
+        for (const auto& file : files) {
+            PackItem item;
+            item.source = root / file;
+            item.name = AssetArchive::NormalizePath(file);
+            item.hash = AssetArchive::HashPath(item.name);
+            item.nameOffset = static_cast<uint32_t>(namesSize);
+
+            if (!std::filesystem::is_regular_file(item.source)) {
+                Logger::Instance().Error("ŷ  ã  ϴ: {}", item.source.string());
+                return false;
+            }
+            if (item.name.size() > std::numeric_limits<uint16_t>::max()) {
+                Logger::Instance().Error("ΰ ʹ ϴ: {}", item.name);
+                return false;
+            }
+            namesSize += item.name.size();
+            items.push_back(std::move(item));
+        }
+
+        //  ؽ   (ȸ   Ž)
+        std::vector<PackItem*> toc;
+        toc.reserve(items.size());
+        for (auto& item : items) {
+            toc.push_back(&item);
+        }
+        std::sort(toc.begin(), toc.end(), [](const PackItem* a, const PackItem* b) {
+            return a->hash != b->hash ? a->hash < b->hash : a->name < b->name;
+            });
+
+        for (size_t i = 1; i < toc.size(); ++i) {
+            if (toc[i - 1]->name == toc[i]->name) {
+                Logger::Instance().Error("ߺ : {}", toc[i]->name);
+                return false;
+            }
+        }
+
+        std::ofstream out(outputPath, std::ios::binary | std::ios::trunc);
+        if (!out) {
+            Logger::Instance().Error("Ű    ϴ: {}", outputPath);
+            return false;
+        }
+
+        //   ڸ  ΰ ̷ε带   ä
+        // (  ũ     )
+        const uint64_t tocOffset = sizeof(ArchiveFormat::Header);
+        const uint64_t namesOffset = tocOffset + items.size() * sizeof(ArchiveFormat::Entry);
+        const std::vector<char> reserved(static_cast<size_t>(namesOffset), 0);
+        out.write(reserved.data(), reserved.size());
+
+        for (const auto& item : items) {
+            out.write(item.name.data(), item.name.size());
+        }
+
+        // ̷ε Է  ġ (Բ ̴   ̵)
+        uint64_t cursor = namesOffset + namesSize;
+        uint64_t rawTotal = 0;
+        std::vector<uint8_t> data;
+        for (auto& item : items) {
+            if (!ReadFile(item.source, data)) {
+                Logger::Instance().Error(" б : {}", item.source.string());
+                return false;
+            }
+
+            std::vector<uint8_t> stream;
+            if (compressionLevel > 0 && !data.empty()) {
+                stream = BlockCodec::Compress(data, compressionLevel);
+            }
+
+            const bool compressed = !stream.empty() && stream.size() < data.size() * MaxCompressedRatio;
+            const std::vector<uint8_t>& payload = compressed ? stream : data;
+
+            const uint64_t aligned = AlignUp(cursor, alignment);
+            const std::vector<char> padding(static_cast<size_t>(aligned - cursor), 0);
+            out.write(padding.data(), padding.size());
+            out.write(reinterpret_cast<const char*>(payload.data()), payload.size());
+
+            item.offset = aligned;
+            item.size = payload.size();
+            item.rawSize = data.size();
+            item.flags = compressed ? ArchiveFormat::EntryCompressed : 0;
+            cursor = aligned + payload.size();
+            rawTotal += data.size();
+        }
+
+        ArchiveFormat::Header header = {};
+        header.magic = ArchiveFormat::Magic;
+        header.version = ArchiveFormat::Version;
+        header.entryCount = static_cast<uint32_t>(items.size());
+        header.alignment = alignment;
+        header.tocOffset = tocOffset;
+        header.namesOffset = namesOffset;
+
+        out.seekp(0);
+        out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        for (const PackItem* item : toc) {
+            ArchiveFormat::Entry entry = {};
+            entry.pathHash = item->hash;
+            entry.offset = item->offset;
+            entry.size = item->size;
+            entry.rawSize = item->rawSize;
+            entry.nameOffset = item->nameOffset;
+            entry.nameLength = static_cast<uint16_t>(item->name.size());
+            entry.flags = item->flags;
+            out.write(reinterpret_cast<const char*>(&entry), sizeof(entry));
+        }
+
+        if (!out) {
+            Logger::Instance().Error("Ű  : {}", outputPath);
+            return false;
+        }
+
+        Logger::Instance().Info("Ű  Ϸ: {} ({} ׸,  {} bytes -> {} bytes)",
+            outputPath, items.size(), rawTotal, cursor);
+        return true;
+    }
+
+    bool AssetPacker::PackDirectory(const std::string& rootDir, const std::string& outputPath,
+        int compressionLevel, uint32_t alignment)
+    {
+        std::error_code ec;
+        const auto outputAbsolute = std::filesystem::weakly_canonical(outputPath, ec);
+
+        std::vector<std::string> files;
+        for (const auto& entry : std::filesystem::recursive_directory_iterator(rootDir, ec)) {
+            if (!entry.is_regular_file()) continue;
+            if (std::filesystem::weakly_canonical(entry.path(), ec) == outputAbsolute) continue;
+            files.push_back(std::filesystem::relative(entry.path(), rootDir).generic_string());
+        }
+        if (ec) {
+            Logger::Instance().Error("͸   ϴ: {}", rootDir);
+            return false;
+        }
+
+        //  ͸  ̿ϵ   
+        std::sort(files.begin(), files.end());
+        return Pack(rootDir, files, outputPath, compressionLevel, alignment);
+    }
+
+    AssetPacker::BenchmarkResult AssetPacker::RunLoadBenchmark(const std::string& archivePath,
+        const std::string& rootDir, int iterations)
+    {
+        BenchmarkResult result;
+
+        std::vector<std::string> names;
+        {
+            AssetArchive archive;
+            if (!archive.Open(archivePath)) {
+                return result;
+            }
+            archive.ForEach([&](std::string_view name, const ArchiveItem& item) {
+                names.emplace_back(name);
+                result.totalBytes += static_cast<size_t>(item.rawSize);
+                result.storedBytes += item.bytes.size();
+                });
+        }
+        result.fileCount = names.size();
+        iterations = std::max(iterations, 1);
+
+        using Clock = std::chrono::steady_clock;
+        uint64_t looseSum = 0;
+        uint64_t archiveSum = 0;
+
+        //  :  δó  Ȯ +  + ü б
+        const std::filesystem::path root(rootDir);
+        auto looseStart = Clock::now();
+        for (int i = 0; i < iterations; ++i) {
+            for (const auto& name : names) {
+                const auto path = root / name;
+                if (!std::filesystem::exists(path)) continue;
+
+                std::vector<uint8_t> data;
+                ReadFile(path, data);
+                looseSum += Checksum(data.data(), data.size());
+            }
+        }
+        auto looseEnd = Clock::now();
+
+        // Ű:    ο ٷ б ( ׸  )
+        std::vector<uint8_t> decoded;
+        auto archiveStart = Clock::now();
+        for (int i = 0; i < iterations; ++i) {
+            AssetArchive archive;
+            if (!archive.Open(archivePath)) break;
+            for (const auto& name : names) {
+                auto item = archive.Find(name);
+                if (!item.compressed) {
+                    archiveSum += Checksum(item.bytes.data(), item.bytes.size());
+                    continue;
+                }
+                decoded.resize(static_cast<size_t>(item.rawSize));
+                if (AssetArchive::Read(item, decoded)) {
+                    archiveSum += Checksum(decoded.data(), decoded.size());
+                }
+            }
+        }
+        auto archiveEnd = Clock::now();
+
+        result.looseMs = std::chrono::duration<double, std::milli>(looseEnd - looseStart).count() / iterations;
+        result.archiveMs = std::chrono::duration<double, std::milli>(archiveEnd - archiveStart).count() / iterations;
+
+        if (looseSum != archiveSum) {
+            Logger::Instance().Warning(" ϰ Ű  ٸϴ (üũ {} / {})", looseSum, archiveSum);
+        }
+
+        Logger::Instance().Info("=== Ű ε ġũ ({}ȸ ) ===", iterations);
+        Logger::Instance().Info("׸ {},  {} bytes,  {} bytes", result.fileCount, result.totalBytes, result.storedBytes);
+        Logger::Instance().Info(" : {:.3f} ms", result.looseMs);
+        Logger::Instance().Info("Ű:    {:.3f} ms", result.archiveMs);
+        return result;
+    }
+
+    std::vector<AssetPacker::CodecBenchmarkResult> AssetPacker::RunCodecBenchmark(const std::string& filePath,
+        uint32_t blockSize, int iterations)
+    {
+        std::vector<CodecBenchmarkResult> results;
+
+        std::vector<uint8_t> data;
+        if (!ReadFile(filePath, data) || data.empty()) {
+            Logger::Instance().Error("ġũ    ϴ: {}", filePath);
+            return results;
+        }
+        iterations = std::max(iterations, 1);
+
+        using Clock = std::chrono::steady_clock;
+        auto elapsedMs = [](Clock::time_point start) {
+            return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+            };
+
+        Logger::Instance().Info("=== ڵ ġũ: {} ({} bytes,  {} bytes, {}ȸ ) ===",
+            filePath, data.size(), blockSize, iterations);
+        Logger::Instance().Info(" |  |  MB/s |  MB/s () |  MB/s ()");
+
+        //  0     -    ó
+        std::vector<uint8_t> decoded(data.size());
+        for (int level = 0; level <= BlockCodec::MaxLevel; ++level) {
+            CodecBenchmarkResult result;
+            result.level = level;
+
+            std::vector<uint8_t> stream;
+            auto start = Clock::now();
+            for (int i = 0; i < iterations; ++i) {
+                stream = BlockCodec::Compress(data, level, blockSize);
+            }
+            result.compressMBps = ToMBps(data.size() * iterations, elapsedMs(start));
+            result.ratio = static_cast<double>(data.size()) / stream.size();
+
+            bool valid = true;
+            start = Clock::now();
+            for (int i = 0; i < iterations; ++i) {
+                valid &= BlockCodec::Decompress(stream, decoded, false);
+            }
+            result.decompressMBps = ToMBps(data.size() * iterations, elapsedMs(start));
+
+            start = Clock::now();
+            for (int i = 0; i < iterations; ++i) {
+                valid &= BlockCodec::Decompress(stream, decoded, true);
+            }
+            result.parallelDecompressMBps = ToMBps(data.size() * iterations, elapsedMs(start));
+
+            if (!valid || decoded != data) {
+                Logger::Instance().Error(" {}     ٸϴ", level);
+            }
+
+            Logger::Instance().Info("{:4} | {:6.2f} | {:9.1f} | {:16.1f} | {:16.1f}",
+                level, result.ratio, result.compressMBps, result.decompressMBps, result.parallelDecompressMBps);
+            results.push_back(result);
+        }
+
+        return results;
+    }
+}
\ No newline at end of file
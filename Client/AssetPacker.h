@@ -0,0 +1,45 @@
+#pragma once
+#include "pch.h"
+#include "AssetArchive.h"
+#include "BlockCodec.h"
+
+namespace Resource
+{
+    //  Ű   ε ġũ 
+    class AssetPacker {
+    public:
+        // rootDir   η files ŷ
+        // compressionLevel 0̸   (̵  ϵ  ״ )
+        static bool Pack(const std::string& rootDir, const std::vector<std::string>& files,
+            const std::string& outputPath, int compressionLevel = 0,
+            uint32_t alignment = ArchiveFormat::DefaultAlignment);
+
+        // rootDir Ʒ   ŷ (  ڽ )
+        static bool PackDirectory(const std::string& rootDir, const std::string& outputPath,
+            int compressionLevel = 0, uint32_t alignment = ArchiveFormat::DefaultAlignment);
+
+        struct BenchmarkResult {
+            size_t fileCount = 0;
+            size_t totalBytes = 0;      //  ũ 
+            size_t storedBytes = 0;     // Ű  ũ 
+            double looseMs = 0.0;       // ݺ 1ȸ  ( )
+            double archiveMs = 0.0;     // ݺ 1ȸ  (Ű)
+        };
+
+        // Ű  ׸  (rootDir Ʒ) Ű  о 
+        static BenchmarkResult RunLoadBenchmark(const std::string& archivePath,
+            const std::string& rootDir, int iterations = 10);
+
+        struct CodecBenchmarkResult {
+            int level = 0;
+            double ratio = 0.0;
+            double compressMBps = 0.0;
+            double decompressMBps = 0.0;            //  
+            double parallelDecompressMBps = 0.0;    //  
+        };
+
+        //  ϳ  0( )~ִ  /ϸ ó 
+        static std::vector<CodecBenchmarkResult> RunCodecBenchmark(const std::string& filePath,
+            uint32_t blockSize = BlockCodec::DefaultBlockSize, int iterations = 5);
+    };
+}
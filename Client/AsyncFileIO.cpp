@@ -0,0 +1,527 @@
+#include "pch.h"
+#include "AsyncFileIO.h"
+#include "Logger.h"
+
+namespace Resource
+{
+    namespace
+    {
+        // IoRing Windows 11 Ƿ Ÿӿ ã (  Ǯ 鿣 )
+        struct IoRingApi {
+            decltype(&::QueryIoRingCapabilities) QueryIoRingCapabilities = nullptr;
+            decltype(&::CreateIoRing) CreateIoRing = nullptr;
+            decltype(&::CloseIoRing) CloseIoRing = nullptr;
+            decltype(&::BuildIoRingReadFile) BuildIoRingReadFile = nullptr;
+            decltype(&::BuildIoRingRegisterBuffers) BuildIoRingRegisterBuffers = nullptr;
+            decltype(&::SubmitIoRing) SubmitIoRing = nullptr;
+            decltype(&::PopIoRingCompletion) PopIoRingCompletion = nullptr;
+            decltype(&::SetIoRingCompletionEvent) SetIoRingCompletionEvent = nullptr;
+            bool loaded = false;
+        };
+
+        const IoRingApi& GetIoRingApi() {
+            static const IoRingApi api = []() {
+                IoRingApi result;
+                HMODULE module = GetModuleHandleW(L"kernelbase.dll");
+                if (!module) return result;
+
+                auto load = [module](auto& function, const char* name) {
+                    function = reinterpret_cast<std::remove_reference_t<decltype(function)>>(GetProcAddress(module, name));
+                    return function != nullptr;
+                };
+                result.loaded =
+                    load(result.QueryIoRingCapabilities, "QueryIoRingCapabilities") &&
+                    load(result.CreateIoRing, "CreateIoRing") &&
+                    load(result.CloseIoRing, "CloseIoRing") &&
+                    load(result.BuildIoRingReadFile, "BuildIoRingReadFile") &&
+                    load(result.BuildIoRingRegisterBuffers, "BuildIoRingRegisterBuffers") &&
+                    load(result.SubmitIoRing, "SubmitIoRing") &&
+                    load(result.PopIoRingCompletion, "PopIoRingCompletion") &&
+                    load(result.SetIoRingCompletionEvent, "SetIoRingCompletionEvent");
+                return result;
+            }();
+            return api;
+        }
+
+        //   ϷḦ б Ϸ ϴ  
+        constexpr UINT_PTR RegisterBuffersTag = std::numeric_limits<UINT_PTR>::max();
+    }
+
+    AsyncFileIO::AsyncFileIO(std::optional<Backend> backend, uint32_t queueDepth, size_t stagingSize)
+        : m_queueDepth(std::max<uint32_t>(queueDepth, 1))
+    {
+        // ¡  -   ߰, ϸ Streaming   ϳ 
+        m_stagingSize = stagingSize / StagingSlotSize * StagingSlotSize;
+        if (m_stagingSize > 0) {
+            auto* allocator = Memory::MemoryManager::Instance().GetAllocator(Memory::MemoryManager::Domain::Streaming);
+            if (allocator && m_stagingSize <= allocator->GetTotalMemory() - allocator->GetUsedMemory()) {
+                m_staging = static_cast<uint8_t*>(allocator->Allocate(m_stagingSize, 4096).ptr);
+                m_stagingAllocator = m_staging ? allocator : nullptr;
+            }
+            if (!m_staging) {
+                m_staging = static_cast<uint8_t*>(_aligned_malloc(m_stagingSize, 4096));
+            }
+            m_stagingUsed.assign(m_stagingSize / StagingSlotSize, 0);
+        }
+
+        m_backend = backend.value_or(IsIoRingSupported() ? Backend::IoRing : Backend::ThreadPool);
+        if (m_backend == Backend::IoRing && !InitializeIoRing()) {
+            Logger::Instance().Warning("IoRing ʱȭ ,  Ǯ 鿣 ü");
+            m_backend = Backend::ThreadPool;
+        }
+
+        if (m_backend == Backend::IoRing) {
+            m_threads.emplace_back(&AsyncFileIO::IoRingLoop, this);
+        }
+        else {
+            //  б Ŀ   ÿ Ǵ б 
+            const size_t workerCount = std::min<size_t>(std::max(2u, std::thread::hardware_concurrency()), m_queueDepth);
+            for (size_t i = 0; i < workerCount; ++i) {
+                m_threads.emplace_back(&AsyncFileIO::ThreadPoolLoop, this);
+            }
+        }
+
+        Logger::Instance().Info("񵿱  IO ʱȭ Ϸ ({},  {}, ¡ {}MB)",
+            m_backend == Backend::IoRing ? "IoRing" : " Ǯ",
+            m_backend == Backend::IoRing ? m_queueDepth : static_cast<uint32_t>(m_threads.size()),
+            m_stagingSize / (1024 * 1024));
+    }
+
+    AsyncFileIO::~AsyncFileIO()
+    {
+        Shutdown();
+
+        if (m_staging) {
+            // ޸ Ŵ    ̹ 
+            if (!m_stagingAllocator) {
+                _aligned_free(m_staging);
+            }
+            else if (Memory::MemoryManager::Instance().GetAllocator(Memory::MemoryManager::Domain::Streaming) == m_stagingAllocator) {
+                m_stagingAllocator->Deallocate(m_staging);
+            }
+            m_staging = nullptr;
+        }
+    }
+
+    bool AsyncFileIO::IsIoRingSupported()
+    {
+        const auto& api = GetIoRingApi();
+        if (!api.loaded) return false;
+
+        IORING_CAPABILITIES capabilities = {};
+        return SUCCEEDED(api.QueryIoRingCapabilities(&capabilities)) &&
+            capabilities.MaxVersion >= IORING_VERSION_1;
+    }
+
+    bool AsyncFileIO::InitializeIoRing()
+    {
+        const auto& api = GetIoRingApi();
+        if (!api.loaded) return false;
+
+        IORING_CAPABILITIES capabilities = {};
+        if (FAILED(api.QueryIoRingCapabilities(&capabilities))) return false;
+
+        m_queueDepth = std::min(m_queueDepth, capabilities.MaxSubmissionQueueSize);
+        const uint32_t completionQueueSize = std::min(m_queueDepth * 2, capabilities.MaxCompletionQueueSize);
+
+        IORING_CREATE_FLAGS flags = { IORING_CREATE_REQUIRED_FLAGS_NONE, IORING_CREATE_ADVISORY_FLAGS_NONE };
+        if (FAILED(api.CreateIoRing(capabilities.MaxVersion, flags, m_queueDepth, completionQueueSize, &m_ring))) {
+            m_ring = nullptr;
+            return false;
+        }
+
+        m_completionEvent = CreateEventW(nullptr, FALSE, FALSE, nullptr);
+        m_wakeEvent = CreateEventW(nullptr, FALSE, FALSE, nullptr);
+        api.SetIoRingCompletionEvent(m_ring, m_completionEvent);
+
+        // ¡ ۸   0 - б⸶ Ŀ  / 
+        bool registered = !m_staging;
+        if (m_staging) {
+            IORING_BUFFER_INFO buffer = { m_staging, static_cast<UINT32>(m_stagingSize) };
+            UINT32 submitted = 0;
+            IORING_CQE completion = {};
+            registered =
+                SUCCEEDED(api.BuildIoRingRegisterBuffers(m_ring, 1, &buffer, RegisterBuffersTag)) &&
+                SUCCEEDED(api.SubmitIoRing(m_ring, 1, INFINITE, &submitted)) &&
+                api.PopIoRingCompletion(m_ring, &completion) == S_OK &&
+                SUCCEEDED(completion.ResultCode);
+        }
+
+        if (!registered) {
+            api.CloseIoRing(m_ring);
+            m_ring = nullptr;
+            CloseHandle(m_completionEvent);
+            CloseHandle(m_wakeEvent);
+            m_completionEvent = m_wakeEvent = nullptr;
+            return false;
+        }
+        return true;
+    }
+
+    AsyncFileIO::RequestId AsyncFileIO::Submit(std::vector<ReadRequest> requests)
+    {
+        if (requests.empty()) return InvalidRequest;
+
+        RequestId first = InvalidRequest;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (m_stopping) {
+                Logger::Instance().Warning("   IO û  ({})", requests.size());
+                return InvalidRequest;
+            }
+
+            first = m_nextId;
+            for (auto& request : requests) {
+                m_queue.push_back({ m_nextId++, std::move(request) });
+            }
+            m_pendingCount.fetch_add(requests.size());
+        }
+
+        if (m_backend == Backend::IoRing) {
+            SetEvent(m_wakeEvent);
+        }
+        else if (requests.size() == 1) {
+            m_condition.notify_one();
+        }
+        else {
+            m_condition.notify_all();
+        }
+        return first;
+    }
+
+    AsyncFileIO::RequestId AsyncFileIO::Submit(ReadRequest request)
+    {
+        std::vector<ReadRequest> requests;
+        requests.push_back(std::move(request));
+        return Submit(std::move(requests));
+    }
+
+    AsyncFileIO::ReadStatus AsyncFileIO::Read(const std::string& path, uint64_t offset, uint32_t size, void* destination)
+    {
+        // ݹ    Լ ȯ  Ƿ promise ݹ 
+        auto done = std::make_shared<std::promise<ReadStatus>>();
+        auto future = done->get_future();
+
+        const RequestId id = Submit(ReadRequest{ path, offset, size, destination,
+            [done](const ReadResult& result) {
+                done->set_value({ result.success, static_cast<uint32_t>(result.data.size()), result.fileSize });
+            } });
+        if (id == InvalidRequest) {
+            return {};
+        }
+        return future.get();
+    }
+
+    void AsyncFileIO::Shutdown()
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_stopping = true;
+        }
+        m_condition.notify_all();
+        if (m_wakeEvent) {
+            SetEvent(m_wakeEvent);
+        }
+
+        for (auto& thread : m_threads) {
+            if (thread.joinable()) {
+                thread.join();
+            }
+        }
+        m_threads.clear();
+
+        if (m_ring) {
+            GetIoRingApi().CloseIoRing(m_ring);
+            m_ring = nullptr;
+        }
+        for (HANDLE* handle : { &m_completionEvent, &m_wakeEvent }) {
+            if (*handle) {
+                CloseHandle(*handle);
+                *handle = nullptr;
+            }
+        }
+    }
+
+    size_t AsyncFileIO::GetPendingCount() const
+    {
+        return m_pendingCount.load();
+    }
+
+    bool AsyncFileIO::Prepare(ActiveRead& read, bool overlapped)
+    {
+        const auto& request = read.pending.request;
+
+        const std::wstring widePath = std::filesystem::path(request.path).wstring();
+        read.file = CreateFileW(widePath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+            FILE_FLAG_SEQUENTIAL_SCAN | (overlapped ? FILE_FLAG_OVERLAPPED : 0), nullptr);
+        if (read.file == INVALID_HANDLE_VALUE) {
+            Logger::Instance().Error("  : {} ({})", request.path, GetLastError());
+            return false;
+        }
+
+        LARGE_INTEGER fileSize = {};
+        if (!GetFileSizeEx(read.file, &fileSize)) {
+            Logger::Instance().Error(" ũ ȸ : {} ({})", request.path, GetLastError());
+            return false;
+        }
+        read.fileSize = static_cast<uint64_t>(fileSize.QuadPart);
+
+        //   Ѵ κ   (IoRing  Ѵ   )
+        const uint64_t available = request.offset < read.fileSize ? read.fileSize - request.offset : 0;
+        if (request.size == 0) {
+            if (request.destination || available > m_stagingSize) {
+                Logger::Instance().Error(" ü б ¡ ۿ  : {} ({}bytes)", request.path, available);
+                return false;
+            }
+            read.size = static_cast<uint32_t>(available);
+        }
+        else {
+            read.size = static_cast<uint32_t>(std::min<uint64_t>(request.size, available));
+        }
+
+        if (request.destination) {
+            read.buffer = static_cast<uint8_t*>(request.destination);
+        }
+        else if (read.size > m_stagingSize) {
+            Logger::Instance().Error("¡ ۺ ū б destination ʿ: {} ({}bytes)", request.path, read.size);
+            return false;
+        }
+        return true;
+    }
+
+    bool AsyncFileIO::AllocateStaging(ActiveRead& read, bool wait)
+    {
+        const size_t slotCount = std::max<size_t>(1, (read.size + StagingSlotSize - 1) / StagingSlotSize);
+
+        auto tryAllocate = [&]() {
+            size_t run = 0;
+            for (size_t i = 0; i < m_stagingUsed.size(); ++i) {
+                run = m_stagingUsed[i] ? 0 : run + 1;
+                if (run == slotCount) {
+                    const size_t first = i + 1 - slotCount;
+                    std::fill_n(m_stagingUsed.begin() + first, slotCount, uint8_t(1));
+                    read.stagingSlot = first;
+                    read.stagingSlotCount = slotCount;
+                    read.buffer = m_staging + first * StagingSlotSize;
+                    return true;
+                }
+            }
+            return false;
+        };
+
+        std::unique_lock<std::mutex> lock(m_stagingMutex);
+        if (!wait) {
+            return tryAllocate();
+        }
+        // ٸ Ŀ  ִ  Ǯ   (Ŀ     )
+        m_stagingFreed.wait(lock, tryAllocate);
+        return true;
+    }
+
+    void AsyncFileIO::ReleaseStaging(ActiveRead& read)
+    {
+        if (read.stagingSlotCount == 0) return;
+        {
+            std::lock_guard<std::mutex> lock(m_stagingMutex);
+            std::fill_n(m_stagingUsed.begin() + read.stagingSlot, read.stagingSlotCount, uint8_t(0));
+        }
+        read.stagingSlotCount = 0;
+        m_stagingFreed.notify_all();
+    }
+
+    void AsyncFileIO::Finish(ActiveRead& read, bool success, uint32_t bytesRead)
+    {
+        if (read.file != INVALID_HANDLE_VALUE) {
+            CloseHandle(read.file);
+            read.file = INVALID_HANDLE_VALUE;
+        }
+
+        ReadResult result;
+        result.id = read.pending.id;
+        result.path = read.pending.request.path;
+        result.success = success;
+        result.data = { read.buffer, success && read.buffer ? bytesRead : 0u };
+        result.fileSize = read.fileSize;
+
+        if (read.pending.request.callback) {
+            try {
+                read.pending.request.callback(result);
+            }
+            catch (const std::exception& e) {
+                Logger::Instance().Error(" б ݹ鿡  ߻: {} - {}", read.pending.request.path, e.what());
+            }
+        }
+
+        // ݹ  ڿ ¡  
+        ReleaseStaging(read);
+        m_pendingCount.fetch_sub(1);
+    }
+
+    void AsyncFileIO::Fail(PendingRead& pending)
+    {
+        ActiveRead read;
+        read.pending = std::move(pending);
+        Finish(read, false, 0);
+    }
+
+    void AsyncFileIO::IoRingLoop()
+    {
+        const auto& api = GetIoRingApi();
+
+        //  ť Ը   б ϳ (  =  ȣ)
+        std::vector<ActiveRead> slots(m_queueDepth);
+        std::vector<uint32_t> freeSlots(m_queueDepth);
+        std::iota(freeSlots.rbegin(), freeSlots.rend(), 0u);
+        uint32_t inflight = 0;
+
+        std::deque<PendingRead> backlog;
+        std::optional<ActiveRead> stalled;  // ¡  ٸ û (û  )
+
+        while (true) {
+            //  б ó - ԰ ¡   ޾ƾ  û ø  
+            IORING_CQE completion = {};
+            while (api.PopIoRingCompletion(m_ring, &completion) == S_OK) {
+                if (completion.UserData == RegisterBuffersTag) continue;
+
+                const auto index = static_cast<uint32_t>(completion.UserData);
+                const bool success = SUCCEEDED(completion.ResultCode);
+                if (!success) {
+                    Logger::Instance().Error(" б : {} ({:08x})",
+                        slots[index].pending.request.path, static_cast<uint32_t>(completion.ResultCode));
+                }
+                Finish(slots[index], success, static_cast<uint32_t>(completion.Information));
+                slots[index] = {};
+                freeSlots.push_back(index);
+                --inflight;
+            }
+
+            bool stopping = false;
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                stopping = m_stopping;
+                std::move(m_queue.begin(), m_queue.end(), std::back_inserter(backlog));
+                m_queue.clear();
+            }
+
+            if (stopping) {
+                if (stalled) {
+                    Finish(*stalled, false, 0);
+                    stalled.reset();
+                }
+                for (auto& pending : backlog) {
+                    Fail(pending);
+                }
+                backlog.clear();
+                if (inflight == 0) break;
+            }
+
+            //  Ըŭ б⸦     
+            uint32_t built = 0;
+            while (!freeSlots.empty() && (stalled || !backlog.empty())) {
+                ActiveRead read;
+                if (stalled) {
+                    read = std::move(*stalled);
+                    stalled.reset();
+                }
+                else {
+                    read.pending = std::move(backlog.front());
+                    backlog.pop_front();
+                    if (!Prepare(read, true)) {
+                        Finish(read, false, 0);
+                        continue;
+                    }
+                    if (read.size == 0) {
+                        Finish(read, true, 0);
+                        continue;
+                    }
+                }
+
+                if (!read.buffer && !AllocateStaging(read, false)) {
+                    stalled = std::move(read);
+                    break;
+                }
+
+                const uint32_t index = freeSlots.back();
+                freeSlots.pop_back();
+                ActiveRead& active = slots[index];
+                active = std::move(read);
+
+                const IORING_BUFFER_REF buffer = active.stagingSlotCount > 0
+                    ? IoRingBufferRefFromIndexAndOffset(0, static_cast<UINT32>(active.buffer - m_staging))
+                    : IoRingBufferRefFromPointer(active.buffer);
+                const HRESULT hr = api.BuildIoRingReadFile(m_ring, IoRingHandleRefFromHandle(active.file), buffer,
+                    active.size, active.pending.request.offset, index, IOSQE_FLAGS_NONE);
+                if (FAILED(hr)) {
+                    Logger::Instance().Error("IoRing б ۼ : {} ({:08x})", active.pending.request.path, static_cast<uint32_t>(hr));
+                    Finish(active, false, 0);
+                    active = {};
+                    freeSlots.push_back(index);
+                    continue;
+                }
+                ++inflight;
+                ++built;
+            }
+
+            if (built > 0) {
+                UINT32 submitted = 0;
+                const HRESULT hr = api.SubmitIoRing(m_ring, 0, 0, &submitted);
+                if (FAILED(hr)) {
+                    Logger::Instance().Error("IoRing   ({:08x})", static_cast<uint32_t>(hr));
+                }
+            }
+
+            //   бⰡ  Ϸᳪ  û,   û ٸ
+            if (inflight > 0) {
+                HANDLE handles[] = { m_completionEvent, m_wakeEvent };
+                WaitForMultipleObjects(_countof(handles), handles, FALSE, INFINITE);
+            }
+            else if (!stalled && backlog.empty()) {
+                WaitForSingleObject(m_wakeEvent, INFINITE);
+            }
+        }
+    }
+
+    void AsyncFileIO::ThreadPoolLoop()
+    {
+        while (true) {
+            PendingRead pending;
+            bool stopping = false;
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_condition.wait(lock, [this]() { return m_stopping || !m_queue.empty(); });
+                if (m_queue.empty()) return;
+
+                pending = std::move(m_queue.front());
+                m_queue.pop_front();
+                stopping = m_stopping;
+            }
+
+            if (stopping) {
+                Fail(pending);
+                continue;
+            }
+
+            ActiveRead read;
+            read.pending = std::move(pending);
+            if (!Prepare(read, false)) {
+                Finish(read, false, 0);
+                continue;
+            }
+            if (read.size > 0 && !read.buffer) {
+                AllocateStaging(read, true);
+            }
+
+            OVERLAPPED overlapped = {};
+            overlapped.Offset = static_cast<DWORD>(read.pending.request.offset);
+            overlapped.OffsetHigh = static_cast<DWORD>(read.pending.request.offset >> 32);
+
+            DWORD bytesRead = 0;
+            const bool success = read.size == 0 ||
+                ReadFile(read.file, read.buffer, read.size, &bytesRead, &overlapped) != FALSE;
+            if (!success) {
+                Logger::Instance().Error(" б : {} ({})", read.pending.request.path, GetLastError());
+            }
+            Finish(read, success, bytesRead);
+        }
+    }
+}
@@ -0,0 +1,128 @@
+#pragma once
+#include "pch.h"
+#include "MemoryManager.h"
+
+namespace Resource
+{
+    // 񵿱  б
+    // - û     ϰ,   ݹ ȣ (IO 忡 ȣǹǷ ª óϰ ѱ )
+    // - IoRing 鿣 (Windows 11+): IO  ϳ  û     ť ̸ŭ ÿ 
+    // -  Ǯ 鿣: IoRing  Ŀ  ReadFile (Ŀ ŭ ÿ )
+    // - destination  û Memory::Streaming ο  ¡ ۿ 
+    //   (IoRing  ۷ ÷ û   ). ʹ ݹ  
+    class AsyncFileIO {
+    public:
+        using RequestId = uint64_t;
+        static constexpr RequestId InvalidRequest = 0;
+
+        enum class Backend {
+            IoRing,
+            ThreadPool
+        };
+
+        struct ReadResult {
+            RequestId id = InvalidRequest;
+            std::string_view path;
+            bool success = false;
+            std::span<const uint8_t> data;  //   Ʈ ( ̸ û ª)
+            uint64_t fileSize = 0;
+        };
+        using Callback = std::function<void(const ReadResult&)>;
+
+        struct ReadRequest {
+            std::string path;
+            uint64_t offset = 0;
+            uint32_t size = 0;              // 0̸ offset   (¡  )
+            void* destination = nullptr;    //  ¡ ۿ 
+            Callback callback;
+        };
+
+        // backend  IoRing     IoRing, ƴϸ  Ǯ
+        // ¡ ۺ ū б destination ؾ 
+        explicit AsyncFileIO(std::optional<Backend> backend = std::nullopt, uint32_t queueDepth = 64,
+            size_t stagingSize = 16 * 1024 * 1024);
+        ~AsyncFileIO();
+
+        AsyncFileIO(const AsyncFileIO&) = delete;
+        AsyncFileIO& operator=(const AsyncFileIO&) = delete;
+
+        // û   . ù û ID ȯ ( û  ȣ)
+        RequestId Submit(std::vector<ReadRequest> requests);
+        RequestId Submit(ReadRequest request);
+
+        // ϰ    (ݹ ȿ ȣϸ  )
+        struct ReadStatus {
+            bool success = false;
+            uint32_t bytesRead = 0;
+            uint64_t fileSize = 0;
+        };
+        ReadStatus Read(const std::string& path, uint64_t offset, uint32_t size, void* destination);
+
+        //   б  ٸ,  ۵  û з ݹ
+        void Shutdown();
+
+        Backend GetBackend() const { return m_backend; }
+        uint32_t GetQueueDepth() const { return m_queueDepth; }
+        size_t GetStagingSize() const { return m_stagingSize; }
+        size_t GetPendingCount() const;     //   ݹ   û 
+
+        static bool IsIoRingSupported();
+
+    private:
+        struct PendingRead {
+            RequestId id = InvalidRequest;
+            ReadRequest request;
+        };
+
+        //   б (IoRing  Ǵ Ŀ ϳ)
+        struct ActiveRead {
+            PendingRead pending;
+            HANDLE file = INVALID_HANDLE_VALUE;
+            uint64_t fileSize = 0;
+            uint32_t size = 0;
+            uint8_t* buffer = nullptr;
+            size_t stagingSlot = 0;         // ¡ ۸  ù ԰  
+            size_t stagingSlotCount = 0;
+        };
+
+        // ¡ ۸  ũ     first-fit Ҵ
+        static constexpr size_t StagingSlotSize = 64 * 1024;
+        bool AllocateStaging(ActiveRead& read, bool wait);
+        void ReleaseStaging(ActiveRead& read);
+
+        //     ũ  (  ڸ)
+        bool Prepare(ActiveRead& read, bool overlapped);
+        void Finish(ActiveRead& read, bool success, uint32_t bytesRead);
+        void Fail(PendingRead& pending);
+
+        bool InitializeIoRing();
+        void IoRingLoop();
+        void ThreadPoolLoop();
+
+        Backend m_backend = Backend::ThreadPool;
+        uint32_t m_queueDepth = 0;
+
+        // ¡  (  δ m_stagingMutex ȣ)
+        uint8_t* m_staging = nullptr;
+        size_t m_stagingSize = 0;
+        Memory::IAllocator* m_stagingAllocator = nullptr;   //   Ҵ (޸ Ŵ ʱȭ ,   )
+        std::vector<uint8_t> m_stagingUsed;
+        std::mutex m_stagingMutex;
+        std::condition_variable m_stagingFreed;
+
+        //  ⿭
+        mutable std::mutex m_mutex;
+        std::condition_variable m_condition;
+        std::deque<PendingRead> m_queue;
+        RequestId m_nextId = 1;
+        bool m_stopping = false;
+        std::atomic<size_t> m_pendingCount{ 0 };
+
+        // IoRing 鿣
+        HIORING m_ring = nullptr;
+        HANDLE m_completionEvent = nullptr;
+        HANDLE m_wakeEvent = nullptr;
+
+        std::vector<std::thread> m_threads;
+    };
+}
@@ -0,0 +1,766 @@
+#include "pch.h"
+#include "AudioMixer.h"
+#include "Logger.h"
+
+namespace Audio
+{
+    namespace
+    {
+        using Clock = std::chrono::steady_clock;
+
+        constexpr uint32_t FixedOne = 1u << 16;     // 16.16 Ҽ 1.0
+
+        // ̽ ϳ ͽϴ  ʿ 
+        // source ӵ   (position ΰ Ű Ӱ    ׻ )
+        struct MixParams {
+            const float* source = nullptr;
+            uint32_t channels = 0;
+            uint32_t position = 0;      // 16.16, source 
+            uint32_t step = 0;          // 16.16
+            uint32_t frames = 0;
+            float gain[2] = {};         // k°   gain + k * gainStep
+            float gainStep[2] = {};
+        };
+
+        // Į  - SSE   Ӱ    (  ϹǷ  )
+        void MixScalar(const MixParams& p, float* output, uint32_t first = 0)
+        {
+            for (uint32_t k = first; k < p.frames; ++k) {
+                const uint32_t position = p.position + k * p.step;
+                const uint32_t index = position >> 16;
+                const float frac = float(position & 0xFFFF) * (1.0f / 65536.0f);
+                const float kf = float(k);
+                const float gainLeft = p.gain[0] + kf * p.gainStep[0];
+                const float gainRight = p.gain[1] + kf * p.gainStep[1];
+
+                float left, right;
+                if (p.channels == 1) {
+                    const float a = p.source[index];
+                    const float b = p.source[index + 1];
+                    left = right = a + (b - a) * frac;
+                }
+                else {
+                    const float* frame = p.source + index * 2;
+                    left = frame[0] + (frame[2] - frame[0]) * frac;
+                    right = frame[1] + (frame[3] - frame[1]) * frac;
+                }
+                output[k * 2] += left * gainLeft;
+                output[k * 2 + 1] += right * gainRight;
+            }
+        }
+
+        // SSE  -  4Ӿ
+        //  ӵ Ȯ 1̸  ״ а, ƴϸ Ӹ    
+        void MixSse(const MixParams& p, float* output)
+        {
+            const __m128 gainLeft0 = _mm_set1_ps(p.gain[0]);
+            const __m128 gainRight0 = _mm_set1_ps(p.gain[1]);
+            const __m128 gainStepLeft = _mm_set1_ps(p.gainStep[0]);
+            const __m128 gainStepRight = _mm_set1_ps(p.gainStep[1]);
+            const __m128 four = _mm_set1_ps(4.0f);
+            const __m128 fracScale = _mm_set1_ps(1.0f / 65536.0f);
+            const __m128i fracMask = _mm_set1_epi32(0xFFFF);
+            const __m128i step4 = _mm_set1_epi32(static_cast<int>(p.step * 4));
+
+            const bool unitStep = p.step == FixedOne && (p.position & 0xFFFF) == 0;
+            const uint32_t base = p.position >> 16;
+
+            __m128 kf = _mm_setr_ps(0.0f, 1.0f, 2.0f, 3.0f);
+            __m128i position = _mm_setr_epi32(static_cast<int>(p.position), static_cast<int>(p.position + p.step),
+                static_cast<int>(p.position + p.step * 2), static_cast<int>(p.position + p.step * 3));
+            alignas(16) uint32_t index[4];
+
+            uint32_t k = 0;
+            for (; k + 4 <= p.frames; k += 4) {
+                const __m128 gainLeft = _mm_add_ps(gainLeft0, _mm_mul_ps(kf, gainStepLeft));
+                const __m128 gainRight = _mm_add_ps(gainRight0, _mm_mul_ps(kf, gainStepRight));
+                float* out = output + k * 2;
+
+                if (unitStep && p.channels == 2) {
+                    // [L0 R0 L1 R1], [L2 R2 L3 R3]  ġ  
+                    const float* source = p.source + (base + k) * 2;
+                    const __m128 gain01 = _mm_unpacklo_ps(gainLeft, gainRight);
+                    const __m128 gain23 = _mm_unpackhi_ps(gainLeft, gainRight);
+                    _mm_storeu_ps(out, _mm_add_ps(_mm_loadu_ps(out), _mm_mul_ps(_mm_loadu_ps(source), gain01)));
+                    _mm_storeu_ps(out + 4, _mm_add_ps(_mm_loadu_ps(out + 4), _mm_mul_ps(_mm_loadu_ps(source + 4), gain23)));
+                }
+                else {
+                    __m128 left, right;
+                    if (unitStep) {
+                        left = right = _mm_loadu_ps(p.source + base + k);
+                    }
+                    else {
+                        _mm_store_si128(reinterpret_cast<__m128i*>(index), _mm_srli_epi32(position, 16));
+                        const __m128 frac = _mm_mul_ps(_mm_cvtepi32_ps(_mm_and_si128(position, fracMask)), fracScale);
+
+                        if (p.channels == 1) {
+                            const float* s = p.source;
+                            const __m128 a = _mm_setr_ps(s[index[0]], s[index[1]], s[index[2]], s[index[3]]);
+                            const __m128 b = _mm_setr_ps(s[index[0] + 1], s[index[1] + 1], s[index[2] + 1], s[index[3] + 1]);
+                            left = right = _mm_add_ps(a, _mm_mul_ps(_mm_sub_ps(b, a), frac));
+                        }
+                        else {
+                            // Ӹ [L0 R0 L1 R1] о ġϸ κ L0, R0, L1, R1
+                            __m128 row0 = _mm_loadu_ps(p.source + index[0] * 2);
+                            __m128 row1 = _mm_loadu_ps(p.source + index[1] * 2);
+                            __m128 row2 = _mm_loadu_ps(p.source + index[2] * 2);
+                            __m128 row3 = _mm_loadu_ps(p.source + index[3] * 2);
+                            _MM_TRANSPOSE4_PS(row0, row1, row2, row3);
+                            left = _mm_add_ps(row0, _mm_mul_ps(_mm_sub_ps(row2, row0), frac));
+                            right = _mm_add_ps(row1, _mm_mul_ps(_mm_sub_ps(row3, row1), frac));
+                        }
+                    }
+
+                    left = _mm_mul_ps(left, gainLeft);
+                    right = _mm_mul_ps(right, gainRight);
+                    _mm_storeu_ps(out, _mm_add_ps(_mm_loadu_ps(out), _mm_unpacklo_ps(left, right)));
+                    _mm_storeu_ps(out + 4, _mm_add_ps(_mm_loadu_ps(out + 4), _mm_unpackhi_ps(left, right)));
+                }
+
+                position = _mm_add_epi32(position, step4);
+                kf = _mm_add_ps(kf, four);
+            }
+
+            MixScalar(p, output, k);
+        }
+    }
+
+    AudioMixer& AudioMixer::Instance()
+    {
+        static AudioMixer instance;
+        return instance;
+    }
+
+    bool AudioMixer::Initialize(std::unique_ptr<IAudioSink> sink, uint32_t sampleRate)
+    {
+        if (m_initialized) {
+            Shutdown();
+        }
+
+        m_sampleRate = sampleRate;
+
+        //  ߿ Ҵ ʵ  ̸  
+        m_source.assign((size_t(BlockFrames) * MaxStep + 2) * 2, 0.0f);
+        m_output.assign(size_t(sampleRate / 5) * OutputChannels, 0.0f);     // 200ms
+        for (auto& stream : m_streams) {
+            stream.ring = std::make_unique<float[]>(size_t(StreamRingFrames) * 2);
+            stream.state.store(StreamState::Free, std::memory_order_relaxed);
+            stream.sound = nullptr;
+        }
+
+        for (uint32_t i = 0; i < MaxVoices; ++i) {
+            m_freeVoices[i] = static_cast<uint16_t>(MaxVoices - 1 - i);    // 0 Ժ 
+            m_generations[i] = 1;
+            m_owners[i].reset();
+            m_voices[i] = {};
+        }
+        m_freeVoiceCount = MaxVoices;
+        m_voiceStreams.fill(InvalidStream);
+        for (uint32_t i = 0; i < MaxStreams; ++i) {
+            m_freeStreams[i] = static_cast<uint16_t>(MaxStreams - 1 - i);
+        }
+        m_freeStreamCount = MaxStreams;
+        m_retiringCount = 0;
+        m_activeCount = 0;
+        m_masterVolume = 1.0f;
+        m_commands.Clear();
+        m_finished.Clear();
+
+        m_statActive = 0;
+        m_statStreaming = 0;
+        m_statMixedFrames = 0;
+        m_statDropped = 0;
+        m_statUnderruns = 0;
+        m_statMixMsPerSecond = 0.0;
+
+        m_running.store(true, std::memory_order_release);
+
+        if (sink) {
+            // ġ ͼ 忡  COM Ʈ 
+            m_sink = std::move(sink);
+            m_streamEvent = CreateEventW(nullptr, FALSE, FALSE, nullptr);
+
+            std::promise<bool> opened;
+            auto result = opened.get_future();
+            m_mixerThread = std::thread(&AudioMixer::MixerLoop, this, std::move(opened));
+            if (!result.get()) {
+                m_running.store(false, std::memory_order_release);
+                m_mixerThread.join();
+                Logger::Instance().Error("    ϴ: {}", m_sink->GetName());
+                m_sink.reset();
+                CloseHandle(m_streamEvent);
+                m_streamEvent = nullptr;
+                return false;
+            }
+            m_streamThread = std::thread(&AudioMixer::StreamLoop, this);
+        }
+
+        m_initialized = true;
+        Logger::Instance().Info(" ͼ ʱȭ Ϸ: {}Hz,  {}, ̽ {}, Ʈ {}",
+            m_sampleRate, GetSinkName(), MaxVoices, MaxStreams);
+        return true;
+    }
+
+    void AudioMixer::Shutdown()
+    {
+        if (!m_initialized) return;
+
+        m_running.store(false, std::memory_order_release);
+        if (m_streamEvent) {
+            SetEvent(m_streamEvent);
+        }
+        if (m_mixerThread.joinable()) {
+            m_mixerThread.join();
+        }
+        if (m_streamThread.joinable()) {
+            m_streamThread.join();
+        }
+        m_sink.reset();
+        if (m_streamEvent) {
+            CloseHandle(m_streamEvent);
+            m_streamEvent = nullptr;
+        }
+
+        // 尡  Ƿ ״ 
+        for (auto& owner : m_owners) {
+            owner.reset();
+        }
+        for (auto& stream : m_streams) {
+            stream.state.store(StreamState::Free, std::memory_order_relaxed);
+            stream.sound = nullptr;
+            stream.ring.reset();
+        }
+        m_activeCount = 0;
+        m_retiringCount = 0;
+        m_commands.Clear();
+        m_finished.Clear();
+        m_source.clear();
+        m_output.clear();
+
+        m_initialized = false;
+        Logger::Instance().Info(" ͼ ");
+    }
+
+    AudioMixer::VoiceHandle AudioMixer::Play(const std::shared_ptr<Resource::SoundResource>& sound, const PlayParams& params)
+    {
+        if (!m_initialized || !sound || !sound->IsReady() || sound->GetFrameCount() == 0) {
+            return InvalidVoice;
+        }
+        if (m_freeVoiceCount == 0 || (sound->IsStreaming() && m_freeStreamCount == 0)) {
+            m_statDropped.fetch_add(1, std::memory_order_relaxed);
+            return InvalidVoice;
+        }
+
+        const uint16_t slot = m_freeVoices[m_freeVoiceCount - 1];
+
+        Command command;
+        command.type = Command::Type::Play;
+        command.slot = slot;
+        command.generation = m_generations[slot];
+        command.params.volume = std::max(params.volume, 0.0f);
+        command.params.pan = std::clamp(params.pan, -1.0f, 1.0f);
+        command.params.pitch = std::clamp(params.pitch, MinPitch, MaxPitch);
+        command.params.loop = params.loop;
+        command.frameCount = sound->GetFrameCount();
+        command.channels = sound->GetChannels();
+        command.sampleRate = sound->GetSampleRate();
+
+        if (sound->IsStreaming()) {
+            // Ʈ Free ¶ Ʈ 尡  . ʱȭ  ť release ͼ 
+            command.stream = m_freeStreams[m_freeStreamCount - 1];
+            auto& stream = m_streams[command.stream];
+            stream.sound = sound.get();
+            stream.loop = params.loop;
+            stream.written.store(0, std::memory_order_relaxed);
+            stream.consumed.store(0, std::memory_order_relaxed);
+            stream.decodePosition = 0;
+            stream.finished = false;
+        }
+        else {
+            command.samples = sound->GetSamples().data();
+        }
+
+        if (!PushCommand(command)) {
+            m_statDropped.fetch_add(1, std::memory_order_relaxed);
+            return InvalidVoice;
+        }
+
+        --m_freeVoiceCount;
+        m_owners[slot] = sound;
+        m_voiceStreams[slot] = command.stream;
+        if (command.stream != InvalidStream) {
+            --m_freeStreamCount;
+            m_streams[command.stream].state.store(StreamState::Active, std::memory_order_release);
+            if (m_streamEvent) {
+                SetEvent(m_streamEvent);
+            }
+        }
+
+        return (VoiceHandle(command.generation) << 16) | slot;
+    }
+
+    void AudioMixer::Stop(VoiceHandle voice)
+    {
+        Command command;
+        if (!ResolveHandle(voice, command.slot)) return;
+
+        command.type = Command::Type::Stop;
+        command.generation = m_generations[command.slot];
+        PushCommand(command);
+    }
+
+    void AudioMixer::SetVolume(VoiceHandle voice, float volume)
+    {
+        Command command;
+        if (!ResolveHandle(voice, command.slot)) return;
+
+        command.type = Command::Type::SetVolume;
+        command.generation = m_generations[command.slot];
+        command.value = std::max(volume, 0.0f);
+        PushCommand(command);
+    }
+
+    void AudioMixer::SetPan(VoiceHandle voice, float pan)
+    {
+        Command command;
+        if (!ResolveHandle(voice, command.slot)) return;
+
+        command.type = Command::Type::SetPan;
+        command.generation = m_generations[command.slot];
+        command.value = std::clamp(pan, -1.0f, 1.0f);
+        PushCommand(command);
+    }
+
+    void AudioMixer::SetPitch(VoiceHandle voice, float pitch)
+    {
+        Command command;
+        if (!ResolveHandle(voice, command.slot)) return;
+
+        command.type = Command::Type::SetPitch;
+        command.generation = m_generations[command.slot];
+        command.value = std::clamp(pitch, MinPitch, MaxPitch);
+        PushCommand(command);
+    }
+
+    void AudioMixer::SetMasterVolume(float volume)
+    {
+        if (!m_initialized) return;
+
+        Command command;
+        command.type = Command::Type::SetMasterVolume;
+        command.value = std::max(volume, 0.0f);
+        PushCommand(command);
+    }
+
+    bool AudioMixer::IsPlaying(VoiceHandle voice) const
+    {
+        uint16_t slot;
+        return ResolveHandle(voice, slot);
+    }
+
+    bool AudioMixer::PushCommand(const Command& command)
+    {
+        return m_commands.Push(command);
+    }
+
+    bool AudioMixer::ResolveHandle(VoiceHandle voice, uint16_t& slot) const
+    {
+        slot = static_cast<uint16_t>(voice & 0xFFFF);
+        const auto generation = static_cast<uint16_t>(voice >> 16);
+        return m_initialized && slot < MaxVoices && m_owners[slot] && m_generations[slot] == generation;
+    }
+
+    void AudioMixer::ReleaseVoice(uint16_t slot)
+    {
+        m_owners[slot].reset();
+        m_voiceStreams[slot] = InvalidStream;
+        if (++m_generations[slot] == 0) {
+            m_generations[slot] = 1;    // ڵ 0(InvalidVoice)  ʰ
+        }
+        m_freeVoices[m_freeVoiceCount++] = slot;
+    }
+
+    void AudioMixer::Update()
+    {
+        if (!m_initialized) return;
+
+        // Ʈ ̽ Ʈ 尡 Ʈ  ڿ ȸ
+        bool retired = false;
+        uint16_t slot;
+        while (m_finished.Pop(slot)) {
+            const uint16_t stream = m_voiceStreams[slot];
+            if (stream == InvalidStream) {
+                ReleaseVoice(slot);
+                continue;
+            }
+            m_streams[stream].state.store(StreamState::Retiring, std::memory_order_release);
+            m_retiring[m_retiringCount++] = slot;
+            retired = true;
+        }
+
+        for (uint32_t i = 0; i < m_retiringCount;) {
+            const uint16_t retiring = m_retiring[i];
+            const uint16_t stream = m_voiceStreams[retiring];
+            if (m_streams[stream].state.load(std::memory_order_acquire) != StreamState::Free) {
+                ++i;
+                continue;
+            }
+            m_freeStreams[m_freeStreamCount++] = stream;
+            ReleaseVoice(retiring);
+            m_retiring[i] = m_retiring[--m_retiringCount];
+        }
+
+        if (retired && m_streamEvent) {
+            SetEvent(m_streamEvent);
+        }
+    }
+
+    AudioMixer::Stats AudioMixer::GetStats() const
+    {
+        Stats stats;
+        stats.activeVoices = m_statActive.load(std::memory_order_relaxed);
+        stats.streamingVoices = m_statStreaming.load(std::memory_order_relaxed);
+        stats.mixedFrames = m_statMixedFrames.load(std::memory_order_relaxed);
+        stats.droppedPlays = m_statDropped.load(std::memory_order_relaxed);
+        stats.underruns = m_statUnderruns.load(std::memory_order_relaxed);
+        stats.mixMsPerSecond = m_statMixMsPerSecond.load(std::memory_order_relaxed);
+        return stats;
+    }
+
+    void AudioMixer::MixerLoop(std::promise<bool> opened)
+    {
+        const HRESULT com = CoInitializeEx(nullptr, COINIT_MULTITHREADED);
+        const bool ready = m_sink->Open(m_sampleRate, OutputChannels);
+        opened.set_value(ready);
+
+        if (ready) {
+            //   ٷ 鸮Ƿ  庸   
+            SetThreadPriority(GetCurrentThread(), THREAD_PRIORITY_TIME_CRITICAL);
+
+            const uint32_t capacity = static_cast<uint32_t>(m_output.size() / OutputChannels);
+            while (m_running.load(std::memory_order_acquire)) {
+                const uint32_t frames = std::min(m_sink->WaitForSpace(100), capacity);
+                if (frames == 0) continue;
+
+                Render(m_output.data(), frames);
+                m_sink->Write(m_output.data(), frames);
+            }
+        }
+
+        m_sink->Close();
+        if (SUCCEEDED(com)) {
+            CoUninitialize();
+        }
+    }
+
+    void AudioMixer::Render(float* output, uint32_t frames)
+    {
+        const auto start = Clock::now();
+
+        for (uint32_t done = 0; done < frames;) {
+            const uint32_t count = std::min(BlockFrames, frames - done);
+            ProcessCommands();
+            if (!m_sink) {
+                PumpStreams();
+            }
+            MixBlock(output + size_t(done) * OutputChannels, count);
+            done += count;
+        }
+
+        // Ʈ  ŭ ٽ ä쵵 
+        if (m_streamEvent && m_statStreaming.load(std::memory_order_relaxed) > 0) {
+            SetEvent(m_streamEvent);
+        }
+
+        const double ms = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+        const double perSecond = ms * m_sampleRate / std::max(frames, 1u);
+        const double previous = m_statMixMsPerSecond.load(std::memory_order_relaxed);
+        m_statMixMsPerSecond.store(previous == 0.0 ? perSecond : previous * 0.95 + perSecond * 0.05,
+            std::memory_order_relaxed);
+        m_statMixedFrames.fetch_add(frames, std::memory_order_relaxed);
+    }
+
+    void AudioMixer::ProcessCommands()
+    {
+        Command command;
+        while (m_commands.Pop(command)) {
+            if (command.type == Command::Type::SetMasterVolume) {
+                m_masterVolume = command.value;
+                continue;
+            }
+
+            Voice& voice = m_voices[command.slot];
+            if (command.type == Command::Type::Play) {
+                voice = {};
+                voice.samples = command.samples;
+                voice.frameCount = command.frameCount;
+                voice.channels = command.channels;
+                voice.sampleRate = command.sampleRate;
+                voice.stream = command.stream;
+                voice.generation = command.generation;
+                voice.volume = command.params.volume;
+                voice.pan = command.params.pan;
+                voice.pitch = command.params.pitch;
+                voice.loop = command.params.loop;
+                voice.active = true;
+                m_activeVoices[m_activeCount++] = command.slot;
+                continue;
+            }
+
+            // ̹  ̽  
+            if (!voice.active || voice.generation != command.generation) continue;
+
+            switch (command.type) {
+            case Command::Type::Stop:
+                voice.stopping = true;
+                break;
+            case Command::Type::SetVolume:
+                voice.volume = command.value;
+                break;
+            case Command::Type::SetPan:
+                voice.pan = command.value;
+                break;
+            case Command::Type::SetPitch:
+                voice.pitch = command.value;
+                break;
+            default:
+                break;
+            }
+        }
+    }
+
+    void AudioMixer::MixBlock(float* output, uint32_t frames)
+    {
+        std::fill_n(output, size_t(frames) * OutputChannels, 0.0f);
+
+        uint32_t streaming = 0;
+        for (uint32_t i = 0; i < m_activeCount;) {
+            const uint16_t slot = m_activeVoices[i];
+            Voice& voice = m_voices[slot];
+            if (MixVoice(voice, output, frames)) {
+                streaming += voice.stream != InvalidStream;
+                ++i;
+                continue;
+            }
+
+            //  -  尡 Update ȸ ( Ƿ  ׸ ޿)
+            voice.active = false;
+            m_finished.Push(slot);
+            m_activeVoices[i] = m_activeVoices[--m_activeCount];
+        }
+
+        //    [-1, 1] ڸ
+        const __m128 master = _mm_set1_ps(m_masterVolume);
+        const __m128 lower = _mm_set1_ps(-1.0f);
+        const __m128 upper = _mm_set1_ps(1.0f);
+        const size_t count = size_t(frames) * OutputChannels;
+        size_t i = 0;
+        for (; i + 4 <= count; i += 4) {
+            const __m128 value = _mm_mul_ps(_mm_loadu_ps(output + i), master);
+            _mm_storeu_ps(output + i, _mm_min_ps(_mm_max_ps(value, lower), upper));
+        }
+        for (; i < count; ++i) {
+            output[i] = std::clamp(output[i] * m_masterVolume, -1.0f, 1.0f);
+        }
+
+        m_statActive.store(m_activeCount, std::memory_order_relaxed);
+        m_statStreaming.store(streaming, std::memory_order_relaxed);
+    }
+
+    bool AudioMixer::MixVoice(Voice& voice, float* output, uint32_t frames)
+    {
+        // ǥ  -   , ׷ ݴʸ ̴ 뷱
+        float target[2] = { 0.0f, 0.0f };
+        if (!voice.stopping) {
+            if (voice.channels == 1) {
+                const float angle = (voice.pan + 1.0f) * 0.785398163f;
+                target[0] = std::cos(angle) * voice.volume;
+                target[1] = std::sin(angle) * voice.volume;
+            }
+            else {
+                target[0] = voice.volume * std::min(1.0f, 1.0f - voice.pan);
+                target[1] = voice.volume * std::min(1.0f, 1.0f + voice.pan);
+            }
+        }
+        if (!voice.started) {
+            //  ٷ ǥ  (  ʰ)
+            voice.gain[0] = target[0];
+            voice.gain[1] = target[1];
+            voice.started = true;
+        }
+
+        const double rate = double(voice.pitch) * voice.sampleRate / m_sampleRate;
+        const uint32_t step = std::clamp(static_cast<uint32_t>(rate * FixedOne + 0.5), 1u, MaxStep * FixedOne);
+
+        uint32_t count = frames;
+        bool ended = voice.stopping;
+
+        // ݺ   ӱ
+        if (!voice.loop) {
+            const uint64_t end = voice.frameCount << 16;
+            const uint64_t remaining = voice.position < end ? (end - voice.position + step - 1) / step : 0;
+            if (remaining <= count) {
+                count = static_cast<uint32_t>(remaining);
+                ended = true;
+            }
+        }
+
+        // Ʈ  ۿ ä ŭ (  ӱ ʿ)
+        if (voice.stream != InvalidStream && count > 0) {
+            uint64_t available = m_streams[voice.stream].written.load(std::memory_order_acquire);
+            if (!voice.loop && available >= voice.frameCount) {
+                available = voice.frameCount + 1;       //  ä    0
+            }
+            const uint64_t limit = available > 0 ? (available - 1) << 16 : 0;
+            const uint64_t playable = voice.position < limit ? (limit - voice.position + step - 1) / step : 0;
+            if (playable < count) {
+                if (voice.position > 0) {
+                    m_statUnderruns.fetch_add(1, std::memory_order_relaxed);
+                }
+                count = static_cast<uint32_t>(playable);
+                ended = voice.stopping;
+            }
+        }
+
+        const float gainStep[2] = {
+            (target[0] - voice.gain[0]) / float(frames),
+            (target[1] - voice.gain[1]) / float(frames)
+        };
+
+        if (count > 0) {
+            const uint64_t firstFrame = voice.position >> 16;
+            const uint64_t lastFrame = (voice.position + uint64_t(count - 1) * step) >> 16;
+            const uint32_t sourceFrames = static_cast<uint32_t>(lastFrame - firstFrame + 2);
+            FetchSource(voice, firstFrame, sourceFrames, m_source.data());
+
+            MixParams params;
+            params.source = m_source.data();
+            params.channels = voice.channels;
+            params.position = static_cast<uint32_t>(voice.position & 0xFFFF);
+            params.step = step;
+            params.frames = count;
+            params.gain[0] = voice.gain[0];
+            params.gain[1] = voice.gain[1];
+            params.gainStep[0] = gainStep[0];
+            params.gainStep[1] = gainStep[1];
+
+            if (m_simdEnabled.load(std::memory_order_relaxed)) {
+                MixSse(params, output);
+            }
+            else {
+                MixScalar(params, output);
+            }
+        }
+
+        voice.position += uint64_t(count) * step;
+        voice.gain[0] += gainStep[0] * float(count);
+        voice.gain[1] += gainStep[1] * float(count);
+
+        if (voice.stream != InvalidStream) {
+            m_streams[voice.stream].consumed.store(voice.position >> 16, std::memory_order_release);
+        }
+        else if (voice.loop) {
+            voice.position %= voice.frameCount << 16;
+        }
+
+        return !ended;
+    }
+
+    void AudioMixer::FetchSource(const Voice& voice, uint64_t firstFrame, uint32_t frameCount, float* destination) const
+    {
+        const uint32_t channels = voice.channels;
+
+        uint32_t i = 0;
+        if (voice.stream != InvalidStream) {
+            //  ۴ ݺ Ǯ ä ιǷ   ״ 
+            const auto& stream = m_streams[voice.stream];
+            const uint64_t written = stream.written.load(std::memory_order_acquire);
+            while (i < frameCount && firstFrame + i < written) {
+                const uint64_t frame = firstFrame + i;
+                const uint32_t ringIndex = static_cast<uint32_t>(frame % StreamRingFrames);
+                const uint32_t count = static_cast<uint32_t>(std::min<uint64_t>(
+                    { frameCount - i, StreamRingFrames - ringIndex, written - frame }));
+                std::memcpy(destination + size_t(i) * channels, stream.ring.get() + size_t(ringIndex) * channels,
+                    size_t(count) * channels * sizeof(float));
+                i += count;
+            }
+        }
+        else {
+            while (i < frameCount) {
+                uint64_t frame = firstFrame + i;
+                if (voice.loop) {
+                    frame %= voice.frameCount;
+                }
+                else if (frame >= voice.frameCount) {
+                    break;
+                }
+                const uint32_t count = static_cast<uint32_t>(std::min<uint64_t>(frameCount - i, voice.frameCount - frame));
+                std::memcpy(destination + size_t(i) * channels, voice.samples + frame * channels,
+                    size_t(count) * channels * sizeof(float));
+                i += count;
+            }
+        }
+
+        //    0 
+        std::fill(destination + size_t(i) * channels, destination + size_t(frameCount) * channels, 0.0f);
+    }
+
+    void AudioMixer::StreamLoop()
+    {
+        while (m_running.load(std::memory_order_acquire)) {
+            WaitForSingleObject(m_streamEvent, 10);
+            PumpStreams();
+        }
+    }
+
+    void AudioMixer::PumpStreams()
+    {
+        for (auto& stream : m_streams) {
+            const StreamState state = stream.state.load(std::memory_order_acquire);
+            if (state == StreamState::Retiring) {
+                stream.sound = nullptr;
+                stream.state.store(StreamState::Free, std::memory_order_release);
+            }
+            else if (state == StreamState::Active) {
+                FillStream(stream);
+            }
+        }
+    }
+
+    void AudioMixer::FillStream(Stream& stream)
+    {
+        const uint32_t channels = stream.sound->GetChannels();
+        const uint64_t frameCount = stream.sound->GetFrameCount();
+        uint64_t written = stream.written.load(std::memory_order_relaxed);
+
+        while (!stream.finished) {
+            const uint64_t consumed = stream.consumed.load(std::memory_order_acquire);
+            const uint64_t space = StreamRingFrames - (written - consumed);
+            if (space == 0) break;
+
+            const uint32_t ringIndex = static_cast<uint32_t>(written % StreamRingFrames);
+            const uint32_t count = static_cast<uint32_t>(std::min<uint64_t>(
+                { StreamChunkFrames, space, StreamRingFrames - ringIndex, frameCount - stream.decodePosition }));
+            const uint32_t decoded = stream.sound->Decode(stream.decodePosition, count,
+                stream.ring.get() + size_t(ringIndex) * channels);
+            if (decoded == 0) {
+                stream.finished = true;
+                break;
+            }
+
+            stream.decodePosition += decoded;
+            written += decoded;
+            stream.written.store(written, std::memory_order_release);
+
+            // ݺ̸ ó ̾ ä
+            if (stream.decodePosition >= frameCount) {
+                if (stream.loop) {
+                    stream.decodePosition = 0;
+                }
+                else {
+                    stream.finished = true;
+                }
+            }
+        }
+    }
+}
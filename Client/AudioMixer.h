@@ -0,0 +1,246 @@
+#pragma once
+#include "pch.h"
+#include "SoundResource.h"
+#include "AudioOutput.h"
+
+namespace Audio
+{
+    //  / Һ  ũ ť (, Ҵ )
+    template<typename T, size_t Capacity>
+    class SpscQueue {
+        static_assert((Capacity & (Capacity - 1)) == 0, "Capacity 2 ŵ");
+
+    public:
+        bool Push(const T& value) {
+            const size_t tail = m_tail.load(std::memory_order_relaxed);
+            if (tail - m_head.load(std::memory_order_acquire) == Capacity) return false;
+            m_items[tail & (Capacity - 1)] = value;
+            m_tail.store(tail + 1, std::memory_order_release);
+            return true;
+        }
+
+        bool Pop(T& value) {
+            const size_t head = m_head.load(std::memory_order_relaxed);
+            if (head == m_tail.load(std::memory_order_acquire)) return false;
+            value = m_items[head & (Capacity - 1)];
+            m_head.store(head + 1, std::memory_order_release);
+            return true;
+        }
+
+        // ڿ Һڰ   ¿
+        void Clear() {
+            m_head.store(0, std::memory_order_relaxed);
+            m_tail.store(0, std::memory_order_relaxed);
+        }
+
+    private:
+        std::array<T, Capacity> m_items{};
+        alignas(64) std::atomic<size_t> m_head{ 0 };
+        alignas(64) std::atomic<size_t> m_tail{ 0 };
+    };
+
+    // ̽  
+    struct PlayParams {
+        float volume = 1.0f;
+        float pan = 0.0f;       // -1() ~ 1().   , ׷ 뷱
+        float pitch = 1.0f;     //  ӵ (AudioMixer::MinPitch ~ MaxPitch)
+        bool loop = false;
+    };
+
+    // Ʈ ͼ
+    // -  : Play/Stop/Set*  ũ  ť ֱ⸸  (, Ҵ,  IO )
+    //   ̽ ԰    尡 ϰ,  ̽ Update ȸ
+    // - ͼ :  ġ ڸ   ݿϰ BlockFrames  ͽؼ sink 
+    //   ̽   ۷   SSE 4Ӿ    +   + 
+    // - Ʈ : Ʈ 带 Ʈ  ۿ ̸ ڵ (ͼ  ۸ )
+    // -  ϸ ǥ  ٲǷ /   Ŭ 
+    class AudioMixer {
+    public:
+        static constexpr uint32_t MaxVoices = 256;
+        static constexpr uint32_t MaxStreams = 32;
+        static constexpr uint32_t OutputChannels = 2;
+        static constexpr uint32_t BlockFrames = 256;            // 48kHz 5.3ms
+        static constexpr uint32_t StreamRingFrames = 16384;     // Ʈ   ( , 44.1kHz 0.37)
+        static constexpr uint32_t StreamChunkFrames = 4096;     // Ʈ 尡   ڵϴ 
+        static constexpr float MinPitch = 1.0f / 16.0f;
+        static constexpr float MaxPitch = 4.0f;
+        static constexpr uint32_t MaxStep = 8;                  // / ÷Ʈ    ӵ 
+
+        // [ 16][ 16] -  ̽ ڵ  ٽ ᵵ õ
+        using VoiceHandle = uint32_t;
+        static constexpr VoiceHandle InvalidVoice = 0;
+
+        struct Stats {
+            uint32_t activeVoices = 0;
+            uint32_t streamingVoices = 0;
+            uint64_t mixedFrames = 0;
+            uint64_t droppedPlays = 0;      // ̽/Ʈ/ ť     
+            uint64_t underruns = 0;         // Ʈ  ۰   ä  
+            double mixMsPerSecond = 0.0;    //  1ʸ ͽϴ   ð (ֱ  )
+        };
+
+        static AudioMixer& Instance();
+
+        // sink  ͼ/Ʈ 尡 sink 
+        //    - ȣڰ Render  θ Ʈ Render ȿ ä ( )
+        // sink  ϸ false (sink )
+        bool Initialize(std::unique_ptr<IAudioSink> sink, uint32_t sampleRate = 48000);
+        void Shutdown();
+
+        bool IsInitialized() const { return m_initialized; }
+        uint32_t GetSampleRate() const { return m_sampleRate; }
+        const char* GetSinkName() const { return m_sink ? m_sink->GetName() : ""; }
+
+        // ----    ----
+        // غ 常 . ڸ  InvalidVoice
+        VoiceHandle Play(const std::shared_ptr<Resource::SoundResource>& sound, const PlayParams& params = {});
+        void Stop(VoiceHandle voice);
+        void SetVolume(VoiceHandle voice, float volume);
+        void SetPan(VoiceHandle voice, float pan);
+        void SetPitch(VoiceHandle voice, float pitch);
+        void SetMasterVolume(float volume);
+        bool IsPlaying(VoiceHandle voice) const;
+
+        //  ̽ ȸ (  , Ʈ ȯ).   ȣ
+        void Update();
+
+        // ---- ͼ  ( 忡 ȣ) ----
+        // frames  output(׷ interleaved) 
+        void Render(float* output, uint32_t frames);
+
+        // false Į η ͽ (SSE  )
+        void SetSimdEnabled(bool enabled) { m_simdEnabled.store(enabled, std::memory_order_relaxed); }
+
+        Stats GetStats() const;
+
+    private:
+        AudioMixer() = default;
+        ~AudioMixer() { Shutdown(); }
+
+        AudioMixer(const AudioMixer&) = delete;
+        AudioMixer& operator=(const AudioMixer&) = delete;
+
+        static constexpr uint16_t InvalidStream = 0xFFFF;
+        static constexpr size_t CommandQueueSize = 1024;
+
+        struct Command {
+            enum class Type : uint8_t {
+                Play,
+                Stop,
+                SetVolume,
+                SetPan,
+                SetPitch,
+                SetMasterVolume
+            };
+
+            Type type = Type::Stop;
+            uint16_t slot = 0;
+            uint16_t generation = 0;
+            uint16_t stream = InvalidStream;
+            float value = 0.0f;
+            PlayParams params;
+
+            // Play -  尡 忡 о   (ͼ ҽ ü ǵ帮 )
+            const float* samples = nullptr;
+            uint64_t frameCount = 0;
+            uint32_t channels = 0;
+            uint32_t sampleRate = 0;
+        };
+
+        // ͼ   ̽ 
+        struct Voice {
+            const float* samples = nullptr;     //   (Ʈ̸ nullptr)
+            uint64_t frameCount = 0;
+            uint32_t channels = 0;
+            uint32_t sampleRate = 0;
+            uint16_t stream = InvalidStream;
+            uint16_t generation = 0;
+            uint64_t position = 0;              // 48.16 Ҽ   (Ʈ  ۿ ä   )
+            float volume = 1.0f;
+            float pan = 0.0f;
+            float pitch = 1.0f;
+            bool loop = false;
+            bool active = false;
+            bool stopping = false;              // ̹ Ͽ 0 ̰ 
+            bool started = false;
+            float gain[2] = {};                 //    
+        };
+
+        // Ʈ -  : Free -> Active () -> Retiring () -> Free (Ʈ )
+        enum class StreamState : uint8_t {
+            Free,
+            Active,
+            Retiring
+        };
+
+        struct Stream {
+            std::atomic<StreamState> state{ StreamState::Free };
+            const Resource::SoundResource* sound = nullptr;
+            bool loop = false;
+            std::unique_ptr<float[]> ring;                  // StreamRingFrames x ä (Initialize Ҵ)
+            std::atomic<uint64_t> written{ 0 };             // Ʈ 尡 ä  
+            std::atomic<uint64_t> consumed{ 0 };            // ͼ    ( ᵵ )
+            uint64_t decodePosition = 0;                    // Ʈ   -  ڵ  
+            bool finished = false;                          // Ʈ   - ݺ ʴ 带  ä
+        };
+
+        //  
+        bool PushCommand(const Command& command);
+        bool ResolveHandle(VoiceHandle voice, uint16_t& slot) const;
+        void ReleaseVoice(uint16_t slot);
+
+        // ͼ 
+        void MixerLoop(std::promise<bool> opened);
+        void ProcessCommands();
+        void MixBlock(float* output, uint32_t frames);
+        bool MixVoice(Voice& voice, float* output, uint32_t frames);
+        void FetchSource(const Voice& voice, uint64_t firstFrame, uint32_t frameCount, float* destination) const;
+
+        // Ʈ  ( 忡 Render)
+        void StreamLoop();
+        void PumpStreams();
+        void FillStream(Stream& stream);
+
+        bool m_initialized = false;
+        uint32_t m_sampleRate = 0;
+        std::unique_ptr<IAudioSink> m_sink;
+
+        std::thread m_mixerThread;
+        std::thread m_streamThread;
+        std::atomic<bool> m_running{ false };
+        HANDLE m_streamEvent = nullptr;
+
+        //   
+        std::array<std::shared_ptr<Resource::SoundResource>, MaxVoices> m_owners;
+        std::array<uint16_t, MaxVoices> m_generations{};
+        std::array<uint16_t, MaxVoices> m_voiceStreams{};
+        std::array<uint16_t, MaxVoices> m_freeVoices{};
+        uint32_t m_freeVoiceCount = 0;
+        std::array<uint16_t, MaxStreams> m_freeStreams{};
+        uint32_t m_freeStreamCount = 0;
+        std::array<uint16_t, MaxVoices> m_retiring{};       // Ʈ ȯ ٸ ̽
+        uint32_t m_retiringCount = 0;
+
+        //  
+        SpscQueue<Command, CommandQueueSize> m_commands;    //  -> ͼ
+        SpscQueue<uint16_t, MaxVoices> m_finished;          // ͼ ->  (Ը   ̶ ġ )
+        std::array<Stream, MaxStreams> m_streams;
+
+        // ͼ  
+        std::array<Voice, MaxVoices> m_voices;
+        std::array<uint16_t, MaxVoices> m_activeVoices{};
+        uint32_t m_activeCount = 0;
+        float m_masterVolume = 1.0f;
+        std::vector<float> m_source;                        // ̽ ϳ   (BlockFrames x MaxStep + 2 )
+        std::vector<float> m_output;                        // ͼ 尡 sink  
+        std::atomic<bool> m_simdEnabled{ true };
+
+        // 
+        std::atomic<uint32_t> m_statActive{ 0 };
+        std::atomic<uint32_t> m_statStreaming{ 0 };
+        std::atomic<uint64_t> m_statMixedFrames{ 0 };
+        std::atomic<uint64_t> m_statDropped{ 0 };
+        std::atomic<uint64_t> m_statUnderruns{ 0 };
+        std::atomic<double> m_statMixMsPerSecond{ 0.0 };
+    };
+}
@@ -0,0 +1,198 @@
+#include "pch.h"
+#include "AudioOutput.h"
+#include "Logger.h"
+
+namespace Audio
+{
+    bool NullAudioSink::Open(uint32_t sampleRate, uint32_t channels)
+    {
+        m_sampleRate = sampleRate;
+        m_channels = channels;
+        m_periodFrames = sampleRate / 100;
+        m_start = Clock::now();
+        m_writtenFrames = 0;
+        return sampleRate > 0 && channels > 0;
+    }
+
+    uint32_t NullAudioSink::WaitForSpace(uint32_t timeoutMs)
+    {
+        if (!m_realtime) {
+            return m_periodFrames;
+        }
+
+        // ġ ۰  ֱ з̶ ,  ŭ ڸ 
+        const auto deadline = Clock::now() + std::chrono::milliseconds(timeoutMs);
+        while (true) {
+            const auto elapsed = std::chrono::duration<double>(Clock::now() - m_start).count();
+            const uint64_t played = static_cast<uint64_t>(elapsed * m_sampleRate);
+            const uint64_t limit = played + m_periodFrames;
+            if (limit > m_writtenFrames + m_periodFrames / 2) {
+                return static_cast<uint32_t>(std::min<uint64_t>(limit - m_writtenFrames, m_periodFrames));
+            }
+            if (Clock::now() >= deadline) {
+                return 0;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+
+    bool NullAudioSink::Write(const float* samples, uint32_t frames)
+    {
+        m_writtenFrames += frames;
+        return true;
+    }
+
+    bool WavFileAudioSink::Open(uint32_t sampleRate, uint32_t channels)
+    {
+        if (!NullAudioSink::Open(sampleRate, channels)) return false;
+
+        m_file.open(m_path, std::ios::binary | std::ios::trunc);
+        if (!m_file) {
+            Logger::Instance().Error("WAV     ϴ: {}", m_path);
+            return false;
+        }
+
+        // ũ Close ä
+        const uint16_t formatTag = 3;       // IEEE float
+        const uint16_t channelCount = static_cast<uint16_t>(channels);
+        const uint16_t bits = 32;
+        const uint16_t blockAlign = channelCount * bits / 8;
+        const uint32_t byteRate = sampleRate * blockAlign;
+        const uint32_t fmtSize = 16;
+        const uint32_t zero = 0;
+
+        m_file.write("RIFF", 4);
+        m_file.write(reinterpret_cast<const char*>(&zero), 4);
+        m_file.write("WAVEfmt ", 8);
+        m_file.write(reinterpret_cast<const char*>(&fmtSize), 4);
+        m_file.write(reinterpret_cast<const char*>(&formatTag), 2);
+        m_file.write(reinterpret_cast<const char*>(&channelCount), 2);
+        m_file.write(reinterpret_cast<const char*>(&sampleRate), 4);
+        m_file.write(reinterpret_cast<const char*>(&byteRate), 4);
+        m_file.write(reinterpret_cast<const char*>(&blockAlign), 2);
+        m_file.write(reinterpret_cast<const char*>(&bits), 2);
+        m_file.write("data", 4);
+        m_file.write(reinterpret_cast<const char*>(&zero), 4);
+        return m_file.good();
+    }
+
+    void WavFileAudioSink::Close()
+    {
+        if (!m_file.is_open()) return;
+
+        const uint32_t dataSize = static_cast<uint32_t>(m_writtenFrames * m_channels * sizeof(float));
+        const uint32_t riffSize = 36 + dataSize;
+        m_file.seekp(4);
+        m_file.write(reinterpret_cast<const char*>(&riffSize), 4);
+        m_file.seekp(40);
+        m_file.write(reinterpret_cast<const char*>(&dataSize), 4);
+        m_file.close();
+
+        Logger::Instance().Info("WAV   Ϸ: {} ({:.2f})", m_path,
+            m_sampleRate ? double(m_writtenFrames) / m_sampleRate : 0.0);
+    }
+
+    bool WavFileAudioSink::Write(const float* samples, uint32_t frames)
+    {
+        m_file.write(reinterpret_cast<const char*>(samples), std::streamsize(frames) * m_channels * sizeof(float));
+        return NullAudioSink::Write(samples, frames) && m_file.good();
+    }
+
+    bool WasapiAudioSink::Open(uint32_t sampleRate, uint32_t channels)
+    {
+        ComPtr<IMMDeviceEnumerator> enumerator;
+        if (FAILED(CoCreateInstance(__uuidof(MMDeviceEnumerator), nullptr, CLSCTX_ALL, IID_PPV_ARGS(&enumerator)))) {
+            Logger::Instance().Error(" ġ   ");
+            return false;
+        }
+        if (FAILED(enumerator->GetDefaultAudioEndpoint(eRender, eConsole, &m_device))) {
+            Logger::Instance().Warning("⺻   ġ ϴ");
+            return false;
+        }
+        if (FAILED(m_device->Activate(__uuidof(IAudioClient), CLSCTX_ALL, nullptr, &m_client))) {
+            Logger::Instance().Error(" Ŭ̾Ʈ  ");
+            Close();
+            return false;
+        }
+
+        WAVEFORMATEX format = {};
+        format.wFormatTag = WAVE_FORMAT_IEEE_FLOAT;
+        format.nChannels = static_cast<WORD>(channels);
+        format.nSamplesPerSec = sampleRate;
+        format.wBitsPerSample = 32;
+        format.nBlockAlign = format.nChannels * format.wBitsPerSample / 8;
+        format.nAvgBytesPerSec = format.nSamplesPerSec * format.nBlockAlign;
+
+        const DWORD flags = AUDCLNT_STREAMFLAGS_EVENTCALLBACK |
+            AUDCLNT_STREAMFLAGS_AUTOCONVERTPCM | AUDCLNT_STREAMFLAGS_SRC_DEFAULT_QUALITY;
+        const REFERENCE_TIME duration = REFERENCE_TIME(m_bufferMs) * 10000;
+        if (FAILED(m_client->Initialize(AUDCLNT_SHAREMODE_SHARED, flags, duration, 0, &format, nullptr))) {
+            Logger::Instance().Error(" Ŭ̾Ʈ ʱȭ  ({}Hz, {}ch)", sampleRate, channels);
+            Close();
+            return false;
+        }
+
+        m_event = CreateEventW(nullptr, FALSE, FALSE, nullptr);
+        UINT32 bufferFrames = 0;
+        if (!m_event || FAILED(m_client->SetEventHandle(m_event)) ||
+            FAILED(m_client->GetBufferSize(&bufferFrames)) ||
+            FAILED(m_client->GetService(IID_PPV_ARGS(&m_renderClient)))) {
+            Logger::Instance().Error("  Ŭ̾Ʈ غ ");
+            Close();
+            return false;
+        }
+        m_bufferFrames = bufferFrames;
+        m_channels = channels;
+
+        Logger::Instance().Info("WASAPI  : {}Hz, {}ch,  {}", sampleRate, channels, m_bufferFrames);
+        return true;
+    }
+
+    void WasapiAudioSink::Close()
+    {
+        if (m_client && m_started) {
+            m_client->Stop();
+        }
+        m_started = false;
+        m_renderClient.Reset();
+        m_client.Reset();
+        m_device.Reset();
+        if (m_event) {
+            CloseHandle(m_event);
+            m_event = nullptr;
+        }
+    }
+
+    uint32_t WasapiAudioSink::WaitForSpace(uint32_t timeoutMs)
+    {
+        if (!m_client) return 0;
+
+        //   ۸ ٷ ä,  ڷδ ġ ֱ⸶ ̺Ʈ 
+        if (m_started && WaitForSingleObject(m_event, timeoutMs) != WAIT_OBJECT_0) {
+            return 0;
+        }
+
+        UINT32 padding = 0;
+        if (FAILED(m_client->GetCurrentPadding(&padding))) {
+            return 0;
+        }
+        return m_bufferFrames - padding;
+    }
+
+    bool WasapiAudioSink::Write(const float* samples, uint32_t frames)
+    {
+        if (!m_renderClient || frames == 0) return m_renderClient != nullptr;
+
+        BYTE* buffer = nullptr;
+        if (FAILED(m_renderClient->GetBuffer(frames, &buffer))) {
+            return false;
+        }
+        std::memcpy(buffer, samples, size_t(frames) * m_channels * sizeof(float));
+        m_renderClient->ReleaseBuffer(frames, 0);
+
+        if (!m_started) {
+            m_started = SUCCEEDED(m_client->Start());
+        }
+        return true;
+    }
+}
@@ -0,0 +1,92 @@
+#pragma once
+#include "pch.h"
+
+namespace Audio
+{
+    // ͼ   - ͼ 常 ȣ (Open ͼ 忡, COM MTA ʱȭ )
+    //  ׻ interleaved float
+    class IAudioSink {
+    public:
+        virtual ~IAudioSink() = default;
+
+        // ϴ  . ġ ٸ ̸ ȯ ñų 
+        virtual bool Open(uint32_t sampleRate, uint32_t channels) = 0;
+        virtual void Close() = 0;
+
+        //    ִ  . ڸ   ֱ ٸ (timeoutMs  0)
+        virtual uint32_t WaitForSpace(uint32_t timeoutMs) = 0;
+
+        // frames WaitForSpace   
+        virtual bool Write(const float* samples, uint32_t frames) = 0;
+
+        virtual const char* GetName() const = 0;
+    };
+
+    //   (帮 , )
+    // realtime̸  ġó ֱ(10ms) 帥 ðŭ , ƴϸ ûϴ  ٷ 
+    class NullAudioSink : public IAudioSink {
+    public:
+        explicit NullAudioSink(bool realtime = true) : m_realtime(realtime) {}
+
+        bool Open(uint32_t sampleRate, uint32_t channels) override;
+        void Close() override {}
+        uint32_t WaitForSpace(uint32_t timeoutMs) override;
+        bool Write(const float* samples, uint32_t frames) override;
+        const char* GetName() const override { return "Null"; }
+
+        uint64_t GetWrittenFrames() const { return m_writtenFrames; }
+
+    protected:
+        using Clock = std::chrono::steady_clock;
+
+        bool m_realtime;
+        uint32_t m_sampleRate = 0;
+        uint32_t m_channels = 0;
+        uint32_t m_periodFrames = 0;
+        Clock::time_point m_start;
+        uint64_t m_writtenFrames = 0;
+    };
+
+    // WAV Ϸ  (32Ʈ float). Close   ũ⸦ ä
+    // Ÿ̹ NullAudioSink  - 帮 ׽Ʈ ͼ  ״ Ȯϴ 뵵
+    class WavFileAudioSink : public NullAudioSink {
+    public:
+        explicit WavFileAudioSink(std::string path, bool realtime = true)
+            : NullAudioSink(realtime), m_path(std::move(path)) {}
+        ~WavFileAudioSink() override { Close(); }
+
+        bool Open(uint32_t sampleRate, uint32_t channels) override;
+        void Close() override;
+        bool Write(const float* samples, uint32_t frames) override;
+        const char* GetName() const override { return "WAV "; }
+
+    private:
+        std::string m_path;
+        std::ofstream m_file;
+    };
+
+    // WASAPI  , ̺Ʈ . ġ ͽ ˰ ٸ WASAPI ȯ (AUTOCONVERTPCM)
+    class WasapiAudioSink : public IAudioSink {
+    public:
+        // bufferMs: ġ   ( ð). ͼ  ŭ äǷ     
+        explicit WasapiAudioSink(uint32_t bufferMs = 40) : m_bufferMs(bufferMs) {}
+        ~WasapiAudioSink() override { Close(); }
+
+        bool Open(uint32_t sampleRate, uint32_t channels) override;
+        void Close() override;
+        uint32_t WaitForSpace(uint32_t timeoutMs) override;
+        bool Write(const float* samples, uint32_t frames) override;
+        const char* GetName() const override { return "WASAPI"; }
+
+    private:
+        uint32_t m_bufferMs;
+        uint32_t m_channels = 0;
+        uint32_t m_bufferFrames = 0;
+        bool m_started = false;
+
+        ComPtr<IMMDevice> m_device;
+        ComPtr<IAudioClient> m_client;
+        ComPtr<IAudioRenderClient> m_renderClient;
+        HANDLE m_event = nullptr;
+    };
+}
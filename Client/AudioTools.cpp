@@ -0,0 +1,275 @@
+#include "pch.h"
+#include "AudioTools.h"
+#include "Logger.h"
+
+namespace Audio
+{
+    namespace
+    {
+        using Clock = std::chrono::steady_clock;
+
+        template<typename T>
+        void Append(std::vector<uint8_t>& bytes, T value) {
+            const auto* p = reinterpret_cast<const uint8_t*>(&value);
+            bytes.insert(bytes.end(), p, p + sizeof(T));
+        }
+    }
+
+    bool AudioTools::WriteWave(const std::string& path, uint32_t sampleRate, uint16_t channels,
+        uint16_t bitsPerSample, std::span<const float> samples)
+    {
+        const bool isFloat = bitsPerSample == 32;
+        const uint32_t bytesPerSample = bitsPerSample / 8u;
+        const uint32_t dataSize = static_cast<uint32_t>(samples.size() * bytesPerSample);
+
+        std::vector<uint8_t> bytes;
+        bytes.reserve(44 + dataSize + 1);
+        bytes.insert(bytes.end(), { 'R', 'I', 'F', 'F' });
+        Append<uint32_t>(bytes, 36 + dataSize + (dataSize & 1));
+        bytes.insert(bytes.end(), { 'W', 'A', 'V', 'E', 'f', 'm', 't', ' ' });
+        Append<uint32_t>(bytes, 16);
+        Append<uint16_t>(bytes, isFloat ? 3 : 1);
+        Append<uint16_t>(bytes, channels);
+        Append<uint32_t>(bytes, sampleRate);
+        Append<uint32_t>(bytes, sampleRate * channels * bytesPerSample);
+        Append<uint16_t>(bytes, static_cast<uint16_t>(channels * bytesPerSample));
+        Append<uint16_t>(bytes, bitsPerSample);
+        bytes.insert(bytes.end(), { 'd', 'a', 't', 'a' });
+        Append<uint32_t>(bytes, dataSize);
+
+        for (float sample : samples) {
+            const float value = std::clamp(sample, -1.0f, 1.0f);
+            switch (bitsPerSample) {
+            case 8:
+                bytes.push_back(static_cast<uint8_t>(std::lround(value * 127.0f) + 128));
+                break;
+            case 16:
+                Append<int16_t>(bytes, static_cast<int16_t>(std::lround(value * 32767.0f)));
+                break;
+            case 24: {
+                const int32_t scaled = std::lround(value * 8388607.0f);
+                bytes.push_back(static_cast<uint8_t>(scaled));
+                bytes.push_back(static_cast<uint8_t>(scaled >> 8));
+                bytes.push_back(static_cast<uint8_t>(scaled >> 16));
+                break;
+            }
+            default:
+                Append<float>(bytes, value);
+                break;
+            }
+        }
+        if (dataSize & 1) {
+            bytes.push_back(0);
+        }
+
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        if (!file || !file.write(reinterpret_cast<const char*>(bytes.data()), bytes.size())) {
+            Logger::Instance().Error("WAV  : {}", path);
+            return false;
+        }
+        return true;
+    }
+
+    AudioTools::MixBenchmarkResult AudioTools::RunMixBenchmark(uint32_t voiceCount, double seconds,
+        const std::string& outputPath)
+    {
+        MixBenchmarkResult result;
+        result.voiceCount = voiceCount = std::clamp<uint32_t>(voiceCount, 1, AudioMixer::MaxVoices);
+
+        // 1. ׽Ʈ  -  Ÿ, ȭ, ,   ( Ʈ)
+        const auto directory = std::filesystem::temp_directory_path() / "AudioBench";
+        std::error_code ec;
+        std::filesystem::create_directories(directory, ec);
+
+        std::mt19937 rng(5);
+        std::uniform_real_distribution<float> noise(-1.0f, 1.0f);
+        constexpr float TwoPi = 6.28318531f;
+
+        struct TestSound {
+            const char* name;
+            uint32_t sampleRate;
+            uint16_t channels;
+            uint16_t bits;
+            double duration;
+        };
+        const TestSound testSounds[] = {
+            { "impact.wav", 44100, 1, 16, 0.5 },
+            { "chord.wav", 48000, 2, 24, 1.5 },
+            { "sweep.wav", 22050, 1, 8, 1.0 },
+            { "ambience.wav", 48000, 2, 32, 12.0 },
+        };
+
+        std::vector<std::shared_ptr<Resource::SoundResource>> sounds;
+        for (const auto& test : testSounds) {
+            const size_t frames = static_cast<size_t>(test.duration * test.sampleRate);
+            std::vector<float> samples(frames * test.channels);
+            for (size_t i = 0; i < frames; ++i) {
+                const float t = float(i) / test.sampleRate;
+                for (uint16_t c = 0; c < test.channels; ++c) {
+                    float value = 0.0f;
+                    if (test.name[0] == 'i') {
+                        value = noise(rng) * std::exp(-t * 12.0f);
+                    }
+                    else if (test.name[0] == 'c') {
+                        value = 0.3f * (std::sin(TwoPi * 261.6f * t) + std::sin(TwoPi * (c ? 392.0f : 329.6f) * t));
+                    }
+                    else if (test.name[0] == 's') {
+                        value = 0.8f * std::sin(TwoPi * (200.0f + 1800.0f * t) * t);
+                    }
+                    else {
+                        value = 0.4f * std::sin(TwoPi * (110.0f + c * 0.5f) * t) * (0.6f + 0.4f * std::sin(TwoPi * 0.25f * t));
+                    }
+                    samples[i * test.channels + c] = value;
+                }
+            }
+
+            const auto path = (directory / test.name).string();
+            auto sound = std::make_shared<Resource::SoundResource>(path);
+            if (!WriteWave(path, test.sampleRate, test.channels, test.bits, samples) || !sound->Load()) {
+                ++result.violations;
+                continue;
+            }
+            sounds.push_back(std::move(sound));
+        }
+        if (sounds.empty()) {
+            return result;
+        }
+
+        // 2.    SSE/Į  ͽ (ġ ֱó 10ms, ̻ Update)
+        auto& mixer = AudioMixer::Instance();
+        const uint32_t sampleRate = 48000;
+        const uint32_t period = sampleRate / 100;
+        const uint32_t periods = std::max(1u, static_cast<uint32_t>(seconds * 100.0));
+        result.seconds = double(periods) * period / sampleRate;
+
+        // Ʈ  Ѵ Ʈ ̽   
+        auto pickSound = [&](uint32_t index, uint32_t& streaming) {
+            auto sound = sounds[index % sounds.size()];
+            if (sound->IsStreaming() && streaming == AudioMixer::MaxStreams) {
+                sound = sounds[0];
+            }
+            streaming += sound->IsStreaming();
+            return sound;
+        };
+
+        auto mix = [&](bool simd, std::vector<float>& output) -> double {
+            mixer.Initialize(nullptr, sampleRate);
+            mixer.SetSimdEnabled(simd);
+
+            std::mt19937 playRng(17);
+            std::uniform_real_distribution<float> volume(0.02f, 0.08f);
+            std::uniform_real_distribution<float> pan(-1.0f, 1.0f);
+            std::uniform_real_distribution<float> pitch(0.5f, 2.0f);
+            result.streamingVoices = 0;
+            for (uint32_t i = 0; i < voiceCount; ++i) {
+                auto sound = pickSound(i, result.streamingVoices);
+                PlayParams params;
+                params.volume = volume(playRng);
+                params.pan = pan(playRng);
+                params.pitch = i % 8 == 0 ? 1.0f : pitch(playRng);     // Ϻδ   
+                params.loop = true;
+                if (mixer.Play(sound, params) == AudioMixer::InvalidVoice) {
+                    ++result.violations;
+                }
+            }
+
+            output.assign(size_t(periods) * period * AudioMixer::OutputChannels, 0.0f);
+            const auto start = Clock::now();
+            for (uint32_t i = 0; i < periods; ++i) {
+                mixer.Render(output.data() + size_t(i) * period * AudioMixer::OutputChannels, period);
+                mixer.Update();
+            }
+            const double ms = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+
+            const auto stats = mixer.GetStats();
+            result.violations += stats.underruns + stats.droppedPlays;
+            if (stats.activeVoices != voiceCount) {
+                ++result.violations;
+            }
+            mixer.Shutdown();
+            return ms;
+        };
+
+        std::vector<float> simdOutput, scalarOutput;
+        result.simdMs = mix(true, simdOutput);
+        result.scalarMs = mix(false, scalarOutput);
+        for (size_t i = 0; i < simdOutput.size(); ++i) {
+            result.maxDifference = std::max(result.maxDifference, double(std::fabs(simdOutput[i] - scalarOutput[i])));
+        }
+        if (result.maxDifference > 1e-5) {
+            ++result.violations;
+        }
+
+        // 3.  sink ϰ ٽ о  Ȯ
+        if (!outputPath.empty()) {
+            WavFileAudioSink sink(outputPath, false);
+            const uint32_t frames = static_cast<uint32_t>(simdOutput.size() / AudioMixer::OutputChannels);
+            if (sink.Open(sampleRate, AudioMixer::OutputChannels) && sink.Write(simdOutput.data(), frames)) {
+                sink.Close();
+                Resource::SoundResource written(outputPath);
+                if (!written.Load() || written.GetFrameCount() != frames ||
+                    written.GetSampleRate() != sampleRate || written.GetChannels() != AudioMixer::OutputChannels) {
+                    ++result.violations;
+                }
+            }
+            else {
+                ++result.violations;
+            }
+        }
+
+        // 4. ͼ  - ǽð  1, ߰  ϰ ȸ Ȯ
+        if (mixer.Initialize(std::make_unique<NullAudioSink>(true), sampleRate)) {
+            std::vector<AudioMixer::VoiceHandle> voices;
+            uint32_t streaming = 0;
+            for (uint32_t i = 0; i < voiceCount; ++i) {
+                PlayParams params;
+                params.volume = 0.05f;
+                params.loop = true;
+                voices.push_back(mixer.Play(pickSound(i, streaming), params));
+            }
+
+            const auto start = Clock::now();
+            bool stopped = false;
+            while (Clock::now() - start < std::chrono::seconds(1)) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(16));
+                if (!stopped && Clock::now() - start > std::chrono::milliseconds(700)) {
+                    for (auto voice : voices) {
+                        mixer.Stop(voice);
+                    }
+                    stopped = true;
+                }
+                mixer.Update();
+            }
+
+            result.threadedFrames = mixer.GetStats().mixedFrames;
+            if (result.threadedFrames < sampleRate * 8 / 10 || result.threadedFrames > sampleRate * 12 / 10) {
+                ++result.violations;
+            }
+            for (auto voice : voices) {
+                if (voice == AudioMixer::InvalidVoice || mixer.IsPlaying(voice)) {
+                    ++result.violations;
+                }
+            }
+            mixer.Shutdown();
+        }
+        else {
+            ++result.violations;
+        }
+
+        sounds.clear();
+        std::filesystem::remove_all(directory, ec);
+
+        const double audioMs = result.seconds * 1000.0;
+        Logger::Instance().Info("===  ͼ ġũ: ̽ {} (Ʈ {}),  {:.1f} ===",
+            result.voiceCount, result.streamingVoices, result.seconds);
+        Logger::Instance().Info("SSE: {:.1f}ms (ǽð  {:.1f}, ̽ {:.1f}ns/)",
+            result.simdMs, audioMs / std::max(result.simdMs, 1e-3),
+            result.simdMs * 1e6 / (double(voiceCount) * result.seconds * sampleRate));
+        Logger::Instance().Info("Į: {:.1f}ms (SSE {:.2f} ), ִ  {:.2e}",
+            result.scalarMs, result.scalarMs / std::max(result.simdMs, 1e-3), result.maxDifference);
+        Logger::Instance().Info("ͼ : 1  {} ", result.threadedFrames);
+        Logger::Instance().Info(" : {}", result.violations);
+
+        return result;
+    }
+}
@@ -0,0 +1,33 @@
+#pragma once
+#include "pch.h"
+#include "AudioMixer.h"
+
+namespace Audio
+{
+    // WAV ϰ ͼ ġũ 
+    class AudioTools {
+    public:
+        // interleaved float  WAV  (bitsPerSample: 8/16/24  Ǵ 32 float)
+        static bool WriteWave(const std::string& path, uint32_t sampleRate, uint16_t channels,
+            uint16_t bitsPerSample, std::span<const float> samples);
+
+        struct MixBenchmarkResult {
+            uint32_t voiceCount = 0;
+            uint32_t streamingVoices = 0;
+            double seconds = 0.0;               // ͽ  
+            double simdMs = 0.0;
+            double scalarMs = 0.0;
+            double maxDifference = 0.0;         // SSE/Į  
+            uint64_t threadedFrames = 0;        // ͼ 尡 1  NullAudioSink  
+            size_t violations = 0;              //  ġ,  ,  , ȸ , WAV  ġ
+        };
+
+        // ( 16Ʈ 44.1kHz, ׷ 24Ʈ,  8Ʈ 22.05kHz) Ʈ(׷ float 12)
+        // ׽Ʈ 带  voiceCount ̽  //ġ ݺ ϸ  ͽ
+        // - SSE ο Į η  Է ͽ ð  
+        // - ͼ  + ǽð NullAudioSink 1    ̽  ȸǴ Ȯ
+        // outputPath  SSE  WavFileAudioSink 
+        static MixBenchmarkResult RunMixBenchmark(uint32_t voiceCount = 256, double seconds = 10.0,
+            const std::string& outputPath = {});
+    };
+}
@@ -0,0 +1,379 @@
+#include "pch.h"
+#include "BlockCodec.h"
+
+namespace Resource::BlockCodec
+{
+    namespace
+    {
+        //   (LZ4 迭)
+        // [ū: ͷ  4Ʈ | ġ -4 4Ʈ][߰ ͷ ][ͷ][ 16Ʈ][߰ ġ ]
+        //   ͷ  Է  е
+        constexpr size_t MinMatch = 4;
+        constexpr size_t MaxOffset = 65535;
+        constexpr uint32_t HashBits = 16;
+        constexpr int32_t NoPosition = -1;
+
+        inline uint32_t Read32(const uint8_t* p) {
+            uint32_t value;
+            std::memcpy(&value, p, sizeof(value));
+            return value;
+        }
+
+        inline uint32_t Hash(uint32_t value) {
+            return (value * 2654435761u) >> (32 - HashBits);
+        }
+
+        //  ؽ ü Ž 
+        inline uint32_t ChainDepth(int level) {
+            level = std::clamp(level, MinLevel, MaxLevel);
+            return 1u << (level - 1);
+        }
+
+        class SequenceWriter {
+        public:
+            SequenceWriter(uint8_t* dst, size_t capacity)
+                : m_dst(dst), m_capacity(capacity) {
+            }
+
+            bool Emit(const uint8_t* literals, size_t literalCount, size_t offset, size_t matchLength) {
+                const size_t matchCode = matchLength ? matchLength - MinMatch : 0;
+
+                if (!Reserve(1)) return false;
+                uint8_t* token = m_dst + m_size++;
+                *token = static_cast<uint8_t>((std::min<size_t>(literalCount, 15) << 4) |
+                    std::min<size_t>(matchCode, 15));
+
+                if (literalCount >= 15 && !WriteLength(literalCount - 15)) return false;
+
+                if (!Reserve(literalCount)) return false;
+                std::memcpy(m_dst + m_size, literals, literalCount);
+                m_size += literalCount;
+
+                if (matchLength == 0) return true;  //  
+
+                if (!Reserve(2)) return false;
+                m_dst[m_size++] = static_cast<uint8_t>(offset);
+                m_dst[m_size++] = static_cast<uint8_t>(offset >> 8);
+
+                if (matchCode >= 15 && !WriteLength(matchCode - 15)) return false;
+                return true;
+            }
+
+            size_t GetSize() const { return m_size; }
+
+        private:
+            bool Reserve(size_t count) const {
+                return m_size + count <= m_capacity;
+            }
+
+            bool WriteLength(size_t length) {
+                while (length >= 255) {
+                    if (!Reserve(1)) return false;
+                    m_dst[m_size++] = 255;
+                    length -= 255;
+                }
+                if (!Reserve(1)) return false;
+                m_dst[m_size++] = static_cast<uint8_t>(length);
+                return true;
+            }
+
+            uint8_t* m_dst;
+            size_t m_capacity;
+            size_t m_size = 0;
+        };
+
+        // 庰 Ž ̺ (ϸ  Ҵ ʵ)
+        struct MatchTables {
+            std::vector<int32_t> head;
+            std::vector<int32_t> chain;
+
+            void Reset(size_t blockSize) {
+                head.assign(size_t(1) << HashBits, NoPosition);
+                if (chain.size() < blockSize) {
+                    chain.resize(blockSize);
+                }
+            }
+        };
+
+        bool ReadLength(const uint8_t* src, size_t size, size_t& ip, size_t& length) {
+            uint8_t byte;
+            do {
+                if (ip >= size) return false;
+                byte = src[ip++];
+                length += byte;
+            } while (byte == 255);
+            return true;
+        }
+
+        // ġ   - ġ (offset < length) ó
+        inline void CopyMatch(uint8_t* dst, size_t offset, size_t length) {
+            const uint8_t* match = dst - offset;
+            if (offset >= length) {
+                std::memcpy(dst, match, length);
+            }
+            else if (offset >= 8) {
+                // 8Ʈ Űܵ  ׻ ̹   
+                size_t i = 0;
+                for (; i + 8 <= length; i += 8) {
+                    std::memcpy(dst + i, match + i, 8);
+                }
+                for (; i < length; ++i) {
+                    dst[i] = match[i];
+                }
+            }
+            else {
+                for (size_t i = 0; i < length; ++i) {
+                    dst[i] = match[i];
+                }
+            }
+        }
+    }
+
+    size_t CompressBound(size_t size)
+    {
+        //  ͷ : ū +  Ʈ + 
+        return size + size / 255 + 16;
+    }
+
+    size_t CompressBlock(const uint8_t* src, size_t size, uint8_t* dst, size_t capacity, int level)
+    {
+        SequenceWriter writer(dst, capacity);
+
+        thread_local MatchTables tables;
+        tables.Reset(size);
+        auto& head = tables.head;
+        auto& chain = tables.chain;
+        const uint32_t maxDepth = ChainDepth(level);
+
+        auto insert = [&](size_t pos) {
+            const uint32_t h = Hash(Read32(src + pos));
+            chain[pos] = head[h];
+            head[h] = static_cast<int32_t>(pos);
+            };
+
+        size_t anchor = 0;
+        size_t ip = 0;
+        while (ip + MinMatch <= size) {
+            // ؽ ü    ġ Ž
+            size_t bestLength = 0;
+            size_t bestOffset = 0;
+            const uint32_t current = Read32(src + ip);
+            int32_t candidate = head[Hash(current)];
+
+            for (uint32_t depth = 0; depth < maxDepth && candidate != NoPosition; ++depth) {
+                const size_t offset = ip - static_cast<size_t>(candidate);
+                if (offset > MaxOffset) break;
+
+                if (Read32(src + candidate) == current) {
+                    size_t length = MinMatch;
+                    while (ip + length < size && src[candidate + length] == src[ip + length]) {
+                        ++length;
+                    }
+                    if (length > bestLength) {
+                        bestLength = length;
+                        bestOffset = offset;
+                        if (ip + length == size) break;
+                    }
+                }
+                candidate = chain[candidate];
+            }
+
+            insert(ip);
+
+            if (bestLength < MinMatch) {
+                ++ip;
+                continue;
+            }
+
+            if (!writer.Emit(src + anchor, ip - anchor, bestOffset, bestLength)) {
+                return 0;
+            }
+
+            // ġ   ġ 
+            //  ݺ  ʱ   ü  ġθ äǷ κи 
+            const size_t matchEnd = ip + bestLength;
+            const size_t tail = maxDepth > 1 && bestLength <= 32 ? bestLength : 2;
+            for (size_t next = std::max(ip + 1, matchEnd - tail); next < matchEnd && next + MinMatch <= size; ++next) {
+                insert(next);
+            }
+
+            ip = matchEnd;
+            anchor = ip;
+        }
+
+        if (!writer.Emit(src + anchor, size - anchor, 0, 0)) {
+            return 0;
+        }
+        return writer.GetSize();
+    }
+
+    bool DecompressBlock(const uint8_t* src, size_t size, uint8_t* dst, size_t rawSize)
+    {
+        size_t ip = 0;
+        size_t op = 0;
+
+        while (ip < size) {
+            const uint8_t token = src[ip++];
+
+            size_t literalCount = token >> 4;
+            if (literalCount == 15 && !ReadLength(src, size, ip, literalCount)) return false;
+            if (literalCount > size - ip || literalCount > rawSize - op) return false;
+
+            std::memcpy(dst + op, src + ip, literalCount);
+            ip += literalCount;
+            op += literalCount;
+
+            if (ip == size) break;  //  
+
+            if (size - ip < 2) return false;
+            const size_t offset = src[ip] | (static_cast<size_t>(src[ip + 1]) << 8);
+            ip += 2;
+            if (offset == 0 || offset > op) return false;
+
+            size_t matchLength = token & 15;
+            if (matchLength == 15 && !ReadLength(src, size, ip, matchLength)) return false;
+            matchLength += MinMatch;
+            if (matchLength > rawSize - op) return false;
+
+            CopyMatch(dst + op, offset, matchLength);
+            op += matchLength;
+        }
+
+        return op == rawSize;
+    }
+
+    std::vector<uint8_t> Compress(std::span<const uint8_t> src, int level, uint32_t blockSize)
+    {
+        blockSize = std::clamp(blockSize, MinBlockSize, MaxBlockSize);
+        const size_t blockCount = (src.size() + blockSize - 1) / blockSize;
+
+        // Ϻ   ( ̵   )
+        std::vector<std::vector<uint8_t>> compressed(blockCount);
+        if (level > 0) {
+            tbb::parallel_for(size_t(0), blockCount, [&](size_t i) {
+                const size_t offset = i * blockSize;
+                const size_t length = std::min<size_t>(blockSize, src.size() - offset);
+
+                std::vector<uint8_t> buffer(length);
+                const size_t written = CompressBlock(src.data() + offset, length, buffer.data(), length - 1, level);
+                if (written > 0) {
+                    buffer.resize(written);
+                    compressed[i] = std::move(buffer);
+                }
+                });
+        }
+
+        StreamHeader header = {};
+        header.magic = Magic;
+        header.blockSize = blockSize;
+        header.rawSize = src.size();
+        header.blockCount = static_cast<uint32_t>(blockCount);
+
+        size_t total = sizeof(StreamHeader) + blockCount * sizeof(BlockInfo);
+        for (size_t i = 0; i < blockCount; ++i) {
+            total += compressed[i].empty()
+                ? std::min<size_t>(blockSize, src.size() - i * blockSize)
+                : compressed[i].size();
+        }
+
+        std::vector<uint8_t> stream(total);
+        uint8_t* out = stream.data();
+        std::memcpy(out, &header, sizeof(header));
+        out += sizeof(header);
+
+        uint8_t* data = out + blockCount * sizeof(BlockInfo);
+        for (size_t i = 0; i < blockCount; ++i) {
+            const size_t offset = i * blockSize;
+            const size_t length = std::min<size_t>(blockSize, src.size() - offset);
+
+            BlockInfo info = {};
+            if (compressed[i].empty()) {
+                info.storedSize = static_cast<uint32_t>(length);
+                info.flags = BlockRaw;
+                std::memcpy(data, src.data() + offset, length);
+            }
+            else {
+                info.storedSize = static_cast<uint32_t>(compressed[i].size());
+                info.flags = BlockCompressed;
+                std::memcpy(data, compressed[i].data(), compressed[i].size());
+            }
+
+            std::memcpy(out, &info, sizeof(info));
+            out += sizeof(info);
+            data += info.storedSize;
+        }
+
+        return stream;
+    }
+
+    std::optional<uint64_t> GetRawSize(std::span<const uint8_t> stream)
+    {
+        if (stream.size() < sizeof(StreamHeader)) return std::nullopt;
+
+        StreamHeader header;
+        std::memcpy(&header, stream.data(), sizeof(header));
+        if (header.magic != Magic || header.blockSize < MinBlockSize || header.blockSize > MaxBlockSize) {
+            return std::nullopt;
+        }
+        if ((header.rawSize + header.blockSize - 1) / header.blockSize != header.blockCount) {
+            return std::nullopt;
+        }
+        return header.rawSize;
+    }
+
+    bool Decompress(std::span<const uint8_t> stream, std::span<uint8_t> dest, bool parallel)
+    {
+        auto rawSize = GetRawSize(stream);
+        if (!rawSize || *rawSize != dest.size()) return false;
+
+        StreamHeader header;
+        std::memcpy(&header, stream.data(), sizeof(header));
+
+        if (header.blockCount == 0) return true;
+
+        const size_t tableSize = static_cast<size_t>(header.blockCount) * sizeof(BlockInfo);
+        if (stream.size() - sizeof(StreamHeader) < tableSize) return false;
+
+        //  ġ  (  ĵ ʾ  Ƿ ؼ )
+        std::vector<BlockInfo> blocks(header.blockCount);
+        std::memcpy(blocks.data(), stream.data() + sizeof(StreamHeader), tableSize);
+
+        std::vector<size_t> offsets(header.blockCount);
+        size_t cursor = sizeof(StreamHeader) + tableSize;
+        for (size_t i = 0; i < blocks.size(); ++i) {
+            offsets[i] = cursor;
+            cursor += blocks[i].storedSize;
+        }
+        if (cursor > stream.size()) return false;
+
+        auto decodeBlock = [&](size_t i) -> bool {
+            const size_t rawOffset = i * header.blockSize;
+            const size_t rawLength = std::min<size_t>(header.blockSize, dest.size() - rawOffset);
+            const uint8_t* src = stream.data() + offsets[i];
+            uint8_t* dst = dest.data() + rawOffset;
+
+            if (blocks[i].flags == BlockRaw) {
+                //    縸
+                if (blocks[i].storedSize != rawLength) return false;
+                std::memcpy(dst, src, rawLength);
+                return true;
+            }
+            return DecompressBlock(src, blocks[i].storedSize, dst, rawLength);
+            };
+
+        if (!parallel || blocks.size() <= 1) {
+            for (size_t i = 0; i < blocks.size(); ++i) {
+                if (!decodeBlock(i)) return false;
+            }
+            return true;
+        }
+
+        std::atomic<bool> succeeded{ true };
+        tbb::parallel_for(size_t(0), blocks.size(), [&](size_t i) {
+            if (succeeded.load(std::memory_order_relaxed) && !decodeBlock(i)) {
+                succeeded.store(false, std::memory_order_relaxed);
+            }
+            });
+        return succeeded.load();
+    }
+}
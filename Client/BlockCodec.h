@@ -0,0 +1,63 @@
+#pragma once
+#include "pch.h"
+
+namespace Resource
+{
+    //   LZ  ڵ
+    // - Ʈ    (64~256KB)  ķ /
+    // -  ̵    ״ ϰ   memcpy 
+    //
+    // Ʈ ̾ƿ: [StreamHeader][BlockInfo x blockCount][ ...]
+    namespace BlockCodec
+    {
+        constexpr uint32_t Magic = 0x315A4C42;  // "BLZ1"
+
+        constexpr uint32_t MinBlockSize = 64 * 1024;
+        constexpr uint32_t MaxBlockSize = 256 * 1024;
+        constexpr uint32_t DefaultBlockSize = 128 * 1024;
+
+        //     ġ ã   ( ӵ )
+        constexpr int MinLevel = 1;
+        constexpr int MaxLevel = 9;
+        constexpr int DefaultLevel = 5;
+
+        struct StreamHeader {
+            uint32_t magic;
+            uint32_t blockSize;
+            uint64_t rawSize;
+            uint32_t blockCount;
+            uint32_t reserved;
+        };
+        static_assert(sizeof(StreamHeader) == 24);
+
+        enum BlockFlags : uint32_t {
+            BlockCompressed = 0,
+            BlockRaw = 1            //  ״ 
+        };
+
+        struct BlockInfo {
+            uint32_t storedSize;
+            uint32_t flags;
+        };
+        static_assert(sizeof(BlockInfo) == 8);
+
+        // ־    ũ
+        size_t CompressBound(size_t size);
+
+        //  ϳ  -  capacity  0 ȯ
+        size_t CompressBlock(const uint8_t* src, size_t size, uint8_t* dst, size_t capacity, int level);
+
+        //  ϳ  - Ȯ rawSize Ʈ  
+        bool DecompressBlock(const uint8_t* src, size_t size, uint8_t* dst, size_t rawSize);
+
+        // ü Ʈ  (  ). level 0 ϸ    ״ 
+        std::vector<uint8_t> Compress(std::span<const uint8_t> src, int level = DefaultLevel,
+            uint32_t blockSize = DefaultBlockSize);
+
+        // Ʈ  ˻   ũ ȯ (߸ Ʈ̸ nullopt)
+        std::optional<uint64_t> GetRawSize(std::span<const uint8_t> stream);
+
+        // ü Ʈ dest  -   ڱ ġ ٷ ϵ
+        bool Decompress(std::span<const uint8_t> stream, std::span<uint8_t> dest, bool parallel = true);
+    }
+}
@@ -1,6 +1,13 @@
 ﻿#include "pch.h"
 #include "Client.h"
 #include "Engine.h"
+#include "AssetPacker.h"
+#include "MeshTools.h"
+#include "TextureTools.h"
+#include "ResourceTools.h"
+#include "AudioTools.h"
+#include "PhysicsTools.h"
+#include "Logger.h"
 
 #define MAX_LOADSTRING 100
 
@@ -12,6 +19,32 @@ ATOM                MyRegisterClass(HINSTANCE hInstance);
 BOOL                InitInstance(HINSTANCE, int);
 LRESULT CALLBACK    WndProc(HWND, UINT, WPARAM, LPARAM);
 INT_PTR CALLBACK    About(HWND, UINT, WPARAM, LPARAM);
+bool                RunToolCommand(LPWSTR lpCmdLine, int& exitCode);
+
+namespace
+{
+    // 도구 명령의 숫자 인자를 읽지 못함 - RunToolCommand가 받아서 알리고 종료 코드 1로 끝냄
+    struct ToolArgumentError {
+        size_t index;
+    };
+
+    // args[index]를 T로 읽음 (인자가 없으면 fallback)
+    // 문자열 전체가 T 범위 안의 숫자가 아니면 ToolArgumentError (std::stoi처럼 앞부분만 읽지 않음)
+    template<typename T>
+    T ParseToolArgument(const std::vector<std::string>& args, size_t index, T fallback)
+    {
+        if (index >= args.size()) {
+            return fallback;
+        }
+        const std::string& text = args[index];
+        T value{};
+        const auto [end, ec] = std::from_chars(text.data(), text.data() + text.size(), value);
+        if (ec != std::errc() || end != text.data() + text.size()) {
+            throw ToolArgumentError{ index };
+        }
+        return value;
+    }
+}
 
 int APIENTRY wWinMain(_In_ HINSTANCE hInstance,
                      _In_opt_ HINSTANCE hPrevInstance,
@@ -19,7 +52,6 @@ int APIENTRY wWinMain(_In_ HINSTANCE hInstance,
                      _In_ int       nCmdShow)
 {
     UNREFERENCED_PARAMETER(hPrevInstance);
-    UNREFERENCED_PARAMETER(lpCmdLine);
 
     // 콘솔 창 활성화
     AllocConsole();
@@ -27,6 +59,14 @@ int APIENTRY wWinMain(_In_ HINSTANCE hInstance,
     freopen_s(&fp, "CONOUT$", "w", stdout); // 표준 출력 연결
     freopen_s(&fp, "CONIN$", "r", stdin);  // 표준 입력 연결
 
+    // 도구 명령이면 창을 띄우지 않고 실행 후 종료
+    int toolExitCode = 0;
+    if (RunToolCommand(lpCmdLine, toolExitCode)) {
+        if (fp != nullptr) fclose(fp);
+        FreeConsole();
+        return toolExitCode;
+    }
+
     LoadStringW(hInstance, IDS_APP_TITLE, szTitle, MAX_LOADSTRING);
     LoadStringW(hInstance, IDC_CLIENT, szWindowClass, MAX_LOADSTRING);
     MyRegisterClass(hInstance);
@@ -60,6 +100,213 @@ int APIENTRY wWinMain(_In_ HINSTANCE hInstance,
     return (int) msg.wParam;
 }
 
+//
+//  함수: RunToolCommand(LPWSTR, int&)
+//
+//  용도: 명령줄 도구 실행
+//
+//  --pack <루트 디렉터리> <출력.pak> [압축 레벨]       루트 아래 모든 파일을 패키지로 묶음 (레벨 0: 압축 안 함)
+//  --bench-archive <패키지.pak> <루트 디렉터리> [반복]  개별 파일과 패키지 로딩 시간 비교
+//  --bench-codec <파일> [블록 KB] [반복]               압축 레벨별 압축/해제 처리량 측정
+//  --bench-vertex [모델 파일] [반복]                   정점 압축 처리량과 오차 측정 (모델이 없으면 임의 정점)
+//  --cook-model <모델 파일> [출력.mesh]                 모델을 런타임 메시 포맷으로 쿠킹 (LOD 포함)
+//  --bench-meshlet [모델 파일] [반복]                  meshlet 분할 처리량과 품질 측정 (모델이 없으면 삼각형 100만 개 구)
+//  --test-mesh-lod [삼각형 수]                         단순화가 보고한 오차가 결과 표면까지 잰 거리의 상한인지 검증
+//  --cook-texture <이미지> [출력.dds] [bc1|bc3|bc4|bc5|bc7]  이미지를 밉 체인 + BC 압축 DDS로 쿠킹
+//  --bench-texture [이미지] [반복]                     밉 생성과 BC 포맷별 압축 처리량/화질 측정
+//  --test-texture-streaming                            DDS 헤더 해석과 밉 스트리밍 상태 전이 검증 (GPU 없음)
+//  --bench-load-graph [텍스처 수] [반복]               직렬/단계별/의존성 DAG 레벨 로딩 시간과 실패 전파 검증
+//  --bench-file-io <디렉터리> [큐 깊이] [반복]         ifstream/스레드 풀/IoRing/ReadFilesAsync 파일 읽기 처리량 비교
+//  --bench-material-sort [머터리얼 수] [드로우 수] [반복]  정렬 키 정렬 전후 PSO/텍스처/상수 변경 수와 정렬 비용
+//  --bench-audio-mix [보이스 수] [초] [출력.wav]       SSE/스칼라 믹싱 시간과 결과 비교, 믹서 스레드 재생/회수 검증
+//  --bench-preload [사운드 수] [레벨 준비 ms]          매니페스트 프리로드 유무에 따른 레벨 로딩 중 멈춘 시간 비교
+//  --test-shader-cache                                 스텁 컴파일러로 셰이더 캐시 적중/손상 파일 거부/입력 변경 무효화 검증
+//  --bench-physics-step [상자 수] [프레임] [렌더링 ms]  동기/분할 물리 스텝의 프레임 시간과 결과 대기 시간 비교
+//  --bench-physics-fixed [상자 수] [프레임]            흔들리는 프레임 시간에서 가변/고정 스텝 + 보간의 화면 움직임 비교
+//  --bench-physics-workers [상자 수] [스텝]            TBB 디스패처의 워커 수별 스텝 시간과 부하 중 동시 실행 수 확인
+//  --bench-physics-extract [상자 수] [프레임]          객체별 변환 읽기와 active actors + SIMD 일괄 행렬 계산 비교
+//  --bench-physics-query [쿼리 수] [프레임]            레이캐스트/스윕/오버랩 일괄 쿼리의 차례 실행과 병렬 실행 비교
+//  --bench-physics-contact [스텝] [충격량 문턱]         더미 크기별 접촉 보고 비용 (쌍마다 이벤트 vs 합쳐진 보고 버퍼)
+//
+//  어느 명령에든 --pause를 붙이면 끝난 뒤 Enter를 누를 때까지 콘솔 창을 유지 (기본은 바로 종료)
+//  숫자 인자를 읽을 수 없으면 명령을 실행하지 않고 그 인자를 알린 뒤 종료 코드 1로 끝남
+//
+bool RunToolCommand(LPWSTR lpCmdLine, int& exitCode)
+{
+    int argc = 0;
+    LPWSTR* argv = CommandLineToArgvW(lpCmdLine, &argc);
+    if (!argv) {
+        return false;
+    }
+
+    std::vector<std::string> args;
+    for (int i = 0; i < argc; ++i) {
+        args.push_back(std::filesystem::path(argv[i]).string());
+    }
+    LocalFree(argv);
+
+    // 스크립트/CI에서 멈추지 않도록 대기는 명시적으로 요청할 때만 함
+    const auto pauseFlag = std::find(args.begin(), args.end(), "--pause");
+    const bool pause = pauseFlag != args.end();
+    if (pause) {
+        args.erase(pauseFlag);
+    }
+
+    // CommandLineToArgvW는 빈 문자열에 대해 실행 파일 경로를 돌려줌
+    if (args.empty() || !args[0].starts_with("--")) {
+        return false;
+    }
+
+    Logger::Instance().AddOutput(std::make_unique<ConsoleOutput>());
+
+    try {
+        if (args[0] == "--pack" && args.size() >= 3) {
+            const int level = ParseToolArgument<int>(args, 3, 0);
+            exitCode = Resource::AssetPacker::PackDirectory(args[1], args[2], level) ? 0 : 1;
+        }
+        else if (args[0] == "--bench-archive" && args.size() >= 3) {
+            const int iterations = ParseToolArgument<int>(args, 3, 10);
+            auto result = Resource::AssetPacker::RunLoadBenchmark(args[1], args[2], iterations);
+            exitCode = result.fileCount > 0 ? 0 : 1;
+        }
+        else if (args[0] == "--bench-codec" && args.size() >= 2) {
+            const uint32_t blockSize = args.size() >= 3 ? ParseToolArgument<uint32_t>(args, 2, 0) * 1024 : Resource::BlockCodec::DefaultBlockSize;
+            const int iterations = ParseToolArgument<int>(args, 3, 5);
+            auto results = Resource::AssetPacker::RunCodecBenchmark(args[1], blockSize, iterations);
+            exitCode = results.empty() ? 1 : 0;
+        }
+        else if (args[0] == "--bench-vertex") {
+            const std::string modelPath = args.size() >= 2 ? args[1] : std::string();
+            const int iterations = ParseToolArgument<int>(args, 2, 5);
+            auto result = Resource::MeshTools::RunPackingBenchmark(modelPath, 4 * 1024 * 1024, iterations);
+            exitCode = result.vertexCount > 0 && result.violations == 0 ? 0 : 1;
+        }
+        else if (args[0] == "--cook-model" && args.size() >= 2) {
+            exitCode = Resource::MeshTools::CookModel(args[1], args.size() >= 3 ? args[2] : std::string()) ? 0 : 1;
+        }
+        else if (args[0] == "--bench-meshlet") {
+            const std::string modelPath = args.size() >= 2 ? args[1] : std::string();
+            const int iterations = ParseToolArgument<int>(args, 2, 3);
+            auto result = Resource::MeshTools::RunMeshletBenchmark(modelPath, 1024 * 1024, 4, iterations);
+            exitCode = result.meshletCount > 0 && result.violations == 0 ? 0 : 1;
+        }
+        else if (args[0] == "--test-mesh-lod") {
+            const size_t triangleCount = ParseToolArgument<size_t>(args, 1, 8192);
+            auto result = Resource::MeshTools::RunSimplifierCheck(triangleCount);
+            exitCode = result.violations == 0 ? 0 : 1;
+        }
+        else if (args[0] == "--cook-texture" && args.size() >= 2) {
+            std::optional<Resource::TextureCompressor::Format> format;
+            if (args.size() >= 4) {
+                format = Resource::TextureCompressor::ParseFormat(args[3]);
+                if (!format) {
+                    Logger::Instance().Error("알 수 없는 압축 포맷: {}", args[3]);
+                }
+            }
+            exitCode = (args.size() < 4 || format) &&
+                Resource::TextureTools::CookTexture(args[1], args.size() >= 3 ? args[2] : std::string(), format) ? 0 : 1;
+        }
+        else if (args[0] == "--bench-texture") {
+            const std::string sourcePath = args.size() >= 2 ? args[1] : std::string();
+            const int iterations = ParseToolArgument<int>(args, 2, 3);
+            auto result = Resource::TextureTools::RunCompressionBenchmark(sourcePath, 2048, iterations);
+            exitCode = !result.formats.empty() && result.violations == 0 ? 0 : 1;
+        }
+        else if (args[0] == "--test-texture-streaming") {
+            auto result = Resource::TextureTools::RunStreamingCheck();
+            exitCode = result.violations == 0 ? 0 : 1;
+        }
+        else if (args[0] == "--bench-load-graph") {
+            const size_t textureCount = ParseToolArgument<size_t>(args, 1, 48);
+            const int iterations = ParseToolArgument<int>(args, 2, 3);
+            auto result = Resource::ResourceTools::RunLoadGraphBenchmark(textureCount, iterations);
+            exitCode = result.violations == 0 ? 0 : 1;
+        }
+        else if (args[0] == "--bench-file-io" && args.size() >= 2) {
+            const uint32_t queueDepth = ParseToolArgument<uint32_t>(args, 2, 64);
+            const int iterations = ParseToolArgument<int>(args, 3, 3);
+            auto result = Resource::ResourceTools::RunFileReadBenchmark(args[1], queueDepth, iterations);
+            exitCode = result.fileCount > 0 && result.violations == 0 ? 0 : 1;
+        }
+        else if (args[0] == "--bench-material-sort") {
+            const size_t materialCount = ParseToolArgument<size_t>(args, 1, 512);
+            const size_t drawCount = ParseToolArgument<size_t>(args, 2, 20000);
+            const int iterations = ParseToolArgument<int>(args, 3, 20);
+            auto result = Resource::ResourceTools::RunMaterialSortBenchmark(materialCount, drawCount, iterations);
+            exitCode = result.violations == 0 ? 0 : 1;
+        }
+        else if (args[0] == "--bench-audio-mix") {
+            const uint32_t voiceCount = ParseToolArgument<uint32_t>(args, 1, 256);
+            const double seconds = ParseToolArgument<double>(args, 2, 10.0);
+            const std::string outputPath = args.size() >= 4 ? args[3] : std::string();
+            auto result = Audio::AudioTools::RunMixBenchmark(voiceCount, seconds, outputPath);
+            exitCode = result.violations == 0 ? 0 : 1;
+        }
+        else if (args[0] == "--bench-preload") {
+            const size_t soundCount = ParseToolArgument<size_t>(args, 1, 64);
+            const double setupMs = ParseToolArgument<double>(args, 2, 50.0);
+            auto result = Resource::ResourceTools::RunPreloadBenchmark(soundCount, setupMs);
+            exitCode = result.violations == 0 ? 0 : 1;
+        }
+        else if (args[0] == "--test-shader-cache") {
+            auto result = Resource::ResourceTools::RunShaderCacheCheck();
+            exitCode = result.violations == 0 ? 0 : 1;
+        }
+        else if (args[0] == "--bench-physics-step") {
+            const size_t bodyCount = ParseToolArgument<size_t>(args, 1, 2000);
+            const int frames = ParseToolArgument<int>(args, 2, 300);
+            const double renderMs = ParseToolArgument<double>(args, 3, 4.0);
+            auto result = PhysicsTools::RunStepBenchmark(bodyCount, frames, renderMs);
+            exitCode = result.violations == 0 ? 0 : 1;
+        }
+        else if (args[0] == "--bench-physics-fixed") {
+            const size_t bodyCount = ParseToolArgument<size_t>(args, 1, 500);
+            const int frames = ParseToolArgument<int>(args, 2, 600);
+            auto result = PhysicsTools::RunFixedStepBenchmark(bodyCount, frames);
+            exitCode = result.violations == 0 ? 0 : 1;
+        }
+        else if (args[0] == "--bench-physics-workers") {
+            const size_t bodyCount = ParseToolArgument<size_t>(args, 1, 4000);
+            const int frames = ParseToolArgument<int>(args, 2, 200);
+            auto result = PhysicsTools::RunWorkerBenchmark(bodyCount, frames);
+            exitCode = result.violations == 0 ? 0 : 1;
+        }
+        else if (args[0] == "--bench-physics-extract") {
+            const size_t bodyCount = ParseToolArgument<size_t>(args, 1, 4000);
+            const int frames = ParseToolArgument<int>(args, 2, 600);
+            auto result = PhysicsTools::RunExtractBenchmark(bodyCount, frames);
+            exitCode = result.violations == 0 ? 0 : 1;
+        }
+        else if (args[0] == "--bench-physics-query") {
+            const size_t queryCount = ParseToolArgument<size_t>(args, 1, 10000);
+            const int frames = ParseToolArgument<int>(args, 2, 30);
+            auto result = PhysicsTools::RunQueryBenchmark(queryCount, frames);
+            exitCode = result.violations == 0 ? 0 : 1;
+        }
+        else if (args[0] == "--bench-physics-contact") {
+            const int frames = ParseToolArgument<int>(args, 1, 240);
+            const float threshold = ParseToolArgument<float>(args, 2, 0.5f);
+            auto result = PhysicsTools::RunContactBenchmark(frames, threshold);
+            exitCode = result.violations == 0 ? 0 : 1;
+        }
+        else {
+            Logger::Instance().Error("알 수 없는 명령: {}", args[0]);
+            exitCode = 1;
+        }
+    }
+    catch (const ToolArgumentError& error) {
+        Logger::Instance().Error("{}: {}번째 인자를 숫자로 읽을 수 없음: '{}'",
+            args[0], error.index, args[error.index]);
+        exitCode = 1;
+    }
+
+    if (pause) {
+        std::cout << "Press Enter to exit...";
+        std::cin.get();
+    }
+    return true;
+}
+
 ATOM MyRegisterClass(HINSTANCE hInstance)
 {
     WNDCLASSEXW wcex;
@@ -0,0 +1,169 @@
+#include "pch.h"
+#include "ContactBuffer.h"
+
+void ContactBuffer::Reserve(const Capacity& capacity)
+{
+    m_contacts.clear();
+    m_contacts.reserve(capacity.contacts);
+    m_points.clear();
+    m_points.reserve(capacity.points);
+    m_triggers.clear();
+    m_triggers.reserve(capacity.triggers);
+    m_slept.clear();
+    m_slept.reserve(capacity.sleepWake);
+    m_woken.clear();
+    m_woken.reserve(capacity.sleepWake);
+
+    size_t tableSize = 16;
+    while (tableSize < size_t(capacity.contacts) * 2) {
+        tableSize *= 2;
+    }
+    m_pairTable.assign(tableSize, PairSlot());
+    m_generation = 1;
+    m_stats = Stats();
+}
+
+void ContactBuffer::Clear()
+{
+    m_contacts.clear();
+    m_points.clear();
+    m_triggers.clear();
+    m_slept.clear();
+    m_woken.clear();
+    m_stats = Stats();
+
+    // 밡    ǥ   (40   )
+    if (++m_generation == 0) {
+        std::fill(m_pairTable.begin(), m_pairTable.end(), PairSlot());
+        m_generation = 1;
+    }
+}
+
+ContactBuffer::Contact* ContactBuffer::FindOrAddContact(PxActor* actor0, PxActor* actor1)
+{
+    if (m_pairTable.empty()) {
+        ++m_stats.dropped;
+        return nullptr;
+    }
+
+    const uint64_t key0 = reinterpret_cast<uintptr_t>(actor0);
+    const uint64_t key1 = reinterpret_cast<uintptr_t>(actor1);
+    const size_t mask = m_pairTable.size() - 1;
+    size_t index = static_cast<size_t>((key0 * 0x9E3779B97F4A7C15ull) ^ (key1 * 0xC2B2AE3D27D4EB4Full)) >> 7;
+
+    //  Ž - ǥ  뷮   ̶̻  ĭ ׻ 
+    for (size_t probe = 0; probe <= mask; ++probe) {
+        PairSlot& slot = m_pairTable[(index + probe) & mask];
+        if (slot.generation != m_generation) {
+            if (m_contacts.size() == m_contacts.capacity()) {
+                ++m_stats.dropped;
+                return nullptr;
+            }
+            slot = { actor0, actor1, static_cast<uint32_t>(m_contacts.size()), m_generation };
+
+            Contact& contact = m_contacts.emplace_back();
+            contact.actor0 = actor0;
+            contact.actor1 = actor1;
+            contact.object0 = actor0 ? static_cast<PhysicsObject*>(actor0->userData) : nullptr;
+            contact.object1 = actor1 ? static_cast<PhysicsObject*>(actor1->userData) : nullptr;
+            return &contact;
+        }
+        if (slot.actor0 == actor0 && slot.actor1 == actor1) {
+            ++m_stats.coalesced;
+            return &m_contacts[slot.contact];
+        }
+    }
+    ++m_stats.dropped;
+    return nullptr;
+}
+
+void ContactBuffer::AddContacts(const PxContactPairHeader& header, const PxContactPair* pairs, PxU32 count)
+{
+    //   ּҷ  ( ٲٸ  ⵵ )
+    PxActor* actor0 = header.flags & PxContactPairHeaderFlag::eREMOVED_ACTOR_0 ? nullptr : header.actors[0];
+    PxActor* actor1 = header.flags & PxContactPairHeaderFlag::eREMOVED_ACTOR_1 ? nullptr : header.actors[1];
+    const bool swapped = std::less<const void*>()(header.actors[1], header.actors[0]);
+    if (swapped) {
+        std::swap(actor0, actor1);
+    }
+    const float normalSign = swapped ? -1.0f : 1.0f;
+
+    for (PxU32 i = 0; i < count; ++i) {
+        const PxContactPair& pair = pairs[i];
+        ++m_stats.pairs;
+
+        uint8_t events = 0;
+        if (pair.events & PxPairFlag::eNOTIFY_TOUCH_FOUND) events |= Contact::Found;
+        if (pair.events & PxPairFlag::eNOTIFY_TOUCH_LOST) events |= Contact::Lost;
+        if (events == 0) continue;
+
+        // ݷ հ    (   MaxPointsPerPair)
+        const PxU32 pointCount = pair.contactCount ? pair.extractContacts(m_scratch.data(), MaxPointsPerPair) : 0;
+        float impulse = 0.0f;
+        float maxImpulse = -1.0f;
+        PxU32 strongest = 0;
+        for (PxU32 p = 0; p < pointCount; ++p) {
+            const float magnitude = m_scratch[p].impulse.magnitude();
+            impulse += magnitude;
+            if (magnitude > maxImpulse) {
+                maxImpulse = magnitude;
+                strongest = p;
+            }
+        }
+
+        if (!(events & Contact::Lost) && impulse < m_impulseThreshold) {
+            ++m_stats.filtered;
+            continue;
+        }
+
+        Contact* contact = FindOrAddContact(actor0, actor1);
+        if (!contact) continue;
+
+        contact->events |= events;
+        contact->impulse += impulse;
+        if (pointCount > 0 && maxImpulse >= contact->maxImpulse) {
+            const bool stronger = contact->pointCount == 0 || maxImpulse > contact->maxImpulse;
+            contact->maxImpulse = maxImpulse;
+            contact->position = m_scratch[strongest].position;
+            contact->normal = m_scratch[strongest].normal * normalSign;
+
+            // ˸    ͸  (   ڸ ϰ )
+            if (m_capturePoints && stronger) {
+                if (m_points.size() + pointCount > m_points.capacity()) {
+                    ++m_stats.dropped;
+                    continue;
+                }
+                contact->firstPoint = static_cast<uint32_t>(m_points.size());
+                contact->pointCount = pointCount;
+                for (PxU32 p = 0; p < pointCount; ++p) {
+                    const PxContactPairPoint& source = m_scratch[p];
+                    m_points.push_back({ source.position, source.normal * normalSign, source.separation,
+                        source.impulse.magnitude() });
+                }
+            }
+        }
+    }
+}
+
+void ContactBuffer::AddTriggers(const PxTriggerPair* pairs, PxU32 count)
+{
+    for (PxU32 i = 0; i < count; ++i) {
+        const PxTriggerPair& pair = pairs[i];
+        if (pair.flags & (PxTriggerPairFlag::eREMOVED_SHAPE_TRIGGER | PxTriggerPairFlag::eREMOVED_SHAPE_OTHER)) {
+            continue;
+        }
+        PushBounded(m_triggers, Trigger{ pair.triggerActor, pair.otherActor,
+            pair.status == PxPairFlag::eNOTIFY_TOUCH_FOUND });
+    }
+}
+
+void ContactBuffer::AddSleep(PxActor* const* actors, PxU32 count, bool sleeping)
+{
+    auto& list = sleeping ? m_slept : m_woken;
+    for (PxU32 i = 0; i < count; ++i) {
+        if (!PushBounded(list, actors[i])) {
+            m_stats.dropped += count - i - 1;
+            break;
+        }
+    }
+}
@@ -0,0 +1,125 @@
+#pragma once
+#include "PhysicsTypes.h"
+class PhysicsObject;
+
+//    - ùķ̼ ݹ   ڵ尡 ӿ   ° 
+// -  迭 Reserve ̸  ΰ ġ  (ݹ ȿ Ҵ )
+// -     ϳ ħ (   ų  ӿ 꽺  ̾)
+// -  /Ḹ .    ̿  ָ   Ƿ  ̴ û 
+// - ݷ  κ     ( ģ )
+// - PhysX fetchResults  ȣ 忡 ݹ θǷ  
+class ContactBuffer {
+public:
+    struct Point {
+        PxVec3 position;
+        PxVec3 normal;              // actor1 actor0 
+        float separation;
+        float impulse;
+    };
+
+    struct Contact {
+        enum Event : uint8_t {
+            Found = 1 << 0,
+            Lost = 1 << 1
+        };
+
+        PxActor* actor0 = nullptr;          //  ŵ ͸ nullptr
+        PxActor* actor1 = nullptr;
+        PhysicsObject* object0 = nullptr;   //  userData
+        PhysicsObject* object1 = nullptr;
+        PxVec3 position = PxVec3(0.0f);     //   
+        PxVec3 normal = PxVec3(0.0f);
+        float impulse = 0.0f;               // ģ   ݷ 
+        float maxImpulse = 0.0f;            //    ݷ
+        uint32_t firstPoint = 0;            // ˸ ü (CapturePoints ,    )
+        uint32_t pointCount = 0;
+        uint8_t events = 0;                 // Event Ʈ 
+
+        bool Has(Event event) const { return (events & event) != 0; }
+    };
+
+    struct Trigger {
+        PxActor* triggerActor = nullptr;
+        PxActor* otherActor = nullptr;
+        bool entered = false;               // false 
+    };
+
+    struct Stats {
+        uint32_t pairs = 0;                 // PhysX   
+        uint32_t coalesced = 0;             // ̹ ִ  ֿ  
+        uint32_t filtered = 0;              // ݷ ο ɸ 
+        uint32_t dropped = 0;               // 뷮 ڶ  //Ʈ/ ˸
+    };
+
+    struct Capacity {
+        uint32_t contacts = 4096;
+        uint32_t points = 16384;
+        uint32_t triggers = 256;
+        uint32_t sleepWake = 4096;          // / 
+    };
+
+    void Reserve(const Capacity& capacity);
+
+    // (Ǵ ܵ ) ۿ . 뷮 ״
+    void Clear();
+
+    // ݷ  ̺      (  ׻ )
+    void SetImpulseThreshold(float threshold) { m_impulseThreshold = threshold; }
+    float GetImpulseThreshold() const { return m_impulseThreshold; }
+
+    // ˸    (    ϳ Contact)
+    void SetCapturePoints(bool capture) { m_capturePoints = capture; }
+    bool GetCapturePoints() const { return m_capturePoints; }
+
+    // ùķ̼ ݹ鿡 ȣ
+    void AddContacts(const PxContactPairHeader& header, const PxContactPair* pairs, PxU32 count);
+    void AddTriggers(const PxTriggerPair* pairs, PxU32 count);
+    void AddSleep(PxActor* const* actors, PxU32 count, bool sleeping);
+
+    std::span<const Contact> GetContacts() const { return m_contacts; }
+    std::span<const Point> GetPoints(const Contact& contact) const {
+        return std::span<const Point>(m_points).subspan(contact.firstPoint, contact.pointCount);
+    }
+    std::span<const Trigger> GetTriggers() const { return m_triggers; }
+    std::span<PxActor* const> GetSlept() const { return m_slept; }
+    std::span<PxActor* const> GetWoken() const { return m_woken; }
+    const Stats& GetStats() const { return m_stats; }
+
+private:
+    static constexpr uint32_t MaxPointsPerPair = 64;
+
+    //   -> m_contacts ȣ.  ȣ Ƿ Clear ǥ ũ 
+    struct PairSlot {
+        const PxActor* actor0 = nullptr;
+        const PxActor* actor1 = nullptr;
+        uint32_t contact = 0;
+        uint32_t generation = 0;
+    };
+
+    Contact* FindOrAddContact(PxActor* actor0, PxActor* actor1);
+
+    template<typename T>
+    bool PushBounded(std::vector<T>& items, const T& item) {
+        if (items.size() == items.capacity()) {
+            ++m_stats.dropped;
+            return false;
+        }
+        items.push_back(item);
+        return true;
+    }
+
+    std::vector<Contact> m_contacts;
+    std::vector<Point> m_points;
+    std::vector<Trigger> m_triggers;
+    std::vector<PxActor*> m_slept;
+    std::vector<PxActor*> m_woken;
+
+    std::vector<PairSlot> m_pairTable;      // ũ 2 ŵ ( 뷮   ̻)
+    uint32_t m_generation = 1;
+
+    std::array<PxContactPairPoint, MaxPointsPerPair> m_scratch;
+
+    float m_impulseThreshold = 0.0f;
+    bool m_capturePoints = false;
+    Stats m_stats;
+};
@@ -1,42 +1,23 @@
 #include "pch.h"
 #include "ContactReportCallback.h"
-#include "Event.h"
-#include "EventManager.h"
 
 void ContactReportCallback::onContact(const PxContactPairHeader& pairHeader, const PxContactPair* pairs, PxU32 nbPairs)
 {
-    for (PxU32 i = 0; i < nbPairs; i++) {
-        const PxContactPair& cp = pairs[i];
-
-        // 浹 ̺Ʈ Ÿ Ȯ
-        if (cp.events & PxPairFlag::eNOTIFY_TOUCH_FOUND) {
-            // 浹 
-            Logger::Instance().Info("'{}'  '{}' 浹 ߻.",
-                pairHeader.actors[0]->getName(),
-                pairHeader.actors[1]->getName());
+    // ָ ̺Ʈ ϴ  ۿ  ΰ  ڵ尡 ӿ   
+    m_buffer.AddContacts(pairHeader, pairs, nbPairs);
+}
 
-            //   
-            PxContactPairPoint contacts[1];
-            PxU32 nbContacts = cp.extractContacts(contacts, 1);
+void ContactReportCallback::onWake(PxActor** actors, PxU32 count)
+{
+    m_buffer.AddSleep(actors, count, false);
+}
 
-			// 浹 ̺Ʈ 
-            if (nbContacts > 0) {
-                Event::CollisionEvent event(
-                    pairHeader.actors[0],
-                    pairHeader.actors[1],
-                    contacts[0].position,
-                    contacts[0].normal,
-                    contacts[0].impulse.magnitude()
-                    );
+void ContactReportCallback::onSleep(PxActor** actors, PxU32 count)
+{
+    m_buffer.AddSleep(actors, count, true);
+}
 
-                EventManager::Instance().Publish(event);
-            }
-        }
-        else if (cp.events & PxPairFlag::eNOTIFY_TOUCH_LOST) {
-            // 浹 
-            Logger::Instance().Info("'{}'  '{}' 浹 .",
-                pairHeader.actors[0]->getName(),
-                pairHeader.actors[1]->getName());
-        }
-    }
+void ContactReportCallback::onTrigger(PxTriggerPair* pairs, PxU32 count)
+{
+    m_buffer.AddTriggers(pairs, count);
 }
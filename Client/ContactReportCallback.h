@@ -1,15 +1,21 @@
 #pragma once
 #include "PhysX/include/PxSimulationEventCallback.h"
-#include "Logger.h"
+#include "ContactBuffer.h"
 
+// ùķ̼ ̺Ʈ PhysicsEngine ContactBuffer  (fetchResults ȿ ȣ)
 class ContactReportCallback : public PxSimulationEventCallback {
 public:
+    explicit ContactReportCallback(ContactBuffer& buffer) : m_buffer(buffer) {}
+
     void onContact(const PxContactPairHeader& pairHeader,
         const PxContactPair* pairs, PxU32 nbPairs) override;
 
     void onConstraintBreak(PxConstraintInfo* constraints, PxU32 count) override {}
-    void onWake(PxActor** actors, PxU32 count) override {}
-    void onSleep(PxActor** actors, PxU32 count) override {}
-    void onTrigger(PxTriggerPair* pairs, PxU32 count) override {}
+    void onWake(PxActor** actors, PxU32 count) override;
+    void onSleep(PxActor** actors, PxU32 count) override;
+    void onTrigger(PxTriggerPair* pairs, PxU32 count) override;
     void onAdvance(const PxRigidBody* const* bodyBuffer, const PxTransform* poseBuffer, const PxU32 count) override {}
+
+private:
+    ContactBuffer& m_buffer;
 };
\ No newline at end of file
@@ -0,0 +1,155 @@
+#include "pch.h"
+#include "D3DShaderCompiler.h"
+#include "ArchiveManager.h"
+
+namespace Resource
+{
+    namespace
+    {
+        //   (Ű  Ǵ ũ  )
+        struct SourceData {
+            AssetData asset;
+            std::vector<char> buffer;
+
+            const void* data() const { return asset ? static_cast<const void*>(asset.data()) : buffer.data(); }
+            size_t size() const { return asset ? asset.size() : buffer.size(); }
+        };
+
+        bool ReadSource(const std::string& path, SourceData& source)
+        {
+            if (auto asset = ArchiveManager::Instance().Find(path)) {
+                source.asset = std::move(asset);
+                return true;
+            }
+
+            std::ifstream file(path, std::ios::binary | std::ios::ate);
+            if (!file) {
+                return false;
+            }
+            source.buffer.resize(static_cast<size_t>(file.tellg()));
+            file.seekg(0);
+            file.read(source.buffer.data(), source.buffer.size());
+            return static_cast<bool>(file);
+        }
+
+        // #include Ű  ã,    
+        class IncludeHandler : public ID3DInclude {
+        public:
+            explicit IncludeHandler(std::filesystem::path baseDir)
+                : m_baseDir(std::move(baseDir)) {
+            }
+
+            HRESULT __stdcall Open(D3D_INCLUDE_TYPE, LPCSTR fileName, LPCVOID,
+                LPCVOID* data, UINT* bytes) override {
+                const auto path = (m_baseDir / fileName).generic_string();
+
+                SourceData source;
+                if (!ReadSource(path, source)) {
+                    return E_FAIL;
+                }
+
+                *data = source.data();
+                *bytes = static_cast<UINT>(source.size());
+                m_opened.push_back(path);
+                m_sources.push_back(std::move(source));  // ó   
+                return S_OK;
+            }
+
+            HRESULT __stdcall Close(LPCVOID) override {
+                return S_OK;
+            }
+
+            std::vector<std::string>& GetOpened() { return m_opened; }
+
+        private:
+            std::filesystem::path m_baseDir;
+            std::vector<std::string> m_opened;
+            std::vector<SourceData> m_sources;  // ̵ص / ּҴ 
+        };
+
+        std::string ToString(ID3DBlob* blob)
+        {
+            if (!blob) return {};
+            return std::string(static_cast<const char*>(blob->GetBufferPointer()), blob->GetBufferSize());
+        }
+    }
+
+    std::string D3DShaderCompiler::GetVersion() const
+    {
+        return "d3dcompiler_" + std::to_string(D3D_COMPILER_VERSION);
+    }
+
+    bool D3DShaderCompiler::Preprocess(const ShaderCompileRequest& request,
+        PreprocessedShader& result, std::string& errors)
+    {
+        SourceData source;
+        if (!ReadSource(request.path, source)) {
+            errors = "̴  ã  ϴ.";
+            return false;
+        }
+
+        // η  ũ 迭 (ڿ request )
+        std::vector<D3D_SHADER_MACRO> macros;
+        macros.reserve(request.defines.size() + 1);
+        for (const auto& [name, value] : request.defines) {
+            macros.push_back({ name.c_str(), value.c_str() });
+        }
+        macros.push_back({ nullptr, nullptr });
+
+        IncludeHandler include(std::filesystem::path(request.path).parent_path());
+        ComPtr<ID3DBlob> codeBlob;
+        ComPtr<ID3DBlob> errorBlob;
+
+        HRESULT hr = D3DPreprocess(
+            source.data(),
+            source.size(),
+            request.path.c_str(),
+            macros.data(),
+            &include,
+            &codeBlob,
+            &errorBlob);
+
+        if (FAILED(hr)) {
+            errors = errorBlob ? ToString(errorBlob.Get()) : "Unknown error";
+            return false;
+        }
+
+        //     ڸ 
+        result.source = ToString(codeBlob.Get());
+        while (!result.source.empty() && result.source.back() == '\0') {
+            result.source.pop_back();
+        }
+        result.includes = std::move(include.GetOpened());
+        return true;
+    }
+
+    bool D3DShaderCompiler::Compile(const ShaderCompileRequest& request, const PreprocessedShader& source,
+        std::vector<uint8_t>& bytecode, std::string& errors)
+    {
+        ComPtr<ID3DBlob> shaderBlob;
+        ComPtr<ID3DBlob> errorBlob;
+
+        // ũο #include ̹ Ǿ Ƿ ״ 
+        HRESULT hr = D3DCompile(
+            source.source.data(),
+            source.source.size(),
+            request.path.c_str(),
+            nullptr,
+            nullptr,
+            request.entryPoint.c_str(),
+            request.target.c_str(),
+            request.flags,
+            0,
+            &shaderBlob,
+            &errorBlob);
+
+        if (FAILED(hr)) {
+            errors = errorBlob ? ToString(errorBlob.Get()) : "Unknown error";
+            return false;
+        }
+
+        const auto* bytes = static_cast<const uint8_t*>(shaderBlob->GetBufferPointer());
+        bytecode.assign(bytes, bytes + shaderBlob->GetBufferSize());
+        return true;
+    }
+}
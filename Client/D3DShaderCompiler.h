@@ -0,0 +1,19 @@
+#pragma once
+#include "pch.h"
+#include "ShaderCompiler.h"
+
+namespace Resource
+{
+    // D3DCompiler  
+    // - ҽ #include Ʈ Ű  ã,  ũ 
+    class D3DShaderCompiler : public IShaderCompiler {
+    public:
+        std::string GetVersion() const override;
+
+        bool Preprocess(const ShaderCompileRequest& request,
+            PreprocessedShader& result, std::string& errors) override;
+
+        bool Compile(const ShaderCompileRequest& request, const PreprocessedShader& source,
+            std::vector<uint8_t>& bytecode, std::string& errors) override;
+    };
+}
@@ -0,0 +1,295 @@
+#include "pch.h"
+#include "DDSHeader.h"
+#include "TextureFormat.h"
+
+namespace Resource::DDS
+{
+    namespace
+    {
+        //  ÷
+        constexpr uint32_t HeaderFlagCaps = 0x00000001;
+        constexpr uint32_t HeaderFlagHeight = 0x00000002;
+        constexpr uint32_t HeaderFlagWidth = 0x00000004;
+        constexpr uint32_t HeaderFlagPitch = 0x00000008;
+        constexpr uint32_t HeaderFlagPixelFormat = 0x00001000;
+        constexpr uint32_t HeaderFlagMipMapCount = 0x00020000;
+        constexpr uint32_t HeaderFlagLinearSize = 0x00080000;
+        constexpr uint32_t HeaderFlagDepth = 0x00800000;
+
+        // caps
+        constexpr uint32_t CapsComplex = 0x00000008;
+        constexpr uint32_t CapsTexture = 0x00001000;
+        constexpr uint32_t CapsMipMap = 0x00400000;
+
+        // ȼ  ÷
+        constexpr uint32_t PixelAlpha = 0x00000002;
+        constexpr uint32_t PixelFourCC = 0x00000004;
+        constexpr uint32_t PixelRGB = 0x00000040;
+        constexpr uint32_t PixelLuminance = 0x00020000;
+        constexpr uint32_t PixelBumpDuDv = 0x00080000;
+
+        // caps2
+        constexpr uint32_t Caps2Cubemap = 0x00000200;
+        constexpr uint32_t Caps2CubemapAllFaces = 0x0000FC00;
+        constexpr uint32_t Caps2Volume = 0x00200000;
+
+        // DX10 Ȯ
+        constexpr uint32_t MiscTextureCube = 0x4;
+
+        constexpr uint32_t MakeFourCC(char a, char b, char c, char d) {
+            return static_cast<uint32_t>(static_cast<uint8_t>(a)) |
+                (static_cast<uint32_t>(static_cast<uint8_t>(b)) << 8) |
+                (static_cast<uint32_t>(static_cast<uint8_t>(c)) << 16) |
+                (static_cast<uint32_t>(static_cast<uint8_t>(d)) << 24);
+        }
+
+        bool HasMasks(const PixelFormat& pf, uint32_t r, uint32_t g, uint32_t b, uint32_t a) {
+            return pf.rBitMask == r && pf.gBitMask == g && pf.bBitMask == b && pf.aBitMask == a;
+        }
+
+        // DX10 Ȯ   DDS ȼ  ȯ ( ̴ ˸)
+        DXGI_FORMAT ToDXGIFormat(const PixelFormat& pf)
+        {
+            if (pf.flags & PixelRGB) {
+                switch (pf.rgbBitCount) {
+                case 32:
+                    if (HasMasks(pf, 0x000000ff, 0x0000ff00, 0x00ff0000, 0xff000000)) return DXGI_FORMAT_R8G8B8A8_UNORM;
+                    if (HasMasks(pf, 0x00ff0000, 0x0000ff00, 0x000000ff, 0xff000000)) return DXGI_FORMAT_B8G8R8A8_UNORM;
+                    if (HasMasks(pf, 0x00ff0000, 0x0000ff00, 0x000000ff, 0)) return DXGI_FORMAT_B8G8R8X8_UNORM;
+                    if (HasMasks(pf, 0x3ff00000, 0x000ffc00, 0x000003ff, 0xc0000000)) return DXGI_FORMAT_R10G10B10A2_UNORM;
+                    if (HasMasks(pf, 0x0000ffff, 0xffff0000, 0, 0)) return DXGI_FORMAT_R16G16_UNORM;
+                    if (HasMasks(pf, 0xffffffff, 0, 0, 0)) return DXGI_FORMAT_R32_FLOAT;
+                    break;
+                case 16:
+                    if (HasMasks(pf, 0x7c00, 0x03e0, 0x001f, 0x8000)) return DXGI_FORMAT_B5G5R5A1_UNORM;
+                    if (HasMasks(pf, 0xf800, 0x07e0, 0x001f, 0)) return DXGI_FORMAT_B5G6R5_UNORM;
+                    if (HasMasks(pf, 0x0f00, 0x00f0, 0x000f, 0xf000)) return DXGI_FORMAT_B4G4R4A4_UNORM;
+                    break;
+                }
+            }
+            else if (pf.flags & PixelLuminance) {
+                if (pf.rgbBitCount == 8 && HasMasks(pf, 0xff, 0, 0, 0)) return DXGI_FORMAT_R8_UNORM;
+                if (pf.rgbBitCount == 16 && HasMasks(pf, 0xffff, 0, 0, 0)) return DXGI_FORMAT_R16_UNORM;
+                if (pf.rgbBitCount == 16 && HasMasks(pf, 0x00ff, 0, 0, 0xff00)) return DXGI_FORMAT_R8G8_UNORM;
+            }
+            else if (pf.flags & PixelAlpha) {
+                if (pf.rgbBitCount == 8) return DXGI_FORMAT_A8_UNORM;
+            }
+            else if (pf.flags & PixelBumpDuDv) {
+                if (pf.rgbBitCount == 16 && HasMasks(pf, 0x00ff, 0xff00, 0, 0)) return DXGI_FORMAT_R8G8_SNORM;
+                if (pf.rgbBitCount == 32 && HasMasks(pf, 0x000000ff, 0x0000ff00, 0x00ff0000, 0xff000000)) return DXGI_FORMAT_R8G8B8A8_SNORM;
+                if (pf.rgbBitCount == 32 && HasMasks(pf, 0x0000ffff, 0xffff0000, 0, 0)) return DXGI_FORMAT_R16G16_SNORM;
+            }
+            else if (pf.flags & PixelFourCC) {
+                switch (pf.fourCC) {
+                case MakeFourCC('D', 'X', 'T', '1'): return DXGI_FORMAT_BC1_UNORM;
+                case MakeFourCC('D', 'X', 'T', '2'):
+                case MakeFourCC('D', 'X', 'T', '3'): return DXGI_FORMAT_BC2_UNORM;
+                case MakeFourCC('D', 'X', 'T', '4'):
+                case MakeFourCC('D', 'X', 'T', '5'): return DXGI_FORMAT_BC3_UNORM;
+                case MakeFourCC('A', 'T', 'I', '1'):
+                case MakeFourCC('B', 'C', '4', 'U'): return DXGI_FORMAT_BC4_UNORM;
+                case MakeFourCC('B', 'C', '4', 'S'): return DXGI_FORMAT_BC4_SNORM;
+                case MakeFourCC('A', 'T', 'I', '2'):
+                case MakeFourCC('B', 'C', '5', 'U'): return DXGI_FORMAT_BC5_UNORM;
+                case MakeFourCC('B', 'C', '5', 'S'): return DXGI_FORMAT_BC5_SNORM;
+                case MakeFourCC('R', 'G', 'B', 'G'): return DXGI_FORMAT_R8G8_B8G8_UNORM;
+                case MakeFourCC('G', 'R', 'G', 'B'): return DXGI_FORMAT_G8R8_G8B8_UNORM;
+                case MakeFourCC('Y', 'U', 'Y', '2'): return DXGI_FORMAT_YUY2;
+                // D3DFORMAT   ϵ 
+                case 36:  return DXGI_FORMAT_R16G16B16A16_UNORM;
+                case 110: return DXGI_FORMAT_R16G16B16A16_SNORM;
+                case 111: return DXGI_FORMAT_R16_FLOAT;
+                case 112: return DXGI_FORMAT_R16G16_FLOAT;
+                case 113: return DXGI_FORMAT_R16G16B16A16_FLOAT;
+                case 114: return DXGI_FORMAT_R32_FLOAT;
+                case 115: return DXGI_FORMAT_R32G32_FLOAT;
+                case 116: return DXGI_FORMAT_R32G32B32A32_FLOAT;
+                }
+            }
+            return DXGI_FORMAT_UNKNOWN;
+        }
+
+        uint32_t FullMipCount(uint32_t width, uint32_t height, uint32_t depth)
+        {
+            uint32_t largest = std::max({ width, height, depth });
+            uint32_t count = 1;
+            while (largest > 1) {
+                largest >>= 1;
+                ++count;
+            }
+            return count;
+        }
+    }
+
+    uint32_t Layout::GetFirstMipWithin(uint32_t maxDimension) const
+    {
+        for (uint32_t mip = 0; mip < mipCount; ++mip) {
+            const auto& sub = subresources[mip];
+            if (sub.width <= maxDimension && sub.height <= maxDimension) {
+                return mip;
+            }
+        }
+        return mipCount - 1;
+    }
+
+    uint64_t Layout::GetMipTailSize(uint32_t firstMip) const
+    {
+        uint64_t total = 0;
+        for (uint32_t slice = 0; slice < arraySize; ++slice) {
+            for (uint32_t mip = firstMip; mip < mipCount; ++mip) {
+                total += GetSubresource(mip, slice).size;
+            }
+        }
+        return total;
+    }
+
+    std::optional<Layout> ParseHeader(std::span<const uint8_t> header, uint64_t fileSize)
+    {
+        constexpr size_t BaseSize = sizeof(uint32_t) + sizeof(Header);
+        if (header.size() < BaseSize || fileSize < BaseSize) {
+            return std::nullopt;
+        }
+
+        uint32_t magic;
+        std::memcpy(&magic, header.data(), sizeof(magic));
+        Header dds;
+        std::memcpy(&dds, header.data() + sizeof(uint32_t), sizeof(dds));
+
+        if (magic != Magic || dds.size != sizeof(Header) || dds.pixelFormat.size != sizeof(PixelFormat)) {
+            return std::nullopt;
+        }
+
+        Layout layout;
+        layout.width = std::max(dds.width, 1u);
+        layout.height = std::max(dds.height, 1u);
+        layout.depth = 1;
+        layout.arraySize = 1;
+        layout.dataOffset = BaseSize;
+
+        const bool hasDX10 = (dds.pixelFormat.flags & PixelFourCC) &&
+            dds.pixelFormat.fourCC == MakeFourCC('D', 'X', '1', '0');
+
+        if (hasDX10) {
+            if (header.size() < MaxHeaderSize || fileSize < MaxHeaderSize) {
+                return std::nullopt;
+            }
+            HeaderDX10 dx10;
+            std::memcpy(&dx10, header.data() + BaseSize, sizeof(dx10));
+            layout.dataOffset = MaxHeaderSize;
+
+            layout.format = static_cast<DXGI_FORMAT>(dx10.dxgiFormat);
+            layout.arraySize = dx10.arraySize;
+            if (layout.arraySize == 0) {
+                return std::nullopt;
+            }
+
+            switch (dx10.resourceDimension) {
+            case D3D12_RESOURCE_DIMENSION_TEXTURE1D:
+                layout.dimension = D3D12_RESOURCE_DIMENSION_TEXTURE1D;
+                layout.height = 1;
+                break;
+            case D3D12_RESOURCE_DIMENSION_TEXTURE2D:
+                layout.dimension = D3D12_RESOURCE_DIMENSION_TEXTURE2D;
+                if (dx10.miscFlag & MiscTextureCube) {
+                    layout.isCube = true;
+                    layout.arraySize *= 6;
+                }
+                break;
+            case D3D12_RESOURCE_DIMENSION_TEXTURE3D:
+                if (layout.arraySize != 1) return std::nullopt;
+                layout.dimension = D3D12_RESOURCE_DIMENSION_TEXTURE3D;
+                layout.depth = std::max(dds.depth, 1u);
+                break;
+            default:
+                return std::nullopt;
+            }
+        }
+        else {
+            layout.format = ToDXGIFormat(dds.pixelFormat);
+
+            if ((dds.flags & HeaderFlagDepth) && (dds.caps2 & Caps2Volume)) {
+                layout.dimension = D3D12_RESOURCE_DIMENSION_TEXTURE3D;
+                layout.depth = std::max(dds.depth, 1u);
+            }
+            else {
+                layout.dimension = D3D12_RESOURCE_DIMENSION_TEXTURE2D;
+                if (dds.caps2 & Caps2Cubemap) {
+                    // Ϻ 鸸 ִ ť  
+                    if ((dds.caps2 & Caps2CubemapAllFaces) != Caps2CubemapAllFaces) {
+                        return std::nullopt;
+                    }
+                    layout.isCube = true;
+                    layout.arraySize = 6;
+                }
+            }
+        }
+
+        if (layout.format == DXGI_FORMAT_UNKNOWN || TextureFormat::BitsPerPixel(layout.format) == 0) {
+            return std::nullopt;
+        }
+
+        const uint32_t maxMips = FullMipCount(layout.width, layout.height, layout.depth);
+        layout.mipCount = dds.mipMapCount == 0 ? 1 : dds.mipMapCount;
+        if (layout.mipCount > maxMips) {
+            return std::nullopt;
+        }
+
+        //   긮ҽ ġ: ̽    
+        layout.subresources.reserve(static_cast<size_t>(layout.arraySize) * layout.mipCount);
+        uint64_t offset = layout.dataOffset;
+        for (uint32_t slice = 0; slice < layout.arraySize; ++slice) {
+            for (uint32_t mip = 0; mip < layout.mipCount; ++mip) {
+                Subresource sub;
+                sub.width = static_cast<uint32_t>(TextureFormat::MipDimension(layout.width, mip));
+                sub.height = static_cast<uint32_t>(TextureFormat::MipDimension(layout.height, mip));
+                sub.depth = static_cast<uint32_t>(TextureFormat::MipDimension(layout.depth, mip));
+
+                const auto surface = TextureFormat::GetSurfaceInfo(layout.format, sub.width, sub.height);
+                sub.rowPitch = surface.rowPitch;
+                sub.slicePitch = surface.slicePitch;
+                sub.offset = offset;
+                sub.size = static_cast<uint64_t>(surface.slicePitch) * sub.depth;
+
+                offset += sub.size;
+                if (offset > fileSize) {
+                    return std::nullopt;  // ߸ 
+                }
+                layout.subresources.push_back(sub);
+            }
+        }
+
+        return layout;
+    }
+
+    std::vector<uint8_t> CreateHeader(DXGI_FORMAT format, uint32_t width, uint32_t height, uint32_t mipCount)
+    {
+        const bool blockCompressed = TextureFormat::IsBlockCompressed(format);
+        const auto surface = TextureFormat::GetSurfaceInfo(format, width, height);
+
+        Header dds = {};
+        dds.size = sizeof(Header);
+        dds.flags = HeaderFlagCaps | HeaderFlagHeight | HeaderFlagWidth | HeaderFlagPixelFormat |
+            (blockCompressed ? HeaderFlagLinearSize : HeaderFlagPitch) | (mipCount > 1 ? HeaderFlagMipMapCount : 0);
+        dds.height = height;
+        dds.width = width;
+        dds.pitchOrLinearSize = static_cast<uint32_t>(blockCompressed ? surface.slicePitch : surface.rowPitch);
+        dds.depth = 1;
+        dds.mipMapCount = mipCount;
+        dds.pixelFormat.size = sizeof(PixelFormat);
+        dds.pixelFormat.flags = PixelFourCC;
+        dds.pixelFormat.fourCC = MakeFourCC('D', 'X', '1', '0');
+        dds.caps = CapsTexture | (mipCount > 1 ? CapsComplex | CapsMipMap : 0);
+
+        HeaderDX10 dx10 = {};
+        dx10.dxgiFormat = format;
+        dx10.resourceDimension = D3D12_RESOURCE_DIMENSION_TEXTURE2D;
+        dx10.arraySize = 1;
+
+        std::vector<uint8_t> bytes(MaxHeaderSize);
+        std::memcpy(bytes.data(), &Magic, sizeof(Magic));
+        std::memcpy(bytes.data() + sizeof(uint32_t), &dds, sizeof(dds));
+        std::memcpy(bytes.data() + sizeof(uint32_t) + sizeof(dds), &dx10, sizeof(dx10));
+        return bytes;
+    }
+}
@@ -0,0 +1,96 @@
+#pragma once
+#include "pch.h"
+
+namespace Resource
+{
+    // DDS  긮ҽ ġ ؼ (GPU   )
+    namespace DDS
+    {
+        constexpr uint32_t Magic = 0x20534444;  // "DDS "
+
+        struct PixelFormat {
+            uint32_t size;
+            uint32_t flags;
+            uint32_t fourCC;
+            uint32_t rgbBitCount;
+            uint32_t rBitMask;
+            uint32_t gBitMask;
+            uint32_t bBitMask;
+            uint32_t aBitMask;
+        };
+
+        struct Header {
+            uint32_t size;
+            uint32_t flags;
+            uint32_t height;
+            uint32_t width;
+            uint32_t pitchOrLinearSize;
+            uint32_t depth;
+            uint32_t mipMapCount;
+            uint32_t reserved1[11];
+            PixelFormat pixelFormat;
+            uint32_t caps;
+            uint32_t caps2;
+            uint32_t caps3;
+            uint32_t caps4;
+            uint32_t reserved2;
+        };
+        static_assert(sizeof(Header) == 124);
+
+        struct HeaderDX10 {
+            uint32_t dxgiFormat;
+            uint32_t resourceDimension;
+            uint32_t miscFlag;
+            uint32_t arraySize;
+            uint32_t miscFlags2;
+        };
+        static_assert(sizeof(HeaderDX10) == 20);
+
+        //  ؼ ʿ ִ Ʈ  ( +  + DX10 Ȯ)
+        constexpr size_t MaxHeaderSize = sizeof(uint32_t) + sizeof(Header) + sizeof(HeaderDX10);
+
+        // 긮ҽ ϳ ( ϳ, 迭 ̽ ϳ)
+        struct Subresource {
+            uint64_t offset = 0;    //   
+            uint64_t size = 0;
+            size_t rowPitch = 0;
+            size_t slicePitch = 0;  //  ̽ ϳ ũ
+            uint32_t width = 0;
+            uint32_t height = 0;
+            uint32_t depth = 0;
+        };
+
+        struct Layout {
+            DXGI_FORMAT format = DXGI_FORMAT_UNKNOWN;
+            D3D12_RESOURCE_DIMENSION dimension = D3D12_RESOURCE_DIMENSION_UNKNOWN;
+            uint32_t width = 0;
+            uint32_t height = 0;
+            uint32_t depth = 0;
+            uint32_t mipCount = 0;
+            uint32_t arraySize = 0;     // ť  (6 )
+            bool isCube = false;
+            uint64_t dataOffset = 0;
+
+            // D3D12 긮ҽ  (slice * mipCount + mip)
+            std::vector<Subresource> subresources;
+
+            const Subresource& GetSubresource(uint32_t mip, uint32_t slice) const {
+                return subresources[static_cast<size_t>(slice) * mipCount + mip];
+            }
+
+            // μΰ maxDimension   ū  (  )
+            uint32_t GetFirstMipWithin(uint32_t maxDimension) const;
+
+            // [firstMip, mipCount) ӵ ü ̽ հ ũ
+            uint64_t GetMipTailSize(uint32_t firstMip) const;
+        };
+
+        // header  պκ ּ MaxHeaderSize Ʈ(Ǵ  ü) 
+        // fileSize 긮ҽ  ȿ ִ ˻ϴ  
+        //  ʰų ջ  nullopt
+        std::optional<Layout> ParseHeader(std::span<const uint8_t> header, uint64_t fileSize);
+
+        // 2D ؽó  +  + DX10 Ȯ (MaxHeaderSize Ʈ). ڿ  0 ͸ ̾  
+        std::vector<uint8_t> CreateHeader(DXGI_FORMAT format, uint32_t width, uint32_t height, uint32_t mipCount);
+    }
+}
@@ -5,6 +5,12 @@
 #include "MemoryManager.h"
 #include "EventManager.h"
 #include "ResourceManager.h"
+#include "ArchiveManager.h"
+#include "ShaderCache.h"
+#include "GraphicsDevice.h"
+#include "AudioMixer.h"
+#include "TaskSystem.h"
+#include "D3DShaderCompiler.h"
 #include "Logger.h"
 #include "Utils.h"
 
@@ -49,6 +55,28 @@ bool Engine::Initialize(HWND hwnd, UINT width, UINT height)
 		return false;
 	}
 
+	//  ۾  -  ҽ  ھ ŭ TBB Ŀ  
+	TaskSystem::Instance().Initialize();
+
+	//  Ű  Ʈ (  Ͽ ε)
+	if (std::filesystem::exists("Assets.pak")) {
+		Resource::ArchiveManager::Instance().Mount("Assets.pak");
+	}
+
+	// ϵ ̴ ĳ ( ҽ    )
+	Resource::ShaderCache::Instance().Initialize("ShaderCache",
+		std::make_unique<Resource::D3DShaderCompiler>());
+
+	//  忡 ۾ ͸   ؼ ٲ ҽ ٽ ε
+	IFDEBUG(
+		Resource::ResourceManager::Instance().EnableHotReload(".");
+	);
+
+	//  -  ġ   ͼ   
+	if (!Audio::AudioMixer::Instance().Initialize(std::make_unique<Audio::WasapiAudioSink>())) {
+		Audio::AudioMixer::Instance().Initialize(std::make_unique<Audio::NullAudioSink>());
+	}
+
 	// ̺Ʈ ڵ鷯 
 	RegisterEventHandlers();
 
@@ -70,6 +98,9 @@ bool Engine::Initialize(HWND hwnd, UINT width, UINT height)
 		Logger::Instance().Fatal("Ŀǵ ť  ");
 		return false;
 	}
+
+	// ҽ(ؽó, , ͸ ) ε Ŀ  ̽
+	GraphicsDevice::Instance().Initialize(m_device.Get(), m_commandQueue.Get());
 	if (!CreateSwapChain(hwnd)) {
 		Logger::Instance().Fatal("ü  ");
 		return false;
@@ -92,10 +123,6 @@ bool Engine::Initialize(HWND hwnd, UINT width, UINT height)
 		Logger::Instance().Fatal("Ʈ    ");
 		return false;
 	}
-	if (!CreateTexture(L"Texture/checker.dds")) {
-		Logger::Instance().Fatal("ؽó  ");
-		return false;
-	}
 	if (!CreateDescHeap()) {
 		Logger::Instance().Fatal("ũ   ");
 		return false;
@@ -116,6 +143,15 @@ bool Engine::Initialize(HWND hwnd, UINT width, UINT height)
 		Logger::Instance().Fatal("   ");
 		return false;
 	}
+
+	//  ǿ   ûߴ ҽ   ̸ ûϰ ̹ û  
+	Resource::ResourceManager::Instance().BeginLevel("Main");
+
+	// ť ͸ - ̴  ؽó غ  ü  ׸
+	m_material = Resource::ResourceManager::Instance().RequestResource<Resource::MaterialResource>("Material/checker.mat");
+
+	// 浹 - ªƼ ϹǷ 浹 ̺Ʈ ٷ 
+	m_impactSound = Resource::ResourceManager::Instance().RequestResource<Resource::SoundResource>("Sound/impact.wav");
 	if (!CreateVertexBuffer()) {
 		Logger::Instance().Fatal("   ");
 		return false;
@@ -131,6 +167,10 @@ bool Engine::Initialize(HWND hwnd, UINT width, UINT height)
 		Logger::Instance().Fatal("  ʱȭ ");
 		return false;
 	}
+	m_physicsEngine->SetFixedTimeStep(1.0f / 60.0f, 4);
+
+	// ¦ ų ׿   浹  ŭ  Ƿ  
+	m_physicsEngine->GetContactBuffer().SetImpulseThreshold(0.5f);
 
 	//  
 	m_ground = m_physicsEngine->CreateBox(
@@ -164,7 +204,7 @@ bool Engine::Initialize(HWND hwnd, UINT width, UINT height)
 
 	// ȸ ִϸ̼ ʱȭ
 	m_rotationAngle = 0.0f;
-	m_lastTick = GetTickCount64();
+	m_lastFrameTime = std::chrono::steady_clock::now();
 
 	Logger::Instance().Info("Engine ʱȭ Ϸ");
 	return true;
@@ -175,22 +215,27 @@ void Engine::Update()
 	//  ޸ ʱȭ
 	Memory::BeginFrameMemory();
 
+	// Ϸ ҽ ε     ʰ  
+	Resource::ResourceManager::Instance().ProcessLoadingQueue();
+	Resource::ResourceManager::Instance().ProcessHotReload();
+	Resource::ResourceManager::Instance().EvictUnderPressure(std::chrono::microseconds(500));
+	Resource::ResourceManager::Instance().UpdateTextureStreaming(2);
+
 	//  ť ִ ̺Ʈ ó
 	EventManager::Instance().Update();
 	
-	// Ÿ ð 
-	ULONGLONG currentTick = GetTickCount64();
-	float deltaTime = (currentTick - m_lastTick) / 1000.0f;
-	m_lastTick = currentTick;
+	// Ÿ ð  (steady_clock QPC ̶ GetTickCount64 15ms  ȭ )
+	const auto currentTime = std::chrono::steady_clock::now();
+	const float deltaTime = std::chrono::duration<float>(currentTime - m_lastFrameTime).count();
+	m_lastFrameTime = currentTime;
 
-	// deltaTime 0  ּҰ 
-	if (deltaTime <= 0.0f) {
-		deltaTime = 1.0f / 600.0f;  // ⺻  Ʈ
-		//Logger::Instance().Warning("0 Ǵ  DT , ⺻  : {}", deltaTime);
-	}
+	//     -    (浹 ̺Ʈ ⼭ )
+	//   ̸   ħ. ȭ鿡   ¸ ؼ ׸
+	m_physicsEngine->Advance(deltaTime);
+	ProcessContacts();
 
-	//   Ʈ
-	m_physicsEngine->Update(deltaTime);
+	//  ̽ ȸ
+	Audio::AudioMixer::Instance().Update();
 
 	//   Ʈ
 	UpdateWorldMatrix();
@@ -215,8 +260,11 @@ void Engine::Update()
 
 void Engine::Render()
 {
+	// ̹ ӿ  ͸ (ε ̸ ü ,  ؽó, ⺻ )
+	const Resource::MaterialResource* material = m_material && m_material->IsReady() ? m_material.get() : nullptr;
+
 	ThrowIfFailed(m_commandAllocator->Reset());
-	ThrowIfFailed(m_commandList->Reset(m_commandAllocator.Get(), m_pipelineState.Get()));
+	ThrowIfFailed(m_commandList->Reset(m_commandAllocator.Get(), SelectPipelineState(material)));
 
 	//   Ʈ
 	UpdateConstantBuffer();
@@ -243,10 +291,16 @@ void Engine::Render()
 	lightCbvHandle.Offset(m_device->GetDescriptorHandleIncrementSize(D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV));
 	m_commandList->SetGraphicsRootDescriptorTable(1, lightCbvHandle);
 
-	// Texture SRV  ( ° ġ)
-	CD3DX12_GPU_DESCRIPTOR_HANDLE textureSrvHandle(m_descHeap->GetGPUDescriptorHandleForHeapStart());
-	textureSrvHandle.Offset(2, m_device->GetDescriptorHandleIncrementSize(D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV));
-	m_commandList->SetGraphicsRootDescriptorTable(2, textureSrvHandle);
+	// ͸ ؽó ̺ ( ° ġ)
+	RequestTextureMips(material, m_worldMatrix);
+	m_commandList->SetGraphicsRootDescriptorTable(2, GetTextureTable(material));
+
+	// ͸  CBV ( ° ġ) -  ּҸ ε
+	const D3D12_GPU_VIRTUAL_ADDRESS materialConstants = material && material->GetConstantsAddress()
+		? material->GetConstantsAddress() : m_defaultMaterialConstants.GetGpuAddress();
+	if (materialConstants) {
+		m_commandList->SetGraphicsRootConstantBufferView(3, materialConstants);
+	}
 
 	// ҽ 踮
 	CD3DX12_RESOURCE_BARRIER barrier = CD3DX12_RESOURCE_BARRIER::Transition(
@@ -297,19 +351,54 @@ void Engine::Cleanup()
 
 	UnregisterEventHandlers();
 
+	// ҽ    ε ũⰡ Ŵ佺Ʈ 
+	Resource::ResourceManager::Instance().EndLevel();
+
+	// ͼ 带     带   
+	Audio::AudioMixer::Instance().Shutdown();
+	m_impactSound.reset();
+
+	m_material.reset();
+	m_textureTables.clear();
+	m_defaultMaterialConstants.Reset();
+
 	m_physicsEngine.reset();
 
+	//    ڶ  PhysX ۾ 
+	TaskSystem::Instance().Shutdown();
+
     CloseHandle(m_fenceEvent);
 }
 
 void Engine::UpdateWorldMatrix()
 {
+	// ֱ ܿ  ü   ٽ  ( ü ĳõ  ״)
+	m_physicsEngine->UpdateRenderMatrices();
+
 	if (m_physicsBox) {
 		//  ü ȯ  ͼ     Ʈ
 		m_worldMatrix = m_physicsBox->GetTransformMatrix();
 	}
 }
 
+void Engine::ProcessContacts()
+{
+	if (!m_impactSound || !m_impactSound->IsReady()) {
+		return;
+	}
+
+	//   ָ 浹 - ͼ  ť ֱ⸸  (Ҵ/ )
+	for (const auto& contact : m_physicsEngine->GetContacts().GetContacts()) {
+		if (!contact.Has(ContactBuffer::Contact::Found)) {
+			continue;
+		}
+		Audio::PlayParams params;
+		params.volume = std::clamp(contact.impulse * 0.1f, 0.05f, 1.0f);
+		params.pan = std::clamp(contact.position.x * 0.2f, -1.0f, 1.0f);
+		Audio::AudioMixer::Instance().Play(m_impactSound, params);
+	}
+}
+
 bool Engine::CreateDevice()
 {
 	ComPtr<IDXGIFactory7> factory;
@@ -509,15 +598,15 @@ bool Engine::CreateRootSignature()
 	ranges[1].RegisterSpace = 0;
 	ranges[1].OffsetInDescriptorsFromTableStart = D3D12_DESCRIPTOR_RANGE_OFFSET_APPEND;
 
-	// ؽó range
+	// ͸ ؽó range
 	ranges[2].RangeType = D3D12_DESCRIPTOR_RANGE_TYPE_SRV;
-	ranges[2].NumDescriptors = 1;
-	ranges[2].BaseShaderRegister = 0;	// t0 
+	ranges[2].NumDescriptors = Resource::MaterialResource::MaxTextures;
+	ranges[2].BaseShaderRegister = 0;	// t0 ~ t3 
 	ranges[2].RegisterSpace = 0;
 	ranges[2].OffsetInDescriptorsFromTableStart = D3D12_DESCRIPTOR_RANGE_OFFSET_APPEND;
 
 	// Ʈ Ķ 
-	D3D12_ROOT_PARAMETER rootParameters[3] = {};
+	D3D12_ROOT_PARAMETER rootParameters[4] = {};
 
 	// ȯ Ŀ Ķ
 	rootParameters[0].ParameterType = D3D12_ROOT_PARAMETER_TYPE_DESCRIPTOR_TABLE;
@@ -537,6 +626,12 @@ bool Engine::CreateRootSignature()
 	rootParameters[2].DescriptorTable.pDescriptorRanges = &ranges[2];
 	rootParameters[2].ShaderVisibility = D3D12_SHADER_VISIBILITY_PIXEL;
 
+	// ͸  Ķ - ͸󸶴  ּҸ ٲٹǷ ũ  Ʈ CBV
+	rootParameters[3].ParameterType = D3D12_ROOT_PARAMETER_TYPE_CBV;
+	rootParameters[3].Descriptor.ShaderRegister = 2;	// b2 
+	rootParameters[3].Descriptor.RegisterSpace = 0;
+	rootParameters[3].ShaderVisibility = D3D12_SHADER_VISIBILITY_ALL;
+
 	// Ʈ ñ״ó 
 	D3D12_ROOT_SIGNATURE_DESC rootSignatureDesc = {};
 	rootSignatureDesc.NumParameters = _countof(rootParameters);
@@ -562,6 +657,48 @@ bool Engine::CreatePipelineState()
 		return false;
 	}
 
+	// ü  PSO  , ͸ PSO ͸ غǴ  SelectPipelineState 
+	return BuildFallbackPipeline();
+}
+
+bool Engine::BuildFallbackPipeline()
+{
+	auto fallback = m_pixelShaders->Get(m_pixelShaders->GetFallback());
+	if (!fallback || !m_vertexShader->IsReady()) {
+		return false;
+	}
+
+	ID3DBlob* fallbackShader = fallback->GetShaderBlob();
+	auto pipelineState = BuildPipelineState(m_vertexShader->GetShaderBlob(), fallbackShader,
+		Resource::MaterialResource::BlendMode::Opaque, Resource::MaterialResource::CullMode::Back);
+	if (!pipelineState) {
+		return false;
+	}
+
+	// ͸ غǱ    - ̴  ʱⰪ
+	ID3DBlob* shaders[] = { fallbackShader, m_vertexShader->GetShaderBlob() };
+	const auto layout = Resource::MaterialLayout::Reflect(shaders);
+	Resource::MaterialConstantBuffer::Block constants;
+	if (!layout.IsEmpty()) {
+		constants = Resource::MaterialConstantBuffer::Instance().Allocate(layout.GetSize());
+		if (!constants) {
+			return false;
+		}
+		memcpy(constants.GetCpuAddress(), layout.GetDefaults().data(), layout.GetSize());
+	}
+
+	//   ڿ ü (ϸ   ״ )
+	m_pipelineState = std::move(pipelineState);
+	m_defaultMaterialConstants = std::move(constants);
+	return true;
+}
+
+ComPtr<ID3D12PipelineState> Engine::BuildPipelineState(ID3DBlob* vertexShader, ID3DBlob* pixelShader,
+	Resource::MaterialResource::BlendMode blend, Resource::MaterialResource::CullMode cull)
+{
+	using BlendMode = Resource::MaterialResource::BlendMode;
+	using CullMode = Resource::MaterialResource::CullMode;
+
 	//  Է ̾ƿ 
 	D3D12_INPUT_ELEMENT_DESC inputElementDescs[] =
 	{
@@ -579,12 +716,25 @@ bool Engine::CreatePipelineState()
 	D3D12_GRAPHICS_PIPELINE_STATE_DESC psoDesc = {};
 	psoDesc.InputLayout = { inputElementDescs, _countof(inputElementDescs) };
 	psoDesc.pRootSignature = m_rootSignature.Get();
-	psoDesc.VS = CD3DX12_SHADER_BYTECODE(m_vertexShader->GetShaderBlob());
-	psoDesc.PS = CD3DX12_SHADER_BYTECODE(m_pixelShader->GetShaderBlob());
+	psoDesc.VS = CD3DX12_SHADER_BYTECODE(vertexShader);
+	psoDesc.PS = CD3DX12_SHADER_BYTECODE(pixelShader);
 	psoDesc.RasterizerState = CD3DX12_RASTERIZER_DESC(D3D12_DEFAULT);
 	psoDesc.RasterizerState.FrontCounterClockwise = TRUE;
-	psoDesc.RasterizerState.CullMode = D3D12_CULL_MODE_BACK;
+	psoDesc.RasterizerState.CullMode =
+		cull == CullMode::None ? D3D12_CULL_MODE_NONE :
+		cull == CullMode::Front ? D3D12_CULL_MODE_FRONT : D3D12_CULL_MODE_BACK;
 	psoDesc.BlendState = CD3DX12_BLEND_DESC(D3D12_DEFAULT);
+	if (blend != BlendMode::Opaque) {
+		// : src * a + dst * (1 - a), : src * a + dst
+		auto& target = psoDesc.BlendState.RenderTarget[0];
+		target.BlendEnable = TRUE;
+		target.SrcBlend = D3D12_BLEND_SRC_ALPHA;
+		target.DestBlend = blend == BlendMode::Additive ? D3D12_BLEND_ONE : D3D12_BLEND_INV_SRC_ALPHA;
+		target.BlendOp = D3D12_BLEND_OP_ADD;
+		target.SrcBlendAlpha = D3D12_BLEND_ONE;
+		target.DestBlendAlpha = D3D12_BLEND_INV_SRC_ALPHA;
+		target.BlendOpAlpha = D3D12_BLEND_OP_ADD;
+	}
 	psoDesc.DepthStencilState.DepthEnable = FALSE;
 	psoDesc.DepthStencilState.StencilEnable = FALSE;
 	psoDesc.SampleMask = UINT_MAX;
@@ -593,7 +743,108 @@ bool Engine::CreatePipelineState()
 	psoDesc.RTVFormats[0] = DXGI_FORMAT_R8G8B8A8_UNORM;
 	psoDesc.SampleDesc.Count = 1;
 
-	return SUCCEEDED(m_device->CreateGraphicsPipelineState(&psoDesc, IID_PPV_ARGS(&m_pipelineState)));
+	ComPtr<ID3D12PipelineState> pipelineState;
+	if (FAILED(m_device->CreateGraphicsPipelineState(&psoDesc, IID_PPV_ARGS(&pipelineState)))) {
+		return nullptr;
+	}
+	return pipelineState;
+}
+
+ID3D12PipelineState* Engine::SelectPipelineState(const Resource::MaterialResource* material)
+{
+	// ͸  ε (̴ , ؽó ε)̸ ü  ׸
+	if (!material) {
+		return m_pipelineState.Get();
+	}
+
+	//  Ű  ͸ PSO ϳ 
+	auto& pipelineState = m_pipelineStates[material->GetPipelineKey()];
+	if (!pipelineState) {
+		pipelineState = BuildPipelineState(material->GetVertexShader()->GetShaderBlob(),
+			material->GetPixelShader()->GetShaderBlob(), material->GetBlendMode(), material->GetCullMode());
+		if (!pipelineState) {
+			Logger::Instance().Error("͸ PSO  : {} ({:016x})", material->GetPath(), material->GetPipelineKey());
+			m_pipelineStates.erase(material->GetPipelineKey());
+			return m_pipelineState.Get();
+		}
+	}
+	return pipelineState.Get();
+}
+
+D3D12_GPU_DESCRIPTOR_HANDLE Engine::GetTextureTable(const Resource::MaterialResource* material)
+{
+	using Resource::MaterialResource;
+
+	const UINT increment = m_device->GetDescriptorHandleIncrementSize(D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
+	const CD3DX12_GPU_DESCRIPTOR_HANDLE nullTable(m_descHeap->GetGPUDescriptorHandleForHeapStart(), TextureTableStart, increment);
+	if (!material) {
+		return nullTable;
+	}
+
+	// ؽó  ̺ ϳ -  ؽó  ͸ ̺ 
+	const uint16_t textureSetId = MaterialResource::GetTextureSetId(material->GetStateKey());
+	auto [it, inserted] = m_textureTables.try_emplace(textureSetId);
+	TextureTable& table = it->second;
+	if (inserted) {
+		if (m_textureTableCount >= MaxTextureTables) {
+			Logger::Instance().Warning("ؽó ̺ : {}", material->GetPath());
+			m_textureTables.erase(it);
+			return nullTable;
+		}
+		table.index = m_textureTableCount++;
+	}
+
+	// ؽó üǾų(ε)   ٲ(Ʈ) SRV ٽ 
+	//   GPU ٸǷ    ũ͸ ٷ ᵵ 
+	decltype(table.slots) slots = {};
+	for (uint32_t slot = 0; slot < MaterialResource::MaxTextures; ++slot) {
+		const auto& texture = material->GetTexture(slot);
+		if (texture && texture->IsReady() && texture->GetTexture()) {
+			slots[slot] = { texture->GetTexture(), texture->GetResidentMip() };
+		}
+	}
+
+	if (inserted || slots != table.slots) {
+		CD3DX12_CPU_DESCRIPTOR_HANDLE handle(m_descHeap->GetCPUDescriptorHandleForHeapStart(),
+			TextureTableStart + table.index * MaterialResource::MaxTextures, increment);
+		for (uint32_t slot = 0; slot < MaterialResource::MaxTextures; ++slot) {
+			if (slots[slot].resource) {
+				const auto srvDesc = material->GetTexture(slot)->GetSrvDesc();
+				m_device->CreateShaderResourceView(slots[slot].resource, &srvDesc, handle);
+			}
+			else {
+				CreateNullTextureView(handle);
+			}
+			handle.Offset(increment);
+		}
+		table.slots = slots;
+	}
+
+	return CD3DX12_GPU_DESCRIPTOR_HANDLE(nullTable, table.index * MaterialResource::MaxTextures, increment);
+}
+
+void Engine::RequestTextureMips(const Resource::MaterialResource* material, const XMMATRIX& world)
+{
+	if (!material) {
+		return;
+	}
+
+	//  ť   ȭ鿡 ϴ ȼ  ( ũ x   / )
+	// ī޶ ڳ  ̸   ػ󵵸 û
+	const float faceSize = XMVectorGetX(XMVector3Length(world.r[0]));
+	const float depth = XMVectorGetZ(XMVector3TransformCoord(world.r[3], m_viewMatrix));
+	const float projScale = XMVectorGetY(m_projectionMatrix.r[1]);
+	const float screenPixels = depth > 0.1f
+		? faceSize * projScale * 0.5f * static_cast<float>(m_height) / depth
+		: static_cast<float>(m_height);
+
+	// û ϰ  ε  Update UpdateTextureStreaming Ӵ ѵ ŭ 
+	for (uint32_t slot = 0; slot < Resource::MaterialResource::MaxTextures; ++slot) {
+		const auto& texture = material->GetTexture(slot);
+		if (texture && texture->IsReady()) {
+			texture->RequestScreenSize(screenPixels);
+		}
+	}
 }
 
 bool Engine::CreateVertexBuffer()
@@ -737,15 +988,25 @@ bool Engine::InitializeShaders()
 		"VSMain"
 	);
 
-	// ȼ ̴ ε
-	m_pixelShader = ResourceManager::Instance().RequestResource<ShaderResource>(
+	// ȼ ̴  - Ű   ü  ε
+	m_pixelShaders = std::make_unique<ShaderPermutation>(
 		"shaders.hlsl",
 		ShaderResource::ShaderType::Pixel,
-		"PSMain"
+		"PSMain",
+		ShaderKeywordSet{ "USE_TEXTURE", "USE_SPECULAR" }
 	);
+	const auto& keywords = m_pixelShaders->GetKeywords();
+
+	//   ε Ŀ ķ ̸ 
+	const ShaderVariantKey variants[] = {
+		keywords.MakeKey({ "USE_TEXTURE" }),
+		keywords.MakeKey({ "USE_SPECULAR" }),
+		keywords.MakeKey({ "USE_TEXTURE", "USE_SPECULAR" })
+	};
+	m_pixelShaders->Prewarm(variants);
 
 	// ̴ ε Ϸ 
-	if (!m_vertexShader->Load() || !m_pixelShader->Load()) {
+	if (!ResourceManager::Instance().WaitForLoading(m_vertexShader) || !m_pixelShaders->LoadFallback()) {
 		Logger::Instance().Error("̴ ε ");
 		return false;
 	}
@@ -821,33 +1082,11 @@ bool Engine::CreateLightConstantBuffer()
 	return true;
 }
 
-bool Engine::CreateTexture(const wchar_t* filename)
-{
-	// ҽ ε ġ 
-	DirectX::ResourceUploadBatch resourceUpload(m_device.Get());
-	resourceUpload.Begin();
-
-	// DDS ؽó ε
-	if (FAILED(DirectX::CreateDDSTextureFromFile(
-		m_device.Get(),
-		resourceUpload,
-		filename,
-		m_texture.ReleaseAndGetAddressOf()))) {
-		return false;
-	}
-
-	// ҽ ε 
-	auto uploadResourcesFinished = resourceUpload.End(m_commandQueue.Get());
-	uploadResourcesFinished.wait();
-
-	return true;
-}
-
 bool Engine::CreateDescHeap()
 {
-	// CBV 2 SRV 1  ũ  
+	// CBV 2 ͸ ؽó ̺  ũ  
 	D3D12_DESCRIPTOR_HEAP_DESC srvHeapDesc = {};
-	srvHeapDesc.NumDescriptors = 3;  // CBV 2 + SRV 1
+	srvHeapDesc.NumDescriptors = TextureTableStart + MaxTextureTables * Resource::MaterialResource::MaxTextures;
 	srvHeapDesc.Type = D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV;
 	srvHeapDesc.Flags = D3D12_DESCRIPTOR_HEAP_FLAG_SHADER_VISIBLE;
 
@@ -863,48 +1102,38 @@ bool Engine::CreateDescHeap()
 	lightCbvDesc.BufferLocation = m_lightConstantBuffer->GetGPUVirtualAddress();
 	lightCbvDesc.SizeInBytes = (sizeof(LightConstants) + 255) & ~255;
 
-	// ؽó SRV 
-	D3D12_SHADER_RESOURCE_VIEW_DESC srvDesc = {};
-	srvDesc.Shader4ComponentMapping = D3D12_DEFAULT_SHADER_4_COMPONENT_MAPPING;
-	srvDesc.Format = m_texture->GetDesc().Format;
-	srvDesc.ViewDimension = D3D12_SRV_DIMENSION_TEXTURE2D;
-	srvDesc.Texture2D.MipLevels = m_texture->GetDesc().MipLevels;
-
 	// ũ ڵ 
 	CD3DX12_CPU_DESCRIPTOR_HANDLE handle(m_descHeap->GetCPUDescriptorHandleForHeapStart());
 	UINT handleIncrement = m_device->GetDescriptorHandleIncrementSize(D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
 
-	// CBV SRV 
+	// CBV 
 	m_device->CreateConstantBufferView(&transformCbvDesc, handle);
 	handle.Offset(handleIncrement);
 	m_device->CreateConstantBufferView(&lightCbvDesc, handle);
 	handle.Offset(handleIncrement);
-	m_device->CreateShaderResourceView(m_texture.Get(), &srvDesc, handle);
+
+	// 0 ؽó ̺ - ͸ غǱ    SRV
+	for (UINT slot = 0; slot < Resource::MaterialResource::MaxTextures; ++slot) {
+		CreateNullTextureView(handle);
+		handle.Offset(handleIncrement);
+	}
 
 	return true;
 }
 
-void Engine::RegisterEventHandlers()
+void Engine::CreateNullTextureView(D3D12_CPU_DESCRIPTOR_HANDLE handle)
 {
-	auto collisionHandler = m_collisionHandlerIds.emplace_back(
-		EventManager::Instance().Subscribe<Event::CollisionEvent>(
-			Event::EventCallback<Event::CollisionEvent>(
-			[this](const Event::CollisionEvent& event) {
-				// 浹 ̺Ʈ ó
-				Logger::Instance().Debug("'{}' '{}' 浹 ߻. ġ: ({}, {}, {}), 븻: ({}, {}, {}), ݷ: ({})",
-					event.actor1->getName(),
-					event.actor2->getName(),
-					event.position.x,
-					event.position.y,
-					event.position.z,
-					event.normal.x,
-					event.normal.y,
-					event.normal.z,
-					event.impulse);
-			})
-		)
-	);
+	// ҽ  SRV - ̴  0
+	D3D12_SHADER_RESOURCE_VIEW_DESC srvDesc = {};
+	srvDesc.Shader4ComponentMapping = D3D12_DEFAULT_SHADER_4_COMPONENT_MAPPING;
+	srvDesc.Format = DXGI_FORMAT_R8G8B8A8_UNORM;
+	srvDesc.ViewDimension = D3D12_SRV_DIMENSION_TEXTURE2D;
+	srvDesc.Texture2D.MipLevels = 1;
+	m_device->CreateShaderResourceView(nullptr, &srvDesc, handle);
+}
 
+void Engine::RegisterEventHandlers()
+{
 	auto resourceHandler = m_resourceHandlerIds.emplace_back(
 		EventManager::Instance().Subscribe<Event::ResourceEvent>(
 			Event::EventCallback <Event::ResourceEvent>(
@@ -921,6 +1150,19 @@ void Engine::RegisterEventHandlers()
 					Logger::Instance().Error("ҽ ε : {}, : {}",
 						event.path, event.error);
 					break;
+				case Event::ResourceEvent::Type::Reloaded:
+					Logger::Instance().Info("ҽ ٽ ε: {}", event.path);
+
+					// ̴ ٲ PSO  Ʈڵ ٽ 鵵 , ü PSO ⺻  ٷ ٽ 
+					// (    PSO     Ƿ GPU  )
+					if (std::filesystem::path(event.path).extension() == ".hlsl" && m_device) {
+						WaitForGpu();
+						m_pipelineStates.clear();
+						if (m_pixelShaders && m_vertexShader && !BuildFallbackPipeline()) {
+							Logger::Instance().Error("ü  ٽ  : {}", event.path);
+						}
+					}
+					break;
 				}
 			})
 		)
@@ -955,9 +1197,6 @@ void Engine::RegisterEventHandlers()
 
 void Engine::UnregisterEventHandlers()
 {
-	for (auto id : m_collisionHandlerIds) {
-		EventManager::Instance().Unsubscribe<Event::CollisionEvent>(id);
-	}
 	for (auto id : m_resourceHandlerIds) {
 		EventManager::Instance().Unsubscribe<Event::ResourceEvent>(id);
 	}
@@ -972,6 +1211,8 @@ void Engine::UpdateConstantBuffer()
 	constants.worldMatrix = XMMatrixTranspose(m_worldMatrix);
 	constants.viewMatrix = XMMatrixTranspose(m_viewMatrix);
 	constants.projectionMatrix = XMMatrixTranspose(m_projectionMatrix);
+	constants.positionScale = XMFLOAT4(1.0f, 1.0f, 1.0f, 0.0f);
+	constants.positionOffset = XMFLOAT4(0.0f, 0.0f, 0.0f, 0.0f);
 
 	memcpy(m_constantBufferMappedData, &constants, sizeof(constants));
 }
@@ -2,6 +2,9 @@
 #include "Event.h"
 #include "EventTypes.h"
 #include "ShaderResource.h"
+#include "ShaderPermutation.h"
+#include "MaterialResource.h"
+#include "SoundResource.h"
 
 class PhysicsObject;
 class PhysicsEngine;
@@ -36,7 +39,8 @@ private:
 	ComPtr<ID3D12GraphicsCommandList7> m_commandList;
 	ComPtr<ID3D12Fence1> m_fence;
 	ComPtr<ID3D12RootSignature> m_rootSignature;
-	ComPtr<ID3D12PipelineState> m_pipelineState;
+	ComPtr<ID3D12PipelineState> m_pipelineState;  // ü  (͸ غǱ )
+	std::unordered_map<uint64_t, ComPtr<ID3D12PipelineState>> m_pipelineStates;  // ͸  Ű
 
 	UINT64 m_fenceValues[FRAME_BUFFER_COUNT];
 	HANDLE m_fenceEvent;
@@ -50,7 +54,7 @@ private:
 
 	// ̴  
 	std::shared_ptr<Resource::ShaderResource> m_vertexShader;
-	std::shared_ptr<Resource::ShaderResource> m_pixelShader;
+	std::unique_ptr<Resource::ShaderPermutation> m_pixelShaders;
 
 	//  
 	ComPtr<ID3D12Resource> m_constantBuffer;
@@ -61,9 +65,25 @@ private:
 	UINT8* m_lightConstantBufferMappedData;
 	LightConstants m_lightConstants;
 
-	// ؽó  
-	ComPtr<ID3D12Resource> m_texture;
-	
+	// ͸ (̴ , ؽó, )
+	std::shared_ptr<Resource::MaterialResource> m_material;
+	Resource::MaterialConstantBuffer::Block m_defaultMaterialConstants;  // ͸ غǱ   ̴ ʱⰪ
+
+	// ͸ ؽó ũ ̺ - ؽó  ID MaxTextures (0  SRV)
+	static constexpr UINT TextureTableStart = 2;   // CBV 2 
+	static constexpr UINT MaxTextureTables = 256;
+	struct TextureTable {
+		struct Slot {
+			ID3D12Resource* resource = nullptr;
+			uint32_t residentMip = 0;
+			bool operator==(const Slot&) const = default;
+		};
+		UINT index = 0;
+		std::array<Slot, Resource::MaterialResource::MaxTextures> slots;  // SRV   ؽó 
+	};
+	std::unordered_map<uint16_t, TextureTable> m_textureTables;
+	UINT m_textureTableCount = 1;
+
 	// ȯ  (ī޶)
 	XMMATRIX m_worldMatrix;
 	XMMATRIX m_viewMatrix;
@@ -71,23 +91,28 @@ private:
 
 	// for animation
 	float m_rotationAngle;
-	ULONGLONG m_lastTick;
+	std::chrono::steady_clock::time_point m_lastFrameTime;
 
 	//  
 	std::unique_ptr<PhysicsEngine> m_physicsEngine;
 
+	// 浹
+	std::shared_ptr<Resource::SoundResource> m_impactSound;
+
 	//  ü
 	std::shared_ptr<PhysicsObject> m_physicsBox;
 	std::shared_ptr<PhysicsObject> m_ground;
 
 	// ̺Ʈ ڵ鷯 ID  
-	std::vector<Event::EventDispatcher<Event::CollisionEvent>::HandlerId> m_collisionHandlerIds;
 	std::vector<Event::EventDispatcher<Event::ResourceEvent>::HandlerId> m_resourceHandlerIds;
 	std::vector<Event::EventDispatcher<Event::InputEvent>::HandlerId> m_inputHandlerIds;
 
 	//   Ʈ Լ
 	void UpdateWorldMatrix();
 
+	// ̹    Ѳ ó
+	void ProcessContacts();
+
 	// ʱȭ  Լ
 	bool CreateDevice();
 	bool CreateCommandQueue();
@@ -98,13 +123,19 @@ private:
 	bool CreateFence();
 	bool CreateRootSignature();
 	bool CreatePipelineState();
+	bool BuildFallbackPipeline();   // ü  PSO ⺻ ͸  (̴ ε  ٽ ȣ)
+	ComPtr<ID3D12PipelineState> BuildPipelineState(ID3DBlob* vertexShader, ID3DBlob* pixelShader,
+		Resource::MaterialResource::BlendMode blend, Resource::MaterialResource::CullMode cull);
+	ID3D12PipelineState* SelectPipelineState(const Resource::MaterialResource* material);
+	D3D12_GPU_DESCRIPTOR_HANDLE GetTextureTable(const Resource::MaterialResource* material);
+	void RequestTextureMips(const Resource::MaterialResource* material, const XMMATRIX& world);
 	bool CreateVertexBuffer();
 	bool CreateIndexBuffer();
 	bool InitializeShaders();
 	bool CreateConstantBuffer();
 	bool CreateLightConstantBuffer();
-	bool CreateTexture(const wchar_t* filename);
 	bool CreateDescHeap();
+	void CreateNullTextureView(D3D12_CPU_DESCRIPTOR_HANDLE handle);
 
 	// ̺Ʈ ڵ鷯 ,   Լ
 	void RegisterEventHandlers();
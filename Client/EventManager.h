@@ -29,7 +29,6 @@ public:
 
     // ̺Ʈ ó ( 忡 ȣ)
     void Update() {
-        ProcessEvents<Event::CollisionEvent>();
         ProcessEvents<Event::ResourceEvent>();
         ProcessEvents<Event::InputEvent>();
     }
@@ -64,13 +63,11 @@ private:
 
     //  ̺Ʈ ŸԿ  ť ó 
     std::tuple<
-        Event::EventQueue<Event::CollisionEvent>,
         Event::EventQueue<Event::ResourceEvent>,
         Event::EventQueue<Event::InputEvent>
     > m_queues;
 
     std::tuple<
-        Event::EventDispatcher<Event::CollisionEvent>,
         Event::EventDispatcher<Event::ResourceEvent>,
         Event::EventDispatcher<Event::InputEvent>
     > m_dispatchers;
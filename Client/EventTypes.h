@@ -4,30 +4,14 @@
 
 namespace Event
 {
-    //  浹 ̺Ʈ
-    struct CollisionEvent : public IEvent {
-		CollisionEvent() = default;
-        CollisionEvent(const PxActor* actor1, const PxActor* actor2,
-            const PxVec3& position, const PxVec3& normal, float impulse)
-            : actor1(actor1)
-            , actor2(actor2)
-            , position(position)
-            , normal(normal)
-            , impulse(impulse) {}
-
-        const PxActor* actor1;
-        const PxActor* actor2;
-        PxVec3 position;
-        PxVec3 normal;
-        float impulse;
-    };
-
     // ҽ ε ̺Ʈ
     struct ResourceEvent : public IEvent {
         enum class Type {
             Started,
             Completed,
-            Failed
+            Failed,
+            Cancelled,
+            Reloaded        //   ٽ εǾ  ü
         };
 		ResourceEvent() = default;
         ResourceEvent(const std::string& path, Type type, const std::string& error = "")
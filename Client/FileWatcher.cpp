@@ -0,0 +1,178 @@
+#include "pch.h"
+#include "FileWatcher.h"
+#include "Logger.h"
+
+namespace Resource
+{
+    namespace
+    {
+        // ˸  (UTF-16) ҽ Ű  ANSI ڵ  ڿ ('/' )
+        // ڵ  ǥ   ̸̸ false - path::generic_string ̶ ܸ Ƿ  忡  
+        bool ToResourcePath(std::wstring_view name, std::string& path)
+        {
+            // ڴ ȯ  ٲ (Ϻ ڵ   Ʈ  Ʈ  ޹Ʈ )
+            std::wstring generic(name);
+            std::replace(generic.begin(), generic.end(), L'\\', L'/');
+            if (generic.empty() || generic.size() > static_cast<size_t>(INT_MAX)) {
+                return false;
+            }
+
+            // UTF-8 ڵ  ü  Ȯ  ߸ ڿ ϵ û
+            const UINT codePage = GetACP();
+            const bool utf8 = codePage == CP_UTF8;
+            const DWORD flags = utf8 ? WC_ERR_INVALID_CHARS : WC_NO_BEST_FIT_CHARS;
+            const int wideLength = static_cast<int>(generic.size());
+
+            BOOL usedDefault = FALSE;
+            const int length = WideCharToMultiByte(codePage, flags, generic.data(), wideLength,
+                nullptr, 0, nullptr, utf8 ? nullptr : &usedDefault);
+            if (length <= 0 || usedDefault) {
+                return false;
+            }
+
+            path.resize(static_cast<size_t>(length));
+            return WideCharToMultiByte(codePage, flags, generic.data(), wideLength,
+                path.data(), length, nullptr, utf8 ? nullptr : &usedDefault) == length && !usedDefault;
+        }
+    }
+
+    FileWatcher::~FileWatcher()
+    {
+        Stop();
+    }
+
+    bool FileWatcher::Start(const std::filesystem::path& directory, std::chrono::milliseconds settleTime)
+    {
+        Stop();
+
+        m_directory = directory;
+        m_settleTime = settleTime;
+
+        m_directoryHandle = CreateFileW(
+            directory.c_str(),
+            FILE_LIST_DIRECTORY,
+            FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+            nullptr,
+            OPEN_EXISTING,
+            FILE_FLAG_BACKUP_SEMANTICS | FILE_FLAG_OVERLAPPED,
+            nullptr);
+
+        if (m_directoryHandle == INVALID_HANDLE_VALUE) {
+            Logger::Instance().Error("   : {} ({})", directory.string(), GetLastError());
+            return false;
+        }
+
+        m_stopEvent = CreateEventW(nullptr, TRUE, FALSE, nullptr);
+        m_thread = std::thread(&FileWatcher::WatchLoop, this);
+
+        Logger::Instance().Info("  : {}", std::filesystem::absolute(directory).string());
+        return true;
+    }
+
+    void FileWatcher::Stop()
+    {
+        if (m_thread.joinable()) {
+            SetEvent(m_stopEvent);
+            m_thread.join();
+        }
+        if (m_stopEvent) {
+            CloseHandle(m_stopEvent);
+            m_stopEvent = nullptr;
+        }
+        if (m_directoryHandle != INVALID_HANDLE_VALUE) {
+            CloseHandle(m_directoryHandle);
+            m_directoryHandle = INVALID_HANDLE_VALUE;
+        }
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_changes.clear();
+    }
+
+    std::vector<std::string> FileWatcher::PollChanges()
+    {
+        std::vector<std::string> settled;
+        const auto now = std::chrono::steady_clock::now();
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for (auto it = m_changes.begin(); it != m_changes.end();) {
+            if (now - it->second >= m_settleTime) {
+                settled.push_back(it->first);
+                it = m_changes.erase(it);
+            }
+            else {
+                ++it;
+            }
+        }
+        return settled;
+    }
+
+    void FileWatcher::WatchLoop()
+    {
+        // FILE_NOTIFY_INFORMATION DWORD  ʿ
+        alignas(DWORD) std::array<uint8_t, 64 * 1024> buffer;
+
+        OVERLAPPED overlapped = {};
+        overlapped.hEvent = CreateEventW(nullptr, TRUE, FALSE, nullptr);
+
+        const DWORD filter = FILE_NOTIFY_CHANGE_LAST_WRITE | FILE_NOTIFY_CHANGE_FILE_NAME | FILE_NOTIFY_CHANGE_SIZE;
+
+        while (true) {
+            ResetEvent(overlapped.hEvent);
+            if (!ReadDirectoryChangesW(m_directoryHandle, buffer.data(), static_cast<DWORD>(buffer.size()),
+                TRUE, filter, nullptr, &overlapped, nullptr)) {
+                Logger::Instance().Error("͸   : {}", GetLastError());
+                break;
+            }
+
+            HANDLE handles[] = { overlapped.hEvent, m_stopEvent };
+            const DWORD wait = WaitForMultipleObjects(_countof(handles), handles, FALSE, INFINITE);
+            if (wait != WAIT_OBJECT_0) {
+                //  û -   б⸦ ϰ   
+                CancelIoEx(m_directoryHandle, &overlapped);
+                DWORD ignored = 0;
+                GetOverlappedResult(m_directoryHandle, &overlapped, &ignored, TRUE);
+                break;
+            }
+
+            DWORD bytes = 0;
+            if (!GetOverlappedResult(m_directoryHandle, &overlapped, &bytes, FALSE)) {
+                break;
+            }
+
+            // ۰ ġ 0Ʈ ƿ -     Ƿ   ٸ
+            if (bytes == 0) {
+                Logger::Instance().Warning("  ˸  ʰ: {}", m_directory.string());
+                continue;
+            }
+
+            size_t offset = 0;
+            while (true) {
+                const auto* info = reinterpret_cast<const FILE_NOTIFY_INFORMATION*>(buffer.data() + offset);
+
+                if (info->Action == FILE_ACTION_MODIFIED || info->Action == FILE_ACTION_ADDED ||
+                    info->Action == FILE_ACTION_RENAMED_NEW_NAME) {
+                    std::wstring_view name(info->FileName, info->FileNameLength / sizeof(WCHAR));
+                    std::string path;
+                    if (ToResourcePath(name, path)) {
+                        Record(std::move(path));
+                    }
+                    else {
+                        // ҽ η    ̸̹Ƿ ε  ƴ
+                        Logger::Instance().Warning("ڵ  ȯ    ̸   ({})", name.size());
+                    }
+                }
+
+                if (info->NextEntryOffset == 0) break;
+                offset += info->NextEntryOffset;
+            }
+        }
+
+        CloseHandle(overlapped.hEvent);
+    }
+
+    void FileWatcher::Record(std::string path)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_changes[std::move(path)] = std::chrono::steady_clock::now();
+    }
+}
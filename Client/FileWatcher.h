@@ -0,0 +1,42 @@
+#pragma once
+#include "pch.h"
+
+namespace Resource
+{
+    // ͸   (ReadDirectoryChangesW,  ͸ )
+    // -  尡 ٲ  ,  尡 PollChanges 
+    // - Ͱ        찡    
+    //   settleTime  ϸ 
+    class FileWatcher {
+    public:
+        FileWatcher() = default;
+        ~FileWatcher();
+
+        FileWatcher(const FileWatcher&) = delete;
+        FileWatcher& operator=(const FileWatcher&) = delete;
+
+        bool Start(const std::filesystem::path& directory,
+            std::chrono::milliseconds settleTime = std::chrono::milliseconds(200));
+        void Stop();
+
+        bool IsRunning() const { return m_thread.joinable(); }
+        const std::filesystem::path& GetDirectory() const { return m_directory; }
+
+        //     ( ͸   )
+        std::vector<std::string> PollChanges();
+
+    private:
+        void WatchLoop();
+        void Record(std::string path);
+
+        std::filesystem::path m_directory;
+        std::chrono::milliseconds m_settleTime{ 200 };
+
+        HANDLE m_directoryHandle = INVALID_HANDLE_VALUE;
+        HANDLE m_stopEvent = nullptr;
+        std::thread m_thread;
+
+        std::mutex m_mutex;
+        std::unordered_map<std::string, std::chrono::steady_clock::time_point> m_changes;
+    };
+}
@@ -17,7 +17,8 @@ namespace Resource
         Model,      // 3D 
         Shader,     // ̴
         Sound,      // 
-        Material    // ͸
+        Material,   // ͸
+        Count
     };
 
     // ҽ ̽
@@ -34,6 +35,22 @@ namespace Resource
             return Load();
         }
 
+        //  ε 
+        // - CreateReloadCopy:  ڷ  ε  纻 (  nullptr)
+        // - SwapContents: ׶忡 ε 纻  ü ( ,  )
+        //   ü  source   Ƿ GPU      
+        virtual std::shared_ptr<IResource> CreateReloadCopy() const { return nullptr; }
+        virtual bool SwapContents(IResource& source) { return false; }
+
+        //  ҽ д   (ٲ ٽ ε)
+        virtual std::vector<std::string> GetDependencies() const { return { m_path }; }
+
+        // ε  -  ҽ Load   ϴ ҽ (͸ -> ؽó/̴ )
+        // ResourceManager ó   û 忡   ȣ.  RequestResource  ҽ
+        //   ״ ȯ (ĳð ߺ ŸǷ     ε)
+        // δ ̵  Ready  ڿ Load ȣϰ, ϳ ϸ Load  з ó
+        virtual std::vector<std::shared_ptr<IResource>> RequestLoadDependencies() { return {}; }
+
         //  Ȯ Լ
         bool IsReady() const { return m_state == State::Ready; }
         bool IsLoading() const { return m_state == State::Loading; }
@@ -67,11 +84,19 @@ namespace Resource
 
         void SetSize(size_t size) { m_size = size; }
 
+        // SwapContents  - ¿ ũ ȯ
+        void SwapBase(IResource& other) {
+            std::swap(m_state, other.m_state);
+            std::swap(m_size, other.m_size);
+        }
+
         // ۷ ī
         void AddRef() { m_refCount++; }
         bool RemoveRef() { return (m_refCount-- == 1); }
 
     private:
+        friend class ResourceLoader;    //  ҽ ϸ Load  Failed 
+
         Type m_type;                    // ҽ Ÿ
         State m_state;                  //  
         std::string m_path;             // ҽ 
@@ -25,6 +25,14 @@ public:
     }
 };
 
+// ܼ 
+class ConsoleOutput : public ILogOutput {
+public:
+    void Write(LogLevel level, const std::string& message) override {
+        std::cout << message;
+    }
+};
+
 //  
 class FileOutput : public ILogOutput {
 public:
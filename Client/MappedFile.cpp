@@ -0,0 +1,60 @@
+#include "pch.h"
+#include "MappedFile.h"
+
+namespace Resource
+{
+    MappedFile::~MappedFile()
+    {
+        Close();
+    }
+
+    bool MappedFile::Open(const std::string& path, bool randomAccess)
+    {
+        Close();
+
+        const std::wstring widePath = std::filesystem::path(path).wstring();
+        const DWORD flags = FILE_ATTRIBUTE_NORMAL | (randomAccess ? FILE_FLAG_RANDOM_ACCESS : FILE_FLAG_SEQUENTIAL_SCAN);
+        m_file = CreateFileW(widePath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, flags, nullptr);
+        if (m_file == INVALID_HANDLE_VALUE) {
+            return false;
+        }
+
+        LARGE_INTEGER fileSize = {};
+        if (!GetFileSizeEx(m_file, &fileSize) || fileSize.QuadPart <= 0) {
+            Close();
+            return false;
+        }
+
+        m_mapping = CreateFileMappingW(m_file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (!m_mapping) {
+            Close();
+            return false;
+        }
+
+        m_base = static_cast<const uint8_t*>(MapViewOfFile(m_mapping, FILE_MAP_READ, 0, 0, 0));
+        if (!m_base) {
+            Close();
+            return false;
+        }
+
+        m_size = static_cast<size_t>(fileSize.QuadPart);
+        return true;
+    }
+
+    void MappedFile::Close()
+    {
+        if (m_base) {
+            UnmapViewOfFile(m_base);
+            m_base = nullptr;
+        }
+        if (m_mapping) {
+            CloseHandle(m_mapping);
+            m_mapping = nullptr;
+        }
+        if (m_file != INVALID_HANDLE_VALUE) {
+            CloseHandle(m_file);
+            m_file = INVALID_HANDLE_VALUE;
+        }
+        m_size = 0;
+    }
+}
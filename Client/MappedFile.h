@@ -0,0 +1,31 @@
+#pragma once
+#include "pch.h"
+
+namespace Resource
+{
+    // б  ޸  
+    // -  ó   OS о ̹Ƿ ū ϵ    
+    // -     Ƿ з ó
+    class MappedFile {
+    public:
+        MappedFile() = default;
+        ~MappedFile();
+
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+
+        bool Open(const std::string& path, bool randomAccess = false);
+        void Close();
+
+        bool IsOpen() const { return m_base != nullptr; }
+        const uint8_t* GetData() const { return m_base; }
+        size_t GetSize() const { return m_size; }
+        std::span<const uint8_t> GetBytes() const { return { m_base, m_size }; }
+
+    private:
+        HANDLE m_file = INVALID_HANDLE_VALUE;
+        HANDLE m_mapping = nullptr;
+        const uint8_t* m_base = nullptr;
+        size_t m_size = 0;
+    };
+}
@@ -0,0 +1,146 @@
+#include "pch.h"
+#include "MaterialConstantBuffer.h"
+#include "GraphicsDevice.h"
+#include "Logger.h"
+
+namespace Resource
+{
+    MaterialConstantBuffer& MaterialConstantBuffer::Instance()
+    {
+        static MaterialConstantBuffer instance;
+        return instance;
+    }
+
+    MaterialConstantBuffer::Block& MaterialConstantBuffer::Block::operator=(Block&& other) noexcept
+    {
+        if (this != &other) {
+            Reset();
+            m_page = std::move(other.m_page);
+            m_cpu = std::exchange(other.m_cpu, nullptr);
+            m_gpu = std::exchange(other.m_gpu, 0);
+            m_size = std::exchange(other.m_size, 0);
+            m_firstUnit = std::exchange(other.m_firstUnit, 0);
+        }
+        return *this;
+    }
+
+    void MaterialConstantBuffer::Block::Reset()
+    {
+        if (!m_page) return;
+
+        const uint32_t units = m_size / BlockAlignment;
+        {
+            std::lock_guard<std::mutex> lock(m_page->mutex);
+            std::fill_n(m_page->used.begin() + m_firstUnit, units, uint8_t(0));
+            m_page->usedUnits -= units;
+        }
+
+        m_page.reset();
+        m_cpu = nullptr;
+        m_gpu = 0;
+        m_size = 0;
+        m_firstUnit = 0;
+    }
+
+    MaterialConstantBuffer::Block MaterialConstantBuffer::Allocate(uint32_t size)
+    {
+        Block block;
+        if (size == 0 || size > MaxBlockSize) {
+            Logger::Instance().Error("͸   ũⰡ ߸: {}bytes", size);
+            return block;
+        }
+        const uint32_t units = (size + BlockAlignment - 1) / BlockAlignment;
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for (const auto& page : m_pages) {
+            if (TryAllocate(page, units, block)) {
+                return block;
+            }
+        }
+
+        auto page = CreatePage();
+        if (page && TryAllocate(page, units, block)) {
+            m_pages.push_back(std::move(page));
+        }
+        return block;
+    }
+
+    bool MaterialConstantBuffer::TryAllocate(const std::shared_ptr<Page>& page, uint32_t units, Block& block)
+    {
+        std::lock_guard<std::mutex> lock(page->mutex);
+        if (UnitsPerPage - page->usedUnits < units) return false;
+
+        // first-fit -  ƴ  ä  ʿ  ̰ 
+        uint32_t run = 0;
+        for (uint32_t i = 0; i < UnitsPerPage; ++i) {
+            run = page->used[i] ? 0 : run + 1;
+            if (run == units) {
+                const uint32_t first = i + 1 - units;
+                std::fill_n(page->used.begin() + first, units, uint8_t(1));
+                page->usedUnits += units;
+
+                block.m_page = page;
+                block.m_firstUnit = first;
+                block.m_size = units * BlockAlignment;
+                block.m_cpu = page->mapped + size_t(first) * BlockAlignment;
+                block.m_gpu = page->address + uint64_t(first) * BlockAlignment;
+                std::memset(block.m_cpu, 0, block.m_size);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    std::shared_ptr<MaterialConstantBuffer::Page> MaterialConstantBuffer::CreatePage()
+    {
+        auto* device = GraphicsDevice::Instance().GetDevice();
+        if (!device) {
+            Logger::Instance().Error("͸    : ̽ ϴ");
+            return nullptr;
+        }
+
+        auto page = std::make_shared<Page>();
+        const auto heapProperties = CD3DX12_HEAP_PROPERTIES(D3D12_HEAP_TYPE_UPLOAD);
+        const auto resourceDesc = CD3DX12_RESOURCE_DESC::Buffer(PageSize);
+        if (FAILED(device->CreateCommittedResource(&heapProperties, D3D12_HEAP_FLAG_NONE, &resourceDesc,
+            D3D12_RESOURCE_STATE_GENERIC_READ, nullptr, IID_PPV_ARGS(&page->buffer)))) {
+            Logger::Instance().Error("͸    ");
+            return nullptr;
+        }
+
+        // ε    ֵ  (CPU ⸸ )
+        const CD3DX12_RANGE readRange(0, 0);
+        if (FAILED(page->buffer->Map(0, &readRange, reinterpret_cast<void**>(&page->mapped)))) {
+            Logger::Instance().Error("͸    ");
+            return nullptr;
+        }
+        page->address = page->buffer->GetGPUVirtualAddress();
+        page->used.assign(UnitsPerPage, 0);
+
+        Logger::Instance().Debug("͸   : {}° ({}KB)", m_pages.size() + 1, PageSize / 1024);
+        return page;
+    }
+
+    size_t MaterialConstantBuffer::GetUsedBytes() const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        size_t used = 0;
+        for (const auto& page : m_pages) {
+            std::lock_guard<std::mutex> pageLock(page->mutex);
+            used += page->usedUnits * BlockAlignment;
+        }
+        return used;
+    }
+
+    size_t MaterialConstantBuffer::GetCapacity() const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_pages.size() * size_t(PageSize);
+    }
+
+    size_t MaterialConstantBuffer::GetPageCount() const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_pages.size();
+    }
+}
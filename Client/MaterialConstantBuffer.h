@@ -0,0 +1,81 @@
+#pragma once
+#include "pch.h"
+
+namespace Resource
+{
+    // ͸   
+    // - ׻ ε ε  (1MB)  ƴ ̾ ٿ Ҵ
+    //   ( ũ   ũ⸦ CBV ּ  256Ʈ ø )
+    // - CPU ε ּҿ ٷ ϰ, GPU Ʈ CBV ּҸ ޾ 
+    // - Ҵ/  忡  (ε Ŀ ͸ Load)
+    // - GPU д    ʵ    ڿ  
+    class MaterialConstantBuffer {
+    public:
+        static constexpr uint32_t BlockAlignment = D3D12_CONSTANT_BUFFER_DATA_PLACEMENT_ALIGNMENT;
+        static constexpr uint32_t PageSize = 1024 * 1024;
+        static constexpr uint32_t MaxBlockSize = D3D12_REQ_CONSTANT_BUFFER_ELEMENT_COUNT * 16;  // 64KB
+
+    private:
+        struct Page {
+            ComPtr<ID3D12Resource> buffer;
+            uint8_t* mapped = nullptr;
+            D3D12_GPU_VIRTUAL_ADDRESS address = 0;
+            std::vector<uint8_t> used;      // 256Ʈ   
+            size_t usedUnits = 0;
+            std::mutex mutex;
+        };
+
+    public:
+        // Ҵ  - ҸǸ ȯ (     ǹǷ Һ  Ƶ )
+        class Block {
+        public:
+            Block() = default;
+            ~Block() { Reset(); }
+
+            Block(Block&& other) noexcept { *this = std::move(other); }
+            Block& operator=(Block&& other) noexcept;
+            Block(const Block&) = delete;
+            Block& operator=(const Block&) = delete;
+
+            void Reset();
+
+            explicit operator bool() const { return m_cpu != nullptr; }
+            uint8_t* GetCpuAddress() const { return m_cpu; }
+            D3D12_GPU_VIRTUAL_ADDRESS GetGpuAddress() const { return m_gpu; }
+            uint32_t GetSize() const { return m_size; }
+
+        private:
+            friend class MaterialConstantBuffer;
+
+            std::shared_ptr<Page> m_page;
+            uint8_t* m_cpu = nullptr;
+            D3D12_GPU_VIRTUAL_ADDRESS m_gpu = 0;
+            uint32_t m_size = 0;
+            uint32_t m_firstUnit = 0;
+        };
+
+        static MaterialConstantBuffer& Instance();
+
+        // size 256Ʈ ø  (0 ʱȭ). ̽ ų 64KB   
+        Block Allocate(uint32_t size);
+
+        size_t GetUsedBytes() const;
+        size_t GetCapacity() const;
+        size_t GetPageCount() const;
+
+    private:
+        MaterialConstantBuffer() = default;
+        ~MaterialConstantBuffer() = default;
+
+        MaterialConstantBuffer(const MaterialConstantBuffer&) = delete;
+        MaterialConstantBuffer& operator=(const MaterialConstantBuffer&) = delete;
+
+        static constexpr uint32_t UnitsPerPage = PageSize / BlockAlignment;
+
+        static bool TryAllocate(const std::shared_ptr<Page>& page, uint32_t units, Block& block);
+        std::shared_ptr<Page> CreatePage();
+
+        mutable std::mutex m_mutex;
+        std::vector<std::shared_ptr<Page>> m_pages;
+    };
+}
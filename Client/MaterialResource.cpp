@@ -0,0 +1,442 @@
+#include "pch.h"
+#include "MaterialResource.h"
+#include "ResourceManager.h"
+#include "ArchiveManager.h"
+
+namespace Resource
+{
+    namespace
+    {
+        std::vector<std::string_view> Tokenize(std::string_view line) {
+            std::vector<std::string_view> tokens;
+            constexpr std::string_view whitespace = " \t\r";
+            size_t start = line.find_first_not_of(whitespace);
+            while (start != std::string_view::npos) {
+                const size_t end = line.find_first_of(whitespace, start);
+                tokens.push_back(line.substr(start, end - start));
+                start = line.find_first_not_of(whitespace, end);
+            }
+            return tokens;
+        }
+
+        bool ParseFloat(std::string_view token, float& value) {
+            const auto [end, ec] = std::from_chars(token.data(), token.data() + token.size(), value);
+            return ec == std::errc() && end == token.data() + token.size();
+        }
+
+        // 64Ʈ ؽ -> 16Ʈ Ŀ ID (ó   ο)
+        //  Ű ª ϱ  ̶    ID  (Ӹ   )
+        class SortIdTable {
+        public:
+            explicit SortIdTable(const char* name) : m_name(name) {}
+
+            uint16_t Get(uint64_t hash) {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                auto [it, inserted] = m_ids.try_emplace(hash, m_next);
+                if (inserted) {
+                    if (m_next < UINT16_MAX) {
+                        ++m_next;
+                    }
+                    else if (!m_exhausted) {
+                        m_exhausted = true;
+                        Logger::Instance().Warning("{}  ID   - Ĵ  ID ", m_name);
+                    }
+                }
+                return it->second;
+            }
+
+        private:
+            const char* m_name;
+            std::mutex m_mutex;
+            std::unordered_map<uint64_t, uint16_t> m_ids;
+            uint16_t m_next = 0;
+            bool m_exhausted = false;
+        };
+
+        SortIdTable& PipelineIds() {
+            static SortIdTable table("");
+            return table;
+        }
+
+        SortIdTable& TextureSetIds() {
+            static SortIdTable table("ؽó ");
+            return table;
+        }
+
+        SortIdTable& MaterialIds() {
+            static SortIdTable table("͸");
+            return table;
+        }
+
+        constexpr uint64_t StateKeyMask = (uint64_t(1) << 48) - 1;
+        constexpr uint32_t DepthBits = 14;
+        constexpr uint64_t DepthMax = (uint64_t(1) << DepthBits) - 1;
+    }
+
+    MaterialLayout MaterialLayout::Reflect(std::span<ID3DBlob* const> shaders)
+    {
+        MaterialLayout layout;
+        for (ID3DBlob* shader : shaders) {
+            if (!shader) continue;
+
+            ComPtr<ID3D12ShaderReflection> reflection;
+            if (FAILED(D3DReflect(shader->GetBufferPointer(), shader->GetBufferSize(), IID_PPV_ARGS(&reflection)))) {
+                continue;
+            }
+
+            //   ̸̸  ü ȯǰ GetDesc 
+            auto* constantBuffer = reflection->GetConstantBufferByName(ConstantBufferName);
+            D3D12_SHADER_BUFFER_DESC bufferDesc = {};
+            if (FAILED(constantBuffer->GetDesc(&bufferDesc)) || bufferDesc.Size == 0) {
+                continue;
+            }
+
+            layout.m_size = bufferDesc.Size;
+            layout.m_defaults.assign(bufferDesc.Size, 0);
+            for (UINT i = 0; i < bufferDesc.Variables; ++i) {
+                auto* variable = constantBuffer->GetVariableByIndex(i);
+                D3D12_SHADER_VARIABLE_DESC variableDesc = {};
+                D3D12_SHADER_TYPE_DESC typeDesc = {};
+                if (FAILED(variable->GetDesc(&variableDesc)) || FAILED(variable->GetType()->GetDesc(&typeDesc))) {
+                    continue;
+                }
+
+                layout.m_parameters.push_back({ variableDesc.Name, variableDesc.StartOffset, variableDesc.Size,
+                    typeDesc.Type, typeDesc.Elements });
+                if (variableDesc.DefaultValue && variableDesc.StartOffset + variableDesc.Size <= bufferDesc.Size) {
+                    std::memcpy(layout.m_defaults.data() + variableDesc.StartOffset, variableDesc.DefaultValue, variableDesc.Size);
+                }
+            }
+            break;
+        }
+        return layout;
+    }
+
+    const MaterialLayout::Parameter* MaterialLayout::Find(std::string_view name) const
+    {
+        for (const auto& parameter : m_parameters) {
+            if (parameter.name == name) {
+                return &parameter;
+            }
+        }
+        return nullptr;
+    }
+
+    bool MaterialLayout::Write(std::string_view name, std::span<const float> values, std::span<uint8_t> constants) const
+    {
+        const Parameter* parameter = Find(name);
+        if (!parameter || parameter->elements > 0) return false;
+        if (values.size() * sizeof(float) > parameter->size || parameter->offset + parameter->size > constants.size()) {
+            return false;
+        }
+        if (parameter->type != D3D_SVT_FLOAT && parameter->type != D3D_SVT_INT &&
+            parameter->type != D3D_SVT_UINT && parameter->type != D3D_SVT_BOOL) {
+            return false;
+        }
+
+        //   ۿ Ǵ (⺻  켱) ״ 
+        uint8_t* destination = constants.data() + parameter->offset;
+        for (size_t i = 0; i < values.size(); ++i) {
+            uint32_t bits = 0;
+            switch (parameter->type) {
+            case D3D_SVT_FLOAT: std::memcpy(&bits, &values[i], sizeof(bits)); break;
+            case D3D_SVT_UINT:  bits = static_cast<uint32_t>(std::max(values[i], 0.0f)); break;
+            case D3D_SVT_BOOL:  bits = values[i] != 0.0f ? 1u : 0u; break;
+            default:            bits = static_cast<uint32_t>(static_cast<int32_t>(values[i])); break;
+            }
+            std::memcpy(destination + i * sizeof(bits), &bits, sizeof(bits));
+        }
+        return true;
+    }
+
+    bool MaterialResource::Parse(std::string_view text, Desc& desc, std::string& error)
+    {
+        desc = {};
+        std::vector<std::string_view> enabled;
+        size_t lineNumber = 0;
+
+        while (!text.empty()) {
+            const size_t lineEnd = text.find('\n');
+            std::string_view line = text.substr(0, lineEnd);
+            text = lineEnd == std::string_view::npos ? std::string_view() : text.substr(lineEnd + 1);
+            ++lineNumber;
+
+            line = line.substr(0, line.find('#'));
+            const auto tokens = Tokenize(line);
+            if (tokens.empty()) continue;
+
+            auto fail = [&](std::string_view reason) {
+                error = std::format("{}° : {}", lineNumber, reason);
+                return false;
+            };
+
+            const std::string_view command = tokens[0];
+            if (command == "shader") {
+                if (tokens.size() < 2 || tokens.size() > 4) return fail("shader <> [VS Ʈ] [PS Ʈ]");
+                desc.shaderPath = tokens[1];
+                if (tokens.size() >= 3) desc.vertexEntry = tokens[2];
+                if (tokens.size() >= 4) desc.pixelEntry = tokens[3];
+            }
+            else if (command == "keywords") {
+                try {
+                    for (size_t i = 1; i < tokens.size(); ++i) {
+                        desc.keywords.Declare(tokens[i]);
+                    }
+                }
+                catch (const std::length_error&) {
+                    return fail("Ű尡 ʹ ");
+                }
+            }
+            else if (command == "enable") {
+                enabled.insert(enabled.end(), tokens.begin() + 1, tokens.end());
+            }
+            else if (command == "texture") {
+                uint32_t slot = MaxTextures;
+                if (tokens.size() >= 3 && tokens.size() <= 4) {
+                    std::from_chars(tokens[1].data(), tokens[1].data() + tokens[1].size(), slot);
+                }
+                if (slot >= MaxTextures) {
+                    return fail(std::format("texture < 0~{}> <> [stream]", MaxTextures - 1));
+                }
+                if (std::ranges::any_of(desc.textures, [slot](const TextureSlot& texture) { return texture.slot == slot; })) {
+                    return fail(" ؽó    ");
+                }
+
+                TextureSlot texture;
+                texture.slot = slot;
+                texture.path = tokens[2];
+                if (tokens.size() == 4) {
+                    if (tokens[3] != "stream") return fail("ؽó ɼ stream ");
+                    texture.mode = TextureResource::LoadMode::Streaming;
+                }
+                desc.textures.push_back(std::move(texture));
+            }
+            else if (command == "param") {
+                if (tokens.size() < 3 || tokens.size() > 18) return fail("param ≮> < 1~16>");
+                std::vector<float> values(tokens.size() - 2);
+                for (size_t i = 0; i < values.size(); ++i) {
+                    if (!ParseFloat(tokens[i + 2], values[i])) return fail(std::format("ڰ ƴ: {}", tokens[i + 2]));
+                }
+                desc.parameters.emplace_back(std::string(tokens[1]), std::move(values));
+            }
+            else if (command == "blend") {
+                if (tokens.size() != 2) return fail("blend opaque|alpha|additive");
+                if (tokens[1] == "opaque") desc.blend = BlendMode::Opaque;
+                else if (tokens[1] == "alpha") desc.blend = BlendMode::AlphaBlend;
+                else if (tokens[1] == "additive") desc.blend = BlendMode::Additive;
+                else return fail("blend opaque|alpha|additive");
+            }
+            else if (command == "cull") {
+                if (tokens.size() != 2) return fail("cull back|front|none");
+                if (tokens[1] == "back") desc.cull = CullMode::Back;
+                else if (tokens[1] == "front") desc.cull = CullMode::Front;
+                else if (tokens[1] == "none") desc.cull = CullMode::None;
+                else return fail("cull back|front|none");
+            }
+            else {
+                return fail(std::format("   ׸: {}", command));
+            }
+        }
+
+        if (desc.shaderPath.empty()) {
+            error = "shader ׸ ";
+            return false;
+        }
+
+        //  Ű      Ű ȯ (  ϰ   )
+        for (auto keyword : enabled) {
+            auto mask = desc.keywords.GetMask(keyword);
+            if (!mask) {
+                error = std::format("  Ű: {}", keyword);
+                return false;
+            }
+            desc.variant |= *mask;
+        }
+        return true;
+    }
+
+    bool MaterialResource::ReadDesc()
+    {
+        std::string text;
+        if (auto asset = ArchiveManager::Instance().Find(GetPath())) {
+            text.assign(reinterpret_cast<const char*>(asset.data()), asset.size());
+        }
+        else {
+            std::ifstream file(GetPath(), std::ios::binary);
+            if (!file) {
+                Logger::Instance().Error("͸    : {}", GetPath());
+                return false;
+            }
+            text.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+        }
+
+        std::string error;
+        if (!Parse(text, m_desc, error)) {
+            Logger::Instance().Error("͸ ؼ : {} - {}", GetPath(), error);
+            return false;
+        }
+        return true;
+    }
+
+    std::vector<std::shared_ptr<IResource>> MaterialResource::RequestLoadDependencies()
+    {
+        m_parsed = ReadDesc();
+        if (!m_parsed) {
+            return {};  // Load  ó
+        }
+
+        //   켱 û - δ  ͸ 켱 ÷ 
+        //  ̴ /ؽó  ͸󳢸 ĳÿ  ҽ 
+        auto& manager = ResourceManager::Instance();
+        m_vertexShader = manager.RequestResource<ShaderResource>(LoadPriority::Background,
+            m_desc.shaderPath, ShaderResource::ShaderType::Vertex, m_desc.vertexEntry);
+        m_pixelShader = manager.RequestResource<ShaderResource>(LoadPriority::Background,
+            m_desc.shaderPath, ShaderResource::ShaderType::Pixel, m_desc.pixelEntry, m_desc.keywords, m_desc.variant);
+
+        std::vector<std::shared_ptr<IResource>> dependencies = { m_vertexShader, m_pixelShader };
+        for (const auto& texture : m_desc.textures) {
+            m_textures[texture.slot] = manager.RequestResource<TextureResource>(LoadPriority::Background,
+                texture.path, texture.mode);
+            dependencies.push_back(m_textures[texture.slot]);
+        }
+        std::erase(dependencies, nullptr);
+        return dependencies;
+    }
+
+    bool MaterialResource::Load()
+    {
+        if (IsReady()) return true;
+
+        SetState(State::Loading);
+
+        // ε 纻  û  ٷ εǹǷ ⼭ û
+        // ( ʿ ̴  غ ʾ ̹ ε ϰ   )
+        if (!m_parsed) {
+            RequestLoadDependencies();
+        }
+        if (!m_parsed) {
+            SetState(State::Failed);
+            return false;
+        }
+
+        if (!m_vertexShader || !m_pixelShader || !m_vertexShader->IsReady() || !m_pixelShader->IsReady()) {
+            SetState(State::Failed);
+            Logger::Instance().Error("͸ ̴ غ : {} ({})", GetPath(), m_desc.shaderPath);
+            return false;
+        }
+
+        //  - ȼ ̴ ġ 켱 ϰ ̴ ʱⰪ    
+        ID3DBlob* shaders[] = { m_pixelShader->GetShaderBlob(), m_vertexShader->GetShaderBlob() };
+        m_layout = MaterialLayout::Reflect(shaders);
+        if (!m_layout.IsEmpty()) {
+            m_constants = MaterialConstantBuffer::Instance().Allocate(m_layout.GetSize());
+            if (!m_constants) {
+                SetState(State::Failed);
+                Logger::Instance().Error("͸   Ҵ : {}", GetPath());
+                return false;
+            }
+
+            // ε    ޸𸮶 CPU ʿ      
+            std::vector<uint8_t> constants(m_layout.GetDefaults().begin(), m_layout.GetDefaults().end());
+            for (const auto& [name, values] : m_desc.parameters) {
+                if (!m_layout.Write(name, values, constants)) {
+                    Logger::Instance().Warning("͸ Ķ : {} - {} ( ̰ų  /Ÿ ġ)",
+                        GetPath(), name);
+                }
+            }
+            std::memcpy(m_constants.GetCpuAddress(), constants.data(), constants.size());
+        }
+        else if (!m_desc.parameters.empty()) {
+            Logger::Instance().Warning("̴ {}  Ķ͸ : {}", MaterialLayout::ConstantBufferName, GetPath());
+        }
+
+        ComputeKeys();
+
+        SetSize(m_constants.GetSize());
+        SetState(State::Ready);
+
+        Logger::Instance().Info("͸ ε Ϸ: {} ( {:#x}, ؽó {},  {}/{}bytes,  Ű {:012x})",
+            GetName(), m_desc.variant, m_desc.textures.size(), m_layout.GetSize(), m_constants.GetSize(), m_stateKey);
+        return true;
+    }
+
+    void MaterialResource::Unload()
+    {
+        if (!m_parsed && !m_constants) return;
+
+        m_constants.Reset();
+        m_layout = {};
+        m_vertexShader.reset();
+        m_pixelShader.reset();
+        m_textures = {};
+        m_desc = {};
+        m_parsed = false;
+        m_pipelineKey = m_textureSetKey = m_stateKey = 0;
+
+        SetState(State::Unloaded);
+        Logger::Instance().Debug("͸ ε: {}", GetName());
+    }
+
+    bool MaterialResource::SwapContents(IResource& source)
+    {
+        auto* other = dynamic_cast<MaterialResource*>(&source);
+        if (!other) return false;
+
+        std::swap(m_desc, other->m_desc);
+        std::swap(m_parsed, other->m_parsed);
+        m_vertexShader.swap(other->m_vertexShader);
+        m_pixelShader.swap(other->m_pixelShader);
+        m_textures.swap(other->m_textures);
+        std::swap(m_layout, other->m_layout);
+        std::swap(m_constants, other->m_constants);
+        std::swap(m_pipelineKey, other->m_pipelineKey);
+        std::swap(m_textureSetKey, other->m_textureSetKey);
+        std::swap(m_stateKey, other->m_stateKey);
+        SwapBase(*other);
+        return true;
+    }
+
+    bool MaterialResource::SetParameter(std::string_view name, std::span<const float> values)
+    {
+        if (!m_constants) return false;
+        return m_layout.Write(name, values, { m_constants.GetCpuAddress(), m_layout.GetSize() });
+    }
+
+    void MaterialResource::ComputeKeys()
+    {
+        ResourceKeyBuilder pipeline;
+        pipeline.Add(m_desc.shaderPath)
+            .Add(m_desc.vertexEntry)
+            .Add(m_desc.pixelEntry)
+            .Add(m_desc.keywords.Sanitize(m_desc.variant));
+        for (const auto& name : m_desc.keywords.GetNames()) {
+            pipeline.Add(name);
+        }
+        pipeline.Add(m_desc.blend).Add(m_desc.cull);
+        m_pipelineKey = pipeline.Get();
+
+        // ؽó  ͸ η ĺ - εص  ID 
+        ResourceKeyBuilder textures;
+        for (const auto& texture : m_desc.textures) {
+            textures.Add(texture.slot).Add(texture.path).Add(texture.mode);
+        }
+        m_textureSetKey = m_desc.textures.empty() ? 0 : textures.Get();
+
+        m_stateKey = MakeStateKey(
+            PipelineIds().Get(m_pipelineKey),
+            TextureSetIds().Get(m_textureSetKey),
+            MaterialIds().Get(ResourceKeyBuilder().Add(GetPath()).Get()));
+    }
+
+    uint64_t MaterialResource::MakeDrawSortKey(BlendMode blend, uint64_t stateKey, float viewDepth)
+    {
+        const uint64_t depth = static_cast<uint64_t>(std::clamp(viewDepth, 0.0f, 1.0f) * DepthMax + 0.5f);
+        const uint64_t layer = static_cast<uint64_t>(blend) << 62;
+        const uint64_t state = stateKey & StateKeyMask;
+
+        if (blend == BlendMode::Opaque) {
+            return layer | (state << DepthBits) | depth;
+        }
+        return layer | ((DepthMax - depth) << 48) | state;
+    }
+}
@@ -0,0 +1,173 @@
+#pragma once
+#include "pch.h"
+#include "IResource.h"
+#include "ShaderResource.h"
+#include "TextureResource.h"
+#include "MaterialConstantBuffer.h"
+#include "Logger.h"
+
+namespace Resource
+{
+    // ̴ MaterialConstants   ġ (÷  HLSL ŷ Ģ ׻ ġ)
+    class MaterialLayout {
+    public:
+        static constexpr const char* ConstantBufferName = "MaterialConstants";
+
+        struct Parameter {
+            std::string name;
+            uint32_t offset = 0;
+            uint32_t size = 0;
+            D3D_SHADER_VARIABLE_TYPE type = D3D_SVT_FLOAT;
+            uint32_t elements = 0;          // 迭̸   (迭 Ҹ 16Ʈ ä)
+        };
+
+        // ־ ̴  ó MaterialConstants  ̴ ġ (ƹ   ġ)
+        static MaterialLayout Reflect(std::span<ID3DBlob* const> shaders);
+
+        bool IsEmpty() const { return m_size == 0; }
+        uint32_t GetSize() const { return m_size; }
+        const std::vector<Parameter>& GetParameters() const { return m_parameters; }
+        const Parameter* Find(std::string_view name) const;
+
+        // ̴  ʱⰪ ä  (ʱⰪ   0)
+        std::span<const uint8_t> GetDefaults() const { return m_defaults; }
+
+        //  ϳ ġ  (int/uint/bool  ȯ).  ̰ų  ġ false
+        bool Write(std::string_view name, std::span<const float> values, std::span<uint8_t> constants) const;
+
+    private:
+        uint32_t m_size = 0;
+        std::vector<Parameter> m_parameters;
+        std::vector<uint8_t> m_defaults;
+    };
+
+    // ͸ - ̴ , ؽó,   ҽ (ؽƮ .mat , # ڴ ּ)
+    //   shader <> [VS Ʈ] [PS Ʈ]
+    //   keywords <Ű...>      ̴  Ű (  Ʈ̹Ƿ  ̴  )
+    //   enable <Ű...>         Ű
+    //   texture <> <> [stream]
+    //   param ≮> <...>      MaterialConstants  (   ̴ ʱⰪ)
+    //   blend opaque|alpha|additive
+    //   cull back|front|none
+    // - ̴/ؽó ε  ûϹǷ Load ̵ غ  ȣ
+    // -  MaterialConstantBuffer  ϳ ġ  ΰ ο츶 ּҸ ε
+    // -   Ű =  PSO.  Ű ο츦 ϸ PSO -> ؽó ->    پ
+    class MaterialResource : public IResource {
+    public:
+        static constexpr Type ResourceType = Type::Material;
+        static constexpr uint32_t MaxTextures = 4;     // t0 ~ t3
+
+        enum class BlendMode : uint8_t {
+            Opaque,
+            AlphaBlend,
+            Additive
+        };
+
+        enum class CullMode : uint8_t {
+            Back,
+            Front,
+            None
+        };
+
+        struct TextureSlot {
+            uint32_t slot = 0;
+            std::string path;
+            TextureResource::LoadMode mode = TextureResource::LoadMode::Full;
+        };
+
+        struct Desc {
+            std::string shaderPath;
+            std::string vertexEntry = "VSMain";
+            std::string pixelEntry = "PSMain";
+            ShaderKeywordSet keywords;
+            ShaderVariantKey variant = 0;
+            std::vector<TextureSlot> textures;
+            std::vector<std::pair<std::string, std::vector<float>>> parameters;
+            BlendMode blend = BlendMode::Opaque;
+            CullMode cull = CullMode::Back;
+        };
+
+        explicit MaterialResource(const std::string& path)
+            : IResource(Type::Material, path, std::filesystem::path(path).filename().string())
+        {
+            Logger::Instance().Debug("͸ ҽ : {}", GetName());
+        }
+
+        ~MaterialResource() override {
+            Unload();
+        }
+
+        bool Load() override;
+        void Unload() override;
+
+        //  о ̴  ؽó û (ó   û 忡 ȣ)
+        std::vector<std::shared_ptr<IResource>> RequestLoadDependencies() override;
+
+        std::shared_ptr<IResource> CreateReloadCopy() const override {
+            return std::make_shared<MaterialResource>(GetPath());
+        }
+
+        bool SwapContents(IResource& source) override;
+
+        // .mat ؽƮ ؼ. ϸ error  ȣ 
+        static bool Parse(std::string_view text, Desc& desc, std::string& error);
+
+        const Desc& GetDesc() const { return m_desc; }
+        const std::shared_ptr<ShaderResource>& GetVertexShader() const { return m_vertexShader; }
+        const std::shared_ptr<ShaderResource>& GetPixelShader() const { return m_pixelShader; }
+        const std::shared_ptr<TextureResource>& GetTexture(uint32_t slot) const { return m_textures[slot]; }
+        BlendMode GetBlendMode() const { return m_desc.blend; }
+        CullMode GetCullMode() const { return m_desc.cull; }
+
+        //  (̴ MaterialConstants  ʾ ּ 0)
+        const MaterialLayout& GetLayout() const { return m_layout; }
+        D3D12_GPU_VIRTUAL_ADDRESS GetConstantsAddress() const { return m_constants.GetGpuAddress(); }
+
+        //  ϳ  ( , GPU  ͸ ׸   )
+        bool SetParameter(std::string_view name, std::span<const float> values);
+
+        //  Ű - ̴    ؽ (PSO ĳ Ű)
+        uint64_t GetPipelineKey() const { return m_pipelineKey; }
+        // ؽó  Ű - Ժ ؽó ؽ (  ũ ̺ )
+        uint64_t GetTextureSetKey() const { return m_textureSetKey; }
+
+        //   Ű (48Ʈ): [ ID 16][ؽó  ID 16][͸ ID 16]
+        // ID Ű ó   ٴ 16Ʈ ȣ (   ȣ  - Ӹ )
+        uint64_t GetStateKey() const { return m_stateKey; }
+
+        // ο  Ű -  ϸ    
+        // : [ 2][ 48][ 14]          ³   ȿ  -> 
+        // : [ 2][ 14 ( -> )][ 48]  ռ  켱
+        // viewDepth: 0() ~ 1()
+        static uint64_t MakeDrawSortKey(BlendMode blend, uint64_t stateKey, float viewDepth);
+        uint64_t MakeDrawSortKey(float viewDepth) const {
+            return MakeDrawSortKey(m_desc.blend, m_stateKey, viewDepth);
+        }
+
+        //  Ű ̷ ID (ο  /)
+        static uint16_t GetPipelineId(uint64_t stateKey) { return static_cast<uint16_t>(stateKey >> 32); }
+        static uint16_t GetTextureSetId(uint64_t stateKey) { return static_cast<uint16_t>(stateKey >> 16); }
+        static uint16_t GetMaterialId(uint64_t stateKey) { return static_cast<uint16_t>(stateKey); }
+        static uint64_t MakeStateKey(uint16_t pipelineId, uint16_t textureSetId, uint16_t materialId) {
+            return (uint64_t(pipelineId) << 32) | (uint64_t(textureSetId) << 16) | materialId;
+        }
+
+    private:
+        bool ReadDesc();
+        void ComputeKeys();
+
+        Desc m_desc;
+        bool m_parsed = false;
+
+        std::shared_ptr<ShaderResource> m_vertexShader;
+        std::shared_ptr<ShaderResource> m_pixelShader;
+        std::array<std::shared_ptr<TextureResource>, MaxTextures> m_textures;
+
+        MaterialLayout m_layout;
+        MaterialConstantBuffer::Block m_constants;
+
+        uint64_t m_pipelineKey = 0;
+        uint64_t m_textureSetKey = 0;
+        uint64_t m_stateKey = 0;
+    };
+}
@@ -38,6 +38,14 @@ bool Memory::MemoryManager::Initialize()
             "GameObjectAllocator"
         );
 
+        // Ʈ ¡ (񵿱  IO   IoRing  ۷ )
+        m_streamingAllocator = std::make_unique<ThreadSafePoolAllocator>(
+            16 * 1024 * 1024,   //  ũ
+            2,                  //  
+            4096,               // 
+            "StreamingAllocator"
+        );
+
         Logger::Instance().Info("޸ Ŵ ʱȭ Ϸ");
         return true;
     }
@@ -57,6 +65,7 @@ void Memory::MemoryManager::Shutdown()
     m_levelAllocator.reset();
     m_permanentAllocator.reset();
     m_gameObjectAllocator.reset();
+    m_streamingAllocator.reset();
 }
 
 void Memory::MemoryManager::BeginFrame()
@@ -81,6 +90,8 @@ Memory::IAllocator* Memory::MemoryManager::GetAllocator(Domain domain)
         return m_permanentAllocator.get();
     case Domain::GameObject:
         return m_gameObjectAllocator.get();
+    case Domain::Streaming:
+        return m_streamingAllocator.get();
     default:
         Logger::Instance().Error("߸ ޸  û");
         return nullptr;
@@ -109,4 +120,8 @@ void Memory::MemoryManager::PrintStats()
     Logger::Instance().Info("ӿƮ Ҵ: {}/{} Ʈ ",
         m_gameObjectAllocator->GetUsedMemory(),
         m_gameObjectAllocator->GetTotalMemory());
+
+    Logger::Instance().Info("Ʈ Ҵ: {}/{} Ʈ ",
+        m_streamingAllocator->GetUsedMemory(),
+        m_streamingAllocator->GetTotalMemory());
 }
@@ -15,6 +15,7 @@ namespace Memory
             Level,      // /  Ǵ ޸
             Permanent,  //  ü   Ǵ ޸
             GameObject, //  Ʈ  ޸
+            Streaming,  //  б ¡  (ū  )
             Count
         };
 
@@ -47,6 +48,7 @@ namespace Memory
         std::unique_ptr<ThreadSafeStackAllocator> m_levelAllocator;
         std::unique_ptr<ThreadSafeLinearAllocator> m_permanentAllocator;
         std::unique_ptr<ThreadSafePoolAllocator> m_gameObjectAllocator;
+        std::unique_ptr<ThreadSafePoolAllocator> m_streamingAllocator;
 
         size_t m_currentFrameIndex = 0;
     };
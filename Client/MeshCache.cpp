@@ -0,0 +1,200 @@
+#include "pch.h"
+#include "MeshCache.h"
+#include "Logger.h"
+
+namespace Resource
+{
+    namespace MeshCache
+    {
+        namespace
+        {
+            uint64_t AlignUp(uint64_t value)
+            {
+                return (value + MeshFormat::SectionAlignment - 1) & ~uint64_t(MeshFormat::SectionAlignment - 1);
+            }
+
+            bool SectionInRange(uint64_t offset, uint64_t count, uint64_t stride, uint64_t fileSize)
+            {
+                if (offset % MeshFormat::SectionAlignment != 0 || offset > fileSize) return false;
+                return count <= (fileSize - offset) / stride;
+            }
+        }
+
+        uint64_t ComputeSourceStamp(const std::filesystem::path& source, uint32_t importFlags)
+        {
+            std::error_code ec;
+            const auto size = std::filesystem::file_size(source, ec);
+            if (ec) return 0;
+            const auto time = std::filesystem::last_write_time(source, ec);
+            if (ec) return 0;
+
+            const uint64_t values[] = {
+                static_cast<uint64_t>(size),
+                static_cast<uint64_t>(time.time_since_epoch().count()),
+                importFlags,
+                MeshFormat::Version,
+                sizeof(PackedVertex)
+            };
+
+            uint64_t hash = 14695981039346656037ull;
+            for (uint64_t value : values) {
+                for (int i = 0; i < 8; ++i) {
+                    hash = (hash ^ ((value >> (i * 8)) & 0xFF)) * 1099511628211ull;
+                }
+            }
+            return hash;
+        }
+
+        std::vector<PackedVertex> PackVertices(const MeshData& data)
+        {
+            std::vector<PackedVertex> packed(data.vertices.size());
+            for (const auto& mesh : data.meshes) {
+                const auto dequantization = VertexPacking::ComputeDequantization(mesh.boundsMin, mesh.boundsMax);
+                VertexPacking::Pack(std::span(data.vertices).subspan(mesh.vertexOffset, mesh.vertexCount),
+                    dequantization, packed.data() + mesh.vertexOffset);
+            }
+            return packed;
+        }
+
+        bool Write(const std::filesystem::path& path, const MeshData& data, uint64_t sourceStamp)
+        {
+            const auto packed = PackVertices(data);
+
+            MeshFormat::Header header{};
+            header.magic = MeshFormat::Magic;
+            header.version = MeshFormat::Version;
+            header.sourceStamp = sourceStamp;
+            header.meshCount = static_cast<uint32_t>(data.meshes.size());
+            header.vertexStride = sizeof(PackedVertex);
+            header.meshOffset = AlignUp(sizeof(MeshFormat::Header));
+            header.lodOffset = AlignUp(header.meshOffset + data.meshes.size() * sizeof(MeshFormat::Mesh));
+            header.lodCount = static_cast<uint32_t>(data.lods.size());
+            header.meshletOffset = AlignUp(header.lodOffset + data.lods.size() * sizeof(MeshFormat::Lod));
+            header.meshletCount = static_cast<uint32_t>(data.meshlets.size());
+            header.meshletVertexOffset = AlignUp(header.meshletOffset + data.meshlets.size() * sizeof(MeshFormat::Meshlet));
+            header.meshletVertexCount = data.meshletVertices.size();
+            header.meshletTriangleOffset = AlignUp(header.meshletVertexOffset + data.meshletVertices.size() * sizeof(uint32_t));
+            header.meshletTriangleCount = data.meshletTriangles.size() / 3;
+            header.vertexOffset = AlignUp(header.meshletTriangleOffset + data.meshletTriangles.size());
+            header.vertexCount = data.vertices.size();
+            header.indexOffset = AlignUp(header.vertexOffset + packed.size() * sizeof(PackedVertex));
+            header.indexCount = data.indices.size();
+
+            for (int k = 0; k < 3; ++k) {
+                header.boundsMin[k] = data.meshes.empty() ? 0.0f : std::numeric_limits<float>::max();
+                header.boundsMax[k] = data.meshes.empty() ? 0.0f : std::numeric_limits<float>::lowest();
+            }
+            for (const auto& mesh : data.meshes) {
+                for (int k = 0; k < 3; ++k) {
+                    header.boundsMin[k] = std::min(header.boundsMin[k], mesh.boundsMin[k]);
+                    header.boundsMax[k] = std::max(header.boundsMax[k], mesh.boundsMax[k]);
+                }
+            }
+
+            std::error_code ec;
+            if (path.has_parent_path()) {
+                std::filesystem::create_directories(path.parent_path(), ec);
+            }
+
+            auto tempPath = path;
+            tempPath += std::format(".{}.tmp", std::hash<std::thread::id>{}(std::this_thread::get_id()));
+
+            {
+                std::ofstream file(tempPath, std::ios::binary | std::ios::trunc);
+                if (!file) {
+                    return false;
+                }
+
+                auto writeSection = [&file](uint64_t offset, const void* bytes, size_t size) {
+                    static const char padding[MeshFormat::SectionAlignment] = {};
+                    const uint64_t position = static_cast<uint64_t>(file.tellp());
+                    file.write(padding, static_cast<std::streamsize>(offset - position));
+                    file.write(static_cast<const char*>(bytes), static_cast<std::streamsize>(size));
+                };
+
+                file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+                writeSection(header.meshOffset, data.meshes.data(), data.meshes.size() * sizeof(MeshFormat::Mesh));
+                writeSection(header.lodOffset, data.lods.data(), data.lods.size() * sizeof(MeshFormat::Lod));
+                writeSection(header.meshletOffset, data.meshlets.data(), data.meshlets.size() * sizeof(MeshFormat::Meshlet));
+                writeSection(header.meshletVertexOffset, data.meshletVertices.data(),
+                    data.meshletVertices.size() * sizeof(uint32_t));
+                writeSection(header.meshletTriangleOffset, data.meshletTriangles.data(), data.meshletTriangles.size());
+                writeSection(header.vertexOffset, packed.data(), packed.size() * sizeof(PackedVertex));
+                writeSection(header.indexOffset, data.indices.data(), data.indices.size() * sizeof(uint32_t));
+
+                if (!file) {
+                    file.close();
+                    std::filesystem::remove(tempPath, ec);
+                    return false;
+                }
+            }
+
+            std::filesystem::rename(tempPath, path, ec);
+            if (ec) {
+                std::filesystem::remove(tempPath, ec);
+                return false;
+            }
+            return true;
+        }
+
+        MeshView Parse(std::span<const uint8_t> bytes)
+        {
+            if (bytes.size() < sizeof(MeshFormat::Header)) return {};
+
+            const auto* header = reinterpret_cast<const MeshFormat::Header*>(bytes.data());
+            if (header->magic != MeshFormat::Magic || header->version != MeshFormat::Version ||
+                header->vertexStride != sizeof(PackedVertex)) {
+                return {};
+            }
+
+            const uint64_t size = bytes.size();
+            if (!SectionInRange(header->meshOffset, header->meshCount, sizeof(MeshFormat::Mesh), size) ||
+                !SectionInRange(header->lodOffset, header->lodCount, sizeof(MeshFormat::Lod), size) ||
+                !SectionInRange(header->meshletOffset, header->meshletCount, sizeof(MeshFormat::Meshlet), size) ||
+                !SectionInRange(header->meshletVertexOffset, header->meshletVertexCount, sizeof(uint32_t), size) ||
+                !SectionInRange(header->meshletTriangleOffset, header->meshletTriangleCount, 3, size) ||
+                !SectionInRange(header->vertexOffset, header->vertexCount, sizeof(PackedVertex), size) ||
+                !SectionInRange(header->indexOffset, header->indexCount, sizeof(uint32_t), size)) {
+                return {};
+            }
+
+            MeshView view;
+            view.header = header;
+            view.meshes = { reinterpret_cast<const MeshFormat::Mesh*>(bytes.data() + header->meshOffset), header->meshCount };
+            view.lods = { reinterpret_cast<const MeshFormat::Lod*>(bytes.data() + header->lodOffset), header->lodCount };
+            view.meshlets = { reinterpret_cast<const MeshFormat::Meshlet*>(bytes.data() + header->meshletOffset),
+                header->meshletCount };
+            view.meshletVertices = { reinterpret_cast<const uint32_t*>(bytes.data() + header->meshletVertexOffset),
+                static_cast<size_t>(header->meshletVertexCount) };
+            view.meshletTriangles = { bytes.data() + header->meshletTriangleOffset,
+                static_cast<size_t>(header->meshletTriangleCount * 3) };
+            view.vertices = { reinterpret_cast<const PackedVertex*>(bytes.data() + header->vertexOffset),
+                static_cast<size_t>(header->vertexCount) };
+            view.indices = { reinterpret_cast<const uint32_t*>(bytes.data() + header->indexOffset),
+                static_cast<size_t>(header->indexCount) };
+
+            // ޽  ۸  ׸ ߿ GPU ߸ ޸𸮸 
+            for (const auto& mesh : view.meshes) {
+                if (uint64_t(mesh.vertexOffset) + mesh.vertexCount > header->vertexCount ||
+                    uint64_t(mesh.indexOffset) + mesh.indexCount > header->indexCount ||
+                    uint64_t(mesh.lodOffset) + mesh.lodCount > header->lodCount ||
+                    uint64_t(mesh.meshletOffset) + mesh.meshletCount > header->meshletCount) {
+                    return {};
+                }
+            }
+            for (const auto& lod : view.lods) {
+                if (uint64_t(lod.indexOffset) + lod.indexCount > header->indexCount) {
+                    return {};
+                }
+            }
+            for (const auto& meshlet : view.meshlets) {
+                if (uint64_t(meshlet.vertexOffset) + meshlet.vertexCount > header->meshletVertexCount ||
+                    uint64_t(meshlet.triangleOffset) + meshlet.triangleCount > header->meshletTriangleCount ||
+                    uint64_t(meshlet.indexOffset) + meshlet.triangleCount * 3ull > header->indexCount) {
+                    return {};
+                }
+            }
+            return view;
+        }
+    }
+}
@@ -0,0 +1,126 @@
+#pragma once
+#include "pch.h"
+#include "VertexPacking.h"
+
+namespace Resource
+{
+    // ŷ Ÿ ޽  ̾ƿ (.mesh)
+    // [Header][Mesh x meshCount][Lod x lodCount][Meshlet x meshletCount]
+    // [uint32 meshlet vertex x meshletVertexCount][uint8 x 3 meshlet triangle x meshletTriangleCount]
+    // [PackedVertex x vertexCount][uint32 index x indexCount]
+    //  ġ ޽   ȭ (VertexPacking::ComputeDequantization)
+    //   16Ʈ  -   ״ ε  
+    namespace MeshFormat
+    {
+        constexpr uint32_t Magic = 0x3148534D;     // "MSH1"
+        constexpr uint32_t Version = 4;
+        constexpr uint32_t SectionAlignment = 16;
+
+        struct Header {
+            uint32_t magic;
+            uint32_t version;
+            uint64_t sourceStamp;       //  ũ/ ð/Ʈ ɼ ؽ - ٸ ٽ ŷ
+            uint32_t meshCount;
+            uint32_t vertexStride;
+            uint64_t meshOffset;
+            uint64_t vertexOffset;
+            uint64_t vertexCount;
+            uint64_t indexOffset;
+            uint64_t indexCount;
+            uint64_t lodOffset;
+            uint32_t lodCount;
+            uint32_t meshletCount;
+            uint64_t meshletOffset;
+            uint64_t meshletVertexOffset;
+            uint64_t meshletVertexCount;
+            uint64_t meshletTriangleOffset;
+            uint64_t meshletTriangleCount;
+            float boundsMin[3];
+            float boundsMax[3];
+        };
+        static_assert(sizeof(Header) == 144);
+
+        // ޽ -   /ε   (DrawIndexedInstanced  ״)
+        struct Mesh {
+            uint32_t vertexOffset;      // BaseVertexLocation
+            uint32_t vertexCount;
+            uint32_t indexOffset;       // StartIndexLocation (LOD0)
+            uint32_t indexCount;
+            uint32_t materialIndex;
+            float acmr;                 // ŷ   ĳ ̽  (ܿ)
+            uint32_t lodOffset;         // Lod ̺  (LOD0,  ĥ)
+            uint32_t lodCount;
+            uint32_t meshletOffset;     // Meshlet ̺  (LOD0 ﰢ ü )
+            uint32_t meshletCount;
+            float boundsMin[3];
+            float boundsMax[3];
+        };
+        static_assert(sizeof(Mesh) == 64);
+
+        // ޽ LOD -     ε  ٸ
+        struct Lod {
+            uint32_t indexOffset;
+            uint32_t indexCount;
+            float error;                // LOD0  ִ ǥ  ( ǥ ) - ȭ  
+            uint32_t reserved;
+        };
+        static_assert(sizeof(Lod) == 16);
+
+        // Ŭ ( 64, ﰢ 124 ) - CPU ø ,  ޽ ̴ Է
+        // LOD0 ε meshlet  ĵ ־ [indexOffset, indexOffset + triangleCount * 3) ٷ ׸  
+        struct Meshlet {
+            uint32_t vertexOffset;      // meshlet   ( ޽   ȣ)
+            uint32_t triangleOffset;    // meshlet ﰢ  (ﰢ , meshlet  uint8 x 3)
+            uint32_t indexOffset;       // ε   ﰢ 
+            uint16_t vertexCount;
+            uint16_t triangleCount;
+            float center[3];            //  
+            float radius;
+            float coneApex[3];          //   - dot(normalize(apex - ī޶), axis) >= cutoff  ޸
+            float coneCutoff;           // 1̸  ʹ о ޸ ø Ұ
+            float coneAxis[3];
+            uint32_t reserved;
+        };
+        static_assert(sizeof(Meshlet) == 64);
+    }
+
+    // ŷ  ޽ (ε ޽ ,   )
+    struct MeshData {
+        std::vector<MeshFormat::Mesh> meshes;
+        std::vector<MeshFormat::Lod> lods;
+        std::vector<MeshFormat::Meshlet> meshlets;
+        std::vector<uint32_t> meshletVertices;
+        std::vector<uint8_t> meshletTriangles;
+        std::vector<Vertex> vertices;
+        std::vector<uint32_t> indices;
+    };
+
+    // ε .mesh  Ű  ( ,    ִ ȸ ȿ)
+    struct MeshView {
+        const MeshFormat::Header* header = nullptr;
+        std::span<const MeshFormat::Mesh> meshes;
+        std::span<const MeshFormat::Lod> lods;
+        std::span<const MeshFormat::Meshlet> meshlets;
+        std::span<const uint32_t> meshletVertices;
+        std::span<const uint8_t> meshletTriangles;     // ﰢ 3Ʈ
+        std::span<const PackedVertex> vertices;
+        std::span<const uint32_t> indices;
+
+        explicit operator bool() const { return header != nullptr; }
+    };
+
+    namespace MeshCache
+    {
+        //   ٲ Ǵϴ  (  0)
+        uint64_t ComputeSourceStamp(const std::filesystem::path& source, uint32_t importFlags);
+
+        // ޽ø ڱ  ȭ  (ϰ  )
+        std::vector<PackedVertex> PackVertices(const MeshData& data);
+
+        // ӽ Ͽ   ̸ ٲ - д      ʵ
+        bool Write(const std::filesystem::path& path, const MeshData& data, uint64_t sourceStamp);
+
+        //    ˻ϰ   (ϸ  )
+        MeshView Parse(std::span<const uint8_t> bytes);
+    }
+}
@@ -0,0 +1,442 @@
+#include "pch.h"
+#include "MeshOptimizer.h"
+
+namespace Resource
+{
+    namespace MeshOptimizer
+    {
+        namespace
+        {
+            constexpr uint32_t InvalidIndex = ~0u;
+
+            // Forsyth   (  )
+            constexpr uint32_t ForsythCacheSize = 32;
+            constexpr uint32_t MaxValence = 32;
+            constexpr float CacheDecayPower = 1.5f;
+            constexpr float LastTriangleScore = 0.75f;
+            constexpr float ValenceBoostScale = 2.0f;
+            constexpr float ValenceBoostPower = 0.5f;
+
+            struct ScoreTable {
+                float cache[ForsythCacheSize + 1];  //  ĭ ĳ 
+                float valence[MaxValence + 1];
+
+                ScoreTable() {
+                    for (uint32_t i = 0; i < ForsythCacheSize; ++i) {
+                        //  ׸ ﰢ    -   ٷ ٽ  ͺ ̿ 
+                        cache[i] = i < 3 ? LastTriangleScore
+                            : std::pow(1.0f - float(i - 3) / float(ForsythCacheSize - 3), CacheDecayPower);
+                    }
+                    cache[ForsythCacheSize] = 0.0f;
+
+                    //  ﰢ      ﰢ  ʰ 
+                    valence[0] = 0.0f;
+                    for (uint32_t i = 1; i <= MaxValence; ++i) {
+                        valence[i] = ValenceBoostScale * std::pow(float(i), -ValenceBoostPower);
+                    }
+                }
+            };
+
+            float VertexScore(const ScoreTable& table, uint32_t cachePosition, uint32_t remaining)
+            {
+                if (remaining == 0) return -1.0f;
+                return table.cache[cachePosition] + table.valence[std::min(remaining, MaxValence)];
+            }
+
+            uint64_t HashBytes(const uint8_t* bytes, size_t size)
+            {
+                uint64_t hash = 14695981039346656037ull;
+                for (size_t i = 0; i < size; ++i) {
+                    hash = (hash ^ bytes[i]) * 1099511628211ull;
+                }
+                return hash;
+            }
+
+            // Ÿӽ  FIFO ĳ ùķ̼
+            class FifoCache {
+            public:
+                FifoCache(size_t vertexCount, uint32_t cacheSize)
+                    : m_timestamps(vertexCount, 0), m_cacheSize(cacheSize), m_time(cacheSize + 1) {}
+
+                // ̽ true ( ĳÿ )
+                bool Touch(uint32_t vertex) {
+                    if (m_time - m_timestamps[vertex] <= m_cacheSize) return false;
+                    m_timestamps[vertex] = m_time++;
+                    return true;
+                }
+
+                void Flush() { m_time += m_cacheSize + 1; }
+
+            private:
+                std::vector<uint32_t> m_timestamps;
+                uint32_t m_cacheSize;
+                uint32_t m_time;
+            };
+
+            uint32_t TriangleMisses(FifoCache& cache, const uint32_t* triangle)
+            {
+                return uint32_t(cache.Touch(triangle[0])) + uint32_t(cache.Touch(triangle[1])) + uint32_t(cache.Touch(triangle[2]));
+            }
+        }
+
+        size_t GenerateVertexRemap(const void* vertices, size_t vertexCount, size_t vertexSize,
+            std::vector<uint32_t>& remap)
+        {
+            remap.assign(vertexCount, InvalidIndex);
+            if (vertexCount == 0) return 0;
+
+            const auto* bytes = static_cast<const uint8_t*>(vertices);
+
+            //  ּ ؽ ̺ ( 50% )
+            const size_t tableSize = std::bit_ceil(std::max<size_t>(vertexCount * 2, 16));
+            const size_t mask = tableSize - 1;
+            std::vector<uint32_t> table(tableSize, InvalidIndex);
+
+            uint32_t unique = 0;
+            for (size_t i = 0; i < vertexCount; ++i) {
+                const uint8_t* vertex = bytes + i * vertexSize;
+                size_t slot = static_cast<size_t>(HashBytes(vertex, vertexSize)) & mask;
+
+                while (true) {
+                    const uint32_t existing = table[slot];
+                    if (existing == InvalidIndex) {
+                        table[slot] = static_cast<uint32_t>(i);
+                        remap[i] = unique++;
+                        break;
+                    }
+                    if (std::memcmp(bytes + existing * vertexSize, vertex, vertexSize) == 0) {
+                        remap[i] = remap[existing];
+                        break;
+                    }
+                    slot = (slot + 1) & mask;
+                }
+            }
+            return unique;
+        }
+
+        size_t GenerateFetchRemap(std::span<const uint32_t> indices, size_t vertexCount,
+            std::vector<uint32_t>& remap)
+        {
+            remap.assign(vertexCount, InvalidIndex);
+
+            uint32_t next = 0;
+            for (uint32_t index : indices) {
+                if (remap[index] == InvalidIndex) {
+                    remap[index] = next++;
+                }
+            }
+            return next;
+        }
+
+        void RemapIndices(std::span<uint32_t> indices, std::span<const uint32_t> remap)
+        {
+            for (auto& index : indices) {
+                index = remap[index];
+            }
+        }
+
+        void RemapVertices(std::vector<Vertex>& vertices, std::span<const uint32_t> remap, size_t newCount)
+        {
+            std::vector<Vertex> result(newCount);
+            for (size_t i = 0; i < vertices.size(); ++i) {
+                if (remap[i] != InvalidIndex) {
+                    result[remap[i]] = vertices[i];
+                }
+            }
+            vertices = std::move(result);
+        }
+
+        void OptimizeVertexCache(std::span<uint32_t> indices, size_t vertexCount)
+        {
+            const size_t triangleCount = indices.size() / 3;
+            if (triangleCount < 2 || vertexCount == 0) return;
+
+            static const ScoreTable table;
+
+            //  ->  ﰢ . [offset, offset + remaining)  ׸  ﰢ
+            std::vector<uint32_t> remaining(vertexCount, 0);
+            for (uint32_t index : indices) {
+                ++remaining[index];
+            }
+
+            std::vector<uint32_t> offsets(vertexCount, 0);
+            for (size_t v = 1; v < vertexCount; ++v) {
+                offsets[v] = offsets[v - 1] + remaining[v - 1];
+            }
+
+            std::vector<uint32_t> adjacency(indices.size());
+            {
+                std::vector<uint32_t> fill(offsets);
+                for (size_t i = 0; i < indices.size(); ++i) {
+                    adjacency[fill[indices[i]]++] = static_cast<uint32_t>(i / 3);
+                }
+            }
+
+            std::vector<uint32_t> cachePosition(vertexCount, ForsythCacheSize);
+            std::vector<float> vertexScores(vertexCount);
+            for (size_t v = 0; v < vertexCount; ++v) {
+                vertexScores[v] = VertexScore(table, ForsythCacheSize, remaining[v]);
+            }
+
+            std::vector<float> triangleScores(triangleCount);
+            for (size_t t = 0; t < triangleCount; ++t) {
+                triangleScores[t] = vertexScores[indices[t * 3]] + vertexScores[indices[t * 3 + 1]] +
+                    vertexScores[indices[t * 3 + 2]];
+            }
+
+            std::vector<bool> emitted(triangleCount, false);
+            std::vector<uint32_t> result;
+            result.reserve(indices.size());
+
+            //  ﰢ 3 +  ĳ
+            std::vector<uint32_t> cache;
+            std::vector<uint32_t> nextCache;
+            cache.reserve(ForsythCacheSize + 3);
+            nextCache.reserve(ForsythCacheSize + 3);
+
+            uint32_t best = static_cast<uint32_t>(std::max_element(triangleScores.begin(), triangleScores.end()) -
+                triangleScores.begin());
+            size_t scanCursor = 0;
+
+            for (size_t emittedCount = 0; emittedCount < triangleCount; ++emittedCount) {
+                if (best == InvalidIndex) {
+                    // ĳ ȿ ĺ  -  ׸  ù ﰢ 
+                    while (emitted[scanCursor]) ++scanCursor;
+                    best = static_cast<uint32_t>(scanCursor);
+                }
+
+                const uint32_t* triangle = &indices[best * 3];
+                result.insert(result.end(), triangle, triangle + 3);
+                emitted[best] = true;
+
+                //  Ͽ ﰢ 
+                for (int k = 0; k < 3; ++k) {
+                    const uint32_t v = triangle[k];
+                    uint32_t* list = &adjacency[offsets[v]];
+                    const uint32_t count = remaining[v];
+                    for (uint32_t i = 0; i < count; ++i) {
+                        if (list[i] == best) {
+                            list[i] = list[count - 1];
+                            break;
+                        }
+                    }
+                    --remaining[v];
+                }
+
+                // LRU ĳ  -  ׸  
+                nextCache.assign(triangle, triangle + 3);
+                for (uint32_t v : cache) {
+                    if (v != triangle[0] && v != triangle[1] && v != triangle[2]) {
+                        nextCache.push_back(v);
+                    }
+                }
+
+                // ĳ  (з  )  ٽ ű ̸  ﰢ ݿ
+                for (size_t i = 0; i < nextCache.size(); ++i) {
+                    const uint32_t v = nextCache[i];
+                    cachePosition[v] = i < ForsythCacheSize ? static_cast<uint32_t>(i) : ForsythCacheSize;
+
+                    const float score = VertexScore(table, cachePosition[v], remaining[v]);
+                    const float delta = score - vertexScores[v];
+                    vertexScores[v] = score;
+
+                    const uint32_t* list = &adjacency[offsets[v]];
+                    for (uint32_t j = 0; j < remaining[v]; ++j) {
+                        triangleScores[list[j]] += delta;
+                    }
+                }
+
+                if (nextCache.size() > ForsythCacheSize) {
+                    nextCache.resize(ForsythCacheSize);
+                }
+                std::swap(cache, nextCache);
+
+                //  ﰢ ĳ   ﰢ ߿  ( ð)
+                best = InvalidIndex;
+                float bestScore = -1.0f;
+                for (uint32_t v : cache) {
+                    const uint32_t* list = &adjacency[offsets[v]];
+                    for (uint32_t j = 0; j < remaining[v]; ++j) {
+                        if (triangleScores[list[j]] > bestScore) {
+                            bestScore = triangleScores[list[j]];
+                            best = list[j];
+                        }
+                    }
+                }
+            }
+
+            std::copy(result.begin(), result.end(), indices.begin());
+        }
+
+        void OptimizeOverdraw(std::span<uint32_t> indices, const float* positions, size_t positionStride,
+            size_t vertexCount, float threshold)
+        {
+            const size_t triangleCount = indices.size() / 3;
+            if (triangleCount < 2 || vertexCount == 0) return;
+
+            const auto* positionBytes = reinterpret_cast<const uint8_t*>(positions);
+            auto position = [&](uint32_t v) {
+                return reinterpret_cast<const float*>(positionBytes + v * positionStride);
+            };
+
+            // 1.  :    ĳ ̽ ﰢ - ⼭ ڸ ĳ ս 
+            std::vector<uint32_t> hardBoundaries;
+            {
+                FifoCache cache(vertexCount, CacheSize);
+                for (size_t t = 0; t < triangleCount; ++t) {
+                    if (TriangleMisses(cache, &indices[t * 3]) == 3) {
+                        hardBoundaries.push_back(static_cast<uint32_t>(t));
+                    }
+                }
+            }
+            hardBoundaries.push_back(static_cast<uint32_t>(triangleCount));
+
+            // 2.  :  Ŭ ȿ պκ ACMR Ŭ ACMR threshold  ̳ 
+            std::vector<uint32_t> clusters;
+            {
+                FifoCache cache(vertexCount, CacheSize);
+                for (size_t h = 0; h + 1 < hardBoundaries.size(); ++h) {
+                    const uint32_t begin = hardBoundaries[h];
+                    const uint32_t end = hardBoundaries[h + 1];
+
+                    cache.Flush();
+                    uint32_t clusterMisses = 0;
+                    for (uint32_t t = begin; t < end; ++t) {
+                        clusterMisses += TriangleMisses(cache, &indices[t * 3]);
+                    }
+                    const float limit = float(clusterMisses) / float(end - begin) * threshold;
+
+                    clusters.push_back(begin);
+                    cache.Flush();
+                    uint32_t start = begin;
+                    uint32_t misses = 0;
+                    for (uint32_t t = begin; t < end; ++t) {
+                        misses += TriangleMisses(cache, &indices[t * 3]);
+
+                        if (t + 1 < end && float(misses) / float(t + 1 - start) <= limit) {
+                            clusters.push_back(t + 1);
+                            cache.Flush();
+                            start = t + 1;
+                            misses = 0;
+                        }
+                    }
+                }
+            }
+            clusters.push_back(static_cast<uint32_t>(triangleCount));
+
+            // 3. Ŭ͸   ߽ɰ   - ޽ ߽ɿ ٱ Ҽ  ׸
+            struct ClusterInfo {
+                float centroid[3];
+                float normal[3];
+                float area;
+                float sortKey;
+            };
+            const size_t clusterCount = clusters.size() - 1;
+            std::vector<ClusterInfo> infos(clusterCount);
+
+            float meshCentroid[3] = {};
+            float meshArea = 0.0f;
+
+            for (size_t c = 0; c < clusterCount; ++c) {
+                ClusterInfo& info = infos[c];
+                info = {};
+
+                for (uint32_t t = clusters[c]; t < clusters[c + 1]; ++t) {
+                    const float* p0 = position(indices[t * 3]);
+                    const float* p1 = position(indices[t * 3 + 1]);
+                    const float* p2 = position(indices[t * 3 + 2]);
+
+                    const float e1[3] = { p1[0] - p0[0], p1[1] - p0[1], p1[2] - p0[2] };
+                    const float e2[3] = { p2[0] - p0[0], p2[1] - p0[1], p2[2] - p0[2] };
+                    const float n[3] = {
+                        e1[1] * e2[2] - e1[2] * e2[1],
+                        e1[2] * e2[0] - e1[0] * e2[2],
+                        e1[0] * e2[1] - e1[1] * e2[0] };
+                    const float area = std::sqrt(n[0] * n[0] + n[1] * n[1] + n[2] * n[2]);
+
+                    for (int k = 0; k < 3; ++k) {
+                        info.centroid[k] += (p0[k] + p1[k] + p2[k]) * (area / 3.0f);
+                        info.normal[k] += n[k];
+                    }
+                    info.area += area;
+                }
+
+                for (int k = 0; k < 3; ++k) {
+                    meshCentroid[k] += info.centroid[k];
+                }
+                meshArea += info.area;
+
+                const float inverseArea = info.area > 0.0f ? 1.0f / info.area : 0.0f;
+                for (int k = 0; k < 3; ++k) {
+                    info.centroid[k] *= inverseArea;
+                }
+
+                const float length = std::sqrt(info.normal[0] * info.normal[0] +
+                    info.normal[1] * info.normal[1] + info.normal[2] * info.normal[2]);
+                const float inverseLength = length > 0.0f ? 1.0f / length : 0.0f;
+                for (int k = 0; k < 3; ++k) {
+                    info.normal[k] *= inverseLength;
+                }
+            }
+
+            const float inverseMeshArea = meshArea > 0.0f ? 1.0f / meshArea : 0.0f;
+            for (int k = 0; k < 3; ++k) {
+                meshCentroid[k] *= inverseMeshArea;
+            }
+
+            for (auto& info : infos) {
+                info.sortKey =
+                    (info.centroid[0] - meshCentroid[0]) * info.normal[0] +
+                    (info.centroid[1] - meshCentroid[1]) * info.normal[1] +
+                    (info.centroid[2] - meshCentroid[2]) * info.normal[2];
+            }
+
+            std::vector<uint32_t> order(clusterCount);
+            std::iota(order.begin(), order.end(), 0u);
+            std::stable_sort(order.begin(), order.end(), [&](uint32_t a, uint32_t b) {
+                return infos[a].sortKey > infos[b].sortKey;
+            });
+
+            // 4. ĵ Ŭ  ٽ  (Ŭ   ĳ ȭ  ״)
+            std::vector<uint32_t> result;
+            result.reserve(indices.size());
+            for (uint32_t c : order) {
+                result.insert(result.end(), indices.begin() + clusters[c] * 3, indices.begin() + clusters[c + 1] * 3);
+            }
+            std::copy(result.begin(), result.end(), indices.begin());
+        }
+
+        float AnalyzeVertexCache(std::span<const uint32_t> indices, size_t vertexCount, uint32_t cacheSize)
+        {
+            const size_t triangleCount = indices.size() / 3;
+            if (triangleCount == 0) return 0.0f;
+
+            FifoCache cache(vertexCount, cacheSize);
+            size_t misses = 0;
+            for (size_t t = 0; t < triangleCount; ++t) {
+                misses += TriangleMisses(cache, &indices[t * 3]);
+            }
+            return float(misses) / float(triangleCount);
+        }
+
+        void Optimize(std::vector<Vertex>& vertices, std::vector<uint32_t>& indices, float overdrawThreshold)
+        {
+            if (vertices.empty() || indices.empty()) return;
+
+            std::vector<uint32_t> remap;
+
+            const size_t unique = GenerateVertexRemap(vertices.data(), vertices.size(), sizeof(Vertex), remap);
+            RemapIndices(indices, remap);
+            RemapVertices(vertices, remap, unique);
+
+            OptimizeVertexCache(indices, vertices.size());
+
+            static_assert(offsetof(Vertex, position) == 0);
+            OptimizeOverdraw(indices, &vertices[0].position.x, sizeof(Vertex), vertices.size(), overdrawThreshold);
+
+            const size_t used = GenerateFetchRemap(indices, vertices.size(), remap);
+            RemapIndices(indices, remap);
+            RemapVertices(vertices, remap, used);
+        }
+    }
+}
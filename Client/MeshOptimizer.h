@@ -0,0 +1,45 @@
+#pragma once
+#include "pch.h"
+
+namespace Resource
+{
+    // Ÿ ޽ÿ ε/  ȭ (CPU , Ʈ    )
+    // :  ߺ  ->  ĳ ->  ->  ġ
+    // ε  ޽ (0) 
+    namespace MeshOptimizer
+    {
+        // ACMR  Ŭ    FIFO ĳ ũ (post-transform ĳ ٻ)
+        constexpr uint32_t CacheSize = 16;
+
+        //   ϴ ACMR ȭ  (1.05 = 5%)
+        constexpr float DefaultOverdrawThreshold = 1.05f;
+
+        // Ʈ    ϳ  - remap[old] = new, ȯ   
+        size_t GenerateVertexRemap(const void* vertices, size_t vertexCount, size_t vertexSize,
+            std::vector<uint32_t>& remap);
+
+        // ε ó ϴ   ȣ ű -  ʴ  ~0u, ȯ   
+        size_t GenerateFetchRemap(std::span<const uint32_t> indices, size_t vertexCount,
+            std::vector<uint32_t>& remap);
+
+        void RemapIndices(std::span<uint32_t> indices, std::span<const uint32_t> remap);
+        void RemapVertices(std::vector<Vertex>& vertices, std::span<const uint32_t> remap, size_t newCount);
+
+        // Forsyth   ĳ ȭ - ﰢ  ٲ (ĳ ũ⿡  ΰ)
+        void OptimizeVertexCache(std::span<uint32_t> indices, size_t vertexCount);
+
+        // ĳ ȭ  Ŭͷ ߶ ٱ ϴ Ŭͺ ׸ 
+        // Ŭʹ ACMR threshold  ̳ Ǵ  
+        // positions:  float3 ġ, positionStride Ʈ 
+        void OptimizeOverdraw(std::span<uint32_t> indices, const float* positions, size_t positionStride,
+            size_t vertexCount, float threshold = DefaultOverdrawThreshold);
+
+        // ﰢ   ĳ ̽ (0.5   3.0 ־)
+        float AnalyzeVertexCache(std::span<const uint32_t> indices, size_t vertexCount,
+            uint32_t cacheSize = CacheSize);
+
+        //  ܰ踦  .  ʴ  ŵ
+        void Optimize(std::vector<Vertex>& vertices, std::vector<uint32_t>& indices,
+            float overdrawThreshold = DefaultOverdrawThreshold);
+    }
+}
@@ -0,0 +1,598 @@
+#include "pch.h"
+#include "MeshSimplifier.h"
+#include "MeshOptimizer.h"
+
+namespace Resource
+{
+    namespace MeshSimplifier
+    {
+        namespace
+        {
+            constexpr uint32_t InvalidIndex = ~0u;
+
+            //    ġ -       ʵ
+            constexpr double BorderWeight = 10.0;
+
+            // Ӽ  ġ (/UV ״,  ä 4 )
+            constexpr double NormalWeight = 1.0;
+            constexpr double TexCoordWeight = 1.0;
+            constexpr double ColorWeight = 0.5;
+
+            enum VertexKind : uint8_t {
+                Manifold,   // Ӱ   
+                Border,     //   󼭸 
+                Locked      // پü  ɸ -  
+            };
+
+            struct Vector3 {
+                double x, y, z;
+            };
+
+            Vector3 Subtract(const Vector3& a, const Vector3& b) { return { a.x - b.x, a.y - b.y, a.z - b.z }; }
+            Vector3 MultiplyAdd(const Vector3& a, const Vector3& b, double s) { return { a.x + b.x * s, a.y + b.y * s, a.z + b.z * s }; }
+            double Dot(const Vector3& a, const Vector3& b) { return a.x * b.x + a.y * b.y + a.z * b.z; }
+            Vector3 Cross(const Vector3& a, const Vector3& b)
+            {
+                return { a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x };
+            }
+
+            //  ﰢ(, ,     ) Ÿ 
+            double PointTriangleDistanceSq(const Vector3& p, const Vector3& a, const Vector3& b, const Vector3& c)
+            {
+                auto distanceSq = [&p](const Vector3& q) {
+                    const Vector3 d = Subtract(p, q);
+                    return Dot(d, d);
+                };
+
+                const Vector3 ab = Subtract(b, a);
+                const Vector3 ac = Subtract(c, a);
+                const Vector3 ap = Subtract(p, a);
+                const double d1 = Dot(ab, ap);
+                const double d2 = Dot(ac, ap);
+                if (d1 <= 0.0 && d2 <= 0.0) return distanceSq(a);
+
+                const Vector3 bp = Subtract(p, b);
+                const double d3 = Dot(ab, bp);
+                const double d4 = Dot(ac, bp);
+                if (d3 >= 0.0 && d4 <= d3) return distanceSq(b);
+
+                const double vc = d1 * d4 - d3 * d2;
+                if (vc <= 0.0 && d1 >= 0.0 && d3 <= 0.0) return distanceSq(MultiplyAdd(a, ab, d1 / (d1 - d3)));
+
+                const Vector3 cp = Subtract(p, c);
+                const double d5 = Dot(ab, cp);
+                const double d6 = Dot(ac, cp);
+                if (d6 >= 0.0 && d5 <= d6) return distanceSq(c);
+
+                const double vb = d5 * d2 - d1 * d6;
+                if (vb <= 0.0 && d2 >= 0.0 && d6 <= 0.0) return distanceSq(MultiplyAdd(a, ac, d2 / (d2 - d6)));
+
+                const double va = d3 * d6 - d5 * d4;
+                if (va <= 0.0 && d4 - d3 >= 0.0 && d5 - d6 >= 0.0) {
+                    return distanceSq(MultiplyAdd(b, Subtract(c, b), (d4 - d3) / ((d4 - d3) + (d5 - d6))));
+                }
+
+                const double denominator = va + vb + vc;
+                if (denominator <= 0.0) return distanceSq(a);
+                return distanceSq(MultiplyAdd(MultiplyAdd(a, ab, vb / denominator), ac, vc / denominator));
+            }
+
+            // Ī 4x4  ( Ÿ  ) ġ 
+            struct Quadric {
+                double a2 = 0, ab = 0, ac = 0, ad = 0;
+                double b2 = 0, bc = 0, bd = 0;
+                double c2 = 0, cd = 0;
+                double d2 = 0;
+                double weight = 0;
+
+                void AddPlane(const Vector3& n, double d, double w) {
+                    a2 += n.x * n.x * w; ab += n.x * n.y * w; ac += n.x * n.z * w; ad += n.x * d * w;
+                    b2 += n.y * n.y * w; bc += n.y * n.z * w; bd += n.y * d * w;
+                    c2 += n.z * n.z * w; cd += n.z * d * w;
+                    d2 += d * d * w;
+                    weight += w;
+                }
+
+                Quadric operator+(const Quadric& o) const {
+                    Quadric q;
+                    q.a2 = a2 + o.a2; q.ab = ab + o.ab; q.ac = ac + o.ac; q.ad = ad + o.ad;
+                    q.b2 = b2 + o.b2; q.bc = bc + o.bc; q.bd = bd + o.bd;
+                    q.c2 = c2 + o.c2; q.cd = cd + o.cd;
+                    q.d2 = d2 + o.d2;
+                    q.weight = weight + o.weight;
+                    return q;
+                }
+
+                //  Ÿ    -  ġ  Ÿ   
+                double Evaluate(const Vector3& p) const {
+                    if (weight <= 0.0) return 0.0;
+                    const double error =
+                        a2 * p.x * p.x + b2 * p.y * p.y + c2 * p.z * p.z +
+                        2.0 * (ab * p.x * p.y + ac * p.x * p.z + bc * p.y * p.z) +
+                        2.0 * (ad * p.x + bd * p.y + cd * p.z) + d2;
+                    return std::max(error, 0.0) / weight;
+                }
+            };
+
+            double AttributeDistance(const Vertex& a, const Vertex& b)
+            {
+                const double n =
+                    (a.normal.x - b.normal.x) * (a.normal.x - b.normal.x) +
+                    (a.normal.y - b.normal.y) * (a.normal.y - b.normal.y) +
+                    (a.normal.z - b.normal.z) * (a.normal.z - b.normal.z);
+                const double t =
+                    (a.texCoord.x - b.texCoord.x) * (a.texCoord.x - b.texCoord.x) +
+                    (a.texCoord.y - b.texCoord.y) * (a.texCoord.y - b.texCoord.y);
+                const double c =
+                    (a.color.x - b.color.x) * (a.color.x - b.color.x) +
+                    (a.color.y - b.color.y) * (a.color.y - b.color.y) +
+                    (a.color.z - b.color.z) * (a.color.z - b.color.z) +
+                    (a.color.w - b.color.w) * (a.color.w - b.color.w);
+                return n * NormalWeight + t * TexCoordWeight + c * ColorWeight;
+            }
+
+            uint64_t EdgeKey(uint32_t a, uint32_t b)
+            {
+                return a < b ? (uint64_t(a) << 32) | b : (uint64_t(b) << 32) | a;
+            }
+
+            //   ܼȭ ۾  (ġ ID =  ġ  )
+            class Simplifier {
+            public:
+                Simplifier(std::span<const Vertex> vertices, std::vector<uint32_t>& indices)
+                    : m_vertices(vertices), m_indices(indices)
+                {
+                    float boundsMin[3] = { FLT_MAX, FLT_MAX, FLT_MAX };
+                    float boundsMax[3] = { -FLT_MAX, -FLT_MAX, -FLT_MAX };
+                    std::vector<XMFLOAT3> rawPositions(vertices.size());
+                    for (size_t i = 0; i < vertices.size(); ++i) {
+                        rawPositions[i] = vertices[i].position;
+                        const float p[3] = { rawPositions[i].x, rawPositions[i].y, rawPositions[i].z };
+                        for (int k = 0; k < 3; ++k) {
+                            boundsMin[k] = std::min(boundsMin[k], p[k]);
+                            boundsMax[k] = std::max(boundsMax[k], p[k]);
+                        }
+                    }
+
+                    //  ޽ ũ   ٷ絵 ȭ
+                    const float extent = std::max({ boundsMax[0] - boundsMin[0], boundsMax[1] - boundsMin[1],
+                        boundsMax[2] - boundsMin[2] });
+                    m_scale = extent > 0.0f ? extent : 1.0f;
+
+                    const size_t positionCount = MeshOptimizer::GenerateVertexRemap(rawPositions.data(),
+                        rawPositions.size(), sizeof(XMFLOAT3), m_positionIds);
+
+                    m_positions.resize(positionCount);
+                    for (size_t i = 0; i < vertices.size(); ++i) {
+                        const auto& p = rawPositions[i];
+                        m_positions[m_positionIds[i]] = {
+                            (p.x - boundsMin[0]) / m_scale, (p.y - boundsMin[1]) / m_scale, (p.z - boundsMin[2]) / m_scale };
+                    }
+
+                    m_collapse.resize(vertices.size());
+                    m_mergedInto.resize(positionCount);
+                    std::iota(m_mergedInto.begin(), m_mergedInto.end(), 0u);
+                    RemoveDegenerateTriangles();
+
+                    // 2         ħ (н     н  )
+                    BuildEdges();
+                    BuildQuadrics();
+                }
+
+                size_t GetPositionCount() const { return m_positions.size(); }
+
+                // ġ    ġ ( ʾ ڱ ڽ)
+                uint32_t FindMerged(uint32_t position)
+                {
+                    uint32_t root = position;
+                    while (m_mergedInto[root] != root) root = m_mergedInto[root];
+                    while (m_mergedInto[position] != root) {
+                        position = std::exchange(m_mergedInto[position], root);
+                    }
+                    return root;
+                }
+
+                //    ġ ʴ   -    false
+                bool RunPass(size_t targetTriangles, double errorLimit)
+                {
+                    const size_t triangleCount = m_indices.size() / 3;
+                    if (triangleCount <= targetTriangles) return false;
+
+                    BuildAdjacency();
+                    BuildEdges();
+
+                    // ĺ -  Ǵ     
+                    struct Candidate {
+                        double cost;
+                        uint32_t from;
+                        uint32_t to;
+                    };
+                    std::vector<Candidate> candidates;
+                    candidates.reserve(m_edges.size());
+
+                    for (uint64_t key : m_edges) {
+                        const uint32_t a = static_cast<uint32_t>(key >> 32);
+                        const uint32_t b = static_cast<uint32_t>(key & 0xFFFFFFFF);
+
+                        Candidate best{ std::numeric_limits<double>::max(), InvalidIndex, InvalidIndex };
+                        for (const auto& [from, to] : { std::pair(a, b), std::pair(b, a) }) {
+                            double cost = 0.0;
+                            if (EvaluateCollapse(from, to, cost) && cost < best.cost) {
+                                best = { cost, from, to };
+                            }
+                        }
+                        if (best.from != InvalidIndex && best.cost <= errorLimit) {
+                            candidates.push_back(best);
+                        }
+                    }
+
+                    std::sort(candidates.begin(), candidates.end(), [](const Candidate& l, const Candidate& r) {
+                        if (l.cost != r.cost) return l.cost < r.cost;
+                        if (l.from != r.from) return l.from < r.from;
+                        return l.to < r.to;
+                    });
+
+                    //   ,   1-ring ̹ н ٽ ǵ帮 
+                    std::iota(m_collapse.begin(), m_collapse.end(), 0u);
+                    m_touched.assign(m_positions.size(), 0);
+
+                    const size_t trianglesToRemove = triangleCount - targetTriangles;
+                    size_t removed = 0;
+                    size_t collapses = 0;
+
+                    for (const auto& candidate : candidates) {
+                        if (removed >= trianglesToRemove) break;
+                        if (m_touched[candidate.from] || m_touched[candidate.to]) continue;
+
+                        size_t collapsedTriangles = 0;
+                        if (!ApplyCollapse(candidate.from, candidate.to, collapsedTriangles)) continue;
+
+                        removed += collapsedTriangles;
+                        ++collapses;
+                    }
+
+                    if (collapses == 0) return false;
+
+                    for (auto& index : m_indices) {
+                        index = m_collapse[index];
+                    }
+                    RemoveDegenerateTriangles();
+                    return true;
+                }
+
+                // reference   ǥ Ÿ ִ ( ǥ )
+                // ǥ ġ(representatives[ġ ID])  ﰢ Ƿ  ִ Ÿ 
+                // ǥ ġ  ﰢ   ﰢ ü ã
+                double MeasureDeviation(std::span<const uint32_t> reference, std::span<const uint32_t> representatives)
+                {
+                    if (m_indices.empty()) return 0.0;
+                    BuildAdjacency();
+
+                    std::vector<Vector3> original(m_positions.size());
+                    for (size_t i = 0; i < m_vertices.size(); ++i) {
+                        const auto& p = m_vertices[i].position;
+                        original[m_positionIds[i]] = { p.x, p.y, p.z };
+                    }
+
+                    auto triangleDistanceSq = [&](const Vector3& p, uint32_t triangle) {
+                        const uint32_t* corners = &m_indices[size_t(triangle) * 3];
+                        return PointTriangleDistanceSq(p, original[m_positionIds[corners[0]]],
+                            original[m_positionIds[corners[1]]], original[m_positionIds[corners[2]]]);
+                    };
+
+                    std::vector<uint8_t> visited(m_positions.size(), 0);
+                    double maxDistanceSq = 0.0;
+                    for (uint32_t index : reference) {
+                        const uint32_t position = m_positionIds[index];
+                        if (std::exchange(visited[position], 1)) continue;
+
+                        const Vector3& p = original[position];
+                        const uint32_t representative = representatives[position];
+                        double distanceSq = std::numeric_limits<double>::max();
+                        for (uint32_t i = m_triangleOffsets[representative]; i < m_triangleOffsets[representative + 1]; ++i) {
+                            distanceSq = std::min(distanceSq, triangleDistanceSq(p, m_triangles[i]));
+                        }
+                        if (m_triangleOffsets[representative] == m_triangleOffsets[representative + 1]) {
+                            for (uint32_t t = 0; t < m_indices.size() / 3; ++t) {
+                                distanceSq = std::min(distanceSq, triangleDistanceSq(p, t));
+                            }
+                        }
+                        maxDistanceSq = std::max(maxDistanceSq, distanceSq);
+                    }
+                    return std::sqrt(maxDistanceSq);
+                }
+
+            private:
+                void RemoveDegenerateTriangles()
+                {
+                    size_t write = 0;
+                    for (size_t i = 0; i + 2 < m_indices.size(); i += 3) {
+                        const uint32_t a = m_positionIds[m_indices[i]];
+                        const uint32_t b = m_positionIds[m_indices[i + 1]];
+                        const uint32_t c = m_positionIds[m_indices[i + 2]];
+                        if (a == b || b == c || a == c) continue;
+
+                        m_indices[write++] = m_indices[i];
+                        m_indices[write++] = m_indices[i + 1];
+                        m_indices[write++] = m_indices[i + 2];
+                    }
+                    m_indices.resize(write);
+                }
+
+                void BuildAdjacency()
+                {
+                    m_triangleOffsets.assign(m_positions.size() + 1, 0);
+                    for (uint32_t index : m_indices) {
+                        ++m_triangleOffsets[m_positionIds[index] + 1];
+                    }
+                    for (size_t i = 1; i < m_triangleOffsets.size(); ++i) {
+                        m_triangleOffsets[i] += m_triangleOffsets[i - 1];
+                    }
+
+                    m_triangles.resize(m_indices.size());
+                    std::vector<uint32_t> fill(m_triangleOffsets.begin(), m_triangleOffsets.end() - 1);
+                    for (size_t i = 0; i < m_indices.size(); ++i) {
+                        m_triangles[fill[m_positionIds[m_indices[i]]]++] = static_cast<uint32_t>(i / 3);
+                    }
+                }
+
+                //     ,   ̻ پü
+                void BuildEdges()
+                {
+                    std::vector<uint64_t> all;
+                    all.reserve(m_indices.size());
+                    for (size_t i = 0; i < m_indices.size(); i += 3) {
+                        for (int k = 0; k < 3; ++k) {
+                            all.push_back(EdgeKey(m_positionIds[m_indices[i + k]], m_positionIds[m_indices[i + (k + 1) % 3]]));
+                        }
+                    }
+                    std::sort(all.begin(), all.end());
+
+                    m_kinds.assign(m_positions.size(), Manifold);
+                    m_edges.clear();
+                    m_borderEdges.clear();
+
+                    for (size_t i = 0; i < all.size();) {
+                        size_t end = i + 1;
+                        while (end < all.size() && all[end] == all[i]) ++end;
+
+                        const uint64_t key = all[i];
+                        const uint32_t a = static_cast<uint32_t>(key >> 32);
+                        const uint32_t b = static_cast<uint32_t>(key & 0xFFFFFFFF);
+                        const size_t count = end - i;
+
+                        m_edges.push_back(key);
+                        if (count == 1) {
+                            m_borderEdges.push_back(key);
+                            m_kinds[a] = std::max<uint8_t>(m_kinds[a], Border);
+                            m_kinds[b] = std::max<uint8_t>(m_kinds[b], Border);
+                        }
+                        else if (count > 2) {
+                            m_kinds[a] = Locked;
+                            m_kinds[b] = Locked;
+                        }
+                        i = end;
+                    }
+                }
+
+                bool IsBorderEdge(uint32_t a, uint32_t b) const
+                {
+                    return std::binary_search(m_borderEdges.begin(), m_borderEdges.end(), EdgeKey(a, b));
+                }
+
+                void BuildQuadrics()
+                {
+                    m_quadrics.assign(m_positions.size(), {});
+
+                    for (size_t i = 0; i < m_indices.size(); i += 3) {
+                        const uint32_t ids[3] = {
+                            m_positionIds[m_indices[i]], m_positionIds[m_indices[i + 1]], m_positionIds[m_indices[i + 2]] };
+                        const Vector3& p0 = m_positions[ids[0]];
+
+                        Vector3 normal = Cross(Subtract(m_positions[ids[1]], p0), Subtract(m_positions[ids[2]], p0));
+                        const double length = std::sqrt(Dot(normal, normal));
+                        if (length <= 0.0) continue;
+                        normal = { normal.x / length, normal.y / length, normal.z / length };
+
+                        //   -  ﰢ ū   ¿ ʵ
+                        const double area = length * 0.5;
+                        const double d = -Dot(normal, p0);
+                        for (uint32_t id : ids) {
+                            m_quadrics[id].AddPlane(normal, d, area);
+                        }
+
+                        //  :   鿡  
+                        for (int k = 0; k < 3; ++k) {
+                            const uint32_t a = ids[k];
+                            const uint32_t b = ids[(k + 1) % 3];
+                            if (!IsBorderEdge(a, b)) continue;
+
+                            const Vector3 edge = Subtract(m_positions[b], m_positions[a]);
+                            Vector3 edgeNormal = Cross(edge, normal);
+                            const double edgeLength = std::sqrt(Dot(edgeNormal, edgeNormal));
+                            if (edgeLength <= 0.0) continue;
+                            edgeNormal = { edgeNormal.x / edgeLength, edgeNormal.y / edgeLength, edgeNormal.z / edgeLength };
+
+                            const double edgeD = -Dot(edgeNormal, m_positions[a]);
+                            const double weight = Dot(edge, edge) * BorderWeight;
+                            m_quadrics[a].AddPlane(edgeNormal, edgeD, weight);
+                            m_quadrics[b].AddPlane(edgeNormal, edgeD, weight);
+                        }
+                    }
+                }
+
+                // from wedge( ġ ) to ʿ ϴ wedge ã
+                //  ų  ̸̻ ֱⰡ Ƿ   
+                bool MatchWedges(uint32_t from, uint32_t to)
+                {
+                    m_pairs.clear();
+
+                    for (uint32_t i = m_triangleOffsets[from]; i < m_triangleOffsets[from + 1]; ++i) {
+                        const uint32_t* triangle = &m_indices[m_triangles[i] * 3];
+
+                        uint32_t wedge = InvalidIndex;
+                        uint32_t target = InvalidIndex;
+                        for (int k = 0; k < 3; ++k) {
+                            const uint32_t id = m_positionIds[triangle[k]];
+                            if (id == from) wedge = triangle[k];
+                            else if (id == to) target = triangle[k];
+                        }
+
+                        auto it = std::find_if(m_pairs.begin(), m_pairs.end(),
+                            [wedge](const auto& pair) { return pair.first == wedge; });
+                        if (it == m_pairs.end()) {
+                            m_pairs.emplace_back(wedge, target);
+                        }
+                        else if (target != InvalidIndex) {
+                            if (it->second == InvalidIndex) it->second = target;
+                            else if (it->second != target) return false;
+                        }
+                    }
+
+                    return std::all_of(m_pairs.begin(), m_pairs.end(),
+                        [](const auto& pair) { return pair.second != InvalidIndex; });
+                }
+
+                bool EvaluateCollapse(uint32_t from, uint32_t to, double& cost)
+                {
+                    if (m_kinds[from] == Locked) return false;
+                    if (m_kinds[from] == Border && !IsBorderEdge(from, to)) return false;
+                    if (!MatchWedges(from, to)) return false;
+
+                    const Vector3& target = m_positions[to];
+                    cost = (m_quadrics[from] + m_quadrics[to]).Evaluate(target);
+
+                    // Ӽ ̴  ̷ Ÿ  ٲ 
+                    double attribute = 0.0;
+                    for (const auto& [wedge, targetWedge] : m_pairs) {
+                        attribute = std::max(attribute, AttributeDistance(m_vertices[wedge], m_vertices[targetWedge]));
+                    }
+                    const Vector3 edge = Subtract(target, m_positions[from]);
+                    cost += Dot(edge, edge) * attribute;
+                    return true;
+                }
+
+                bool ApplyCollapse(uint32_t from, uint32_t to, size_t& collapsedTriangles)
+                {
+                    if (!MatchWedges(from, to)) return false;
+
+                    //  ﰢ   
+                    collapsedTriangles = 0;
+                    for (uint32_t i = m_triangleOffsets[from]; i < m_triangleOffsets[from + 1]; ++i) {
+                        const uint32_t* triangle = &m_indices[m_triangles[i] * 3];
+
+                        Vector3 before[3];
+                        Vector3 after[3];
+                        bool collapsed = false;
+                        for (int k = 0; k < 3; ++k) {
+                            const uint32_t id = m_positionIds[triangle[k]];
+                            collapsed |= id == to;
+                            before[k] = m_positions[id];
+                            after[k] = id == from ? m_positions[to] : before[k];
+                        }
+                        if (collapsed) {
+                            ++collapsedTriangles;
+                            continue;
+                        }
+
+                        const Vector3 n0 = Cross(Subtract(before[1], before[0]), Subtract(before[2], before[0]));
+                        const Vector3 n1 = Cross(Subtract(after[1], after[0]), Subtract(after[2], after[0]));
+                        if (Dot(n0, n1) <= 0.0) return false;
+                    }
+
+                    for (const auto& [wedge, targetWedge] : m_pairs) {
+                        m_collapse[wedge] = targetWedge;
+                    }
+                    m_quadrics[to] = m_quadrics[to] + m_quadrics[from];
+                    m_mergedInto[from] = to;
+
+                    m_touched[to] = 1;
+                    for (uint32_t i = m_triangleOffsets[from]; i < m_triangleOffsets[from + 1]; ++i) {
+                        const uint32_t* triangle = &m_indices[m_triangles[i] * 3];
+                        for (int k = 0; k < 3; ++k) {
+                            m_touched[m_positionIds[triangle[k]]] = 1;
+                        }
+                    }
+                    return true;
+                }
+
+                std::span<const Vertex> m_vertices;
+                std::vector<uint32_t>& m_indices;
+                float m_scale = 1.0f;
+
+                std::vector<uint32_t> m_positionIds;        //  -> ġ ID
+                std::vector<Vector3> m_positions;           // ġ ID -> ȭ ġ
+                std::vector<uint32_t> m_triangleOffsets;    // ġ ID ->  ﰢ (CSR)
+                std::vector<uint32_t> m_triangles;
+                std::vector<uint64_t> m_edges;              // ĵ  
+                std::vector<uint64_t> m_borderEdges;
+                std::vector<uint8_t> m_kinds;
+                std::vector<Quadric> m_quadrics;            // ġ ID ->   ġ ģ 2 
+                std::vector<uint32_t> m_mergedInto;         // ġ ID ->   ġ (union-find)
+
+                std::vector<uint32_t> m_collapse;           //  -> ̹ н Ű  
+                std::vector<uint8_t> m_touched;
+                std::vector<std::pair<uint32_t, uint32_t>> m_pairs;
+            };
+
+            // indices ܼȭϰ reference   ǥ鿡  Ÿ 
+            // representatives: ġ ID ->  ܼȭ   ġ (  ڱ ڽ), ̹  ݿ 
+            float SimplifyAndMeasure(std::span<const Vertex> vertices, std::span<const uint32_t> indices,
+                size_t targetIndexCount, float targetError, std::vector<uint32_t>& result,
+                std::span<const uint32_t> reference, std::vector<uint32_t>& representatives)
+            {
+                result.assign(indices.begin(), indices.end());
+                if (vertices.empty() || result.size() <= targetIndexCount) return 0.0f;
+
+                Simplifier simplifier(vertices, result);
+
+                //  ȭ ǥ Ÿ  - Ѱ赵 ޽ ũ   
+                const size_t targetTriangles = targetIndexCount / 3;
+                const double errorLimit = double(targetError) * double(targetError);
+                while (simplifier.RunPass(targetTriangles, errorLimit)) {
+                }
+
+                if (representatives.empty()) {
+                    representatives.resize(simplifier.GetPositionCount());
+                    std::iota(representatives.begin(), representatives.end(), 0u);
+                }
+                for (uint32_t& representative : representatives) {
+                    representative = simplifier.FindMerged(representative);
+                }
+                return static_cast<float>(simplifier.MeasureDeviation(reference, representatives));
+            }
+        }
+
+        float Simplify(std::span<const Vertex> vertices, std::span<const uint32_t> indices,
+            size_t targetIndexCount, float targetError, std::vector<uint32_t>& result)
+        {
+            std::vector<uint32_t> representatives;
+            return SimplifyAndMeasure(vertices, indices, targetIndexCount, targetError, result, indices, representatives);
+        }
+
+        std::vector<LodLevel> BuildLodChain(std::span<const Vertex> vertices, std::span<const uint32_t> indices,
+            const LodOptions& options)
+        {
+            std::vector<LodLevel> chain;
+            chain.push_back({ std::vector<uint32_t>(indices.begin(), indices.end()), 0.0f });
+
+            // ܰ踶 ġ    ̾ ٿ LOD0    
+            std::vector<uint32_t> representatives;
+
+            while (chain.size() < options.maxLodCount) {
+                const auto& current = chain.back();
+                const size_t targetTriangles = static_cast<size_t>(current.indices.size() / 3 * options.reduction);
+                if (targetTriangles < options.minTriangles) break;
+
+                LodLevel next;
+                next.error = SimplifyAndMeasure(vertices, current.indices, targetTriangles * 3, options.maxError,
+                    next.indices, indices, representatives);
+                if (next.indices.empty() || next.indices.size() * 10 > current.indices.size() * 9) break;
+
+                MeshOptimizer::OptimizeVertexCache(next.indices, vertices.size());
+                chain.push_back(std::move(next));
+            }
+            return chain;
+        }
+    }
+}
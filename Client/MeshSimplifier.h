@@ -0,0 +1,37 @@
+#pragma once
+#include "pch.h"
+
+namespace Resource
+{
+    // 2 (QEM)  ޽ ܼȭ LOD ü 
+    // -    ʴ half-edge collapse -  LOD   ۸ ϰ ε ٸ
+    // - Ӽ : UV/ ֱ( ġ, ٸ Ӽ) ֱ⸦ 󼭸 ,
+    //   Ӽ ̰ ū   ÷ ʰ .   踦 󼭸 
+    // -  Է̸ ׻   (ĳ Ű   ֵ ؽ ȸ/   )
+    namespace MeshSimplifier
+    {
+        // targetIndexCount ϰ ǰų  targetError(޽ ũ  ) ѱ  
+        //   ֺ   Ÿ     ( ġ 2      )
+        //  vertices ״ ϴ ε
+        // ȯ Է   ǥ  Ÿ ִ ( ǥ ,   Hausdorff Ÿ )
+        float Simplify(std::span<const Vertex> vertices, std::span<const uint32_t> indices,
+            size_t targetIndexCount, float targetError, std::vector<uint32_t>& result);
+
+        struct LodOptions {
+            uint32_t maxLodCount = 4;       // LOD0 
+            float reduction = 0.5f;         // ܰ踶  ﰢ 
+            float maxError = 0.05f;         // ޽ ũ   ܰ ִ 
+            size_t minTriangles = 32;       // ̺ ۾ ߴ
+        };
+
+        struct LodLevel {
+            std::vector<uint32_t> indices;
+            float error = 0.0f;             // LOD0   ܰ ǥ  Ÿ  ( ǥ )
+        };
+
+        // LOD0(Է ε)  ܰ踦 ܼȭ ̾  ü
+        // ܼȭ    (10% ̸ )  ڸ 
+        std::vector<LodLevel> BuildLodChain(std::span<const Vertex> vertices, std::span<const uint32_t> indices,
+            const LodOptions& options = {});
+    }
+}
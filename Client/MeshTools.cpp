@@ -0,0 +1,455 @@
+#include "pch.h"
+#include "MeshTools.h"
+#include "ModelResource.h"
+#include "MeshletBuilder.h"
+#include "MeshSimplifier.h"
+#include "Logger.h"
+
+namespace Resource
+{
+    bool MeshTools::CookModel(const std::string& sourcePath, const std::string& outputPath)
+    {
+        using Clock = std::chrono::steady_clock;
+        const auto start = Clock::now();
+
+        MeshData data;
+        if (!ModelResource::Cook(sourcePath, data)) {
+            return false;
+        }
+
+        const std::filesystem::path output = outputPath.empty() ? ModelResource::GetCachePath(sourcePath) : outputPath;
+        const uint64_t stamp = MeshCache::ComputeSourceStamp(sourcePath, ModelResource::ImportFlags);
+        if (!MeshCache::Write(output, data, stamp)) {
+            Logger::Instance().Error("޽   : {}", output.string());
+            return false;
+        }
+
+        const double elapsedMs = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+        Logger::Instance().Info("===  ŷ: {} -> {} ({:.1f}ms) ===", sourcePath, output.string(), elapsedMs);
+
+        for (size_t m = 0; m < data.meshes.size(); ++m) {
+            const auto& mesh = data.meshes[m];
+            Logger::Instance().Info("޽ #{}:  {}, ACMR {:.3f}, meshlet {}",
+                m, mesh.vertexCount, mesh.acmr, mesh.meshletCount);
+            for (uint32_t l = 0; l < mesh.lodCount; ++l) {
+                const auto& lod = data.lods[mesh.lodOffset + l];
+                Logger::Instance().Info("  LOD{}: ﰢ {},  {:.4g}", l, lod.indexCount / 3, lod.error);
+            }
+        }
+        return true;
+    }
+
+    MeshTools::PackingBenchmarkResult MeshTools::RunPackingBenchmark(const std::string& modelPath,
+        size_t vertexCount, int iterations)
+    {
+        PackingBenchmarkResult result;
+
+        MeshData data;
+        if (modelPath.empty()) {
+            data = CreateRandomMesh(vertexCount);
+        }
+        else if (!ModelResource::Cook(modelPath, data)) {
+            Logger::Instance().Error("ġũ  Ʈ  ϴ: {}", modelPath);
+            return result;
+        }
+        iterations = std::max(iterations, 1);
+
+        result.vertexCount = data.vertices.size();
+        result.floatBytes = data.vertices.size() * sizeof(Vertex);
+        result.packedBytes = data.vertices.size() * sizeof(PackedVertex);
+
+        Logger::Instance().Info("===   ġũ: {} ( {}, ޽ {}, {}ȸ ) ===",
+            modelPath.empty() ? " " : modelPath, result.vertexCount, data.meshes.size(), iterations);
+
+        using Clock = std::chrono::steady_clock;
+        std::vector<PackedVertex> packed;
+        const auto start = Clock::now();
+        for (int i = 0; i < iterations; ++i) {
+            packed = MeshCache::PackVertices(data);
+        }
+        const double elapsedMs = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+
+        result.packMVertsPerSec = result.vertexCount * iterations / (elapsedMs * 1000.0);
+        result.packMBps = result.floatBytes * iterations / (elapsedMs * 1000.0);
+
+        // ̴   ؼ к  Ѱ 
+        for (const auto& mesh : data.meshes) {
+            const auto dequantization = VertexPacking::ComputeDequantization(mesh.boundsMin, mesh.boundsMax);
+            const float extent[3] = { dequantization.scale.x, dequantization.scale.y, dequantization.scale.z };
+
+            for (uint32_t i = mesh.vertexOffset; i < mesh.vertexOffset + mesh.vertexCount; ++i) {
+                const Vertex& source = data.vertices[i];
+                const Vertex decoded = VertexPacking::Unpack(packed[i], dequantization);
+
+                const float positionError[3] = {
+                    std::abs(decoded.position.x - source.position.x),
+                    std::abs(decoded.position.y - source.position.y),
+                    std::abs(decoded.position.z - source.position.z) };
+                for (int k = 0; k < 3; ++k) {
+                    if (extent[k] > 0.0f) {
+                        result.maxPositionError = std::max(result.maxPositionError, positionError[k] / extent[k]);
+                    }
+                    result.violations += positionError[k] > VertexPacking::MaxPositionError(extent[k]);
+                }
+
+                // 1   acos float ȮϹǷ atan2(|a x b|, a . b) double 
+                const XMVECTOR a = XMVector3Normalize(XMLoadFloat3(&source.normal));
+                const XMVECTOR b = XMLoadFloat3(&decoded.normal);
+                XMFLOAT3 cross;
+                XMStoreFloat3(&cross, XMVector3Cross(a, b));
+                const double sine = std::sqrt(double(cross.x) * cross.x + double(cross.y) * cross.y + double(cross.z) * cross.z);
+                const double angle = std::atan2(sine, double(XMVectorGetX(XMVector3Dot(a, b)))) * 180.0 / XM_PI;
+                result.maxNormalErrorDegrees = std::max(result.maxNormalErrorDegrees, static_cast<float>(angle));
+                result.violations += angle > VertexPacking::MaxNormalErrorDegrees;
+
+                const float texCoordError[2] = {
+                    std::abs(decoded.texCoord.x - source.texCoord.x),
+                    std::abs(decoded.texCoord.y - source.texCoord.y) };
+                result.maxTexCoordError = std::max({ result.maxTexCoordError, texCoordError[0], texCoordError[1] });
+                result.violations += texCoordError[0] > VertexPacking::MaxTexCoordError(source.texCoord.x);
+                result.violations += texCoordError[1] > VertexPacking::MaxTexCoordError(source.texCoord.y);
+
+                const float colorError = std::max({
+                    std::abs(decoded.color.x - std::clamp(source.color.x, 0.0f, 1.0f)),
+                    std::abs(decoded.color.y - std::clamp(source.color.y, 0.0f, 1.0f)),
+                    std::abs(decoded.color.z - std::clamp(source.color.z, 0.0f, 1.0f)),
+                    std::abs(decoded.color.w - std::clamp(source.color.w, 0.0f, 1.0f)) });
+                result.maxColorError = std::max(result.maxColorError, colorError);
+                result.violations += colorError > VertexPacking::MaxColorError + 1e-6f;
+            }
+        }
+
+        Logger::Instance().Info("ũ: {} -> {} bytes ({:.1f}%)", result.floatBytes, result.packedBytes,
+            100.0 * result.packedBytes / std::max<size_t>(result.floatBytes, 1));
+        Logger::Instance().Info(": {:.1f} M/s ({:.1f} MB/s)", result.packMVertsPerSec, result.packMBps);
+        Logger::Instance().Info("ִ  - ġ {:.3g} ( ),  {:.4f}, UV {:.3g},  {:.4f}",
+            result.maxPositionError, result.maxNormalErrorDegrees, result.maxTexCoordError, result.maxColorError);
+
+        if (result.violations > 0) {
+            Logger::Instance().Error("    {}", result.violations);
+        }
+        return result;
+    }
+
+    MeshTools::MeshletBenchmarkResult MeshTools::RunMeshletBenchmark(const std::string& modelPath,
+        size_t triangleCount, size_t meshCount, int iterations)
+    {
+        MeshletBenchmarkResult result;
+
+        MeshData data;
+        if (modelPath.empty()) {
+            data = CreateSphereMeshes(triangleCount, std::max<size_t>(meshCount, 1));
+        }
+        else if (!ModelResource::Cook(modelPath, data)) {
+            Logger::Instance().Error("ġũ  Ʈ  ϴ: {}", modelPath);
+            return result;
+        }
+        iterations = std::max(iterations, 1);
+
+        result.meshCount = data.meshes.size();
+        for (const auto& mesh : data.meshes) {
+            result.triangleCount += mesh.indexCount / 3;
+        }
+
+        Logger::Instance().Info("=== meshlet ġũ: {} (ﰢ {}, ޽ {}, {}ȸ ) ===",
+            modelPath.empty() ? " " : modelPath, result.triangleCount, result.meshCount, iterations);
+
+        std::vector<MeshletBuilder::Result> built(data.meshes.size());
+        auto buildMesh = [&](size_t m) {
+            const auto& mesh = data.meshes[m];
+            MeshletBuilder::Build(std::span(data.vertices).subspan(mesh.vertexOffset, mesh.vertexCount),
+                std::span(data.indices).subspan(mesh.indexOffset, mesh.indexCount), built[m]);
+        };
+
+        using Clock = std::chrono::steady_clock;
+        auto start = Clock::now();
+        for (int i = 0; i < iterations; ++i) {
+            for (size_t m = 0; m < built.size(); ++m) {
+                buildMesh(m);
+            }
+        }
+        result.serialMs = std::chrono::duration<double, std::milli>(Clock::now() - start).count() / iterations;
+
+        start = Clock::now();
+        for (int i = 0; i < iterations; ++i) {
+            tbb::parallel_for(size_t(0), built.size(), buildMesh);
+        }
+        result.parallelMs = std::chrono::duration<double, std::milli>(Clock::now() - start).count() / iterations;
+        result.parallelMTrisPerSec = result.triangleCount / (result.parallelMs * 1000.0);
+
+        //  - Ŭ Ѱ, ٽ þ ε  ﰢ Ȯ   ,
+        // Է ø Ŭ ﰢ   ޸ ( +X ٱ ī޶ )
+        size_t vertexSum = 0;
+        size_t backFacing = 0;
+        for (size_t m = 0; m < built.size(); ++m) {
+            const auto& mesh = data.meshes[m];
+            const auto& meshlets = built[m];
+            auto vertices = std::span(data.vertices).subspan(mesh.vertexOffset, mesh.vertexCount);
+            auto source = std::span(data.indices).subspan(mesh.indexOffset, mesh.indexCount);
+
+            auto sortedTriangles = [](std::span<const uint32_t> indices) {
+                std::vector<std::array<uint32_t, 3>> triangles(indices.size() / 3);
+                for (size_t t = 0; t < triangles.size(); ++t) {
+                    triangles[t] = { indices[t * 3], indices[t * 3 + 1], indices[t * 3 + 2] };
+                    std::rotate(triangles[t].begin(), std::min_element(triangles[t].begin(), triangles[t].end()),
+                        triangles[t].end());
+                }
+                std::sort(triangles.begin(), triangles.end());
+                return triangles;
+            };
+            if (sortedTriangles(source) != sortedTriangles(meshlets.indices)) {
+                ++result.violations;
+            }
+
+            const XMFLOAT3 camera(mesh.boundsMax[0] + (mesh.boundsMax[0] - mesh.boundsMin[0]),
+                (mesh.boundsMin[1] + mesh.boundsMax[1]) * 0.5f, (mesh.boundsMin[2] + mesh.boundsMax[2]) * 0.5f);
+
+            for (const auto& meshlet : meshlets.meshlets) {
+                vertexSum += meshlet.vertexCount;
+                if (meshlet.vertexCount > MeshletBuilder::MaxVertices || meshlet.triangleCount > MeshletBuilder::MaxTriangles) {
+                    ++result.violations;
+                }
+
+                bool frontFacing = false;
+                for (uint32_t t = 0; t < meshlet.triangleCount; ++t) {
+                    uint32_t corner[3];
+                    for (int k = 0; k < 3; ++k) {
+                        const uint8_t local = meshlets.triangles[(size_t(meshlet.triangleOffset) + t) * 3 + k];
+                        corner[k] = meshlets.vertices[meshlet.vertexOffset + local];
+                        if (local >= meshlet.vertexCount || corner[k] != meshlets.indices[meshlet.indexOffset + t * 3 + k]) {
+                            ++result.violations;
+                        }
+                    }
+
+                    const XMVECTOR p0 = XMLoadFloat3(&vertices[corner[0]].position);
+                    const XMVECTOR normal = XMVector3Cross(
+                        XMVectorSubtract(XMLoadFloat3(&vertices[corner[1]].position), p0),
+                        XMVectorSubtract(XMLoadFloat3(&vertices[corner[2]].position), p0));
+                    frontFacing |= XMVectorGetX(XMVector3Dot(XMVectorSubtract(p0, XMLoadFloat3(&camera)), normal)) < 0.0f;
+                }
+
+                if (MeshletBuilder::IsBackFacing(meshlet, camera)) {
+                    ++backFacing;
+                    result.violations += frontFacing;
+                }
+            }
+            result.meshletCount += meshlets.meshlets.size();
+        }
+
+        result.averageVertices = static_cast<double>(vertexSum) / std::max<size_t>(result.meshletCount, 1);
+        result.averageTriangles = static_cast<double>(result.triangleCount) / std::max<size_t>(result.meshletCount, 1);
+        result.backFacingRatio = static_cast<double>(backFacing) / std::max<size_t>(result.meshletCount, 1);
+
+        Logger::Instance().Info(":  {:.1f}ms,  {:.1f}ms ({:.1f} Mﰢ/s)",
+            result.serialMs, result.parallelMs, result.parallelMTrisPerSec);
+        Logger::Instance().Info("meshlet {} -   {:.1f}/{}, ﰢ {:.1f}/{}", result.meshletCount,
+            result.averageVertices, MeshletBuilder::MaxVertices, result.averageTriangles, MeshletBuilder::MaxTriangles);
+        Logger::Instance().Info(" ī޶󿡼 ޸ ø: {:.1f}%", result.backFacingRatio * 100.0);
+
+        if (result.violations > 0) {
+            Logger::Instance().Error("  {}", result.violations);
+        }
+        return result;
+    }
+
+    MeshTools::SimplifierCheckResult MeshTools::RunSimplifierCheck(size_t triangleCount)
+    {
+        SimplifierCheckResult result;
+        auto check = [&](bool ok, std::string_view what) {
+            ++result.checks;
+            if (!ok) {
+                ++result.violations;
+                Logger::Instance().Error(" : {}", what);
+            }
+        };
+
+        //  ġ     ( ġ ֱ   )
+        MeshData data = CreateSphereMeshes(triangleCount, 1);
+        for (Vertex& vertex : data.vertices) {
+            auto& p = vertex.position;
+            const float bump = 1.0f + 0.1f * std::sin(5.0f * p.x) * std::sin(4.0f * p.y) * std::sin(3.0f * p.z);
+            p = { p.x * bump, p.y * bump, p.z * bump };
+        }
+        const std::span<const Vertex> vertices(data.vertices);
+        const std::span<const uint32_t> source(data.indices);
+
+        Logger::Instance().Info("=== ޽ ܼȭ   (ﰢ {}) ===", source.size() / 3);
+
+        //  ﰢ Ÿ - 鿡   ̸  Ÿ, ƴϸ     
+        auto triangleDistance = [&](const XMFLOAT3& point, const uint32_t* corners) {
+            const XMVECTOR p = XMLoadFloat3(&point);
+            XMVECTOR v[3];
+            for (int k = 0; k < 3; ++k) {
+                v[k] = XMLoadFloat3(&vertices[corners[k]].position);
+            }
+
+            const XMVECTOR normal = XMVector3Cross(XMVectorSubtract(v[1], v[0]), XMVectorSubtract(v[2], v[0]));
+            bool inside = XMVectorGetX(XMVector3LengthSq(normal)) > 0.0f;
+            float distance = std::numeric_limits<float>::max();
+            for (int k = 0; k < 3; ++k) {
+                const XMVECTOR a = v[k];
+                const XMVECTOR edge = XMVectorSubtract(v[(k + 1) % 3], a);
+                inside &= XMVectorGetX(XMVector3Dot(XMVector3Cross(edge, XMVectorSubtract(p, a)), normal)) >= 0.0f;
+
+                const float lengthSq = XMVectorGetX(XMVector3LengthSq(edge));
+                const float t = lengthSq > 0.0f ?
+                    std::clamp(XMVectorGetX(XMVector3Dot(XMVectorSubtract(p, a), edge)) / lengthSq, 0.0f, 1.0f) : 0.0f;
+                distance = std::min(distance,
+                    XMVectorGetX(XMVector3Length(XMVectorSubtract(p, XMVectorMultiplyAdd(edge, XMVectorReplicate(t), a)))));
+            }
+            if (inside) {
+                distance = std::abs(XMVectorGetX(XMVector3Dot(XMVectorSubtract(p, v[0]), XMVector3Normalize(normal))));
+            }
+            return distance;
+        };
+
+        // reference  simplified ﰢ ü   Ÿ (  Hausdorff)
+        auto measure = [&](std::span<const uint32_t> reference, std::span<const uint32_t> simplified) {
+            std::vector<uint8_t> used(vertices.size(), 0);
+            for (uint32_t index : reference) {
+                used[index] = 1;
+            }
+            std::vector<float> distances(vertices.size(), 0.0f);
+            tbb::parallel_for(size_t(0), vertices.size(), [&](size_t i) {
+                if (!used[i]) return;
+                float distance = std::numeric_limits<float>::max();
+                for (size_t t = 0; t + 2 < simplified.size(); t += 3) {
+                    distance = std::min(distance, triangleDistance(vertices[i].position, &simplified[t]));
+                }
+                distances[i] = distance;
+            });
+            return *std::max_element(distances.begin(), distances.end());
+        };
+
+        //  Ѱ踦   float  , Ѱ谡  ǥ  ĵ 
+        auto compare = [&](std::string_view label, size_t before, size_t after, float reported, float measured) {
+            Logger::Instance().Info("{}: ﰢ {} -> {},   {:.5f},  Ÿ {:.5f}", label, before, after, reported, measured);
+            check(measured <= reported * 1.001f + 1e-5f, label);
+            result.maxReportedError = std::max(result.maxReportedError, reported);
+            result.maxMeasuredError = std::max(result.maxMeasuredError, measured);
+        };
+
+        for (float ratio : { 0.5f, 0.25f, 0.1f, 0.02f }) {
+            std::vector<uint32_t> simplified;
+            const size_t targetIndexCount = static_cast<size_t>(source.size() / 3 * ratio) * 3;
+            const float reported = MeshSimplifier::Simplify(vertices, source, targetIndexCount, 1.0f, simplified);
+
+            check(!simplified.empty() && simplified.size() <= targetIndexCount, " Ѱ  ǥ ﰢ  ");
+            compare(std::format("ܼȭ {:.0f}%", ratio * 100.0f), source.size() / 3, simplified.size() / 3,
+                reported, measure(source, simplified));
+        }
+
+        //  Ѱ谡   
+        {
+            std::vector<uint32_t> loose;
+            std::vector<uint32_t> tight;
+            MeshSimplifier::Simplify(vertices, source, source.size() / 10, 0.05f, loose);
+            const float reported = MeshSimplifier::Simplify(vertices, source, source.size() / 10, 0.002f, tight);
+            check(tight.size() >= loose.size(), "  Ѱ迡   ");
+            compare(" Ѱ 0.2%", source.size() / 3, tight.size() / 3, reported, measure(source, tight));
+        }
+
+        const auto chain = MeshSimplifier::BuildLodChain(vertices, source);
+        check(chain.size() > 1, "LOD ü ");
+        for (size_t l = 1; l < chain.size(); ++l) {
+            compare(std::format("LOD{} (LOD0 )", l), source.size() / 3, chain[l].indices.size() / 3,
+                chain[l].error, measure(source, chain[l].indices));
+        }
+
+        Logger::Instance().Info(" {},  {}", result.checks, result.violations);
+        return result;
+    }
+
+    MeshData MeshTools::CreateSphereMeshes(size_t triangleCount, size_t meshCount)
+    {
+        // /浵   -   ĭ ﰢ 2, ޽ø ġ Ű ġ
+        const size_t perMesh = std::max<size_t>(triangleCount / meshCount, 8);
+        const uint32_t segments = static_cast<uint32_t>(std::max(4.0, std::sqrt(perMesh / 4.0)));
+        const uint32_t rings = std::max<uint32_t>(static_cast<uint32_t>(perMesh / (2 * segments)), 2);
+
+        MeshData data;
+        for (size_t m = 0; m < meshCount; ++m) {
+            MeshFormat::Mesh mesh{};
+            mesh.vertexOffset = static_cast<uint32_t>(data.vertices.size());
+            mesh.indexOffset = static_cast<uint32_t>(data.indices.size());
+
+            const float offset = static_cast<float>(m) * 3.0f;
+            for (uint32_t r = 0; r <= rings; ++r) {
+                const float theta = XM_PI * r / rings;
+                for (uint32_t s = 0; s <= segments; ++s) {
+                    const float phi = XM_2PI * s / segments;
+                    const XMFLOAT3 normal(std::sin(theta) * std::cos(phi), std::cos(theta), std::sin(theta) * std::sin(phi));
+
+                    Vertex vertex;
+                    vertex.position = { normal.x + offset, normal.y, normal.z };
+                    vertex.normal = normal;
+                    vertex.color = { 1.0f, 1.0f, 1.0f, 1.0f };
+                    vertex.texCoord = { static_cast<float>(s) / segments, static_cast<float>(r) / rings };
+                    data.vertices.push_back(vertex);
+                }
+            }
+
+            // ٱ   ð  (޼ ǥ ո)
+            for (uint32_t r = 0; r < rings; ++r) {
+                for (uint32_t s = 0; s < segments; ++s) {
+                    const uint32_t i0 = r * (segments + 1) + s;
+                    const uint32_t i1 = i0 + segments + 1;
+                    data.indices.insert(data.indices.end(), { i0, i0 + 1, i1, i1, i0 + 1, i1 + 1 });
+                }
+            }
+
+            mesh.vertexCount = static_cast<uint32_t>(data.vertices.size()) - mesh.vertexOffset;
+            mesh.indexCount = static_cast<uint32_t>(data.indices.size()) - mesh.indexOffset;
+            mesh.boundsMin[0] = offset - 1.0f;
+            mesh.boundsMax[0] = offset + 1.0f;
+            for (int k = 1; k < 3; ++k) {
+                mesh.boundsMin[k] = -1.0f;
+                mesh.boundsMax[k] = 1.0f;
+            }
+            data.meshes.push_back(mesh);
+        }
+        return data;
+    }
+
+    MeshData MeshTools::CreateRandomMesh(size_t vertexCount)
+    {
+        MeshData data;
+        data.vertices.resize(vertexCount);
+
+        std::mt19937 random(12345);
+        std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+        std::uniform_real_distribution<float> color(0.0f, 1.0f);
+
+        MeshFormat::Mesh mesh{};
+        mesh.vertexCount = static_cast<uint32_t>(vertexCount);
+        for (int k = 0; k < 3; ++k) {
+            mesh.boundsMin[k] = std::numeric_limits<float>::max();
+            mesh.boundsMax[k] = std::numeric_limits<float>::lowest();
+        }
+
+        for (Vertex& vertex : data.vertices) {
+            // ึ ũⰡ ٸ  (ȭ  ึ ޶)
+            vertex.position = { unit(random) * 50.0f, unit(random) * 5.0f, unit(random) * 200.0f };
+
+            XMFLOAT3 normal;
+            float lengthSq = 0.0f;
+            do {
+                normal = { unit(random), unit(random), unit(random) };
+                lengthSq = normal.x * normal.x + normal.y * normal.y + normal.z * normal.z;
+            } while (lengthSq < 0.01f || lengthSq > 1.0f);
+            XMStoreFloat3(&vertex.normal, XMVector3Normalize(XMLoadFloat3(&normal)));
+
+            vertex.texCoord = { unit(random) * 4.0f, unit(random) * 4.0f };
+            vertex.color = { color(random), color(random), color(random), color(random) };
+
+            const float position[3] = { vertex.position.x, vertex.position.y, vertex.position.z };
+            for (int k = 0; k < 3; ++k) {
+                mesh.boundsMin[k] = std::min(mesh.boundsMin[k], position[k]);
+                mesh.boundsMax[k] = std::max(mesh.boundsMax[k], position[k]);
+            }
+        }
+
+        data.meshes.push_back(mesh);
+        return data;
+    }
+}
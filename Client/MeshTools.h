@@ -0,0 +1,67 @@
+#pragma once
+#include "pch.h"
+#include "MeshCache.h"
+
+namespace Resource
+{
+    // ޽ ŷ/ ġũ 
+    class MeshTools {
+    public:
+        //  ŷ - Assimp Ʈ, ȭ, meshlet/LOD   .mesh 
+        // outputPath   Ÿ ã ũ ĳ ġ 
+        // (Ű  "< >.mesh" ؼ Բ ŷ)
+        static bool CookModel(const std::string& sourcePath, const std::string& outputPath = {});
+
+        struct PackingBenchmarkResult {
+            size_t vertexCount = 0;
+            size_t floatBytes = 0;              // Vertex  ũ
+            size_t packedBytes = 0;             // PackedVertex  ũ
+            double packMVertsPerSec = 0.0;
+            double packMBps = 0.0;              // Է(Vertex) 
+            float maxPositionError = 0.0f;      // ޽  ũ 
+            float maxNormalErrorDegrees = 0.0f;
+            float maxTexCoordError = 0.0f;
+            float maxColorError = 0.0f;
+            size_t violations = 0;              // VertexPacking     
+        };
+
+        //   ó  
+        // modelPath   Ƿ  vertexCount   (ƴϸ Assimp Ʈ )
+        static PackingBenchmarkResult RunPackingBenchmark(const std::string& modelPath,
+            size_t vertexCount = 4 * 1024 * 1024, int iterations = 5);
+
+        struct MeshletBenchmarkResult {
+            size_t meshCount = 0;
+            size_t triangleCount = 0;
+            size_t meshletCount = 0;
+            double serialMs = 0.0;              // ޽ø ʷ
+            double parallelMs = 0.0;            // ޽ó 
+            double parallelMTrisPerSec = 0.0;
+            double averageVertices = 0.0;       // Ŭʹ
+            double averageTriangles = 0.0;
+            double backFacingRatio = 0.0;       //  ī޶󿡼 Է ø Ŭ 
+            size_t violations = 0;              // Ѱ ʰ, ﰢ /ߺ, ո ̴µ ø Ŭ
+        };
+
+        // meshlet  ó ǰ 
+        // modelPath   ޽ meshCount  triangleCount ﰢ  
+        static MeshletBenchmarkResult RunMeshletBenchmark(const std::string& modelPath,
+            size_t triangleCount = 1024 * 1024, size_t meshCount = 4, int iterations = 3);
+
+        struct SimplifierCheckResult {
+            size_t checks = 0;
+            size_t violations = 0;
+            float maxReportedError = 0.0f;      // ܼȭ    ִ ( ǥ )
+            float maxMeasuredError = 0.0f;      //    Ÿ  ִ
+        };
+
+        // MeshSimplifier     Ÿ  
+        // -   ܰ躰 ܼȭϰ, Է   ﰢ ü   Ÿ 
+        // - LOD ü ܰ踶 LOD0    ˻
+        static SimplifierCheckResult RunSimplifierCheck(size_t triangleCount = 8192);
+
+    private:
+        static MeshData CreateRandomMesh(size_t vertexCount);
+        static MeshData CreateSphereMeshes(size_t triangleCount, size_t meshCount);
+    };
+}
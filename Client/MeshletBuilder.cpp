@@ -0,0 +1,263 @@
+#include "pch.h"
+#include "MeshletBuilder.h"
+
+namespace Resource
+{
+    namespace MeshletBuilder
+    {
+        namespace
+        {
+            constexpr uint8_t NotInMeshlet = 0xFF;
+            constexpr uint32_t InvalidTriangle = ~0u;
+
+            XMVECTOR LoadPosition(std::span<const Vertex> vertices, uint32_t index)
+            {
+                return XMLoadFloat3(&vertices[index].position);
+            }
+
+            // Ŭ    
+            void ComputeBounds(std::span<const Vertex> vertices, std::span<const uint32_t> meshletVertices,
+                std::span<const uint8_t> meshletTriangles, MeshFormat::Meshlet& meshlet)
+            {
+                //   -  AABB ߽ɿ   
+                XMVECTOR boundsMin = LoadPosition(vertices, meshletVertices[0]);
+                XMVECTOR boundsMax = boundsMin;
+                for (uint32_t v : meshletVertices) {
+                    XMVECTOR p = LoadPosition(vertices, v);
+                    boundsMin = XMVectorMin(boundsMin, p);
+                    boundsMax = XMVectorMax(boundsMax, p);
+                }
+                XMVECTOR center = XMVectorScale(XMVectorAdd(boundsMin, boundsMax), 0.5f);
+
+                float radiusSq = 0.0f;
+                for (uint32_t v : meshletVertices) {
+                    radiusSq = std::max(radiusSq, XMVectorGetX(XMVector3LengthSq(XMVectorSubtract(LoadPosition(vertices, v), center))));
+                }
+
+                XMFLOAT3 c;
+                XMStoreFloat3(&c, center);
+                meshlet.center[0] = c.x;
+                meshlet.center[1] = c.y;
+                meshlet.center[2] = c.z;
+                meshlet.radius = std::sqrt(radiusSq);
+
+                //   -    , cutoff = sin(     )
+                std::vector<XMVECTOR> normals;
+                std::vector<XMVECTOR> corners;
+                normals.reserve(meshletTriangles.size() / 3);
+                corners.reserve(meshletTriangles.size() / 3);
+
+                XMVECTOR axis = XMVectorZero();
+                for (size_t t = 0; t + 2 < meshletTriangles.size(); t += 3) {
+                    XMVECTOR p0 = LoadPosition(vertices, meshletVertices[meshletTriangles[t + 0]]);
+                    XMVECTOR p1 = LoadPosition(vertices, meshletVertices[meshletTriangles[t + 1]]);
+                    XMVECTOR p2 = LoadPosition(vertices, meshletVertices[meshletTriangles[t + 2]]);
+                    XMVECTOR normal = XMVector3Cross(XMVectorSubtract(p1, p0), XMVectorSubtract(p2, p0));
+
+                    const float length = XMVectorGetX(XMVector3Length(normal));
+                    if (length <= 0.0f) continue;   //  0 ﰢ  
+
+                    normal = XMVectorScale(normal, 1.0f / length);
+                    normals.push_back(normal);
+                    corners.push_back(p0);
+                    axis = XMVectorAdd(axis, normal);
+                }
+
+                meshlet.coneApex[0] = c.x;
+                meshlet.coneApex[1] = c.y;
+                meshlet.coneApex[2] = c.z;
+                meshlet.coneAxis[0] = 0.0f;
+                meshlet.coneAxis[1] = 0.0f;
+                meshlet.coneAxis[2] = 0.0f;
+                meshlet.coneCutoff = 1.0f;
+
+                const float axisLength = XMVectorGetX(XMVector3Length(axis));
+                if (normals.empty() || axisLength <= 0.0f) return;
+                axis = XMVectorScale(axis, 1.0f / axisLength);
+
+                float minDot = 1.0f;
+                for (const auto& normal : normals) {
+                    minDot = std::min(minDot, XMVectorGetX(XMVector3Dot(axis, normal)));
+                }
+
+                XMFLOAT3 a;
+                XMStoreFloat3(&a, axis);
+                meshlet.coneAxis[0] = a.x;
+                meshlet.coneAxis[1] = a.y;
+                meshlet.coneAxis[2] = a.z;
+
+                // ݰ 90 ̸̻  ⿡ ո    - ø  
+                if (minDot <= 0.1f) return;
+
+                //   ﰢ  ʿ  ߽ɿ  ݴ о
+                // dot(center - t * axis - corner, normal) = 0 -> t = dot(center - corner, normal) / dot(axis, normal)
+                float maxT = 0.0f;
+                for (size_t i = 0; i < normals.size(); ++i) {
+                    const float dc = XMVectorGetX(XMVector3Dot(XMVectorSubtract(center, corners[i]), normals[i]));
+                    const float dn = XMVectorGetX(XMVector3Dot(axis, normals[i]));
+                    maxT = std::max(maxT, dc / dn);
+                }
+
+                XMFLOAT3 apex;
+                XMStoreFloat3(&apex, XMVectorSubtract(center, XMVectorScale(axis, maxT)));
+                meshlet.coneApex[0] = apex.x;
+                meshlet.coneApex[1] = apex.y;
+                meshlet.coneApex[2] = apex.z;
+                meshlet.coneCutoff = std::sqrt(1.0f - minDot * minDot);
+            }
+        }
+
+        void Build(std::span<const Vertex> vertices, std::span<const uint32_t> indices, Result& result)
+        {
+            result = {};
+
+            const size_t triangleCount = indices.size() / 3;
+            if (triangleCount == 0 || vertices.empty()) return;
+
+            //  -> ﰢ  (CSR)
+            std::vector<uint32_t> adjacencyOffsets(vertices.size() + 1, 0);
+            for (size_t i = 0; i < triangleCount * 3; ++i) {
+                ++adjacencyOffsets[indices[i] + 1];
+            }
+            for (size_t v = 0; v < vertices.size(); ++v) {
+                adjacencyOffsets[v + 1] += adjacencyOffsets[v];
+            }
+            std::vector<uint32_t> adjacency(triangleCount * 3);
+            {
+                std::vector<uint32_t> cursor(adjacencyOffsets.begin(), adjacencyOffsets.end() - 1);
+                for (size_t t = 0; t < triangleCount; ++t) {
+                    for (int k = 0; k < 3; ++k) {
+                        adjacency[cursor[indices[t * 3 + k]]++] = static_cast<uint32_t>(t);
+                    }
+                }
+            }
+
+            std::vector<XMFLOAT3> triangleCenters(triangleCount);
+            for (size_t t = 0; t < triangleCount; ++t) {
+                XMVECTOR sum = XMVectorAdd(XMVectorAdd(LoadPosition(vertices, indices[t * 3 + 0]),
+                    LoadPosition(vertices, indices[t * 3 + 1])), LoadPosition(vertices, indices[t * 3 + 2]));
+                XMStoreFloat3(&triangleCenters[t], XMVectorScale(sum, 1.0f / 3.0f));
+            }
+
+            std::vector<bool> emitted(triangleCount, false);
+            std::vector<uint8_t> localIndex(vertices.size(), NotInMeshlet);
+
+            result.meshlets.reserve(triangleCount / MaxTriangles + 1);
+            result.vertices.reserve(triangleCount);
+            result.triangles.reserve(triangleCount * 3);
+            result.indices.reserve(triangleCount * 3);
+
+            MeshFormat::Meshlet meshlet = {};
+            XMVECTOR centerSum = XMVectorZero();
+
+            auto newVertexCount = [&](uint32_t t) {
+                return (localIndex[indices[t * 3 + 0]] == NotInMeshlet ? 1u : 0u) +
+                    (localIndex[indices[t * 3 + 1]] == NotInMeshlet ? 1u : 0u) +
+                    (localIndex[indices[t * 3 + 2]] == NotInMeshlet ? 1u : 0u);
+            };
+
+            auto appendTriangle = [&](uint32_t t) {
+                for (int k = 0; k < 3; ++k) {
+                    const uint32_t v = indices[t * 3 + k];
+                    if (localIndex[v] == NotInMeshlet) {
+                        localIndex[v] = static_cast<uint8_t>(meshlet.vertexCount++);
+                        result.vertices.push_back(v);
+                        centerSum = XMVectorAdd(centerSum, LoadPosition(vertices, v));
+                    }
+                    result.triangles.push_back(localIndex[v]);
+                    result.indices.push_back(v);
+                }
+                ++meshlet.triangleCount;
+                emitted[t] = true;
+            };
+
+            auto finishMeshlet = [&]() {
+                auto meshletVertices = std::span(result.vertices).subspan(meshlet.vertexOffset, meshlet.vertexCount);
+                ComputeBounds(vertices, meshletVertices,
+                    std::span(result.triangles).subspan(size_t(meshlet.triangleOffset) * 3, size_t(meshlet.triangleCount) * 3),
+                    meshlet);
+                for (uint32_t v : meshletVertices) {
+                    localIndex[v] = NotInMeshlet;
+                }
+                result.meshlets.push_back(meshlet);
+            };
+
+            //  ﰢ    ĺ -     ,  Ŭ ߽ɿ  ,  ȣ 
+            auto findCandidate = [&](std::span<const uint32_t> fromVertices) {
+                uint32_t best = InvalidTriangle;
+                uint32_t bestNew = 4;
+                float bestDistance = FLT_MAX;
+
+                const XMVECTOR center = XMVectorScale(centerSum, 1.0f / static_cast<float>(meshlet.vertexCount));
+                for (uint32_t v : fromVertices) {
+                    for (uint32_t a = adjacencyOffsets[v]; a < adjacencyOffsets[v + 1]; ++a) {
+                        const uint32_t t = adjacency[a];
+                        if (emitted[t]) continue;
+
+                        const uint32_t extra = newVertexCount(t);
+                        if (meshlet.vertexCount + extra > MaxVertices || extra > bestNew) continue;
+
+                        const float distance = XMVectorGetX(XMVector3LengthSq(
+                            XMVectorSubtract(XMLoadFloat3(&triangleCenters[t]), center)));
+                        if (extra < bestNew || distance < bestDistance || (distance == bestDistance && t < best)) {
+                            best = t;
+                            bestNew = extra;
+                            bestDistance = distance;
+                        }
+                    }
+                }
+                return best;
+            };
+
+            size_t seedCursor = 0;
+            uint32_t lastTriangle = InvalidTriangle;
+
+            while (true) {
+                if (meshlet.triangleCount == 0) {
+                    //  Ŭ - Է     ù ﰢ 
+                    while (seedCursor < triangleCount && emitted[seedCursor]) ++seedCursor;
+                    if (seedCursor == triangleCount) break;
+
+                    meshlet.vertexOffset = static_cast<uint32_t>(result.vertices.size());
+                    meshlet.triangleOffset = static_cast<uint32_t>(result.triangles.size() / 3);
+                    meshlet.indexOffset = static_cast<uint32_t>(result.indices.size());
+                    centerSum = XMVectorZero();
+
+                    lastTriangle = static_cast<uint32_t>(seedCursor);
+                    appendTriangle(lastTriangle);
+                    continue;
+                }
+
+                //    ﰢ ֺ ,  Ŭ ü  ̿ 
+                uint32_t next = InvalidTriangle;
+                if (meshlet.triangleCount < MaxTriangles) {
+                    const uint32_t recent[3] = { indices[lastTriangle * 3 + 0], indices[lastTriangle * 3 + 1],
+                        indices[lastTriangle * 3 + 2] };
+                    next = findCandidate(recent);
+                    if (next == InvalidTriangle) {
+                        next = findCandidate(std::span(result.vertices).subspan(meshlet.vertexOffset, meshlet.vertexCount));
+                    }
+                }
+
+                if (next == InvalidTriangle) {
+                    finishMeshlet();
+                    meshlet = {};
+                    continue;
+                }
+
+                lastTriangle = next;
+                appendTriangle(next);
+            }
+        }
+
+        bool IsBackFacing(const MeshFormat::Meshlet& meshlet, const XMFLOAT3& cameraPosition)
+        {
+            if (meshlet.coneCutoff >= 1.0f) return false;
+
+            XMVECTOR apex = XMVectorSet(meshlet.coneApex[0], meshlet.coneApex[1], meshlet.coneApex[2], 0.0f);
+            XMVECTOR axis = XMVectorSet(meshlet.coneAxis[0], meshlet.coneAxis[1], meshlet.coneAxis[2], 0.0f);
+            XMVECTOR view = XMVector3Normalize(XMVectorSubtract(apex, XMLoadFloat3(&cameraPosition)));
+            return XMVectorGetX(XMVector3Dot(view, axis)) >= meshlet.coneCutoff;
+        }
+    }
+}
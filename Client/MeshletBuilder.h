@@ -0,0 +1,31 @@
+#pragma once
+#include "pch.h"
+#include "MeshCache.h"
+
+namespace Resource
+{
+    // ޽ø  Ŭ(meshlet)  - Ŭ  CPU ø,  ޽ ̴ Է
+    // - Է ε ( ĳ/ ȭ )   ﰢ ,
+    //         ﰢ ٿ  ( Ŭ ߽ɿ  )
+    // - Ŭ͸      ( ޸ ø)
+    // -  Է̸ ׻  
+    namespace MeshletBuilder
+    {
+        // ޽ ̴ ׷  Ѱ迡   (NVIDIA  64/126 ﰢ 4  )
+        constexpr uint32_t MaxVertices = 64;
+        constexpr uint32_t MaxTriangles = 124;
+
+        struct Result {
+            std::vector<MeshFormat::Meshlet> meshlets;
+            std::vector<uint32_t> vertices;     // meshlet  -> Է  ȣ
+            std::vector<uint8_t> triangles;     // ﰢ meshlet   3
+            std::vector<uint32_t> indices;      // Է ﰢ meshlet  ٽ þ ε
+        };
+
+        //    迭  (indexOffset result.indices )
+        void Build(std::span<const Vertex> vertices, std::span<const uint32_t> indices, Result& result);
+
+        // ī޶ ġ(޽ ǥ) Ŭ  ﰢ ޸
+        bool IsBackFacing(const MeshFormat::Meshlet& meshlet, const DirectX::XMFLOAT3& cameraPosition);
+    }
+}
@@ -0,0 +1,76 @@
+#pragma once
+#include "pch.h"
+
+namespace Resource
+{
+    // ؽó  Ʈ   (GPU   )
+    // -  ȣ  ػ󵵰 
+    // -   ׻ [residentMip, mipCount)  
+    // -    Ӿ,  ػ󵵿  ػ  ø
+    class MipStreamState {
+    public:
+        static constexpr uint32_t NoMip = ~0u;
+
+        //  ([firstResidentMip, mipCount)) ö · ʱȭ
+        void Reset(uint32_t mipCount, uint32_t firstResidentMip) {
+            m_mipCount = mipCount;
+            m_residentMip = std::min(firstResidentMip, mipCount ? mipCount - 1 : 0);
+            m_requestedMip = m_residentMip;
+            m_inflightMip = NoMip;
+        }
+
+        // ʿ   ػ  û (̹    )
+        void Request(uint32_t mip) {
+            if (m_mipCount == 0) return;
+            m_requestedMip = std::min(mip, m_mipCount - 1);
+        }
+
+        //  ø  -   ε尡 ְų û ̹ ϸ NoMip
+        uint32_t BeginNext() {
+            if (m_inflightMip != NoMip || m_residentMip == 0 || m_residentMip <= m_requestedMip) {
+                return NoMip;
+            }
+            m_inflightMip = m_residentMip - 1;
+            return m_inflightMip;
+        }
+
+        // ε尡     ߰
+        void Complete(uint32_t mip) {
+            if (mip != m_inflightMip) return;
+            m_residentMip = mip;
+            m_inflightMip = NoMip;
+        }
+
+        // ε     ǥø  ( BeginNext õ)
+        void Abort() {
+            m_inflightMip = NoMip;
+        }
+
+        uint32_t GetMipCount() const { return m_mipCount; }
+        uint32_t GetResidentMip() const { return m_residentMip; }
+        uint32_t GetRequestedMip() const { return m_requestedMip; }
+        uint32_t GetInflightMip() const { return m_inflightMip; }
+
+        bool IsStreaming() const { return m_inflightMip != NoMip; }
+        bool IsFullyResident() const { return m_residentMip == 0; }
+        bool HasPendingWork() const { return IsStreaming() || m_residentMip > m_requestedMip; }
+
+        // ̴     ʵ  SRV MinLOD 
+        float GetMinLodClamp() const { return static_cast<float>(m_residentMip); }
+
+        // ȭ鿡 screenPixels ȼ  ׷ ؽó(   dimension) ʿ 
+        // ؼ ȼ  ʴ   ػ  (û   Request)
+        static uint32_t GetMipForScreenSize(uint32_t dimension, float screenPixels) {
+            if (dimension == 0) return 0;
+            if (!(screenPixels >= 1.0f)) return NoMip;     //    -    (Request  ڸ)
+            const float ratio = static_cast<float>(dimension) / screenPixels;
+            return ratio <= 1.0f ? 0 : static_cast<uint32_t>(std::floor(std::log2(ratio)));
+        }
+
+    private:
+        uint32_t m_mipCount = 0;
+        uint32_t m_residentMip = 0;
+        uint32_t m_requestedMip = 0;
+        uint32_t m_inflightMip = NoMip;
+    };
+}
@@ -0,0 +1,406 @@
+#include "pch.h"
+#include "ModelResource.h"
+#include "MeshOptimizer.h"
+#include "MeshSimplifier.h"
+#include "MeshletBuilder.h"
+#include "MappedFile.h"
+#include "ArchiveManager.h"
+#include "GraphicsDevice.h"
+
+namespace Resource
+{
+    bool ModelResource::Load()
+    {
+        if (IsReady()) return true;
+
+        SetState(State::Loading);
+
+        if (!GraphicsDevice::Instance().GetDevice() || !GraphicsDevice::Instance().GetCommandQueue()) {
+            SetState(State::Failed);
+            Logger::Instance().Error("̽ Ǵ Ŀǵ ť ϴ: {}", GetPath());
+            return false;
+        }
+
+        try {
+            // ŷ ʹ ε尡    
+            AssetData packaged;
+            MappedFile mapped;
+            MeshView view;
+            MeshData imported;
+            std::vector<PackedVertex> importedVertices;
+            const char* origin = "Ű";
+
+            // 1. Ű Բ  ִ ŷ 
+            if ((packaged = ArchiveManager::Instance().Find(GetPath() + ".mesh"))) {
+                view = MeshCache::Parse(packaged.bytes);
+            }
+
+            // 2. ũ ĳ -       (    ״ ŷ)
+            const auto cachePath = GetCachePath(GetPath());
+            const uint64_t stamp = MeshCache::ComputeSourceStamp(GetPath(), ImportFlags);
+            if (!view && mapped.Open(cachePath.string())) {
+                view = MeshCache::Parse(mapped.GetBytes());
+                if (view && stamp != 0 && view.header->sourceStamp != stamp) {
+                    view = {};
+                }
+                if (!view) {
+                    mapped.Close();
+                }
+                origin = "ĳ";
+            }
+
+            std::span<const MeshFormat::Mesh> meshes = view.meshes;
+            std::span<const MeshFormat::Lod> lods = view.lods;
+            std::span<const MeshFormat::Meshlet> meshlets = view.meshlets;
+            std::span<const PackedVertex> vertices = view.vertices;
+            std::span<const uint32_t> indices = view.indices;
+
+            // 3. Assimp Ʈ   ε带  ĳ 
+            if (!view) {
+                if (!Cook(GetPath(), imported)) {
+                    throw std::runtime_error(" Ʈ ");
+                }
+                if (!MeshCache::Write(cachePath, imported, stamp)) {
+                    Logger::Instance().Warning(" ĳ  : {}", cachePath.string());
+                }
+                importedVertices = MeshCache::PackVertices(imported);
+                meshes = imported.meshes;
+                lods = imported.lods;
+                meshlets = imported.meshlets;
+                vertices = importedVertices;
+                indices = imported.indices;
+                origin = "Ʈ";
+            }
+
+            if (meshes.empty() || vertices.empty() || indices.empty()) {
+                throw std::runtime_error("׸  ִ ޽ð ϴ");
+            }
+
+            UploadBuffers(vertices, indices);
+
+            m_meshes.assign(meshes.begin(), meshes.end());
+            m_lods.assign(lods.begin(), lods.end());
+            m_meshlets.assign(meshlets.begin(), meshlets.end());
+            m_vertexCount = vertices.size();
+            m_indexCount = indices.size();
+
+            XMFLOAT3 boundsMin(FLT_MAX, FLT_MAX, FLT_MAX);
+            XMFLOAT3 boundsMax(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+            for (const auto& mesh : m_meshes) {
+                boundsMin = { std::min(boundsMin.x, mesh.boundsMin[0]), std::min(boundsMin.y, mesh.boundsMin[1]),
+                    std::min(boundsMin.z, mesh.boundsMin[2]) };
+                boundsMax = { std::max(boundsMax.x, mesh.boundsMax[0]), std::max(boundsMax.y, mesh.boundsMax[1]),
+                    std::max(boundsMax.z, mesh.boundsMax[2]) };
+            }
+            DirectX::BoundingBox::CreateFromPoints(m_bounds, XMLoadFloat3(&boundsMin), XMLoadFloat3(&boundsMax));
+
+            SetSize(vertices.size_bytes() + indices.size_bytes());
+            SetState(State::Ready);
+
+            Logger::Instance().Info(" ε Ϸ: {} ({}, ޽ {},  {}, ﰢ {})",
+                GetName(), origin, m_meshes.size(), m_vertexCount, m_indexCount / 3);
+            return true;
+        }
+        catch (const std::exception& e) {
+            SetState(State::Failed);
+            Logger::Instance().Error(" ε   ߻: {} - {}", GetPath(), e.what());
+            return false;
+        }
+    }
+
+    void ModelResource::Unload()
+    {
+        if (m_vertexBuffer || m_indexBuffer) {
+            m_vertexBuffer.Reset();
+            m_indexBuffer.Reset();
+            m_vertexBufferView = {};
+            m_indexBufferView = {};
+            m_meshes.clear();
+            m_lods.clear();
+            m_meshlets.clear();
+            m_vertexCount = 0;
+            m_indexCount = 0;
+            SetState(State::Unloaded);
+            Logger::Instance().Debug(" ε: {}", GetName());
+        }
+    }
+
+    bool ModelResource::SwapContents(IResource& source)
+    {
+        auto* other = dynamic_cast<ModelResource*>(&source);
+        if (!other) return false;
+
+        m_vertexBuffer.Swap(other->m_vertexBuffer);
+        m_indexBuffer.Swap(other->m_indexBuffer);
+        std::swap(m_vertexBufferView, other->m_vertexBufferView);
+        std::swap(m_indexBufferView, other->m_indexBufferView);
+        m_meshes.swap(other->m_meshes);
+        m_lods.swap(other->m_lods);
+        m_meshlets.swap(other->m_meshlets);
+        std::swap(m_bounds, other->m_bounds);
+        std::swap(m_vertexCount, other->m_vertexCount);
+        std::swap(m_indexCount, other->m_indexCount);
+        SwapBase(*other);
+        return true;
+    }
+
+    std::span<const MeshFormat::Lod> ModelResource::GetLods(const MeshFormat::Mesh& mesh) const
+    {
+        if (mesh.lodCount == 0 || mesh.lodOffset + mesh.lodCount > m_lods.size()) return {};
+        return std::span(m_lods).subspan(mesh.lodOffset, mesh.lodCount);
+    }
+
+    MeshFormat::Lod ModelResource::SelectLod(const MeshFormat::Mesh& mesh, float distance, float projectionScale,
+        float maxPixelError) const
+    {
+        // LOD  ޽ ü 
+        MeshFormat::Lod selected{ mesh.indexOffset, mesh.indexCount, 0.0f, 0 };
+
+        // ȭ (ȼ) =  * projectionScale / Ÿ -   ȿ  ģ ܰ
+        const float maxError = maxPixelError * std::max(distance, 0.0f) / projectionScale;
+        for (const auto& lod : GetLods(mesh)) {
+            if (lod.error > maxError) break;
+            selected = lod;
+        }
+        return selected;
+    }
+
+    std::span<const MeshFormat::Meshlet> ModelResource::GetMeshlets(const MeshFormat::Mesh& mesh) const
+    {
+        if (mesh.meshletCount == 0 || mesh.meshletOffset + mesh.meshletCount > m_meshlets.size()) return {};
+        return std::span(m_meshlets).subspan(mesh.meshletOffset, mesh.meshletCount);
+    }
+
+    size_t ModelResource::CullMeshlets(const MeshFormat::Mesh& mesh, const DirectX::BoundingFrustum& frustum,
+        const XMFLOAT3& cameraPosition, std::vector<IndexRange>& drawRanges) const
+    {
+        auto meshlets = GetMeshlets(mesh);
+        if (meshlets.empty()) {
+            // ŬͰ  ( ) ޽ ü
+            drawRanges.push_back({ mesh.indexOffset, mesh.indexCount });
+            return 0;
+        }
+
+        size_t culled = 0;
+        for (const auto& meshlet : meshlets) {
+            const DirectX::BoundingSphere sphere(XMFLOAT3(meshlet.center[0], meshlet.center[1], meshlet.center[2]),
+                meshlet.radius);
+            if (MeshletBuilder::IsBackFacing(meshlet, cameraPosition) || !frustum.Intersects(sphere)) {
+                ++culled;
+                continue;
+            }
+
+            const uint32_t indexCount = meshlet.triangleCount * 3u;
+            if (!drawRanges.empty() && drawRanges.back().indexOffset + drawRanges.back().indexCount == meshlet.indexOffset) {
+                drawRanges.back().indexCount += indexCount;
+            }
+            else {
+                drawRanges.push_back({ meshlet.indexOffset, indexCount });
+            }
+        }
+        return culled;
+    }
+
+    float ModelResource::ComputeProjectionScale(float fovY, float viewportHeight)
+    {
+        return viewportHeight / (2.0f * std::tan(fovY * 0.5f));
+    }
+
+    std::filesystem::path ModelResource::GetCachePath(const std::string& sourcePath)
+    {
+        const uint64_t hash = AssetArchive::HashPath(AssetArchive::NormalizePath(sourcePath));
+        return std::filesystem::path(CacheDirectory) / std::format("{:016x}.mesh", hash);
+    }
+
+    bool ModelResource::Cook(const std::string& sourcePath, MeshData& data)
+    {
+        Assimp::Importer importer;
+
+        // SortByPType  / ޽ô 
+        importer.SetPropertyInteger(AI_CONFIG_PP_SBP_REMOVE, aiPrimitiveType_POINT | aiPrimitiveType_LINE);
+
+        const aiScene* scene = nullptr;
+        if (auto asset = ArchiveManager::Instance().Find(sourcePath)) {
+            // Ȯڷ  ǴϹǷ Ʈ ѱ
+            const std::string extension = std::filesystem::path(sourcePath).extension().string();
+            scene = importer.ReadFileFromMemory(asset.data(), asset.size(), ImportFlags,
+                extension.empty() ? "" : extension.c_str() + 1);
+        }
+        else {
+            scene = importer.ReadFile(sourcePath, ImportFlags);
+        }
+
+        if (!scene || (scene->mFlags & AI_SCENE_FLAGS_INCOMPLETE) || !scene->HasMeshes()) {
+            Logger::Instance().Error("Assimp Ʈ : {} - {}", sourcePath, importer.GetErrorString());
+            return false;
+        }
+
+        struct CookedMesh {
+            std::vector<Vertex> vertices;
+            std::vector<uint32_t> indices;
+            std::vector<MeshSimplifier::LodLevel> lods;
+            MeshletBuilder::Result meshlets;
+            MeshFormat::Mesh info{};
+        };
+        std::vector<CookedMesh> cooked(scene->mNumMeshes);
+
+        // ޽ó ̹Ƿ ķ ȯ/ȭ/meshlet/LOD  ( ޽  Ƿ   )
+        tbb::parallel_for(size_t(0), cooked.size(), [&](size_t m) {
+            const aiMesh* mesh = scene->mMeshes[m];
+            CookedMesh& out = cooked[m];
+
+            out.vertices.resize(mesh->mNumVertices);
+            for (unsigned int i = 0; i < mesh->mNumVertices; ++i) {
+                Vertex& vertex = out.vertices[i];
+                const aiVector3D& position = mesh->mVertices[i];
+                vertex.position = { position.x, position.y, position.z };
+
+                if (mesh->HasVertexColors(0)) {
+                    const aiColor4D& color = mesh->mColors[0][i];
+                    vertex.color = { color.r, color.g, color.b, color.a };
+                }
+                else {
+                    vertex.color = { 1.0f, 1.0f, 1.0f, 1.0f };
+                }
+
+                if (mesh->HasNormals()) {
+                    const aiVector3D& normal = mesh->mNormals[i];
+                    vertex.normal = { normal.x, normal.y, normal.z };
+                }
+                else {
+                    vertex.normal = { 0.0f, 1.0f, 0.0f };
+                }
+
+                if (mesh->HasTextureCoords(0)) {
+                    const aiVector3D& uv = mesh->mTextureCoords[0][i];
+                    vertex.texCoord = { uv.x, uv.y };
+                }
+                else {
+                    vertex.texCoord = { 0.0f, 0.0f };
+                }
+            }
+
+            out.indices.reserve(static_cast<size_t>(mesh->mNumFaces) * 3);
+            for (unsigned int f = 0; f < mesh->mNumFaces; ++f) {
+                const aiFace& face = mesh->mFaces[f];
+                if (face.mNumIndices != 3) continue;
+                out.indices.insert(out.indices.end(), face.mIndices, face.mIndices + 3);
+            }
+
+            MeshOptimizer::Optimize(out.vertices, out.indices);
+
+            // Ŭ  ﰢ ٽ þ - Ŭ͸ LOD0 ε   
+            //  ȭ  Ƿ  ĳ/  κ 
+            MeshletBuilder::Build(out.vertices, out.indices, out.meshlets);
+            out.indices = std::move(out.meshlets.indices);
+
+            out.info.vertexCount = static_cast<uint32_t>(out.vertices.size());
+            out.info.indexCount = static_cast<uint32_t>(out.indices.size());
+            out.info.materialIndex = mesh->mMaterialIndex;
+            out.info.acmr = MeshOptimizer::AnalyzeVertexCache(out.indices, out.vertices.size());
+
+            for (int k = 0; k < 3; ++k) {
+                out.info.boundsMin[k] = std::numeric_limits<float>::max();
+                out.info.boundsMax[k] = std::numeric_limits<float>::lowest();
+            }
+            for (const Vertex& vertex : out.vertices) {
+                const float position[3] = { vertex.position.x, vertex.position.y, vertex.position.z };
+                for (int k = 0; k < 3; ++k) {
+                    out.info.boundsMin[k] = std::min(out.info.boundsMin[k], position[k]);
+                    out.info.boundsMax[k] = std::max(out.info.boundsMax[k], position[k]);
+                }
+            }
+
+            out.lods = MeshSimplifier::BuildLodChain(out.vertices, out.indices);
+        });
+
+        //  ۷ ̾  (ε ޽  ״, ׸  BaseVertexLocation )
+        data = {};
+        for (auto& mesh : cooked) {
+            if (mesh.indices.empty()) continue;
+
+            mesh.info.vertexOffset = static_cast<uint32_t>(data.vertices.size());
+            mesh.info.indexOffset = static_cast<uint32_t>(data.indices.size());
+            mesh.info.lodOffset = static_cast<uint32_t>(data.lods.size());
+            mesh.info.lodCount = static_cast<uint32_t>(mesh.lods.size());
+            mesh.info.meshletOffset = static_cast<uint32_t>(data.meshlets.size());
+            mesh.info.meshletCount = static_cast<uint32_t>(mesh.meshlets.meshlets.size());
+            data.vertices.insert(data.vertices.end(), mesh.vertices.begin(), mesh.vertices.end());
+
+            // Ŭ   迭  (meshlet   ޽  ״)
+            for (auto meshlet : mesh.meshlets.meshlets) {
+                meshlet.vertexOffset += static_cast<uint32_t>(data.meshletVertices.size());
+                meshlet.triangleOffset += static_cast<uint32_t>(data.meshletTriangles.size() / 3);
+                meshlet.indexOffset += mesh.info.indexOffset;
+                data.meshlets.push_back(meshlet);
+            }
+            data.meshletVertices.insert(data.meshletVertices.end(),
+                mesh.meshlets.vertices.begin(), mesh.meshlets.vertices.end());
+            data.meshletTriangles.insert(data.meshletTriangles.end(),
+                mesh.meshlets.triangles.begin(), mesh.meshlets.triangles.end());
+
+            // LOD0(= mesh.indices) ʷ - LOD0  ޽ ⺻  
+            for (const auto& lod : mesh.lods) {
+                data.lods.push_back({ static_cast<uint32_t>(data.indices.size()),
+                    static_cast<uint32_t>(lod.indices.size()), lod.error, 0 });
+                data.indices.insert(data.indices.end(), lod.indices.begin(), lod.indices.end());
+            }
+            data.meshes.push_back(mesh.info);
+
+            Logger::Instance().Debug("޽ ŷ: {} #{} ( {}, ﰢ {}, ACMR {:.3f}, meshlet {}, LOD {}ܰ -> ﰢ {})",
+                sourcePath, data.meshes.size() - 1, mesh.info.vertexCount, mesh.info.indexCount / 3, mesh.info.acmr,
+                mesh.info.meshletCount, mesh.lods.size(), mesh.lods.back().indices.size() / 3);
+        }
+        return !data.meshes.empty();
+    }
+
+    void ModelResource::UploadBuffers(std::span<const PackedVertex> vertices, std::span<const uint32_t> indices)
+    {
+        auto* device = GraphicsDevice::Instance().GetDevice();
+        auto* cmdQueue = GraphicsDevice::Instance().GetCommandQueue();
+
+        const CD3DX12_HEAP_PROPERTIES heapProps(D3D12_HEAP_TYPE_DEFAULT);
+        auto createBuffer = [&](size_t size, ComPtr<ID3D12Resource>& buffer) {
+            const auto desc = CD3DX12_RESOURCE_DESC::Buffer(size);
+            ThrowIfFailed(device->CreateCommittedResource(&heapProps, D3D12_HEAP_FLAG_NONE, &desc,
+                D3D12_RESOURCE_STATE_COPY_DEST, nullptr, IID_PPV_ARGS(&buffer)));
+        };
+
+        ComPtr<ID3D12Resource> vertexBuffer;
+        ComPtr<ID3D12Resource> indexBuffer;
+        createBuffer(vertices.size_bytes(), vertexBuffer);
+        createBuffer(indices.size_bytes(), indexBuffer);
+
+        // ε ĳÿ ε  ٷ 
+        D3D12_SUBRESOURCE_DATA vertexData = {};
+        vertexData.pData = vertices.data();
+        vertexData.RowPitch = static_cast<LONG_PTR>(vertices.size_bytes());
+        vertexData.SlicePitch = vertexData.RowPitch;
+
+        D3D12_SUBRESOURCE_DATA indexData = {};
+        indexData.pData = indices.data();
+        indexData.RowPitch = static_cast<LONG_PTR>(indices.size_bytes());
+        indexData.SlicePitch = indexData.RowPitch;
+
+        DirectX::ResourceUploadBatch resourceUpload(device);
+        resourceUpload.Begin();
+        resourceUpload.Upload(vertexBuffer.Get(), 0, &vertexData, 1);
+        resourceUpload.Upload(indexBuffer.Get(), 0, &indexData, 1);
+        resourceUpload.Transition(vertexBuffer.Get(),
+            D3D12_RESOURCE_STATE_COPY_DEST, D3D12_RESOURCE_STATE_VERTEX_AND_CONSTANT_BUFFER);
+        resourceUpload.Transition(indexBuffer.Get(),
+            D3D12_RESOURCE_STATE_COPY_DEST, D3D12_RESOURCE_STATE_INDEX_BUFFER);
+        resourceUpload.End(cmdQueue).wait();
+
+        m_vertexBuffer = std::move(vertexBuffer);
+        m_indexBuffer = std::move(indexBuffer);
+
+        m_vertexBufferView.BufferLocation = m_vertexBuffer->GetGPUVirtualAddress();
+        m_vertexBufferView.StrideInBytes = sizeof(PackedVertex);
+        m_vertexBufferView.SizeInBytes = static_cast<UINT>(vertices.size_bytes());
+
+        m_indexBufferView.BufferLocation = m_indexBuffer->GetGPUVirtualAddress();
+        m_indexBufferView.Format = DXGI_FORMAT_R32_UINT;
+        m_indexBufferView.SizeInBytes = static_cast<UINT>(indices.size_bytes());
+    }
+}
@@ -0,0 +1,107 @@
+#pragma once
+#include "pch.h"
+#include "IResource.h"
+#include "MeshCache.h"
+#include "Logger.h"
+
+namespace Resource
+{
+    // 3D  - Ÿ ޽ (.mesh) ŷؼ 
+    // - Ű "<>.mesh" ְų ũ ĳð   ؼ ٷ ε (Assimp )
+    // - ƴϸ Assimp   Ʈ ->  ߺ ,  ĳ//ġ  ȭ,
+    //   meshlet , QEM LOD ü  -> ĳ 
+    //  ޽ð  (PackedVertex) ۿ ε  ϳ 
+    // ׸  VSMainPacked + VertexPacking::InputLayout, ޽ø GetDequantization  ۿ 
+    class ModelResource : public IResource {
+    public:
+        static constexpr Type ResourceType = Type::Model;
+
+        // Ʈ ɼ - ٲ ĳ  ٲ ٽ ŷ
+        static constexpr uint32_t ImportFlags =
+            aiProcess_Triangulate |
+            aiProcess_GenSmoothNormals |
+            aiProcess_PreTransformVertices |
+            aiProcess_SortByPType |
+            aiProcess_ConvertToLeftHanded;
+
+        static constexpr const char* CacheDirectory = "ModelCache";
+
+        explicit ModelResource(const std::string& path)
+            : IResource(Type::Model, path, std::filesystem::path(path).filename().string())
+        {
+            Logger::Instance().Debug(" ҽ : {}", GetName());
+        }
+
+        ~ModelResource() override {
+            Unload();
+        }
+
+        bool Load() override;
+        void Unload() override;
+
+        std::shared_ptr<IResource> CreateReloadCopy() const override {
+            return std::make_shared<ModelResource>(GetPath());
+        }
+
+        bool SwapContents(IResource& source) override;
+
+        const D3D12_VERTEX_BUFFER_VIEW& GetVertexBufferView() const { return m_vertexBufferView; }
+        const D3D12_INDEX_BUFFER_VIEW& GetIndexBufferView() const { return m_indexBufferView; }
+
+        // ޽ú DrawIndexedInstanced(indexCount, n, indexOffset, vertexOffset, 0)
+        const std::vector<MeshFormat::Mesh>& GetMeshes() const { return m_meshes; }
+        const DirectX::BoundingBox& GetBounds() const { return m_bounds; }
+
+        // ޽ LOD ü (LOD0)
+        std::span<const MeshFormat::Lod> GetLods(const MeshFormat::Mesh& mesh) const;
+
+        // ȭ  maxPixelError   ģ LOD
+        // distance: ī޶ Ÿ ( ǥ ), projectionScale: ComputeProjectionScale 
+        MeshFormat::Lod SelectLod(const MeshFormat::Mesh& mesh, float distance, float projectionScale,
+            float maxPixelError = 1.0f) const;
+
+        // Ÿ 1  ǥ 1  ϴ ȼ 
+        static float ComputeProjectionScale(float fovY, float viewportHeight);
+
+        // ޽ Ŭ (LOD0 ﰢ ü, ε ۿ  )
+        std::span<const MeshFormat::Meshlet> GetMeshlets(const MeshFormat::Mesh& mesh) const;
+
+        struct IndexRange {
+            uint32_t indexOffset;
+            uint32_t indexCount;
+        };
+
+        // Ŭ  CPU ø (ü +  ) -  Ŭ ε  drawRanges ߰
+        // ε ۿ ̾  ļ ο ȣ  . frustum/cameraPosition  ǥ
+        // ȯ ø Ŭ 
+        size_t CullMeshlets(const MeshFormat::Mesh& mesh, const DirectX::BoundingFrustum& frustum,
+            const DirectX::XMFLOAT3& cameraPosition, std::vector<IndexRange>& drawRanges) const;
+
+        static VertexPacking::Dequantization GetDequantization(const MeshFormat::Mesh& mesh) {
+            return VertexPacking::ComputeDequantization(mesh.boundsMin, mesh.boundsMax);
+        }
+        size_t GetVertexCount() const { return m_vertexCount; }
+        size_t GetIndexCount() const { return m_indexCount; }
+
+        // ũ ĳ  (ȭ   ؽ)
+        static std::filesystem::path GetCachePath(const std::string& sourcePath);
+
+        // Assimp Ʈ + ȭ + meshlet/LOD  (̽   -  ŷ )
+        static bool Cook(const std::string& sourcePath, MeshData& data);
+
+    private:
+        void UploadBuffers(std::span<const PackedVertex> vertices, std::span<const uint32_t> indices);
+
+        ComPtr<ID3D12Resource> m_vertexBuffer;
+        ComPtr<ID3D12Resource> m_indexBuffer;
+        D3D12_VERTEX_BUFFER_VIEW m_vertexBufferView = {};
+        D3D12_INDEX_BUFFER_VIEW m_indexBufferView = {};
+
+        std::vector<MeshFormat::Mesh> m_meshes;
+        std::vector<MeshFormat::Lod> m_lods;
+        std::vector<MeshFormat::Meshlet> m_meshlets;
+        DirectX::BoundingBox m_bounds;
+        size_t m_vertexCount = 0;
+        size_t m_indexCount = 0;
+    };
+}
@@ -2,12 +2,12 @@
 #include "PhysicsEngine.h"
 #include "PhysicsObject.h"
 #include "ContactReportCallback.h"
+#include "TbbCpuDispatcher.h"
 #include "Logger.h"
 
 PhysicsEngine::PhysicsEngine()
 	: m_foundation(nullptr)
 	, m_physics(nullptr)
-	, m_dispatcher(nullptr)
 	, m_scene(nullptr)
 	, m_defaultMaterial(nullptr)
 	, m_pvd(nullptr)
@@ -19,12 +19,12 @@ PhysicsEngine::~PhysicsEngine()
 	Cleanup();
 }
 
-bool PhysicsEngine::Initialize()
+bool PhysicsEngine::Initialize(uint32_t workerCount, TaskSystem::Priority priority)
 {
 	if (!CreateFoundation()) return false;
 	SetupDebugger();
 	if (!CreatePhysics()) return false;
-	if (!CreateScene()) return false;
+	if (!CreateScene(workerCount, priority)) return false;
 
 	// ⺻  material 
 	m_defaultMaterial = m_physics->createMaterial(0.5f, 0.5f, 0.6f); //  ,  , ݹ߷
@@ -35,27 +35,118 @@ bool PhysicsEngine::Initialize()
 
 void PhysicsEngine::Update(float deltaTime)
 {
-	if (m_scene) {
-		try {
-			// simulate ȣ   üũ
-			m_scene->simulate(deltaTime);
+	ClearContacts();
+	BeginSimulate(deltaTime);
+	FetchResults(true);
+	ExecuteQueries();
+}
 
-			// simulate  ٸ
-			m_scene->fetchResults(true);
-		}
-		catch (const std::exception& e) {
-			Logger::Instance().Error("PhysicsEngine::Update - Exception: {}", e.what());
+void PhysicsEngine::BeginSimulate(float deltaTime)
+{
+	if (!m_scene) {
+		Logger::Instance().Error("PhysicsEngine::BeginSimulate - Scene is null");
+		return;
+	}
+
+	//    ʾ   (simulate fetchResults  ٽ θ  )
+	if (m_simulating) {
+		FetchResults(true);
+	}
+
+	try {
+		m_scene->simulate(deltaTime);
+		m_simulating = true;
+	}
+	catch (const std::exception& e) {
+		Logger::Instance().Error("PhysicsEngine::BeginSimulate - Exception: {}", e.what());
+	}
+}
+
+bool PhysicsEngine::FetchResults(bool block)
+{
+	if (!m_simulating) {
+		m_fetchWaitMs = 0.0;
+		return true;
+	}
+
+	const auto start = std::chrono::steady_clock::now();
+	try {
+		if (!m_scene->fetchResults(block)) {
+			return false;
 		}
 	}
-	else {
-		Logger::Instance().Error("PhysicsEngine::Update - Scene is null");
+	catch (const std::exception& e) {
+		Logger::Instance().Error("PhysicsEngine::FetchResults - Exception: {}", e.what());
+	}
+	m_fetchWaitMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+	m_simulating = false;
+
+	ExtractTransforms();
+	return true;
+}
+
+void PhysicsEngine::SetFixedTimeStep(float step, uint32_t maxSubsteps)
+{
+	m_fixedTimeStep = std::max(step, 1.0f / 1000.0f);
+	m_maxSubsteps = std::max(maxSubsteps, 1u);
+	m_accumulator = std::min(m_accumulator, m_fixedTimeStep * 0.999f);
+}
+
+uint32_t PhysicsEngine::Advance(float frameTime)
+{
+	m_accumulator += std::max(frameTime, 0.0f);
+
+	// ̹ ӿ  ܵ   ۿ ħ
+	ClearContacts();
+
+	uint32_t steps = 0;
+	while (m_accumulator >= m_fixedTimeStep && steps < m_maxSubsteps) {
+		// ̸     ( ̹  )   
+		FetchResults(true);
+		BeginSimulate(m_fixedTimeStep);
+		m_accumulator -= m_fixedTimeStep;
+		++steps;
+	}
+
+	//   ð  -      θ Ǽȯ 
+	if (m_accumulator >= m_fixedTimeStep) {
+		const float kept = std::fmod(m_accumulator, m_fixedTimeStep);
+		m_droppedTime += m_accumulator - kept;
+		m_accumulator = kept;
+	}
+
+	// ̹ ӿ     ·  (      ٲ )
+	ExecuteQueries();
+	return steps;
+}
+
+void PhysicsEngine::ExtractTransforms()
+{
+	const auto start = std::chrono::steady_clock::now();
+	m_transformBuffer.BeginStep();
+
+	PxU32 activeCount = 0;
+	PxActor** activeActors = m_scene->getActiveActors(activeCount);
+	for (PxU32 i = 0; i < activeCount; ++i) {
+		const auto* object = static_cast<const PhysicsObject*>(activeActors[i]->userData);
+		if (object) {
+			m_transformBuffer.Write(object->GetTransformSlot(), object->GetActor()->getGlobalPose());
+		}
 	}
+
+	m_activeCount = activeCount;
+	m_extractMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
 }
 
 void PhysicsEngine::Cleanup()
 {
+	//      ϱ   ٸ
+	if (m_scene && m_simulating) {
+		m_scene->fetchResults(true);
+		m_simulating = false;
+	}
 	PX_RELEASE(m_scene);
-	PX_RELEASE(m_dispatcher);
+	m_dispatcher.reset();
 	PX_RELEASE(m_physics);
 	if (m_pvd) {
 		PxPvdTransport* transport = m_pvd->getTransport();
@@ -87,6 +178,7 @@ std::shared_ptr<PhysicsObject> PhysicsEngine::CreateBox(
 	case PhysicsObjectType::DYNAMIC: {
 		PxRigidDynamic* dynamicActor = m_physics->createRigidDynamic(PxTransform(position));
 		dynamicActor->setName("DynamicBox");
+		dynamicActor->setActorFlag(PxActorFlag::eSEND_SLEEP_NOTIFIES, true);
 		shape = PxRigidActorExt::createExclusiveShape(*dynamicActor,
 			PxBoxGeometry(dimensions), *m_defaultMaterial);
 		PxRigidBodyExt::updateMassAndInertia(*dynamicActor, density);
@@ -100,13 +192,12 @@ std::shared_ptr<PhysicsObject> PhysicsEngine::CreateBox(
 	}
 
 	if (actor && shape) {
-		// 浹   
+		// 浹    (  word0 ׷ Ÿ)
 		shape->setSimulationFilterData(CreateFilterData(group, mask));
+		shape->setQueryFilterData(CreateFilterData(group, mask));
 
 		m_scene->addActor(*actor);
-		auto physicsObject = std::make_shared<PhysicsObject>(actor);
-		m_physicsObjects.push_back(physicsObject);
-		return physicsObject;
+		return AddObject(actor);
 	}
 
 	return nullptr;
@@ -116,15 +207,29 @@ std::shared_ptr<PhysicsObject> PhysicsEngine::CreateGroundPlane()
 {
 	PxRigidStatic* groundPlane = PxCreatePlane(*m_physics, PxPlane(0, 1, 0, 0), *m_defaultMaterial);
 	if (groundPlane) {
-		// 浹   
+		//    ɸ   
+		PxShape* shape = nullptr;
+		groundPlane->getShapes(&shape, 1);
+		if (shape) {
+			shape->setQueryFilterData(CreateFilterData(CollisionGroup::Ground));
+		}
 		m_scene->addActor(*groundPlane);
-		auto physicsObject = std::make_shared<PhysicsObject>(groundPlane);
-		m_physicsObjects.push_back(physicsObject);
-		return physicsObject;
+		return AddObject(groundPlane);
 	}
 	return nullptr;
 }
 
+std::shared_ptr<PhysicsObject> PhysicsEngine::AddObject(PxRigidActor* actor)
+{
+	// ùķ̼ ߿ ߰ŵ  FetchResults  ġ 
+	const uint32_t slot = m_transformBuffer.Add(actor->getGlobalPose());
+
+	auto physicsObject = std::make_shared<PhysicsObject>(actor, this, slot);
+	actor->userData = physicsObject.get();
+	m_physicsObjects.push_back(physicsObject);
+	return physicsObject;
+}
+
 PxFilterData PhysicsEngine::CreateFilterData(CollisionGroup group, CollisionGroup mask)
 {
 	PxFilterData filterData;
@@ -146,23 +251,33 @@ bool PhysicsEngine::CreatePhysics()
 	return m_physics != nullptr;
 }
 
-bool PhysicsEngine::CreateScene()
+void PhysicsEngine::SetDispatcher(std::unique_ptr<TbbCpuDispatcher> dispatcher)
+{
+	m_dispatcher = std::move(dispatcher);
+}
+
+bool PhysicsEngine::CreateScene(uint32_t workerCount, TaskSystem::Priority priority)
 {
 	PxSceneDesc sceneDesc(m_physics->getTolerancesScale());
 	sceneDesc.gravity = PxVec3(0.0f, -9.81f, 0.0f);
 
-	// CPU ó  (Ƽ)
-	m_dispatcher = PxDefaultCpuDispatcherCreate(2);  // 2 Ŀ 
-	if (!m_dispatcher) return false;
-	sceneDesc.cpuDispatcher = m_dispatcher;
+	// CPU ó  -      TBB  
+	if (!m_dispatcher) {
+		m_dispatcher = std::make_unique<TbbCpuDispatcher>(priority, workerCount);
+	}
+	sceneDesc.cpuDispatcher = m_dispatcher.get();
 
-	// 浹 ݹ   
-	m_contactCallback = std::make_unique<ContactReportCallback>();
+	// 浹 ݹ    ( ۴ ⼭   )
+	m_contacts.Reserve(ContactBuffer::Capacity());
+	m_contactCallback = std::make_unique<ContactReportCallback>(m_contacts);
 	sceneDesc.simulationEventCallback = m_contactCallback.get();
 
 	// Ŀ  ̴ 
 	sceneDesc.filterShader = CustomFilterShader;
 
+	// ܸ    - ȯ   ü  ̰͸ ȸ
+	sceneDesc.flags |= PxSceneFlag::eENABLE_ACTIVE_ACTORS;
+
 	m_scene = m_physics->createScene(sceneDesc);
 	return m_scene != nullptr;
 }
@@ -189,6 +304,7 @@ PxFilterFlags PhysicsEngine::CustomFilterShader(
 	}
 
 	// 浹 ũ Ȯ
+	//  (eNOTIFY_TOUCH_PERSISTS) û  - ̿  ָ    (ContactBuffer )
 	if ((filterData0.word0 & filterData1.word1) && (filterData1.word0 & filterData0.word1)) {
 		pairFlags = PxPairFlag::eCONTACT_DEFAULT  // ⺻ 浹 Ӽ
 			| PxPairFlag::eNOTIFY_TOUCH_FOUND     // 浹  ˸
@@ -1,17 +1,86 @@
 #pragma once
 #include "PhysicsTypes.h"
+#include "TaskSystem.h"
+#include "TransformBuffer.h"
+#include "SceneQueryService.h"
+#include "ContactBuffer.h"
 class PhysicsObject;
 class ContactReportCallback;
+class TbbCpuDispatcher;
 class PhysicsEngine
 {
 public:
 	PhysicsEngine();
 	~PhysicsEngine();
 
-	bool Initialize();
-	void Update(float deltaTime);
+	// PhysX ۾ TaskSystem priority   (workerCount 0̸ ھ  )
+	bool Initialize(uint32_t workerCount = 0, TaskSystem::Priority priority = TaskSystem::Priority::High);
+
+	// Initialize  ȣϸ  ó  ̰  (۾    ó )
+	// ̶ Initialize workerCount/priority õ
+	void SetDispatcher(std::unique_ptr<TbbCpuDispatcher> dispatcher);
+	void Update(float deltaTime);   //   ϰ   ٸ
 	void Cleanup();
 
+	//   -  N  ùķ̼ ϰ  N+1 ۿ  
+	//   / ڵ ùķ̼      ȯ(б ) 
+	//  Լ ȯ б   忡 ȣ
+	void BeginSimulate(float deltaTime);
+
+	//      ȯ ۸ ü (浹 ݹ鵵 ⼭ ȣ)
+	// block false   ʾ  ٸ ʰ false ȯ.     true
+	bool FetchResults(bool block = true);
+
+	bool IsSimulating() const { return m_simulating; }
+
+	//  FetchResults ùķ̼ ⸦ ٸ ð   ȯ  ð
+	double GetFetchWaitMs() const { return m_fetchWaitMs; }
+	double GetExtractMs() const { return m_extractMs; }
+
+	//  ܿ   
+	uint32_t GetActiveCount() const { return m_activeCount; }
+
+	//   -  ð  step θ  ( ӿ maxSubsteps Ѵ ŭ )
+	void SetFixedTimeStep(float step, uint32_t maxSubsteps = 4);
+	float GetFixedTimeStep() const { return m_fixedTimeStep; }
+	uint32_t GetMaxSubsteps() const { return m_maxSubsteps; }
+
+	//  ðŭ   ϰ    ȯ
+	// ׻   ̸  ΰ,  ð           
+	// ̴ ´  ð     ؼ ϸ   Ʈ ε巯
+	uint32_t Advance(float frameTime);
+
+	//    ̿  ð ġ [0, 1)
+	float GetInterpolationAlpha() const { return m_accumulator / m_fixedTimeStep; }
+
+	//  ð  ( ʹ  maxSubsteps  ŭ)
+	double GetDroppedTime() const { return m_droppedTime; }
+
+	//   ȯ     ȯ (slot PhysicsObject::GetTransformSlot)
+	PxTransform GetTransform(uint32_t slot) const { return m_transformBuffer.GetCurrent(slot); }
+	PxTransform GetPreviousTransform(uint32_t slot) const { return m_transformBuffer.GetPrevious(slot); }
+
+	//   ¸ GetInterpolationAlpha  ȯ
+	PxTransform GetInterpolatedTransform(uint32_t slot) const {
+		return m_transformBuffer.GetInterpolated(slot, GetInterpolationAlpha());
+	}
+
+	//  - Advance  Ӹ   ȣ  ü ĸ ؼ ٽ 
+	void UpdateRenderMatrices() { m_transformBuffer.UpdateMatrices(GetInterpolationAlpha()); }
+	const XMFLOAT4X4A& GetRenderMatrix(uint32_t slot) const { return m_transformBuffer.GetMatrix(slot); }
+
+	const TransformBuffer& GetTransformBuffer() const { return m_transformBuffer; }
+
+	// ϰ   -  ߿ װ Advance/Update    Ŀ  
+	SceneQueryService& GetQueries() { return m_queries; }
+	void ExecuteQueries(bool parallel = true) { m_queries.Execute(m_scene, parallel); }
+
+	// /Ʈ/  - Advance/Update      ܵ ä
+	// BeginSimulate/FetchResults  θ ClearContacts  ҷ 
+	const ContactBuffer& GetContacts() const { return m_contacts; }
+	ContactBuffer& GetContactBuffer() { return m_contacts; }
+	void ClearContacts() { m_contacts.Clear(); }
+
 	//  ü  Լ
 	std::shared_ptr<PhysicsObject> CreateBox(
 		const PxVec3& position,
@@ -34,13 +103,14 @@ public:
 	// PhysX ֿ Ʈ 
 	PxPhysics* GetPhysics() const { return m_physics; }
 	PxScene* GetScene() const { return m_scene; }
+	TbbCpuDispatcher* GetDispatcher() const { return m_dispatcher.get(); }
 
 private:
 	PxDefaultAllocator m_allocator;
 	PxDefaultErrorCallback m_errorCallback;
 	PxFoundation* m_foundation;
 	PxPhysics* m_physics;
-	PxDefaultCpuDispatcher* m_dispatcher;
+	std::unique_ptr<TbbCpuDispatcher> m_dispatcher;
 	PxScene* m_scene;
 	PxMaterial* m_defaultMaterial;
 	PxPvd* m_pvd; // PhysX Visual Debugger
@@ -48,13 +118,36 @@ private:
 	// ü ̳
 	std::vector<std::shared_ptr<PhysicsObject>> m_physicsObjects;
 
-	// 浹 ݹ
+	// 浹 ݹ  
+	ContactBuffer m_contacts;
 	std::unique_ptr<ContactReportCallback> m_contactCallback;
 
+	// ȯ  - FetchResults ٲǷ ùķ̼ ߿     
+	TransformBuffer m_transformBuffer;
+
+	SceneQueryService m_queries;
+
+	//   
+	float m_fixedTimeStep = 1.0f / 60.0f;
+	uint32_t m_maxSubsteps = 4;
+	float m_accumulator = 0.0f;
+	double m_droppedTime = 0.0;
+
+	bool m_simulating = false;
+	double m_fetchWaitMs = 0.0;
+	double m_extractMs = 0.0;
+	uint32_t m_activeCount = 0;
+
+	//  ü ȯ  ְ userData 
+	std::shared_ptr<PhysicsObject> AddObject(PxRigidActor* actor);
+
+	// ̹ ܿ   ȯ ȯ ҿ  ( ʹ ǵ帮 )
+	void ExtractTransforms();
+
 	// ʱȭ  Լ
 	bool CreateFoundation();
 	bool CreatePhysics();
-	bool CreateScene();
+	bool CreateScene(uint32_t workerCount, TaskSystem::Priority priority);
 	void SetupDebugger();
 
 public:
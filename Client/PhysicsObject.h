@@ -1,14 +1,20 @@
 #pragma once
+class PhysicsEngine;
+
 //  ü  ϴ Ŭ
 class PhysicsObject {
 public:
-    PhysicsObject(PxRigidActor* actor);
+    PhysicsObject(PxRigidActor* actor, const PhysicsEngine* engine, uint32_t transformSlot);
 
     //  ü ȯ  DirectX ķ ȯ
+    // ùķ̼     UpdateRenderMatrices    
     XMMATRIX GetTransformMatrix() const;
 
     PxRigidActor* GetActor() const { return m_actor; }
+    uint32_t GetTransformSlot() const { return m_transformSlot; }
 
 private:
     PxRigidActor* m_actor;
+    const PhysicsEngine* m_engine;
+    uint32_t m_transformSlot;
 };
\ No newline at end of file
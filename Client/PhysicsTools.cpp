@@ -0,0 +1,761 @@
+#include "pch.h"
+#include "PhysicsTools.h"
+#include "PhysicsEngine.h"
+#include "PhysicsObject.h"
+#include "TbbCpuDispatcher.h"
+#include "ContactReportCallback.h"
+#include "Logger.h"
+
+namespace
+{
+	using Clock = std::chrono::steady_clock;
+
+	// 10x10 ڷ   (  ĭ ߳ ؼ  )
+	void CreateStack(PhysicsEngine& engine, size_t bodyCount)
+	{
+		engine.CreateBox(PxVec3(0.0f, -0.5f, 0.0f), PxVec3(100.0f, 0.5f, 100.0f),
+			PhysicsObjectType::STATIC, CollisionGroup::Ground, CollisionGroup::Default);
+
+		for (size_t i = 0; i < bodyCount; ++i) {
+			const size_t layer = i / 100;
+			const float offset = (layer & 1) ? 0.5f : 0.0f;
+			const PxVec3 position(
+				static_cast<float>(i % 10) * 1.1f - 5.0f + offset,
+				0.5f + static_cast<float>(layer) * 1.05f,
+				static_cast<float>((i / 10) % 10) * 1.1f - 5.0f + offset);
+			engine.CreateBox(position, PxVec3(0.5f), PhysicsObjectType::DYNAMIC,
+				CollisionGroup::Default, CollisionGroup::Default | CollisionGroup::Ground);
+		}
+	}
+
+	// Ŀ ġũ ó -   ϸ鼭  ۾  ÿ  ۾  
+	// (   ó  ʵ ġũ ġ)
+	class CountingCpuDispatcher : public TbbCpuDispatcher {
+	public:
+		using TbbCpuDispatcher::TbbCpuDispatcher;
+
+		void submitTask(PxBaseTask& task) override {
+			m_submitted.fetch_add(1, std::memory_order_relaxed);
+
+			PxBaseTask* pending = &task;
+			GetArena().enqueue([this, pending] {
+				const uint32_t running = m_running.fetch_add(1, std::memory_order_relaxed) + 1;
+				uint32_t peak = m_peakRunning.load(std::memory_order_relaxed);
+				while (running > peak && !m_peakRunning.compare_exchange_weak(peak, running, std::memory_order_relaxed)) {
+				}
+
+				pending->run();
+				m_running.fetch_sub(1, std::memory_order_relaxed);
+				pending->release();
+			});
+		}
+
+		uint64_t GetSubmittedCount() const { return m_submitted.load(std::memory_order_relaxed); }
+		uint32_t GetPeakRunning() const { return m_peakRunning.load(std::memory_order_relaxed); }
+		uint32_t GetRunning() const { return m_running.load(std::memory_order_relaxed); }
+
+	private:
+		std::atomic<uint64_t> m_submitted = 0;
+		std::atomic<uint32_t> m_running = 0;
+		std::atomic<uint32_t> m_peakRunning = 0;
+	};
+
+	//     - ָ  ϳ  ̺Ʈ ť  (α״  )
+	class LegacyContactCallback : public PxSimulationEventCallback {
+	public:
+		struct Event {
+			const PxActor* actor0;
+			const PxActor* actor1;
+			PxVec3 position;
+			PxVec3 normal;
+			float impulse;
+		};
+
+		void onContact(const PxContactPairHeader& header, const PxContactPair* pairs, PxU32 count) override {
+			for (PxU32 i = 0; i < count; ++i) {
+				if (pairs[i].events & PxPairFlag::eNOTIFY_TOUCH_FOUND) {
+					PxContactPairPoint contacts[1];
+					if (pairs[i].extractContacts(contacts, 1) > 0) {
+						m_events.push({ header.actors[0], header.actors[1], contacts[0].position,
+							contacts[0].normal, contacts[0].impulse.magnitude() });
+					}
+				}
+			}
+		}
+		void onConstraintBreak(PxConstraintInfo*, PxU32) override {}
+		void onWake(PxActor**, PxU32) override {}
+		void onSleep(PxActor**, PxU32) override {}
+		void onTrigger(PxTriggerPair*, PxU32) override {}
+		void onAdvance(const PxRigidBody* const*, const PxTransform*, const PxU32) override {}
+
+		//  尡  ӿ   ó 
+		void Drain() {
+			Event event;
+			while (m_events.try_pop(event)) {
+			}
+		}
+
+	private:
+		tbb::concurrent_queue<Event> m_events;
+	};
+
+	// ݹ ð  ΰ
+	class TimedCallback : public PxSimulationEventCallback {
+	public:
+		explicit TimedCallback(PxSimulationEventCallback& inner) : m_inner(inner) {}
+
+		void onContact(const PxContactPairHeader& header, const PxContactPair* pairs, PxU32 count) override {
+			const auto start = Clock::now();
+			m_inner.onContact(header, pairs, count);
+			m_us += std::chrono::duration<double, std::micro>(Clock::now() - start).count();
+		}
+		void onConstraintBreak(PxConstraintInfo* constraints, PxU32 count) override { m_inner.onConstraintBreak(constraints, count); }
+		void onWake(PxActor** actors, PxU32 count) override {
+			const auto start = Clock::now();
+			m_inner.onWake(actors, count);
+			m_us += std::chrono::duration<double, std::micro>(Clock::now() - start).count();
+		}
+		void onSleep(PxActor** actors, PxU32 count) override {
+			const auto start = Clock::now();
+			m_inner.onSleep(actors, count);
+			m_us += std::chrono::duration<double, std::micro>(Clock::now() - start).count();
+		}
+		void onTrigger(PxTriggerPair* pairs, PxU32 count) override { m_inner.onTrigger(pairs, count); }
+		void onAdvance(const PxRigidBody* const* bodies, const PxTransform* poses, const PxU32 count) override {
+			m_inner.onAdvance(bodies, poses, count);
+		}
+
+		double GetMicroseconds() const { return m_us; }
+
+	private:
+		PxSimulationEventCallback& m_inner;
+		double m_us = 0.0;
+	};
+
+	//  ü ȯ о   ȯ
+	float ReadTransforms(const PhysicsEngine& engine)
+	{
+		float sum = 0.0f;
+		for (const auto& object : engine.GetPhysicsObjects()) {
+			sum += engine.GetTransform(object->GetTransformSlot()).p.y;
+		}
+		return sum;
+	}
+
+	//  䳻 -  ð  ȯ  .    ȯ
+	float Render(const PhysicsEngine& engine, double renderMs)
+	{
+		const auto deadline = Clock::now() + std::chrono::duration<double, std::milli>(renderMs);
+		float sum = 0.0f;
+		do {
+			sum = ReadTransforms(engine);
+		} while (Clock::now() < deadline);
+		return sum;
+	}
+}
+
+PhysicsTools::StepBenchmarkResult PhysicsTools::RunStepBenchmark(size_t bodyCount, int frames, double renderMs)
+{
+	StepBenchmarkResult result;
+	result.bodyCount = bodyCount;
+	result.frames = std::max(frames, 1);
+	frames = result.frames;
+
+	constexpr float DeltaTime = 1.0f / 60.0f;
+	std::vector<PxVec3> finalPositions[2];
+
+	for (int mode = 0; mode < 2; ++mode) {
+		const bool split = mode == 1;
+
+		PhysicsEngine engine;
+		if (!engine.Initialize()) {
+			Logger::Instance().Error("  ʱȭ ");
+			++result.violations;
+			return result;
+		}
+		CreateStack(engine, bodyCount);
+
+		double physicsMs = 0.0;
+		double waitMs = 0.0;
+		const auto start = Clock::now();
+		for (int frame = 0; frame < frames; ++frame) {
+			if (split) {
+				engine.FetchResults();
+				waitMs += engine.GetFetchWaitMs();
+				engine.BeginSimulate(DeltaTime);
+
+				// ùķ̼ ߿ б ۴ ٲ ʾƾ 
+				const float before = ReadTransforms(engine);
+				if (Render(engine, renderMs) != before) {
+					++result.violations;
+				}
+			}
+			else {
+				const auto stepStart = Clock::now();
+				engine.Update(DeltaTime);
+				physicsMs += std::chrono::duration<double, std::milli>(Clock::now() - stepStart).count();
+				Render(engine, renderMs);
+			}
+		}
+		engine.FetchResults();
+		const double totalMs = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+
+		if (engine.GetPhysicsObjects().size() != bodyCount + 1) {
+			++result.violations;
+		}
+		for (const auto& object : engine.GetPhysicsObjects()) {
+			finalPositions[mode].push_back(engine.GetTransform(object->GetTransformSlot()).p);
+		}
+
+		if (split) {
+			result.splitFrameMs = totalMs / frames;
+			result.splitWaitMs = waitMs / frames;
+		}
+		else {
+			result.syncFrameMs = totalMs / frames;
+			result.syncPhysicsMs = physicsMs / frames;
+		}
+	}
+
+	//     Ƿ   ƾ  ( ٿ  ̼ ̴   )
+	for (size_t i = 0; i < std::min(finalPositions[0].size(), finalPositions[1].size()); ++i) {
+		result.maxDifference = std::max(result.maxDifference,
+			static_cast<double>((finalPositions[0][i] - finalPositions[1][i]).magnitude()));
+	}
+
+	Logger::Instance().Info("===   ġũ:  {}, {},  {:.1f}ms ===", bodyCount, frames, renderMs);
+	Logger::Instance().Info(" : {:.2f}ms/ ( {:.2f}ms)", result.syncFrameMs, result.syncPhysicsMs);
+	Logger::Instance().Info(" : {:.2f}ms/ (  {:.2f}ms)", result.splitFrameMs, result.splitWaitMs);
+	Logger::Instance().Info(" ġ ִ : {:.6f}", result.maxDifference);
+	Logger::Instance().Info(" : {}", result.violations);
+
+	return result;
+}
+
+PhysicsTools::FixedStepBenchmarkResult PhysicsTools::RunFixedStepBenchmark(size_t bodyCount, int frames,
+	double minFrameMs, double maxFrameMs)
+{
+	FixedStepBenchmarkResult result;
+	result.frames = std::max(frames, 3);
+	frames = result.frames;
+
+	//  Ŀ   ð  (100Ӹ   150ms )
+	std::mt19937 rng(7);
+	std::uniform_real_distribution<double> frameDistribution(minFrameMs, std::max(minFrameMs, maxFrameMs));
+	std::vector<float> frameTimes(frames);
+	double totalTime = 0.0;
+	for (int frame = 0; frame < frames; ++frame) {
+		const double ms = (frame % 100 == 99) ? 150.0 : frameDistribution(rng);
+		frameTimes[frame] = static_cast<float>(ms / 1000.0);
+		totalTime += frameTimes[frame];
+	}
+
+	constexpr float Gravity = 9.81f;
+	constexpr float FixedStep = 1.0f / 60.0f;
+	constexpr uint32_t MaxSubsteps = 4;
+
+	for (int mode = 0; mode < 2; ++mode) {
+		const bool fixed = mode == 1;
+
+		PhysicsEngine engine;
+		if (!engine.Initialize()) {
+			Logger::Instance().Error("  ʱȭ ");
+			++result.violations;
+			return result;
+		}
+		engine.SetFixedTimeStep(FixedStep, MaxSubsteps);
+		CreateStack(engine, bodyCount);
+
+		// ̿ ε ʴ    ü
+		auto probe = engine.CreateBox(PxVec3(1000.0f, 10000.0f, 0.0f), PxVec3(0.5f),
+			PhysicsObjectType::DYNAMIC, CollisionGroup::Default, CollisionGroup::Default);
+		const uint32_t slot = probe->GetTransformSlot();
+
+		auto displayedHeight = [&]() {
+			return fixed ? engine.GetInterpolatedTransform(slot).p.y : engine.GetTransform(slot).p.y;
+		};
+
+		double squaredError = 0.0;
+		size_t samples = 0;
+		double previousHeight = displayedHeight();
+		double previousVelocity = 0.0;
+		size_t steps = 0;
+
+		for (int frame = 0; frame < frames; ++frame) {
+			const float frameTime = frameTimes[frame];
+			if (fixed) {
+				const uint32_t substeps = engine.Advance(frameTime);
+				steps += substeps;
+				result.maxSubsteps = std::max<size_t>(result.maxSubsteps, substeps);
+				const float alpha = engine.GetInterpolationAlpha();
+				if (substeps > MaxSubsteps || alpha < 0.0f || alpha >= 1.0f) {
+					++result.violations;
+				}
+			}
+			else {
+				engine.Update(frameTime);
+				++steps;
+			}
+
+			// ȭ ӵ ȭ ߷° 󸶳 ٸ (ó  Ӱ  Ĵ )
+			const double height = displayedHeight();
+			const double velocity = (height - previousHeight) / frameTime;
+			if (frame >= 2 && frame % 100 != 99 && frame % 100 != 0) {
+				const double acceleration = (velocity - previousVelocity) / (0.5 * (frameTime + frameTimes[frame - 1]));
+				squaredError += (acceleration + Gravity) * (acceleration + Gravity);
+				++samples;
+			}
+			previousHeight = height;
+			previousVelocity = velocity;
+		}
+		engine.FetchResults();
+
+		const double jitter = samples ? std::sqrt(squaredError / samples) : 0.0;
+		if (fixed) {
+			result.fixedSteps = steps;
+			result.fixedJitter = jitter;
+			result.droppedMs = engine.GetDroppedTime() * 1000.0;
+
+			//  ð +   +  ð = ü  ð
+			const double accounted = steps * static_cast<double>(FixedStep) +
+				engine.GetInterpolationAlpha() * FixedStep + engine.GetDroppedTime();
+			if (std::abs(accounted - totalTime) > 1e-2) {
+				++result.violations;
+			}
+		}
+		else {
+			result.variableSteps = steps;
+			result.variableJitter = jitter;
+		}
+	}
+
+	Logger::Instance().Info("===   ġũ:  {}, {} ({:.0f}~{:.0f}ms, 100Ӹ 150ms) ===",
+		bodyCount, frames, minFrameMs, maxFrameMs);
+	Logger::Instance().Info(" : {}, ȭ ӵ  {:.3f}m/s^2", result.variableSteps, result.variableJitter);
+	Logger::Instance().Info("  + : {} (Ӵ ִ {}),  ð {:.1f}ms, ȭ ӵ  {:.3f}m/s^2",
+		result.fixedSteps, result.maxSubsteps, result.droppedMs, result.fixedJitter);
+	Logger::Instance().Info(" : {}", result.violations);
+
+	return result;
+}
+
+PhysicsTools::WorkerBenchmarkResult PhysicsTools::RunWorkerBenchmark(size_t bodyCount, int frames)
+{
+	WorkerBenchmarkResult result;
+	result.concurrency = TaskSystem::Instance().GetConcurrency();
+	if (result.concurrency == 0) {
+		TaskSystem::Instance().Initialize();
+		result.concurrency = TaskSystem::Instance().GetConcurrency();
+	}
+	frames = std::max(frames, 1);
+
+	const uint32_t maxWorkers = TaskSystem::Instance().GetWorkerCount();
+	for (uint32_t workers = 1; ; workers = std::min(workers * 2, maxWorkers)) {
+		result.workerCounts.push_back(workers);
+		if (workers == maxWorkers) break;
+	}
+
+	constexpr float DeltaTime = 1.0f / 60.0f;
+
+	// Ŀ     ̸  (ó   ĳ/Ҵ غ  )
+	auto runSteps = [&](PhysicsEngine& engine) {
+		for (int frame = 0; frame < 10; ++frame) {
+			engine.Update(DeltaTime);
+		}
+		const auto start = Clock::now();
+		for (int frame = 0; frame < frames; ++frame) {
+			engine.Update(DeltaTime);
+		}
+		return std::chrono::duration<double, std::milli>(Clock::now() - start).count() / frames;
+	};
+
+	//  ó ġ  (workers 0̸  Ŀ )
+	auto initialize = [](PhysicsEngine& engine, uint32_t workers) -> const CountingCpuDispatcher* {
+		auto owned = std::make_unique<CountingCpuDispatcher>(TaskSystem::Priority::High, workers);
+		const CountingCpuDispatcher* dispatcher = owned.get();
+		engine.SetDispatcher(std::move(owned));
+		return engine.Initialize() ? dispatcher : nullptr;
+	};
+
+	for (uint32_t workers : result.workerCounts) {
+		PhysicsEngine engine;
+		const CountingCpuDispatcher* dispatcher = initialize(engine, workers);
+		if (!dispatcher) {
+			Logger::Instance().Error("  ʱȭ ");
+			++result.violations;
+			return result;
+		}
+		CreateStack(engine, bodyCount);
+		result.stepMs.push_back(runSteps(engine));
+
+		if (dispatcher->GetSubmittedCount() == 0) {
+			++result.violations;
+		}
+		result.peakRunning = std::max(result.peakRunning, dispatcher->GetPeakRunning());
+	}
+
+	//  -  켱  parallel_for   (  䳻)
+	{
+		PhysicsEngine engine;
+		const CountingCpuDispatcher* dispatcher = initialize(engine, 0);
+		if (!dispatcher) {
+			++result.violations;
+			return result;
+		}
+		CreateStack(engine, bodyCount);
+
+		std::atomic<bool> stop = false;
+		std::atomic<uint32_t> loadRunning = 0;
+		std::atomic<uint32_t> peakRunning = 0;
+		std::atomic<uint64_t> loadChunks = 0;
+
+		std::thread load([&] {
+			while (!stop.load(std::memory_order_relaxed)) {
+				TaskSystem::Instance().Execute([&] {
+					tbb::parallel_for(size_t(0), size_t(256), [&](size_t chunk) {
+						const uint32_t running = loadRunning.fetch_add(1, std::memory_order_relaxed) + 1 +
+							dispatcher->GetRunning();
+						uint32_t peak = peakRunning.load(std::memory_order_relaxed);
+						while (running > peak && !peakRunning.compare_exchange_weak(peak, running, std::memory_order_relaxed)) {
+						}
+
+						volatile float sink = 0.0f;
+						for (int i = 0; i < 20000; ++i) {
+							sink = sink + std::sqrt(static_cast<float>(i + chunk));
+						}
+						loadRunning.fetch_sub(1, std::memory_order_relaxed);
+						loadChunks.fetch_add(1, std::memory_order_relaxed);
+					});
+				}, TaskSystem::Priority::Low);
+			}
+		});
+
+		result.loadedStepMs = runSteps(engine);
+		stop.store(true, std::memory_order_relaxed);
+		load.join();
+
+		result.loadChunks = loadChunks.load();
+		result.peakRunning = std::max({ result.peakRunning, dispatcher->GetPeakRunning(), peakRunning.load() });
+	}
+
+	//   fetchResults ٸǷ Ŀ +   ϳ 
+	if (result.peakRunning > result.concurrency) {
+		++result.violations;
+	}
+
+	Logger::Instance().Info("===  Ŀ ġũ:  {}, {},   {} ===",
+		bodyCount, frames, result.concurrency);
+	for (size_t i = 0; i < result.workerCounts.size(); ++i) {
+		Logger::Instance().Info("Ŀ {}:  {:.2f}ms (Ŀ 1  {:.2f})", result.workerCounts[i],
+			result.stepMs[i], result.stepMs[i] > 0.0 ? result.stepMs[0] / result.stepMs[i] : 0.0);
+	}
+	Logger::Instance().Info(" 켱 Ͽ Բ:  {:.2f}ms,  ۾ {}",
+		result.loadedStepMs, result.loadChunks);
+	Logger::Instance().Info("  ִ {} / {},  : {}",
+		result.peakRunning, result.concurrency, result.violations);
+
+	return result;
+}
+
+PhysicsTools::ExtractBenchmarkResult PhysicsTools::RunExtractBenchmark(size_t bodyCount, int frames)
+{
+	ExtractBenchmarkResult result;
+	result.bodyCount = bodyCount;
+	result.frames = std::max(frames, 4);
+	frames = result.frames;
+
+	PhysicsEngine engine;
+	if (!engine.Initialize()) {
+		Logger::Instance().Error("  ʱȭ ");
+		++result.violations;
+		return result;
+	}
+	CreateStack(engine, bodyCount);
+
+	constexpr float DeltaTime = 1.0f / 60.0f;
+	constexpr float CheckAlpha = 0.37f;
+	const int restStart = frames - frames / 4;
+
+	//    ȭ  ʵ  
+	XMMATRIX sink = XMMatrixIdentity();
+	uint64_t activeSum = 0;
+	uint64_t restActiveSum = 0;
+
+	for (int frame = 0; frame < frames; ++frame) {
+		//  ̶  ĵ ͸    
+		engine.Update(DeltaTime);
+		const bool rest = frame >= restStart;
+
+		auto start = Clock::now();
+		for (const auto& object : engine.GetPhysicsObjects()) {
+			const PxMat44 pxMatrix(object->GetActor()->getGlobalPose());
+			sink = XMMATRIX(
+				pxMatrix.column0.x, pxMatrix.column0.y, pxMatrix.column0.z, pxMatrix.column0.w,
+				pxMatrix.column1.x, pxMatrix.column1.y, pxMatrix.column1.z, pxMatrix.column1.w,
+				pxMatrix.column2.x, pxMatrix.column2.y, pxMatrix.column2.z, pxMatrix.column2.w,
+				pxMatrix.column3.x, pxMatrix.column3.y, pxMatrix.column3.z, pxMatrix.column3.w);
+		}
+		const double perObjectMs = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+
+		start = Clock::now();
+		engine.UpdateRenderMatrices();
+		const double batchMs = engine.GetExtractMs() +
+			std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+
+		result.perObjectMs += perObjectMs;
+		result.batchMs += batchMs;
+		activeSum += engine.GetActiveCount();
+		if (rest) {
+			result.restPerObjectMs += perObjectMs;
+			result.restBatchMs += batchMs;
+			restActiveSum += engine.GetActiveCount();
+		}
+
+		//    ٲ   Į  + PxMat44  ( )
+		if (frame % 50 == 0 || frame == frames - 1) {
+			TransformBuffer check = engine.GetTransformBuffer();
+			check.UpdateMatrices(CheckAlpha);
+			for (uint32_t slot = 0; slot < check.GetCount(); ++slot) {
+				const PxMat44 expected(check.GetInterpolated(slot, CheckAlpha));
+				const XMFLOAT4X4A& actual = check.GetMatrix(slot);
+				for (int row = 0; row < 4; ++row) {
+					for (int column = 0; column < 4; ++column) {
+						result.maxDifference = std::max(result.maxDifference,
+							static_cast<double>(std::abs(actual.m[row][column] - expected[row][column])));
+					}
+				}
+			}
+		}
+	}
+	(void)sink;
+
+	const int restFrames = frames - restStart;
+	result.perObjectMs /= frames;
+	result.batchMs /= frames;
+	result.restPerObjectMs /= restFrames;
+	result.restBatchMs /= restFrames;
+	result.averageActive = static_cast<double>(activeSum) / frames;
+	result.restActive = static_cast<double>(restActiveSum) / restFrames;
+
+	if (result.maxDifference > 1e-4) {
+		++result.violations;
+	}
+
+	Logger::Instance().Info("=== ȯ  ġũ:  {}, {} ===", bodyCount, frames);
+	Logger::Instance().Info("ü: ü {:.3f}ms, ϰ {:.3f}ms (   {:.0f})",
+		result.perObjectMs, result.batchMs, result.averageActive);
+	Logger::Instance().Info(" 1/4: ü {:.3f}ms, ϰ {:.3f}ms (   {:.0f})",
+		result.restPerObjectMs, result.restBatchMs, result.restActive);
+	Logger::Instance().Info(" ִ : {:.7f},  : {}", result.maxDifference, result.violations);
+
+	return result;
+}
+
+PhysicsTools::QueryBenchmarkResult PhysicsTools::RunQueryBenchmark(size_t queryCount, int frames, size_t bodyCount)
+{
+	QueryBenchmarkResult result;
+	result.queryCount = queryCount;
+	result.frames = std::max(frames, 1);
+	frames = result.frames;
+
+	PhysicsEngine engine;
+	if (!engine.Initialize()) {
+		Logger::Instance().Error("  ʱȭ ");
+		++result.violations;
+		return result;
+	}
+	CreateStack(engine, bodyCount);
+
+	// ̰    ں 
+	constexpr float DeltaTime = 1.0f / 60.0f;
+	for (int frame = 0; frame < 60; ++frame) {
+		engine.Update(DeltaTime);
+	}
+
+	SceneQueryService& queries = engine.GetQueries();
+	const CollisionGroup mask = CollisionGroup::Default | CollisionGroup::Ground;
+	const PxSphereGeometry sphere(0.5f);
+	const PxSphereGeometry area(1.5f);
+
+	//  õ   
+	auto enqueue = [&](uint32_t seed, std::vector<SceneQueryService::Ticket>& tickets) {
+		std::mt19937 rng(seed);
+		std::uniform_real_distribution<float> horizontal(-15.0f, 15.0f);
+		std::uniform_real_distribution<float> height(0.5f, 12.0f);
+		tickets.clear();
+		for (size_t i = 0; i < queryCount; ++i) {
+			const PxVec3 from(horizontal(rng), height(rng), horizontal(rng));
+			const PxVec3 to(horizontal(rng), height(rng), horizontal(rng));
+			const PxVec3 delta = to - from;
+			const float distance = std::max(delta.magnitude(), 0.01f);
+			switch (i % 5) {
+			case 0: case 1: case 2:
+				tickets.push_back(queries.Raycast(from, delta, distance, mask, (i % 5) == 2));
+				break;
+			case 3:
+				tickets.push_back(queries.Sweep(sphere, PxTransform(from), delta, distance, mask));
+				break;
+			default:
+				tickets.push_back(queries.Overlap(area, PxTransform(from), mask, 16));
+				break;
+			}
+		}
+	};
+
+	struct Summary {
+		uint32_t hitCount;
+		const PxRigidActor* actor;
+		float distance;
+	};
+	std::vector<SceneQueryService::Ticket> tickets;
+	std::vector<Summary> serial(queryCount);
+	size_t hitQueries = 0;
+
+	for (int frame = 0; frame < frames; ++frame) {
+		const uint32_t seed = 1000u + static_cast<uint32_t>(frame);
+
+		enqueue(seed, tickets);
+		engine.ExecuteQueries(false);
+		result.serialMs += queries.GetExecuteMs();
+		for (size_t i = 0; i < queryCount; ++i) {
+			const auto hits = queries.GetResult(tickets[i]).hits;
+			serial[i] = { static_cast<uint32_t>(hits.size()), hits.empty() ? nullptr : hits[0].actor,
+				hits.empty() ? 0.0f : hits[0].distance };
+		}
+		const auto previousTickets = tickets;
+
+		enqueue(seed, tickets);
+		engine.ExecuteQueries(true);
+		result.parallelMs += queries.GetExecuteMs();
+
+		//    anyHit ĳƮ  Ž  Ƿ   
+		for (size_t i = 0; i < queryCount; ++i) {
+			const auto query = queries.GetResult(tickets[i]);
+			const auto hits = query.hits;
+			const bool ordered = (i % 5) == 0 || (i % 5) == 1 || (i % 5) == 3;
+			//     
+			if ((i % 5) == 4 && query.GetClosest()) {
+				++result.violations;
+			}
+			if (hits.size() != serial[i].hitCount ||
+				(ordered && !hits.empty() && (hits[0].actor != serial[i].actor || hits[0].distance != serial[i].distance))) {
+				++result.violations;
+			}
+			hitQueries += hits.empty() ? 0 : 1;
+		}
+
+		//  ġ ǥδ     
+		if (queryCount > 0 && queries.GetResult(previousTickets[0]).HasHit()) {
+			++result.violations;
+		}
+
+		engine.Update(DeltaTime);
+	}
+
+	// ̰ 0  PhysX ѱ ʰ   ( Ѱ    )
+	const PxVec3 center(0.0f, 1.0f, 0.0f);
+	const SceneQueryService::Ticket zeroTickets[] = {
+		queries.Raycast(center, PxVec3(0.0f), 10.0f, mask),
+		queries.Raycast(center, PxVec3(0.0f), 10.0f, mask, true),
+		queries.Sweep(sphere, PxTransform(center), PxVec3(0.0f), 10.0f, mask),
+	};
+	engine.ExecuteQueries(true);
+	for (const auto& ticket : zeroTickets) {
+		if (queries.GetResult(ticket).HasHit()) {
+			++result.violations;
+		}
+	}
+
+	result.serialMs /= frames;
+	result.parallelMs /= frames;
+	result.hitRatio = queryCount ? static_cast<double>(hitQueries) / (static_cast<double>(queryCount) * frames) : 0.0;
+
+	Logger::Instance().Info("===   ġũ:  {} x {},  {} ===", queryCount, frames, bodyCount);
+	Logger::Instance().Info("ʷ: {:.2f}ms/,  (Ŀ {}): {:.2f}ms/ ({:.2f})",
+		result.serialMs, TaskSystem::Instance().GetWorkerCount(), result.parallelMs,
+		result.parallelMs > 0.0 ? result.serialMs / result.parallelMs : 0.0);
+	Logger::Instance().Info("  : {:.1f}%,  : {}", result.hitRatio * 100.0, result.violations);
+
+	return result;
+}
+
+PhysicsTools::ContactBenchmarkResult PhysicsTools::RunContactBenchmark(int frames, float impulseThreshold)
+{
+	ContactBenchmarkResult result;
+	result.bodyCounts = { 500, 2000, 8000 };
+	frames = std::max(frames, 1);
+
+	constexpr float DeltaTime = 1.0f / 60.0f;
+
+	for (size_t bodyCount : result.bodyCounts) {
+		double legacyUs = 0.0;
+		double bufferUs = 0.0;
+		uint64_t pairs = 0;
+		uint64_t kept = 0;
+
+		for (int mode = 0; mode < 2; ++mode) {
+			const bool legacy = mode == 0;
+
+			PhysicsEngine engine;
+			if (!engine.Initialize()) {
+				Logger::Instance().Error("  ʱȭ ");
+				++result.violations;
+				return result;
+			}
+			CreateStack(engine, bodyCount);
+
+			ContactBuffer& buffer = engine.GetContactBuffer();
+			buffer.SetImpulseThreshold(impulseThreshold);
+			buffer.SetCapturePoints(true);
+
+			LegacyContactCallback legacyCallback;
+			ContactReportCallback bufferCallback(buffer);
+			TimedCallback timed(legacy ? static_cast<PxSimulationEventCallback&>(legacyCallback) : bufferCallback);
+			engine.GetScene()->setSimulationEventCallback(&timed);
+
+			for (int frame = 0; frame < frames; ++frame) {
+				engine.Update(DeltaTime);
+				if (legacy) {
+					legacyCallback.Drain();
+					continue;
+				}
+
+				pairs += buffer.GetStats().pairs;
+				kept += buffer.GetContacts().size();
+				result.dropped += buffer.GetStats().dropped;
+
+				//     ,  Ʒ   ,   
+				std::set<std::pair<const void*, const void*>> seen;
+				for (const auto& contact : buffer.GetContacts()) {
+					if (!seen.emplace(contact.actor0, contact.actor1).second) {
+						++result.violations;
+					}
+					if (!contact.Has(ContactBuffer::Contact::Lost) && contact.impulse < impulseThreshold) {
+						++result.violations;
+					}
+					const auto points = buffer.GetPoints(contact);
+					if (points.size() != contact.pointCount) {
+						++result.violations;
+					}
+				}
+			}
+
+			engine.GetScene()->setSimulationEventCallback(nullptr);
+			(legacy ? legacyUs : bufferUs) = timed.GetMicroseconds() / frames;
+		}
+
+		result.legacyUs.push_back(legacyUs);
+		result.bufferUs.push_back(bufferUs);
+		result.pairsPerStep.push_back(static_cast<double>(pairs) / frames);
+		result.keptPerStep.push_back(static_cast<double>(kept) / frames);
+	}
+
+	Logger::Instance().Info("===   ġũ: {}, ݷ  {:.2f} ===", frames, impulseThreshold);
+	for (size_t i = 0; i < result.bodyCounts.size(); ++i) {
+		Logger::Instance().Info(" {}:   {:.1f}us,  {:.1f}us (ܴ   {:.0f},   {:.0f})",
+			result.bodyCounts[i], result.legacyUs[i], result.bufferUs[i], result.pairsPerStep[i], result.keptPerStep[i]);
+	}
+	Logger::Instance().Info("뷮 ʰ : {},  : {}", result.dropped, result.violations);
+
+	return result;
+}
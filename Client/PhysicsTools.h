@@ -0,0 +1,93 @@
+#pragma once
+#include "PhysicsTypes.h"
+
+//   / 
+class PhysicsTools {
+public:
+	struct StepBenchmarkResult {
+		size_t bodyCount = 0;
+		int frames = 0;
+		double syncFrameMs = 0.0;       // simulate  ٷ fetchResults(true) +  䳻
+		double splitFrameMs = 0.0;      //  ۿ  ,   +  䳻
+		double syncPhysicsMs = 0.0;     //   Ӹ  带  ð
+		double splitWaitMs = 0.0;       //  ܿ  ٸ ð ( )
+		double maxDifference = 0.0;     //    ġ 
+		size_t violations = 0;          // ùķ̼  б  , ȯ  ġ
+	};
+
+	// ٴ   bodyCount ׾ ߸ frames      ð 
+	//  renderMs  б  ȯ  д  䳻 
+	static StepBenchmarkResult RunStepBenchmark(size_t bodyCount = 2000, int frames = 300, double renderMs = 4.0);
+
+	struct FixedStepBenchmarkResult {
+		int frames = 0;
+		size_t variableSteps = 0;       //  ð ״  ܾ
+		size_t fixedSteps = 0;          //   (Advance)
+		size_t maxSubsteps = 0;         //  ӿ     
+		double droppedMs = 0.0;         //  ӿ  ð
+		double variableJitter = 0.0;    // ȭ鿡 ̴   ӵ  RMS (m/s^2)
+		double fixedJitter = 0.0;
+		size_t violations = 0;          //   , 꽺 ,  ð ġ
+	};
+
+	// 鸮  ð(minFrameMs~maxFrameMs,   )  ̿ ָ   ü 
+	//  ( )   +  ȭ鿡 ̴  ӵ 󸶳  
+	static FixedStepBenchmarkResult RunFixedStepBenchmark(size_t bodyCount = 500, int frames = 600,
+		double minFrameMs = 4.0, double maxFrameMs = 40.0);
+
+	struct WorkerBenchmarkResult {
+		uint32_t concurrency = 0;                   // TaskSystem   
+		std::vector<uint32_t> workerCounts;
+		std::vector<double> stepMs;                 // Ŀ    ð
+		double loadedStepMs = 0.0;                  // ִ Ŀ +  켱 ϰ   
+		uint64_t loadChunks = 0;                    // ׵ ϰ ó ۾ 
+		uint32_t peakRunning = 0;                   //  ۾ +  ۾ ÿ  ִ
+		size_t violations = 0;                      //    ʰ, ۾ 
+	};
+
+	//   ̸ PhysX Ŀ  1, 2, 4, ... frames ܾ  Ȯ强 
+	//   켱    ִ   Բ  ھ   ʴ Ȯ
+	static WorkerBenchmarkResult RunWorkerBenchmark(size_t bodyCount = 4000, int frames = 200);
+
+	struct ExtractBenchmarkResult {
+		size_t bodyCount = 0;
+		int frames = 0;
+		double perObjectMs = 0.0;       //  : ü getGlobalPose -> PxMat44 -> XMMATRIX
+		double batchMs = 0.0;           // active actors  +  Ը SIMD  
+		double restPerObjectMs = 0.0;   //  1/4  (κ  )
+		double restBatchMs = 0.0;
+		double averageActive = 0.0;     // ܴ   
+		double restActive = 0.0;
+		double maxDifference = 0.0;     // SIMD İ PxMat44( ȯ) ִ  
+		size_t violations = 0;          //  ġ
+	};
+
+	//  ̸ ʶ߷   ϸ鼭 Ӹ      ð 
+	static ExtractBenchmarkResult RunExtractBenchmark(size_t bodyCount = 4000, int frames = 600);
+
+	struct QueryBenchmarkResult {
+		size_t queryCount = 0;
+		int frames = 0;
+		double serialMs = 0.0;          //    忡 ʷ ( ڵ尡 PxScene  θ )
+		double parallelMs = 0.0;        // TaskSystem Ŀ  
+		double hitRatio = 0.0;          // 𰡿   
+		size_t violations = 0;          //    ġ, ٸ ġ ǥ  
+	};
+
+	//   ֺ ĳƮ(þ Ȯ 60%),  (20%),  (20%) queryCount ׾
+	// Ӹ   ʷ,   ķ  ð  
+	static QueryBenchmarkResult RunQueryBenchmark(size_t queryCount = 10000, int frames = 30, size_t bodyCount = 2000);
+
+	struct ContactBenchmarkResult {
+		std::vector<size_t> bodyCounts;
+		std::vector<double> legacyUs;       // ָ  ϳ  + ̺Ʈ ť ִ  (ܴ ݹ ð)
+		std::vector<double> bufferUs;       // ContactBuffer ( +  ġ + ˸)
+		std::vector<double> pairsPerStep;   // PhysX   
+		std::vector<double> keptPerStep;    // ۿ   
+		uint32_t dropped = 0;               // 뷮 ʰ  
+		size_t violations = 0;              //   ߺ,  Ʒ ,   
+	};
+
+	// ũⰡ ٸ  ̸ frames ܾ ϸ      
+	static ContactBenchmarkResult RunContactBenchmark(int frames = 240, float impulseThreshold = 0.5f);
+};
@@ -0,0 +1,178 @@
+#include "pch.h"
+#include "PreloadManifest.h"
+
+namespace Resource
+{
+    namespace
+    {
+        // ο    Ƿ θ 
+        std::vector<std::string_view> SplitTabs(std::string_view line) {
+            std::vector<std::string_view> fields;
+            while (true) {
+                const size_t end = line.find('\t');
+                fields.push_back(line.substr(0, end));
+                if (end == std::string_view::npos) break;
+                line = line.substr(end + 1);
+            }
+            return fields;
+        }
+
+        template<typename T>
+        bool ParseNumber(std::string_view token, T& value) {
+            const auto [end, ec] = std::from_chars(token.data(), token.data() + token.size(), value);
+            return ec == std::errc() && end == token.data() + token.size();
+        }
+    }
+
+    const char* PreloadManifest::GetTypeName(Type type)
+    {
+        switch (type) {
+        case Type::Texture:     return "texture";
+        case Type::Model:       return "model";
+        case Type::Shader:      return "shader";
+        case Type::Sound:       return "sound";
+        case Type::Material:    return "material";
+        default:                return "unknown";
+        }
+    }
+
+    std::optional<Type> PreloadManifest::ParseTypeName(std::string_view name)
+    {
+        for (size_t i = 0; i < static_cast<size_t>(Type::Count); ++i) {
+            if (name == GetTypeName(static_cast<Type>(i))) {
+                return static_cast<Type>(i);
+            }
+        }
+        return std::nullopt;
+    }
+
+    bool PreloadManifest::Parse(std::string_view text, std::vector<Entry>& entries, std::string& error)
+    {
+        entries.clear();
+        size_t lineNumber = 0;
+        bool headerFound = false;
+
+        while (!text.empty()) {
+            const size_t lineEnd = text.find('\n');
+            std::string_view line = text.substr(0, lineEnd);
+            text = lineEnd == std::string_view::npos ? std::string_view() : text.substr(lineEnd + 1);
+            ++lineNumber;
+
+            if (!line.empty() && line.back() == '\r') {
+                line.remove_suffix(1);
+            }
+            if (line.empty() || line.front() == '#') continue;
+
+            auto fail = [&](std::string_view reason) {
+                error = std::format("{}° : {}", lineNumber, reason);
+                return false;
+            };
+
+            // ù  "preload <>" -  ٸ    
+            if (!headerFound) {
+                uint32_t version = 0;
+                if (!line.starts_with("preload ") || !ParseNumber(line.substr(8), version)) {
+                    return fail("preload  ");
+                }
+                if (version != Version) {
+                    return fail(std::format(" ʴ  {}", version));
+                }
+                headerFound = true;
+                continue;
+            }
+
+            const auto fields = SplitTabs(line);
+            if (fields.size() < 4) return fail("<Ÿ> <û ð> <ũ> <> [...]");
+
+            Entry entry;
+            const auto type = ParseTypeName(fields[0]);
+            if (!type) return fail(std::format("   Ÿ: {}", fields[0]));
+            entry.type = *type;
+            if (!ParseNumber(fields[1], entry.firstRequestMs)) return fail(std::format("ڰ ƴ: {}", fields[1]));
+            if (!ParseNumber(fields[2], entry.size)) return fail(std::format("ڰ ƴ: {}", fields[2]));
+            if (fields[3].empty()) return fail("ΰ  ");
+            entry.path = fields[3];
+            for (size_t i = 4; i < fields.size(); ++i) {
+                entry.args.emplace_back(fields[i]);
+            }
+            entries.push_back(std::move(entry));
+        }
+
+        if (!headerFound) {
+            error = " Ŵ佺Ʈ";
+            return false;
+        }
+        return true;
+    }
+
+    std::string PreloadManifest::Serialize(std::span<const Entry> entries)
+    {
+        std::string text = std::format("preload {}\n", Version);
+        for (const auto& entry : entries) {
+            text += std::format("{}\t{}\t{}\t{}", GetTypeName(entry.type), entry.firstRequestMs, entry.size, entry.path);
+            for (const auto& arg : entry.args) {
+                text += '\t';
+                text += arg;
+            }
+            text += '\n';
+        }
+        return text;
+    }
+
+    bool PreloadManifest::Load(const std::filesystem::path& path)
+    {
+        m_entries.clear();
+
+        std::ifstream file(path, std::ios::binary);
+        if (!file) {
+            return false;
+        }
+        const std::string text((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+        std::string error;
+        if (!Parse(text, m_entries, error)) {
+            Logger::Instance().Warning("ε Ŵ佺Ʈ : {} - {}", path.generic_string(), error);
+            m_entries.clear();
+            return false;
+        }
+        return true;
+    }
+
+    bool PreloadManifest::Save(const std::filesystem::path& path) const
+    {
+        std::error_code ec;
+        if (path.has_parent_path()) {
+            std::filesystem::create_directories(path.parent_path(), ec);
+        }
+
+        auto tempPath = path;
+        tempPath += ".tmp";
+
+        {
+            const std::string text = Serialize(m_entries);
+            std::ofstream file(tempPath, std::ios::binary | std::ios::trunc);
+            if (!file) {
+                return false;
+            }
+            file.write(text.data(), static_cast<std::streamsize>(text.size()));
+            if (!file) {
+                file.close();
+                std::filesystem::remove(tempPath, ec);
+                return false;
+            }
+        }
+
+        std::filesystem::rename(tempPath, path, ec);
+        if (ec) {
+            std::filesystem::remove(tempPath, ec);
+            return false;
+        }
+        return true;
+    }
+
+    void PreloadManifest::SortByRequestTime()
+    {
+        std::stable_sort(m_entries.begin(), m_entries.end(),
+            [](const Entry& a, const Entry& b) { return a.firstRequestMs < b.firstRequestMs; });
+    }
+}
@@ -0,0 +1,48 @@
+#pragma once
+#include "pch.h"
+#include "IResource.h"
+
+namespace Resource
+{
+    //  ε Ŵ佺Ʈ
+    //  ϴ  û ҽ ó û   
+    //  ǿ     ResourceManager   ̸ û
+    class PreloadManifest {
+    public:
+        static constexpr uint32_t Version = 1;
+
+        struct Entry {
+            Type type = Type::Count;
+            std::string path;
+            std::vector<std::string> args;      // ŸԺ   (̴: , Ʈ, , Ű...)
+            uint32_t firstRequestMs = 0;        //  ۺ ó û 
+            uint64_t size = 0;                  //    ũ (ε ʾ 0)
+        };
+
+        //  ų    false ( Ŵ佺Ʈ)
+        bool Load(const std::filesystem::path& path);
+
+        // ӽ Ͽ   ü
+        bool Save(const std::filesystem::path& path) const;
+
+        //  ٿ  ҽ,  : Ÿ, û ð(ms), ũ, , ...
+        static bool Parse(std::string_view text, std::vector<Entry>& entries, std::string& error);
+        static std::string Serialize(std::span<const Entry> entries);
+
+        void Add(Entry entry) { m_entries.push_back(std::move(entry)); }
+        void Clear() { m_entries.clear(); }
+
+        // û ð   ( ð̸   )
+        void SortByRequestTime();
+
+        std::vector<Entry>& GetEntries() { return m_entries; }
+        const std::vector<Entry>& GetEntries() const { return m_entries; }
+        bool IsEmpty() const { return m_entries.empty(); }
+
+        static const char* GetTypeName(Type type);
+        static std::optional<Type> ParseTypeName(std::string_view name);
+
+    private:
+        std::vector<Entry> m_entries;
+    };
+}
@@ -0,0 +1,184 @@
+#pragma once
+#include "pch.h"
+#include "IResource.h"
+
+namespace Resource
+{
+    // ҽ Ű - (Ÿ, , Ķ) 64Ʈ ؽ
+    using ResourceKey = uint64_t;
+
+    // FNV-1a  Ű 
+    class ResourceKeyBuilder {
+    public:
+        ResourceKeyBuilder& Add(std::string_view text) {
+            for (unsigned char c : text) {
+                Mix(c);
+            }
+            Mix(0xFF);  //  ("ab"+"c"  "a"+"bc" )
+            return *this;
+        }
+
+        template<typename T>
+            requires std::is_integral_v<T> || std::is_enum_v<T>
+        ResourceKeyBuilder& Add(T value) {
+            uint64_t bits = static_cast<uint64_t>(value);
+            for (size_t i = 0; i < sizeof(T); ++i) {
+                Mix(static_cast<uint8_t>(bits >> (i * 8)));
+            }
+            return *this;
+        }
+
+        ResourceKey Get() const { return m_hash; }
+
+    private:
+        void Mix(uint8_t byte) {
+            m_hash ^= byte;
+            m_hash *= 0x100000001B3ull;
+        }
+
+        uint64_t m_hash = 0xCBF29CE484222325ull;
+    };
+
+    // б  ü ҽ ĳ
+    // -  Ž tbb::concurrent_unordered_map   
+    // -  Ʈ std::atomic<std::shared_ptr> а ٲ. lock-free ƴ϶
+    //   (MSVC     Ʈ ɶ )  Գ  
+    // -  Ű   insert-or-get future Ȯ   
+    // -   ʰ ⸸ ϹǷ ȸ   浹 
+    class ResourceCache {
+    public:
+        // Կ ġǴ Ʈ ( Ϸ  future غ  )
+        struct Entry {
+            std::shared_future<std::shared_ptr<IResource>> resource;
+            std::atomic<bool> referenced{ true };   // CLOCK ü  Ʈ
+            size_t accountedSize = 0;               // ޸ 꿡 ݿ ũ (  )
+        };
+        using EntryPtr = std::shared_ptr<Entry>;
+
+        ResourceCache() = default;
+        ~ResourceCache() = default;
+
+        //  
+        ResourceCache(const ResourceCache&) = delete;
+        ResourceCache& operator=(const ResourceCache&) = delete;
+
+        // ĳõ ҽ ȸ (ų    nullptr)
+        std::shared_ptr<IResource> Find(ResourceKey key) const {
+            auto it = m_slots.find(key);
+            if (it == m_slots.end()) return nullptr;
+
+            EntryPtr entry = it->second->entry.load(std::memory_order_acquire);
+            if (!entry) return nullptr;
+
+            Touch(*entry);
+            return entry->resource.get();
+        }
+
+        //   Ʈ ȸ ( Ʈ ǵ帮 )
+        EntryPtr GetEntry(ResourceKey key) const {
+            auto it = m_slots.find(key);
+            if (it == m_slots.end()) return nullptr;
+            return it->second->entry.load(std::memory_order_acquire);
+        }
+
+        //   Ʈ Ȯ
+        static bool IsReady(const Entry& entry) {
+            return entry.resource.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+        }
+
+        // ȸ   factory  - ϴ    
+        // created:  ȣ  ߴ 
+        template<typename Factory>
+        std::shared_ptr<IResource> GetOrCreate(ResourceKey key, Factory&& factory, bool& created) {
+            created = false;
+            Slot& slot = AcquireSlot(key);
+
+            EntryPtr entry = slot.entry.load(std::memory_order_acquire);
+            if (entry) {
+                Touch(*entry);
+                return entry->resource.get();
+            }
+
+            //   -  Ʈ ġ 常 
+            std::promise<std::shared_ptr<IResource>> promise;
+            auto fresh = std::make_shared<Entry>();
+            fresh->resource = promise.get_future().share();
+
+            if (!slot.entry.compare_exchange_strong(entry, fresh, std::memory_order_acq_rel)) {
+                return entry->resource.get();  // ٸ 尡  ġ
+            }
+
+            try {
+                std::shared_ptr<IResource> resource = factory();
+                promise.set_value(resource);
+                created = true;
+                return resource;
+            }
+            catch (...) {
+                //   忡     
+                promise.set_exception(std::current_exception());
+                EntryPtr expected = fresh;
+                slot.entry.compare_exchange_strong(expected, nullptr);
+                throw;
+            }
+        }
+
+        // Ư Ű Ʈ  
+        EntryPtr Remove(ResourceKey key) {
+            auto it = m_slots.find(key);
+            if (it == m_slots.end()) return nullptr;
+            return it->second->entry.exchange(nullptr, std::memory_order_acq_rel);
+        }
+
+        //  Ʈ expected  desired ü
+        bool CompareExchange(ResourceKey key, EntryPtr expected, EntryPtr desired) {
+            auto it = m_slots.find(key);
+            if (it == m_slots.end()) return false;
+            return it->second->entry.compare_exchange_strong(expected, std::move(desired),
+                std::memory_order_acq_rel);
+        }
+
+        //    ҽ ȸ - fn(key, entry, resource)
+        template<typename Fn>
+        void ForEach(Fn&& fn) const {
+            for (const auto& [key, slot] : m_slots) {
+                EntryPtr entry = slot->entry.load(std::memory_order_acquire);
+                if (!entry || !IsReady(*entry)) continue;
+                if (const auto& resource = entry->resource.get()) {
+                    fn(key, entry, resource);
+                }
+            }
+        }
+
+        //  Ʈ  ( )
+        void Clear() {
+            for (auto& [key, slot] : m_slots) {
+                slot->entry.store(nullptr, std::memory_order_release);
+            }
+        }
+
+    private:
+        //  Ű ȸ/ü Ժ ɶ ϹǷ Ű ٸ   
+        struct Slot {
+            std::atomic<EntryPtr> entry;
+        };
+
+        //  Ʈ  - ̹   ⸦  ĳ   
+        static void Touch(Entry& entry) {
+            if (!entry.referenced.load(std::memory_order_relaxed)) {
+                entry.referenced.store(true, std::memory_order_relaxed);
+            }
+        }
+
+        Slot& AcquireSlot(ResourceKey key) {
+            auto it = m_slots.find(key);
+            if (it != m_slots.end()) {
+                return *it->second;
+            }
+            //    ϳ Ƴ    ȯ
+            return *m_slots.emplace(key, std::make_unique<Slot>()).first->second;
+        }
+
+        tbb::concurrent_unordered_map<ResourceKey, std::unique_ptr<Slot>> m_slots;
+    };
+}
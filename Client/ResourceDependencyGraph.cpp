@@ -0,0 +1,82 @@
+#include "pch.h"
+#include "ResourceDependencyGraph.h"
+#include "AssetArchive.h"
+
+namespace Resource
+{
+    void ResourceDependencyGraph::SetDependencies(ResourceKey key, std::span<const std::string> files)
+    {
+        std::vector<std::string> normalized;
+        normalized.reserve(files.size());
+        for (const auto& file : files) {
+            normalized.push_back(AssetArchive::NormalizePath(file));
+        }
+        std::sort(normalized.begin(), normalized.end());
+        normalized.erase(std::unique(normalized.begin(), normalized.end()), normalized.end());
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        RemoveLocked(key);
+
+        for (const auto& file : normalized) {
+            m_dependents[file].insert(key);
+        }
+        m_dependencies[key] = std::move(normalized);
+    }
+
+    void ResourceDependencyGraph::Remove(ResourceKey key)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        RemoveLocked(key);
+    }
+
+    void ResourceDependencyGraph::Clear()
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_dependents.clear();
+        m_dependencies.clear();
+    }
+
+    std::vector<ResourceKey> ResourceDependencyGraph::GetAffected(std::span<const std::string> changedFiles) const
+    {
+        std::unordered_set<ResourceKey> affected;
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for (const auto& file : changedFiles) {
+            auto it = m_dependents.find(AssetArchive::NormalizePath(file));
+            if (it != m_dependents.end()) {
+                affected.insert(it->second.begin(), it->second.end());
+            }
+        }
+        return { affected.begin(), affected.end() };
+    }
+
+    std::vector<std::string> ResourceDependencyGraph::GetDependencies(ResourceKey key) const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto it = m_dependencies.find(key);
+        return it != m_dependencies.end() ? it->second : std::vector<std::string>{};
+    }
+
+    size_t ResourceDependencyGraph::GetResourceCount() const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_dependencies.size();
+    }
+
+    void ResourceDependencyGraph::RemoveLocked(ResourceKey key)
+    {
+        auto it = m_dependencies.find(key);
+        if (it == m_dependencies.end()) return;
+
+        for (const auto& file : it->second) {
+            auto dependents = m_dependents.find(file);
+            if (dependents == m_dependents.end()) continue;
+
+            dependents->second.erase(key);
+            if (dependents->second.empty()) {
+                m_dependents.erase(dependents);
+            }
+        }
+        m_dependencies.erase(it);
+    }
+}
@@ -0,0 +1,32 @@
+#pragma once
+#include "pch.h"
+#include "ResourceCache.h"
+
+namespace Resource
+{
+    //  -> ҽ  
+    // - ҽ д  (ڱ , ̴ include, ͸ ؽó ) 
+    // - ٲ   ٽ εؾ  ҽ 
+    // - δ ArchiveFormat  Ģ ȭؼ  (ҹ,  )
+    class ResourceDependencyGraph {
+    public:
+        // ҽ    ü (ε  include ٲ ݿ)
+        void SetDependencies(ResourceKey key, std::span<const std::string> files);
+
+        void Remove(ResourceKey key);
+        void Clear();
+
+        // ٲ Ͽ ϴ ҽ (ߺ )
+        std::vector<ResourceKey> GetAffected(std::span<const std::string> changedFiles) const;
+
+        std::vector<std::string> GetDependencies(ResourceKey key) const;
+        size_t GetResourceCount() const;
+
+    private:
+        void RemoveLocked(ResourceKey key);
+
+        mutable std::mutex m_mutex;
+        std::unordered_map<std::string, std::unordered_set<ResourceKey>> m_dependents;   //  -> ҽ
+        std::unordered_map<ResourceKey, std::vector<std::string>> m_dependencies;        // ҽ -> 
+    };
+}
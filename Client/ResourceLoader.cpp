@@ -0,0 +1,376 @@
+#include "pch.h"
+#include "ResourceLoader.h"
+
+namespace Resource
+{
+    ResourceLoader::ResourceLoader(size_t workerCount)
+    {
+        if (workerCount == 0) {
+            // IO Ⱑ ̹Ƿ ھ   
+            workerCount = std::max<size_t>(2, std::thread::hardware_concurrency() / 2);
+        }
+
+        m_workers.reserve(workerCount);
+        for (size_t i = 0; i < workerCount; ++i) {
+            m_workers.emplace_back(&ResourceLoader::WorkerLoop, this);
+        }
+
+        Logger::Instance().Info("ҽ δ ʱȭ Ϸ (Ŀ {})", workerCount);
+    }
+
+    ResourceLoader::~ResourceLoader()
+    {
+        Shutdown();
+    }
+
+    ResourceLoader::RequestId ResourceLoader::Enqueue(std::shared_ptr<IResource> resource, LoadPriority priority,
+        std::span<const std::shared_ptr<IResource>> dependencies)
+    {
+        RequestId id = InvalidRequest;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (m_stopping) {
+                Logger::Instance().Warning("  δ û : {}", resource->GetPath());
+                return InvalidRequest;
+            }
+
+            //   ID  ̾ -    ҽ ٸ  û   
+            bool reserved = false;
+            if (auto it = m_inflight.find(resource.get()); it != m_inflight.end()) {
+                if (auto reservation = m_reserved.find(it->second); reservation != m_reserved.end()) {
+                    id = it->second;
+                    priority = std::min(priority, reservation->second);
+                    m_reserved.erase(reservation);
+                    reserved = true;
+                }
+            }
+            if (!reserved) {
+                id = m_nextId++;
+            }
+
+            //    û  - δ ġ   ҽ ̹ Ready 
+            std::vector<RequestId> waitFor;
+            for (const auto& dependency : dependencies) {
+                if (!dependency) continue;
+
+                //  ID ̹ ٸ û ٸ   Ƿ   û ٸ ȯ
+                auto it = m_inflight.find(dependency.get());
+                const bool cycle = it != m_inflight.end() && reserved && (it->second == id || ReachesLocked(it->second, id));
+                if (it != m_inflight.end() && !cycle) {
+                    waitFor.push_back(it->second);
+                    continue;
+                }
+                if (!cycle && dependency->IsReady()) {
+                    continue;
+                }
+
+                // ߰ų, δ û ʾҰų, ȯ  ҽ
+                Logger::Instance().Error("{}: {} -> {}", cycle ? "ȯ  ε " : " ҽ    ε ",
+                    resource->GetPath(), dependency->GetPath());
+                resource->SetState(State::Failed);
+                if (auto inflight = m_inflight.find(resource.get()); inflight != m_inflight.end() && inflight->second == id) {
+                    m_inflight.erase(inflight);
+                }
+                m_completions.push({ id, std::move(resource), false, true });
+
+                //  ߿  û ٸ  û  
+                for (RequestId dependent : TakeDependentsLocked(id)) {
+                    FailWaitingLocked(dependent);
+                }
+                m_completed.notify_all();
+                return id;
+            }
+            std::sort(waitFor.begin(), waitFor.end());
+            waitFor.erase(std::unique(waitFor.begin(), waitFor.end()), waitFor.end());
+
+            m_inflight[resource.get()] = id;
+            PendingRequest request{ std::move(resource), priority, m_nextSequence++ };
+
+            if (!waitFor.empty()) {
+                for (RequestId dependency : waitFor) {
+                    m_dependents[dependency].push_back(id);
+                    PromoteLocked(dependency, priority);
+                }
+                const size_t remaining = waitFor.size();
+                m_waiting.emplace(id, WaitingRequest{ std::move(request), remaining, std::move(waitFor) });
+                return id;
+            }
+
+            m_order.insert(MakeOrderKey(id, request));
+            m_pending.emplace(id, std::move(request));
+        }
+        m_condition.notify_one();
+        return id;
+    }
+
+    ResourceLoader::RequestId ResourceLoader::Reserve(const IResource* resource)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_stopping) {
+            return InvalidRequest;
+        }
+
+        const RequestId id = m_nextId++;
+        m_inflight[resource] = id;
+        m_reserved.emplace(id, LoadPriority::Background);
+        return id;
+    }
+
+    bool ResourceLoader::Cancel(RequestId id)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        // ٸ û ٸ   ҽ  
+        if (auto dependents = m_dependents.find(id); dependents != m_dependents.end()) {
+            const bool needed = std::any_of(dependents->second.begin(), dependents->second.end(),
+                [this](RequestId dependent) { return m_waiting.contains(dependent); });
+            if (needed) return false;
+        }
+
+        std::shared_ptr<IResource> resource;
+        if (auto it = m_pending.find(id); it != m_pending.end()) {
+            m_order.erase(MakeOrderKey(id, it->second));
+            resource = std::move(it->second.resource);
+            m_pending.erase(it);
+        }
+        else if (auto waiting = m_waiting.find(id); waiting != m_waiting.end()) {
+            //  û ʿ   Ϸ  m_waiting ã  õ
+            resource = std::move(waiting->second.request.resource);
+            m_waiting.erase(waiting);
+        }
+        else {
+            return false;  // ̹  ̰ų Ϸ
+        }
+
+        if (auto it = m_inflight.find(resource.get()); it != m_inflight.end() && it->second == id) {
+            m_inflight.erase(it);
+        }
+        m_dependents.erase(id);
+        m_completed.notify_all();
+        return true;
+    }
+
+    bool ResourceLoader::Reprioritize(RequestId id, LoadPriority priority)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (auto it = m_pending.find(id); it != m_pending.end()) {
+            if (it->second.priority != priority) {
+                m_order.erase(MakeOrderKey(id, it->second));
+                it->second.priority = priority;
+                m_order.insert(MakeOrderKey(id, it->second));
+            }
+            return true;
+        }
+
+        auto it = m_waiting.find(id);
+        if (it == m_waiting.end()) {
+            return false;
+        }
+
+        const bool raised = priority < it->second.request.priority;
+        it->second.request.priority = priority;
+        if (raised) {
+            for (RequestId dependency : it->second.dependencies) {
+                PromoteLocked(dependency, priority);
+            }
+        }
+        return true;
+    }
+
+    void ResourceLoader::PromoteLocked(RequestId id, LoadPriority priority)
+    {
+        //  û ٸ Է ּ ׸ŭ  (  - ٸ û   )
+        if (auto it = m_reserved.find(id); it != m_reserved.end()) {
+            it->second = std::min(it->second, priority);   // Enqueue  ݿ
+            return;
+        }
+        if (auto it = m_pending.find(id); it != m_pending.end()) {
+            if (priority < it->second.priority) {
+                m_order.erase(MakeOrderKey(id, it->second));
+                it->second.priority = priority;
+                m_order.insert(MakeOrderKey(id, it->second));
+            }
+            return;
+        }
+
+        auto it = m_waiting.find(id);
+        if (it != m_waiting.end() && priority < it->second.request.priority) {
+            it->second.request.priority = priority;
+            for (RequestId dependency : it->second.dependencies) {
+                PromoteLocked(dependency, priority);
+            }
+        }
+    }
+
+    std::vector<ResourceLoader::RequestId> ResourceLoader::TakeDependentsLocked(RequestId id)
+    {
+        auto it = m_dependents.find(id);
+        if (it == m_dependents.end()) {
+            return {};
+        }
+        auto dependents = std::move(it->second);
+        m_dependents.erase(it);
+        return dependents;
+    }
+
+    bool ResourceLoader::ReachesLocked(RequestId from, RequestId target) const
+    {
+        std::vector<RequestId> stack{ from };
+        std::unordered_set<RequestId> visited;
+        while (!stack.empty()) {
+            const RequestId current = stack.back();
+            stack.pop_back();
+            if (current == target) return true;
+            if (!visited.insert(current).second) continue;
+
+            if (auto it = m_waiting.find(current); it != m_waiting.end()) {
+                stack.insert(stack.end(), it->second.dependencies.begin(), it->second.dependencies.end());
+            }
+        }
+        return false;
+    }
+
+    size_t ResourceLoader::CompleteLocked(RequestId id, const std::shared_ptr<IResource>& resource, bool success)
+    {
+        if (auto it = m_inflight.find(resource.get()); it != m_inflight.end() && it->second == id) {
+            m_inflight.erase(it);
+        }
+        m_completions.push({ id, resource, success });
+
+        size_t released = 0;
+        for (RequestId dependent : TakeDependentsLocked(id)) {
+            if (!success) {
+                FailWaitingLocked(dependent);
+                continue;
+            }
+
+            auto it = m_waiting.find(dependent);
+            if (it == m_waiting.end() || --it->second.remaining > 0) {
+                continue;  // /߰ų  ٸ Է ٸ
+            }
+
+            //  Է  -    ä    ̵
+            PendingRequest request = std::move(it->second.request);
+            m_waiting.erase(it);
+            m_order.insert(MakeOrderKey(dependent, request));
+            m_pending.emplace(dependent, std::move(request));
+            ++released;
+        }
+        return released;
+    }
+
+    void ResourceLoader::FailWaitingLocked(RequestId id)
+    {
+        auto it = m_waiting.find(id);
+        if (it == m_waiting.end()) {
+            return;  // ҵưų ٸ Է з ̹ ó
+        }
+
+        auto resource = std::move(it->second.request.resource);
+        m_waiting.erase(it);
+
+        Logger::Instance().Error(" ҽ з ε ǳʶ: {}", resource->GetPath());
+        resource->SetState(State::Failed);
+
+        if (auto inflight = m_inflight.find(resource.get()); inflight != m_inflight.end() && inflight->second == id) {
+            m_inflight.erase(inflight);
+        }
+        m_completions.push({ id, std::move(resource), false, true });
+
+        // д  û ٸ û 
+        for (RequestId dependent : TakeDependentsLocked(id)) {
+            FailWaitingLocked(dependent);
+        }
+    }
+
+    void ResourceLoader::Wait(const IResource* resource)
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        if (auto it = m_inflight.find(resource); it != m_inflight.end()) {
+            PromoteLocked(it->second, LoadPriority::VisibleNow);
+        }
+        m_completed.wait(lock, [&]() { return m_stopping || !m_inflight.contains(resource); });
+    }
+
+    bool ResourceLoader::PopCompletion(Completion& completion)
+    {
+        return m_completions.try_pop(completion);
+    }
+
+    void ResourceLoader::Shutdown()
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (m_stopping) return;
+            m_stopping = true;
+            m_order.clear();
+            m_pending.clear();
+            m_waiting.clear();
+            m_inflight.clear();
+            m_dependents.clear();
+            m_reserved.clear();
+        }
+        m_condition.notify_all();
+        m_completed.notify_all();
+
+        for (auto& worker : m_workers) {
+            if (worker.joinable()) {
+                worker.join();
+            }
+        }
+        m_workers.clear();
+
+        Completion discarded;
+        while (m_completions.try_pop(discarded)) {}
+    }
+
+    size_t ResourceLoader::GetPendingCount() const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_pending.size() + m_waiting.size();
+    }
+
+    void ResourceLoader::WorkerLoop()
+    {
+        while (true) {
+            RequestId id = InvalidRequest;
+            std::shared_ptr<IResource> resource;
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_condition.wait(lock, [this]() { return m_stopping || !m_order.empty(); });
+                if (m_stopping) return;
+
+                //  켱  û 
+                auto first = m_order.begin();
+                id = std::get<2>(*first);
+                m_order.erase(first);
+
+                auto it = m_pending.find(id);
+                resource = std::move(it->second.resource);
+                m_pending.erase(it);
+            }
+
+            bool success = false;
+            try {
+                success = resource->Load();
+            }
+            catch (const std::exception& e) {
+                Logger::Instance().Error("ҽ ε   ߻: {} - {}", resource->GetPath(), e.what());
+            }
+
+            // Ϸ ϰ  û ٸ û    ó
+            size_t released = 0;
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                released = CompleteLocked(id, resource, success);
+            }
+            m_completed.notify_all();
+            if (released == 1) {
+                m_condition.notify_one();
+            }
+            else if (released > 1) {
+                m_condition.notify_all();
+            }
+        }
+    }
+}
@@ -0,0 +1,123 @@
+#pragma once
+#include "pch.h"
+#include "IResource.h"
+
+namespace Resource
+{
+    // ε û 켱 (   ó)
+    enum class LoadPriority : uint8_t {
+        VisibleNow,     //  ȭ鿡 ʿ ҽ
+        Prefetch,       //  ʿ  Ǵ ҽ
+        Background,     //    ε
+        Count
+    };
+
+    //  ũ Ŀ Ǯ  񵿱 ҽ δ
+    // - û 带  ʰ 켱 ť ۾  ó
+    // -   û /켱  
+    // - Ϸ û   Ϸ ť 
+    // -  ҽ ϸ DAG ٸ: Է      ° ǰ,
+    //   Է ϳ ϸ Load  а ĵ. ü ð   ƴ϶ Ӱ ο 
+    class ResourceLoader {
+    public:
+        using RequestId = uint64_t;
+        static constexpr RequestId InvalidRequest = 0;
+
+        // ε Ϸ 
+        struct Completion {
+            RequestId id = InvalidRequest;
+            std::shared_ptr<IResource> resource;
+            bool success = false;
+            bool dependencyFailed = false;  //  ҽ з Load ȣ 
+        };
+
+        // workerCount: 0̸ ϵ    
+        explicit ResourceLoader(size_t workerCount = 0);
+        ~ResourceLoader();
+
+        //  
+        ResourceLoader(const ResourceLoader&) = delete;
+        ResourceLoader& operator=(const ResourceLoader&) = delete;
+
+        // ε û ߰
+        // dependencies:   ϴ ҽ. δ û ä  ( )̸   ٸ,
+        // ̹ Ready ٷ ,  (, û )  û ٽ ٸ ȯ̸  з Ϸ
+        // ٸ   û 켱 ּ priority ö
+        RequestId Enqueue(std::shared_ptr<IResource> resource, LoadPriority priority,
+            std::span<const std::shared_ptr<IResource>> dependencies = {});
+
+        // Enqueue  û ID ̸   (ҽ ٸ 忡 ϱ  ȣ)
+        //    ҽ ϴ û  ʰ ٸ,  ҽ  Enqueue  ID ̾
+        RequestId Reserve(const IResource* resource);
+
+        //  ۵  û  (̹  ̰ų ٸ û ٸ  false)
+        bool Cancel(RequestId id);
+
+        //  ۵  û 켱  ( û Բ ø)
+        bool Reprioritize(RequestId id, LoadPriority priority);
+
+        // resource   û( )   ٸ.   ̸ VisibleNow ø
+        // ε Ŀ ȿ ȣ  (Ŀ  ٸ )
+        void Wait(const IResource* resource);
+
+        // Ϸ û ϳ  ( 忡 ȣ )
+        bool PopCompletion(Completion& completion);
+
+        //  Ŀ  (  û )
+        void Shutdown();
+
+        size_t GetWorkerCount() const { return m_workers.size(); }
+        size_t GetPendingCount() const;     //   +  
+
+    private:
+        void WorkerLoop();
+
+        struct PendingRequest {
+            std::shared_ptr<IResource> resource;
+            LoadPriority priority;
+            uint64_t sequence;      //  켱  FIFO 
+        };
+
+        //  ҽ ⸦ ٸ û
+        struct WaitingRequest {
+            PendingRequest request;
+            size_t remaining = 0;                   //     û 
+            std::vector<RequestId> dependencies;    // 켱 ӿ
+        };
+
+        // Ʒ Լ m_mutex  ¿ ȣ
+        void PromoteLocked(RequestId id, LoadPriority priority);
+        size_t CompleteLocked(RequestId id, const std::shared_ptr<IResource>& resource, bool success);   //   û  ȯ
+        void FailWaitingLocked(RequestId id);
+        std::vector<RequestId> TakeDependentsLocked(RequestId id);
+        bool ReachesLocked(RequestId from, RequestId target) const;    // from ٸ û 󰡸 target 
+
+        // (켱, , ID)  ĵǴ   Ű
+        using OrderKey = std::tuple<uint8_t, uint64_t, RequestId>;
+
+        static OrderKey MakeOrderKey(RequestId id, const PendingRequest& request) {
+            return { static_cast<uint8_t>(request.priority), request.sequence, id };
+        }
+
+        std::vector<std::thread> m_workers;
+
+        mutable std::mutex m_mutex;
+        std::condition_variable m_condition;
+        std::condition_variable m_completed;                        // û m_inflight   (Wait)
+        std::unordered_map<RequestId, PendingRequest> m_pending;    //  
+        std::set<OrderKey> m_order;
+        std::unordered_map<RequestId, WaitingRequest> m_waiting;    //  
+
+        //  ׷ - Ϸ  û(/ ) 
+        std::unordered_map<const IResource*, RequestId> m_inflight;
+        std::unordered_map<RequestId, std::vector<RequestId>> m_dependents;
+        std::unordered_map<RequestId, LoadPriority> m_reserved;     // Enqueue    ID -> ٸ û ø 켱
+        bool m_stopping = false;
+
+        RequestId m_nextId = 1;
+        uint64_t m_nextSequence = 0;
+
+        // Ϸ ť (Ŀ ->  )
+        tbb::concurrent_queue<Completion> m_completions;
+    };
+}
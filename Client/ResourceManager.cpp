@@ -1,5 +1,6 @@
 #include "pch.h"
 #include "ResourceManager.h"
+#include "ArchiveManager.h"
 
 namespace Resource
 {
@@ -9,69 +10,160 @@ namespace Resource
         return instance;
     }
 
+    ResourceManager::ResourceManager()
+        : m_loader(std::make_unique<ResourceLoader>())
+        , m_fileIO(std::make_unique<AsyncFileIO>())
+    {
+        // ⺻ ޸ 
+        m_memoryBudgets[TypeIndex(Type::Texture)] = 512ull * 1024 * 1024;   // 512MB
+        m_memoryBudgets[TypeIndex(Type::Model)] = 256ull * 1024 * 1024;     // 256MB
+        m_memoryBudgets[TypeIndex(Type::Shader)] = 16ull * 1024 * 1024;     // 16MB
+        m_memoryBudgets[TypeIndex(Type::Sound)] = 64ull * 1024 * 1024;      // 64MB
+        m_memoryBudgets[TypeIndex(Type::Material)] = 8ull * 1024 * 1024;    // 8MB
+    }
+
+    ResourceManager::~ResourceManager()
+    {
+        // Ŀ ҽ ǵ帮 ʵ  
+        DisableHotReload();
+        m_loader->Shutdown();
+        m_fileIO->Shutdown();   // ε Ŀ IO ٸ   Ƿ Ŀ  
+        ReleaseAllResources();
+    }
+
     void ResourceManager::ReleaseResource(const std::string& path) 
     {
-        std::unique_lock<std::shared_mutex> lock(m_mutex);
-        auto it = m_resources.find(path);
-        if (it != m_resources.end()) {
-            Logger::Instance().Info("ҽ : {}", path);
-            it->second->Unload();
-            m_resources.erase(it);
+        //    (̴ Ʈ Ʈ ) 
+        std::vector<ResourceKey> keys;
+        m_cache.ForEach([&](ResourceKey key, const ResourceCache::EntryPtr&, const std::shared_ptr<IResource>& resource) {
+            if (resource->GetPath() == path) {
+                keys.push_back(key);
+            }
+            });
+
+        for (ResourceKey key : keys) {
+            if (auto entry = m_cache.Remove(key)) {
+                const auto& resource = entry->resource.get();
+                Logger::Instance().Info("ҽ : {}", path);
+                CancelLoading(resource);
+                UntrackResident(key, *entry, *resource);
+                resource->Unload();
+            }
         }
     }
 
     void ResourceManager::GarbageCollect() 
     {
-        std::unique_lock<std::shared_mutex> lock(m_mutex);
-        for (auto it = m_resources.begin(); it != m_resources.end();) {
-            if (it->second.use_count() == 1) {  // ResourceManager  
-                Logger::Instance().Info("̻ ҽ : {}", it->first);
-                it->second->Unload();
-                it = m_resources.erase(it);
+        // / ϸ ȸϸ  Ʈ ϰ ̻ ҽ 
+        size_t evicted = SweepFailed();
+        for (auto& list : m_clockLists) {
+            evicted += SweepUnused(list);
+        }
+
+        Logger::Instance().Info("̻ ҽ {} ", evicted);
+    }
+
+    size_t ResourceManager::SweepUnused(ClockList& list)
+    {
+        size_t evicted = 0;
+        list.hand = 0;
+        while (list.hand < list.keys.size()) {
+            switch (TryEvict(list.keys[list.hand], false)) {
+            case EvictResult::Evicted:
+                ++evicted;
+                [[fallthrough]];
+            case EvictResult::Gone:
+                list.RemoveAtHand();
+                break;
+            default:
+                ++list.hand;
+                break;
+            }
+        }
+        list.hand = 0;
+        return evicted;
+    }
+
+    size_t ResourceManager::SweepFailed()
+    {
+        size_t evicted = 0;
+        auto& list = m_failedList;
+        list.hand = 0;
+        while (list.hand < list.keys.size()) {
+            //    Ű ٽ εǾ  CLOCK  ϹǷ ⼭ ⸸ 
+            auto entry = m_cache.GetEntry(list.keys[list.hand]);
+            const bool failed = entry && ResourceCache::IsReady(*entry) &&
+                entry->resource.get() && !entry->resource.get()->IsReady();
+
+            const EvictResult result = failed ? TryEvict(list.keys[list.hand], false) : EvictResult::Gone;
+            if (result == EvictResult::Evicted) {
+                ++evicted;
+            }
+            if (result == EvictResult::Evicted || result == EvictResult::Gone) {
+                list.RemoveAtHand();
             }
             else {
-                ++it;
+                ++list.hand;
             }
         }
+        list.hand = 0;
+        return evicted;
     }
 
     void ResourceManager::ReleaseAllResources() 
     {
-        std::unique_lock<std::shared_mutex> lock(m_mutex);
-        for (auto& [path, resource] : m_resources) {
-            Logger::Instance().Info("ҽ : {}", path);
+        m_cache.ForEach([](ResourceKey, const ResourceCache::EntryPtr&, const std::shared_ptr<IResource>& resource) {
+            Logger::Instance().Info("ҽ : {}", resource->GetPath());
             resource->Unload();
+            });
+        m_cache.Clear();
+
+        for (size_t i = 0; i < TypeCount; ++i) {
+            m_clockLists[i] = ClockList{};
+            m_memoryUsage[i].store(0);
         }
-        m_resources.clear();
+        m_failedList = ClockList{};
+        m_streamingTextures.clear();
+        m_dependencies.Clear();
+
+        for (auto& [frame, retired] : m_retiredContents) {
+            retired->Unload();
+        }
+        m_retiredContents.clear();
     }
 
     size_t ResourceManager::GetTotalMemoryUsage() const 
     {
-        std::shared_lock<std::shared_mutex> lock(m_mutex);
         size_t total = 0;
-        for (const auto& [path, resource] : m_resources) {
+        m_cache.ForEach([&](ResourceKey, const ResourceCache::EntryPtr&, const std::shared_ptr<IResource>& resource) {
             total += resource->GetSize();
-        }
+            });
         return total;
     }
 
     void ResourceManager::PrintResourceStats() const 
     {
-        std::shared_lock<std::shared_mutex> lock(m_mutex);
+        size_t count = 0;
+        m_cache.ForEach([&](ResourceKey, const ResourceCache::EntryPtr&, const std::shared_ptr<IResource>&) {
+            ++count;
+            });
+
         Logger::Instance().Info("=== ҽ  ===");
-        Logger::Instance().Info(" ҽ : {}", m_resources.size());
+        Logger::Instance().Info(" ҽ : {}", count);
         Logger::Instance().Info(" ޸ 뷮: {} bytes", GetTotalMemoryUsage());
 
-        for (const auto& [path, resource] : m_resources) {
-            Logger::Instance().Info("- {} ({}): {} bytes, {} refs",
+        m_cache.ForEach([](ResourceKey key, const ResourceCache::EntryPtr&, const std::shared_ptr<IResource>& resource) {
+            Logger::Instance().Info("- {} ({}, {:016x}): {} bytes, {} refs",
                 resource->GetName(),
-                path,
+                resource->GetPath(),
+                key,
                 resource->GetSize(),
                 resource->GetRefCount());
-        }
+            });
     }
 
-    void ResourceManager::QueueResourceLoading(std::shared_ptr<IResource> resource) 
+    void ResourceManager::QueueResourceLoading(ResourceKey key, std::shared_ptr<IResource> resource, LoadPriority priority,
+        std::span<const std::shared_ptr<IResource>> dependencies)
     {
         std::lock_guard<std::mutex> lock(m_loadingMutex);
 
@@ -79,39 +171,687 @@ namespace Resource
         Event::ResourceEvent event(resource->GetPath(), Event::ResourceEvent::Type::Started);
         EventManager::Instance().Publish(event);
 
-        // 񵿱 ε 
-        auto future = std::async(std::launch::async, [resource]() {
-            return resource->Load();
-            });
+        // Ŀ Ǯ ε û
+        const IResource* requester = resource.get();
+        auto id = m_loader->Enqueue(std::move(resource), priority, dependencies);
+        if (id != ResourceLoader::InvalidRequest) {
+            m_loadingRequests[requester] = { id, key };
+        }
+    }
+
+    bool ResourceManager::CancelLoading(const std::shared_ptr<IResource>& resource)
+    {
+        std::lock_guard<std::mutex> lock(m_loadingMutex);
+        auto it = m_loadingRequests.find(resource.get());
+        if (it == m_loadingRequests.end() || !m_loader->Cancel(it->second.id)) {
+            return false;
+        }
+        const ResourceKey key = it->second.key;
+        m_loadingRequests.erase(it);
 
-        m_loadingQueue.push({ resource, std::move(future) });
+        // ҵ ҽ ε  ä Ƿ ĳÿ   û  εϰ 
+        // (ReleaseResourceó ̹ °ų ٸ ҽ ٲ  ǵ帮 )
+        auto entry = m_cache.GetEntry(key);
+        if (entry && ResourceCache::IsReady(*entry) && entry->resource.get() == resource) {
+            m_cache.CompareExchange(key, entry, nullptr);
+        }
+
+        Event::ResourceEvent event(resource->GetPath(), Event::ResourceEvent::Type::Cancelled);
+        EventManager::Instance().Publish(event);
+        return true;
     }
 
-    void ResourceManager::ProcessLoadingQueue() 
+    bool ResourceManager::SetLoadPriority(const std::shared_ptr<IResource>& resource, LoadPriority priority)
     {
         std::lock_guard<std::mutex> lock(m_loadingMutex);
+        auto it = m_loadingRequests.find(resource.get());
+        if (it == m_loadingRequests.end()) {
+            return false;
+        }
+        return m_loader->Reprioritize(it->second.id, priority);
+    }
+
+    bool ResourceManager::WaitForLoading(const std::shared_ptr<IResource>& resource)
+    {
+        if (!resource) {
+            return false;
+        }
+        m_loader->Wait(resource.get());
+        return resource->IsReady();
+    }
+
+    void ResourceManager::ProcessLoadingQueue()
+    {
+        // Ϸ  ó (ռ û  ʾƵ  )
+        ResourceLoader::Completion completion;
+        while (m_loader->PopCompletion(completion)) {
+            std::optional<ResourceKey> key;
+            std::optional<ReloadRequest> reload;
+            {
+                std::lock_guard<std::mutex> lock(m_loadingMutex);
+                auto it = m_loadingRequests.find(completion.resource.get());
+                if (it != m_loadingRequests.end() && it->second.id == completion.id) {
+                    key = it->second.key;
+                    m_loadingRequests.erase(it);
+                }
+                else if (auto reloadIt = m_reloadRequests.find(completion.resource.get());
+                    reloadIt != m_reloadRequests.end() && reloadIt->second.id == completion.id) {
+                    reload = reloadIt->second;
+                    m_reloadRequests.erase(reloadIt);
+                }
+            }
+
+            //  ε 纻  븸 ü
+            if (reload) {
+                CompleteReload(completion, *reload);
+                continue;
+            }
+
+            if (completion.success && key) {
+                TrackResident(*key, completion.resource);
+                RegisterStreaming(completion.resource);
+            }
+            else if (key) {
+                TrackFailed(*key, completion.resource);
+            }
+
+            Event::ResourceEvent event(
+                completion.resource->GetPath(),
+                completion.success ? Event::ResourceEvent::Type::Completed
+                : Event::ResourceEvent::Type::Failed,
+                completion.success ? "" : completion.dependencyFailed ? "Dependency failed" : "Loading failed"
+                );
+            EventManager::Instance().Publish(event);
+        }
+
+        // 񵿱  б  
+        FileReadCompletion fileRead;
+        while (m_fileReads.try_pop(fileRead)) {
+            (*fileRead.callback)(fileRead.path, std::move(fileRead.data), fileRead.success);
+        }
+    }
+
+    size_t ResourceManager::ReadFilesAsync(std::span<const std::string> paths, FileReadCallback callback)
+    {
+        //   ϵ ¡ ۷ а , ū   ۷ ٷ 
+        constexpr uint64_t StagingReadLimit = 1024 * 1024;
 
-        while (!m_loadingQueue.empty()) {
-            auto& task = m_loadingQueue.front();
+        auto shared = std::make_shared<const FileReadCallback>(std::move(callback));
+        std::vector<AsyncFileIO::ReadRequest> requests;
+        requests.reserve(paths.size());
 
-            // future غǾ Ȯ
-            if (task.loadingFuture.wait_for(std::chrono::seconds(0))
-                == std::future_status::ready) {
+        for (const auto& path : paths) {
+            if (AssetData asset = ArchiveManager::Instance().Find(path)) {
+                m_fileReads.push({ path, { asset.bytes.begin(), asset.bytes.end() }, true, shared });
+                continue;
+            }
 
-                bool success = task.loadingFuture.get();
-                Event::ResourceEvent event(
-                    task.resource->GetPath(),
-                    success ? Event::ResourceEvent::Type::Completed
-                    : Event::ResourceEvent::Type::Failed,
-                    success ? "" : "Loading failed"
-                    );
-                EventManager::Instance().Publish(event);
+            WIN32_FILE_ATTRIBUTE_DATA attributes = {};
+            const std::wstring widePath = std::filesystem::path(path).wstring();
+            if (!GetFileAttributesExW(widePath.c_str(), GetFileExInfoStandard, &attributes)) {
+                Logger::Instance().Error(" ã  : {}", path);
+                m_fileReads.push({ path, {}, false, shared });
+                continue;
+            }
+            const uint64_t size = (static_cast<uint64_t>(attributes.nFileSizeHigh) << 32) | attributes.nFileSizeLow;
 
-                m_loadingQueue.pop();
+            if (size <= StagingReadLimit && size <= m_fileIO->GetStagingSize()) {
+                requests.push_back({ path, 0, 0, nullptr, [this, shared](const AsyncFileIO::ReadResult& result) {
+                    m_fileReads.push({ std::string(result.path), { result.data.begin(), result.data.end() }, result.success, shared });
+                    } });
+            }
+            else if (size <= std::numeric_limits<uint32_t>::max()) {
+                auto data = std::make_shared<std::vector<uint8_t>>(static_cast<size_t>(size));
+                requests.push_back({ path, 0, static_cast<uint32_t>(size), data->data(),
+                    [this, shared, data](const AsyncFileIO::ReadResult& result) {
+                        data->resize(result.data.size());
+                        m_fileReads.push({ std::string(result.path), std::move(*data), result.success, shared });
+                    } });
             }
             else {
-                break;  //  ε  ½ũ Ƿ ߴ
+                Logger::Instance().Error("4GB ̻      : {}", path);
+                m_fileReads.push({ path, {}, false, shared });
+            }
+        }
+
+        const size_t submitted = requests.size();
+        if (requests.empty()) {
+            return 0;
+        }
+
+        // ⿡ ص θ ݹ   Ҹ з 
+        std::vector<std::string> submittedPaths;
+        submittedPaths.reserve(submitted);
+        for (const auto& request : requests) {
+            submittedPaths.push_back(request.path);
+        }
+        if (m_fileIO->Submit(std::move(requests)) == AsyncFileIO::InvalidRequest) {
+            Logger::Instance().Error(" б   ({})", submitted);
+            for (auto& path : submittedPaths) {
+                m_fileReads.push({ std::move(path), {}, false, shared });
+            }
+            return 0;
+        }
+        return submitted;
+    }
+
+    void ResourceManager::RegisterStreaming(const std::shared_ptr<IResource>& resource)
+    {
+        //  Ӹ ö ؽó   Ʈ  
+        auto texture = std::dynamic_pointer_cast<TextureResource>(resource);
+        if (!texture || !texture->IsStreaming() || texture->IsFullyResident()) {
+            return;
+        }
+
+        const bool registered = std::any_of(m_streamingTextures.begin(), m_streamingTextures.end(),
+            [&](const std::weak_ptr<TextureResource>& other) { return other.lock() == texture; });
+        if (!registered) {
+            m_streamingTextures.push_back(texture);
+        }
+    }
+
+    bool ResourceManager::EnableHotReload(const std::string& directory)
+    {
+        auto watcher = std::make_unique<FileWatcher>();
+        if (!watcher->Start(directory)) {
+            return false;
+        }
+        m_fileWatcher = std::move(watcher);
+        return true;
+    }
+
+    void ResourceManager::DisableHotReload()
+    {
+        m_fileWatcher.reset();
+    }
+
+    size_t ResourceManager::ReloadChangedFiles(std::span<const std::string> files)
+    {
+        size_t queued = 0;
+        for (ResourceKey key : m_dependencies.GetAffected(files)) {
+            if (QueueReload(key)) {
+                ++queued;
+            }
+        }
+        return queued;
+    }
+
+    bool ResourceManager::QueueReload(ResourceKey key)
+    {
+        auto entry = m_cache.GetEntry(key);
+        if (!entry || !ResourceCache::IsReady(*entry)) return false;
+
+        auto resource = entry->resource.get();
+        if (!resource || !resource->IsReady()) return false;
+
+        std::lock_guard<std::mutex> lock(m_loadingMutex);
+
+        // ̹ ٽ ε ̸      εϵ ǥø 
+        auto inflight = std::find_if(m_reloadRequests.begin(), m_reloadRequests.end(),
+            [key](const auto& request) { return request.second.key == key; });
+        if (inflight != m_reloadRequests.end()) {
+            inflight->second.stale = true;
+            return false;
+        }
+
+        auto copy = resource->CreateReloadCopy();
+        if (!copy) return false;
+
+        const IResource* requester = copy.get();
+        auto id = m_loader->Enqueue(std::move(copy), LoadPriority::Prefetch);
+        if (id == ResourceLoader::InvalidRequest) return false;
+
+        m_reloadRequests[requester] = { id, key, resource };
+        Logger::Instance().Info("ҽ ٽ ε û: {}", resource->GetPath());
+        return true;
+    }
+
+    void ResourceManager::CompleteReload(const ResourceLoader::Completion& completion, const ReloadRequest& request)
+    {
+        auto target = request.target.lock();
+        if (!target) return;  // ε ߿ 
+
+        if (completion.success && target->SwapContents(*completion.resource)) {
+            // 纻      -      
+            m_retiredContents.emplace_back(m_frameCounter, completion.resource);
+
+            TrackResident(request.key, target);
+            RegisterStreaming(target);
+
+            Logger::Instance().Info("ҽ ü Ϸ: {}", target->GetPath());
+            Event::ResourceEvent event(target->GetPath(), Event::ResourceEvent::Type::Reloaded);
+            EventManager::Instance().Publish(event);
+        }
+        else {
+            // ϸ   ״  (ļ ٽ ϸ ٽ õ)
+            Logger::Instance().Error("ҽ ٽ ε ,   : {}", target->GetPath());
+            Event::ResourceEvent event(target->GetPath(), Event::ResourceEvent::Type::Failed, "Reload failed");
+            EventManager::Instance().Publish(event);
+        }
+
+        // ε ߿   ٲ ֽ  ٽ ε
+        if (request.stale) {
+            QueueReload(request.key);
+        }
+    }
+
+    void ResourceManager::ProcessHotReload()
+    {
+        ++m_frameCounter;
+
+        while (!m_retiredContents.empty() &&
+            m_frameCounter - m_retiredContents.front().first >= RetireFrames) {
+            m_retiredContents.front().second->Unload();
+            m_retiredContents.pop_front();
+        }
+
+        if (!m_fileWatcher) return;
+
+        auto changed = m_fileWatcher->PollChanges();
+        if (changed.empty()) return;
+
+        //  ͸  θ ҽ (۾ ͸ ) ȯ
+        for (auto& file : changed) {
+            file = (m_fileWatcher->GetDirectory() / file).lexically_normal().generic_string();
+        }
+        ReloadChangedFiles(changed);
+    }
+
+    size_t ResourceManager::UpdateTextureStreaming(size_t maxUploadsPerFrame)
+    {
+        size_t started = 0;
+
+        for (size_t i = 0; i < m_streamingTextures.size();) {
+            auto texture = m_streamingTextures[i].lock();
+
+            // Ǿų ü  ö ؽó Ͽ 
+            if (!texture || !texture->IsStreaming() || texture->IsFullyResident()) {
+                m_streamingTextures[i] = std::move(m_streamingTextures.back());
+                m_streamingTextures.pop_back();
+                continue;
+            }
+
+            //   ᵵ  ε ݿ  
+            if (texture->UpdateStreaming(started < maxUploadsPerFrame)) {
+                ++started;
+            }
+            ++i;
+        }
+
+        return started;
+    }
+
+    void ResourceManager::SetMemoryBudget(Type type, size_t bytes)
+    {
+        m_memoryBudgets[TypeIndex(type)] = bytes;
+    }
+
+    size_t ResourceManager::GetMemoryBudget(Type type) const
+    {
+        return m_memoryBudgets[TypeIndex(type)];
+    }
+
+    size_t ResourceManager::GetMemoryUsage(Type type) const
+    {
+        return m_memoryUsage[TypeIndex(type)].load(std::memory_order_relaxed);
+    }
+
+    size_t ResourceManager::EvictUnderPressure(std::chrono::microseconds timeSlice)
+    {
+        const auto deadline = std::chrono::steady_clock::now() + timeSlice;
+
+        //  ҽ  ϰ ƹ     (    )
+        size_t evicted = SweepFailed();
+        size_t steps = 0;
+
+        for (size_t type = 0; type < TypeCount; ++type) {
+            auto& list = m_clockLists[type];
+
+            //  Ʈ    ٽ    ŭ 
+            size_t remainingSteps = list.keys.size() * 2;
+            while (m_memoryUsage[type].load(std::memory_order_relaxed) > m_memoryBudgets[type] &&
+                !list.keys.empty() && remainingSteps-- > 0) {
+                if (list.hand >= list.keys.size()) {
+                    list.hand = 0;
+                }
+
+                switch (TryEvict(list.keys[list.hand], true)) {
+                case EvictResult::Evicted:
+                    ++evicted;
+                    [[fallthrough]];
+                case EvictResult::Gone:
+                    list.RemoveAtHand();
+                    break;
+                default:
+                    ++list.hand;
+                    break;
+                }
+
+                // ð Ȯ  ܰ踶  
+                if ((++steps & 15) == 0 && std::chrono::steady_clock::now() >= deadline) {
+                    return evicted;
+                }
+            }
+        }
+
+        return evicted;
+    }
+
+    void ResourceManager::TrackResident(ResourceKey key, const std::shared_ptr<IResource>& resource)
+    {
+        auto entry = m_cache.GetEntry(key);
+        if (!entry || !ResourceCache::IsReady(*entry) || entry->resource.get() != resource) {
+            return;  // ε ߿ 
+        }
+
+        const size_t type = TypeIndex(resource->GetType());
+        const size_t size = resource->GetSize();
+        m_memoryUsage[type].fetch_add(size, std::memory_order_relaxed);
+        m_memoryUsage[type].fetch_sub(entry->accountedSize, std::memory_order_relaxed);
+        entry->accountedSize = size;
+
+        m_clockLists[type].Insert(key);
+
+        // ε  include  ٲ  Ƿ Ź 
+        m_dependencies.SetDependencies(key, resource->GetDependencies());
+    }
+
+    void ResourceManager::TrackFailed(ResourceKey key, const std::shared_ptr<IResource>& resource)
+    {
+        auto entry = m_cache.GetEntry(key);
+        if (!entry || !ResourceCache::IsReady(*entry) || entry->resource.get() != resource) {
+            return;  // ε ߿ 
+        }
+
+        //  ä ĳÿ     ̹Ƿ,   ŵǵ 
+        m_failedList.Insert(key);
+    }
+
+    void ResourceManager::UntrackResident(ResourceKey key, const ResourceCache::Entry& entry, const IResource& resource)
+    {
+        m_memoryUsage[TypeIndex(resource.GetType())].fetch_sub(entry.accountedSize, std::memory_order_relaxed);
+        m_dependencies.Remove(key);
+    }
+
+    ResourceManager::EvictResult ResourceManager::TryEvict(ResourceKey key, bool honorReferenceBit)
+    {
+        auto entry = m_cache.GetEntry(key);
+        if (!entry || !ResourceCache::IsReady(*entry)) {
+            return EvictResult::Gone;
+        }
+
+        // ֱٿ ȸ ҽ  Ʈ  Ѿ
+        if (honorReferenceBit && entry->referenced.exchange(false, std::memory_order_relaxed)) {
+            return EvictResult::Referenced;
+        }
+
+        const auto& resource = entry->resource.get();
+        if (!resource || resource.use_count() > 1) {
+            return EvictResult::InUse;
+        }
+
+        // Կ    ٽ Ȯ -   ȸ 尡  ǵ
+        if (!m_cache.CompareExchange(key, entry, nullptr)) {
+            return EvictResult::Gone;
+        }
+        if (entry.use_count() > 1 || resource.use_count() > 1) {
+            m_cache.CompareExchange(key, nullptr, entry);
+            return EvictResult::InUse;
+        }
+
+        Logger::Instance().Info("̻ ҽ : {} ({} bytes)", resource->GetPath(), entry->accountedSize);
+        UntrackResident(key, *entry, *resource);
+        resource->Unload();
+        return EvictResult::Evicted;
+    }
+
+    std::filesystem::path ResourceManager::GetManifestPath(const std::string& levelName) const
+    {
+        return std::filesystem::path(m_manifestDirectory) / (levelName + ".preload");
+    }
+
+    size_t ResourceManager::BeginLevel(const std::string& name)
+    {
+        EndLevel();
+
+        auto level = std::make_unique<LevelSession>();
+        level->name = name;
+        level->start = std::chrono::steady_clock::now();
+
+        //  ǿ ó û  û - δ  켱 ȿ û  Ŵ
+        PreloadManifest previous;
+        if (previous.Load(GetManifestPath(name))) {
+            std::array<size_t, TypeCount> planned{};
+            s_preloading = level.get();
+            for (const auto& entry : previous.GetEntries()) {
+                //  Ѱ ̸ ø ü ε常 ݺϹǷ ϵ ũ ߶
+                const size_t type = TypeIndex(entry.type);
+                if (planned[type] + entry.size > m_memoryBudgets[type]) {
+                    ++level->stats.skipped;
+                    continue;
+                }
+
+                const LoadPriority priority = entry.firstRequestMs > LatePreloadMs
+                    ? LoadPriority::Background : LoadPriority::Prefetch;
+                ResourceKey key = 0;
+                auto resource = RequestPreload(entry, priority, key);
+                if (!resource) {
+                    ++level->stats.skipped;
+                    continue;
+                }
+                planned[type] += entry.size;
+                level->preloaded.try_emplace(key, PreloadedResource{ std::move(resource), priority });
+            }
+            s_preloading = nullptr;
+        }
+        level->stats.preloaded = level->preloaded.size();
+
+        Logger::Instance().Info(" : {} - ε {} û (ǳʶ {})",
+            name, level->stats.preloaded, level->stats.skipped);
+
+        const size_t preloaded = level->stats.preloaded;
+        {
+            std::lock_guard<std::mutex> lock(m_levelMutex);
+            m_level = std::move(level);
+        }
+        m_levelRecording.store(true, std::memory_order_relaxed);
+        return preloaded;
+    }
+
+    void ResourceManager::EndLevel()
+    {
+        m_levelRecording.store(false, std::memory_order_relaxed);
+
+        std::unique_ptr<LevelSession> level;
+        {
+            std::lock_guard<std::mutex> lock(m_levelMutex);
+            level = std::move(m_level);
+        }
+        if (!level) return;
+
+        //   ũ⸦   ε  꿡 
+        auto& entries = level->manifest.GetEntries();
+        for (size_t i = 0; i < entries.size(); ++i) {
+            auto cacheEntry = m_cache.GetEntry(level->recordedKeys[i]);
+            if (cacheEntry && ResourceCache::IsReady(*cacheEntry)) {
+                const auto& resource = cacheEntry->resource.get();
+                if (resource && resource->IsReady()) {
+                    entries[i].size = resource->GetSize();
+                }
+            }
+        }
+        level->manifest.SortByRequestTime();
+
+        level->stats.unused = level->preloaded.size();
+        level->stats.recorded = entries.size();
+        m_lastPreloadStats = level->stats;
+
+        // ƹ͵ û  ª     ʵ 
+        const auto path = GetManifestPath(level->name);
+        if (!level->manifest.IsEmpty() && !level->manifest.Save(path)) {
+            Logger::Instance().Error("ε Ŵ佺Ʈ  : {}", path.generic_string());
+        }
+
+        const auto& stats = level->stats;
+        Logger::Instance().Info(" : {} - ε {}   {} (û  غ {}), ̻ {},  {}",
+            level->name, stats.preloaded, stats.used, stats.readyOnRequest, stats.unused, stats.recorded);
+    }
+
+    void ResourceManager::RecordRequest(ResourceKey key, const std::shared_ptr<IResource>& resource,
+        LoadPriority priority, std::optional<PreloadManifest::Entry> description)
+    {
+        bool raise = false;
+        {
+            std::lock_guard<std::mutex> lock(m_levelMutex);
+            if (!m_level) return;
+            auto& level = *m_level;
+
+            const auto elapsedMs = static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::milliseconds>(
+                std::chrono::steady_clock::now() - level.start).count());
+
+            // ̸ û  ҽ -  û   Ƿ   ʿ 
+            auto use = [&](ResourceKey usedKey, const IResource* requested) {
+                auto it = level.preloaded.find(usedKey);
+                if (it == level.preloaded.end()) return;
+
+                ++level.stats.used;
+                if ((requested ? requested : it->second.resource.get())->IsReady()) {
+                    ++level.stats.readyOnRequest;
+                }
+                else if (requested) {
+                    raise = priority < it->second.priority;
+                }
+                level.preloaded.erase(it);
+            };
+            auto record = [&](ResourceKey recordedKey, PreloadManifest::Entry&& entry) {
+                if (level.recorded.insert(recordedKey).second) {
+                    entry.firstRequestMs = elapsedMs;
+                    level.manifest.Add(std::move(entry));
+                    level.recordedKeys.push_back(recordedKey);
+                }
+            };
+
+            use(key, resource.get());
+            if (description) {
+                record(key, std::move(*description));
+            }
+
+            // ε尡   ҽ   û Ƿ ΰ Բ / ó
+            std::vector<ResourceKey> owners{ key };
+            while (!owners.empty()) {
+                auto it = level.dependencies.find(owners.back());
+                owners.pop_back();
+                if (it == level.dependencies.end()) continue;
+
+                auto dependencies = std::move(it->second);
+                level.dependencies.erase(it);
+                for (auto& [dependencyKey, entry] : dependencies) {
+                    use(dependencyKey, nullptr);
+                    record(dependencyKey, std::move(entry));
+                    owners.push_back(dependencyKey);
+                }
+            }
+        }
+
+        //   ̸  û 켱 ø
+        if (raise) {
+            SetLoadPriority(resource, priority);
+        }
+    }
+
+    std::shared_ptr<IResource> ResourceManager::RequestPreload(const PreloadManifest::Entry& entry,
+        LoadPriority priority, ResourceKey& key)
+    {
+        const auto& path = entry.path;
+        const auto& args = entry.args;
+
+        switch (entry.type) {
+        case Type::Texture: {
+            const auto mode = !args.empty() && args[0] == "streaming"
+                ? TextureResource::LoadMode::Streaming : TextureResource::LoadMode::Full;
+            key = CreateResourceKey<TextureResource>(path, mode);
+            return RequestResource<TextureResource>(priority, path, mode);
+        }
+        case Type::Model:
+            key = CreateResourceKey<ModelResource>(path);
+            return RequestResource<ModelResource>(priority, path);
+        case Type::Sound:
+            key = CreateResourceKey<SoundResource>(path);
+            return RequestResource<SoundResource>(priority, path);
+        case Type::Material:
+            key = CreateResourceKey<MaterialResource>(path);
+            return RequestResource<MaterialResource>(priority, path);
+        case Type::Shader: {
+            // , Ʈ [, , Ű...]
+            int typeValue = 0;
+            if (args.size() < 2 || args.size() > 3 + ShaderKeywordSet::MaxKeywords ||
+                std::from_chars(args[0].data(), args[0].data() + args[0].size(), typeValue).ec != std::errc() ||
+                typeValue < 0 || typeValue > static_cast<int>(ShaderResource::ShaderType::Hull)) {
+                break;
+            }
+            const auto type = static_cast<ShaderResource::ShaderType>(typeValue);
+            const std::string& entryPoint = args[1];
+
+            if (args.size() == 2) {
+                key = CreateResourceKey<ShaderResource>(path, type, entryPoint);
+                return RequestResource<ShaderResource>(priority, path, type, entryPoint);
+            }
+
+            ShaderVariantKey variant = 0;
+            if (std::from_chars(args[2].data(), args[2].data() + args[2].size(), variant, 16).ec != std::errc()) {
+                break;
+            }
+            ShaderKeywordSet keywords;
+            for (size_t i = 3; i < args.size(); ++i) {
+                keywords.Declare(args[i]);
             }
+            key = CreateResourceKey<ShaderResource>(path, type, entryPoint, keywords, variant);
+            return RequestResource<ShaderResource>(priority, path, type, entryPoint, keywords, variant);
         }
+        default:
+            break;
+        }
+
+        Logger::Instance().Warning("ε ׸ ؼ  : {} ({})", path, PreloadManifest::GetTypeName(entry.type));
+        return nullptr;
+    }
+
+    PreloadManifest::Entry ResourceManager::DescribeShader(const std::string& path,
+        ShaderResource::ShaderType type, const std::string& entryPoint)
+    {
+        return { Type::Shader, path, { std::to_string(static_cast<int>(type)), entryPoint } };
+    }
+
+    PreloadManifest::Entry ResourceManager::DescribeShader(const std::string& path,
+        ShaderResource::ShaderType type, const std::string& entryPoint,
+        const ShaderKeywordSet& keywords, ShaderVariantKey variant)
+    {
+        // Ű   ܾ  Ʈ ٽ 
+        auto entry = DescribeShader(path, type, entryPoint);
+        entry.args.push_back(std::format("{:x}", keywords.Sanitize(variant)));
+        for (const auto& name : keywords.GetNames()) {
+            entry.args.push_back(name);
+        }
+        return entry;
+    }
+
+    PreloadManifest::Entry ResourceManager::DescribeTexture(const std::string& path, TextureResource::LoadMode mode)
+    {
+        return { Type::Texture, path, { mode == TextureResource::LoadMode::Streaming ? "streaming" : "full" } };
+    }
+
+    void ResourceManager::ClockList::Insert(ResourceKey key)
+    {
+        if (members.insert(key).second) {
+            keys.push_back(key);
+        }
+    }
+
+    void ResourceManager::ClockList::RemoveAtHand()
+    {
+        //  ߿ Ƿ  ҿ ü  
+        members.erase(keys[hand]);
+        keys[hand] = keys.back();
+        keys.pop_back();
     }
 }
\ No newline at end of file
@@ -4,6 +4,15 @@
 #include "EventManager.h"
 #include "ShaderResource.h"
 #include "TextureResource.h"
+#include "ModelResource.h"
+#include "MaterialResource.h"
+#include "SoundResource.h"
+#include "ResourceLoader.h"
+#include "ResourceCache.h"
+#include "ResourceDependencyGraph.h"
+#include "FileWatcher.h"
+#include "AsyncFileIO.h"
+#include "PreloadManifest.h"
 
 namespace Resource
 {
@@ -14,30 +23,63 @@ namespace Resource
         // ҽ û - ĳõ ҽ  ȯ,   
         template<typename T, typename... Args>
         std::shared_ptr<T> RequestResource(const std::string& path, Args&&... args) {
+            return RequestResource<T>(LoadPriority::VisibleNow, path, std::forward<Args>(args)...);
+        }
+
+        // 켱  ҽ û
+        template<typename T, typename... Args>
+        std::shared_ptr<T> RequestResource(LoadPriority priority, const std::string& path, Args&&... args) {
             static_assert(std::is_base_of<IResource, T>::value,
                 "T must inherit from IResource");
 
             // ҽ ŸԺ  Ű 
-            std::string resourceKey = CreateResourceKey<T>(path, args...);
+            const ResourceKey resourceKey = CreateResourceKey<T>(path, args...);
 
-            std::shared_lock<std::shared_mutex> lock(m_mutex);
-            auto it = m_resources.find(resourceKey);
-            if (it != m_resources.end()) {
-                if (auto resource = std::dynamic_pointer_cast<T>(it->second)) {
-                    return resource;
-                }
-                Logger::Instance().Error("ҽ Ÿ ġ: {}", resourceKey);
+            //   ̸ ڰ ڷ Ű  ٽ û  ִ ·  
+            const bool recording = m_levelRecording.load(std::memory_order_relaxed) && !s_preloading;
+            // ε尡 ó  ҽ  ҽ   û Ƿ ο  
+            const bool preloadDependency = s_preloading && s_dependencyOwner != 0;
+            std::optional<PreloadManifest::Entry> description;
+            if (recording || preloadDependency) {
+                description = DescribeRequest<T>(path, args...);
+            }
+
+            bool created = false;
+            auto resource = m_cache.GetOrCreate(resourceKey, [&]() -> std::shared_ptr<IResource> {
+                auto fresh = std::make_shared<T>(path, std::forward<Args>(args)...);
+                // ĳ÷ Ǳ  ε û  - Enqueue   ҽ ϴ ٸ û
+                // (: ε  ͸ Load) з  ʰ ٸ 
+                m_loader->Reserve(fresh.get());
+                return fresh;
+                }, created);
+
+            auto typedResource = std::dynamic_pointer_cast<T>(resource);
+            if (!typedResource) {
+                Logger::Instance().Error("ҽ Ÿ ġ: {} ({:016x})", path, resourceKey);
                 return nullptr;
             }
-            lock.unlock();
+            IFDEBUG(
+                if (resource->GetPath() != path) {
+                    Logger::Instance().Error("ҽ Ű 浹: {} / {}", path, resource->GetPath());
+                }
+            );
 
-            std::unique_lock<std::shared_mutex> writeLock(m_mutex);
-            auto resource = std::make_shared<T>(path, std::forward<Args>(args)...);
-            m_resources[resourceKey] = resource;
+            if (recording) {
+                RecordRequest(resourceKey, resource, priority, std::move(description));
+            }
+            else if (preloadDependency && description) {
+                s_preloading->dependencies[s_dependencyOwner].emplace_back(resourceKey, std::move(*description));
+            }
 
-            QueueResourceLoading(resource);
+            if (created) {
+                //  ҽ  û ΰ δ  ڿ  ҽ ٸϰ 
+                const ResourceKey owner = std::exchange(s_dependencyOwner, resourceKey);
+                auto dependencies = resource->RequestLoadDependencies();
+                s_dependencyOwner = owner;
+                QueueResourceLoading(resourceKey, resource, priority, dependencies);
+            }
 
-            return resource;
+            return typedResource;
         }
 
         // ҽ  û
@@ -55,49 +97,304 @@ namespace Resource
         // ҽ   ()
         void PrintResourceStats() const;
 
+        //  ۵  ε û  - ҵ ҽ ĳÿ Ƿ ٽ ûϸ  ε
+        bool CancelLoading(const std::shared_ptr<IResource>& resource);
+
+        //  ۵  ε û 켱 
+        bool SetLoadPriority(const std::shared_ptr<IResource>& resource, LoadPriority priority);
+
+        // ε û   ٸ (ʱȭó  ٷ ʿ ). Ready true
+        // ε Ŀ ñ ҽ Load  θ  ε尡  忡 ġǷ  ̰ 
+        // Ϸ ̺Ʈ   ״  ProcessLoadingQueue ó
+        bool WaitForLoading(const std::shared_ptr<IResource>& resource);
+
+        // Ϸ ε  ó ( 忡   ȣ)
+        void ProcessLoadingQueue();
+
+        // ŸԺ ޸  (Ʈ)
+        void SetMemoryBudget(Type type, size_t bytes);
+        size_t GetMemoryBudget(Type type) const;
+
+        // ŸԺ  ޸ 뷮 (ε Ϸ ҽ )
+        size_t GetMemoryUsage(Type type) const;
+
+        //   Ÿ ҽ CLOCK   
+        // timeSlice ȿ ϹǷ   ȣ .  ҽ  ȯ
+        size_t EvictUnderPressure(std::chrono::microseconds timeSlice);
+
+        // Ʈ ؽó  ε  ( 忡   ȣ)
+        // Ӵ  ϴ ε带 maxUploadsPerFrame .  ε  ȯ
+        size_t UpdateTextureStreaming(size_t maxUploadsPerFrame);
+
+        //  ε - directory Ʒ  ٲ  Ͽ ϴ ҽ
+        // ε Ŀ ٽ ε   忡  ü
+        bool EnableHotReload(const std::string& directory);
+        void DisableHotReload();
+
+        // ٲ Ͽ ϴ ҽ ε û (   ȣ ). û  ȯ
+        size_t ReloadChangedFiles(std::span<const std::string> files);
+
+        //   ݿ ü    ( 忡   ȣ)
+        void ProcessHotReload();
+
+        const ResourceDependencyGraph& GetDependencyGraph() const { return m_dependencies; }
+
+        //  б - ҽ Load ȿ ŷ б(Read) ġ (Submit) 
+        AsyncFileIO& GetFileIO() { return *m_fileIO; }
+
+        //      񵿱 . ݹ ProcessLoadingQueue   ȣǰ
+        // ʹ ݹ  (Ű ִ  IO  )
+        // ݹ θ Ȯ  , бⰡ   Ҹ (  ų ⿡   success = false)
+        // IO б⸦ û   ȯ (Ű ãҰų     )
+        using FileReadCallback = std::function<void(const std::string& path, std::vector<uint8_t>&& data, bool success)>;
+        size_t ReadFilesAsync(std::span<const std::string> paths, FileReadCallback callback);
+
+        //  ε Ŵ佺Ʈ
+        // - BeginLevel:  ǿ    ҽ ó û  ̸ ûϰ   
+        //   ϵ ũ ŸԺ  Ѵ ŭ ǳʶٰ, ʰ ûƴ ҽ Background û
+        // - EndLevel: ̹  û  Ŵ佺Ʈ  (̸ û   ҽ )
+        // ̸ û ҽ  ûϰų    ü ʵ  
+        // ε尡 ó  ҽ  ҽ(͸ ؽó/̴ )   û Ƿ
+        //  ҽ û  Բ / ó
+        struct PreloadStats {
+            size_t preloaded = 0;           // Ŵ佺Ʈ ̸ û 
+            size_t skipped = 0;             //  ʰ ؼ  ǳʶ 
+            size_t used = 0;                //     û 
+            size_t readyOnRequest = 0;      // û  ̹ ε尡  ִ 
+            size_t unused = 0;              //    û  
+            size_t recorded = 0;            // ̹ ǿ  
+        };
+
+        // ̸ û ҽ  ȯ (   ̸  )
+        size_t BeginLevel(const std::string& name);
+        void EndLevel();
+
+        void SetManifestDirectory(const std::string& directory) { m_manifestDirectory = directory; }
+        const std::string& GetManifestDirectory() const { return m_manifestDirectory; }
+        std::filesystem::path GetManifestPath(const std::string& levelName) const;
+
+        //    ε 
+        const PreloadStats& GetPreloadStats() const { return m_lastPreloadStats; }
+
+        // ̺ ʰ ó û ҽ  ҽ  ʵ Background ̸ û
+        static constexpr uint32_t LatePreloadMs = 10000;
+
     private:
-        ResourceManager() = default;
-        ~ResourceManager() { ReleaseAllResources(); }
+        ResourceManager();
+        ~ResourceManager();
 
         ResourceManager(const ResourceManager&) = delete;
         ResourceManager& operator=(const ResourceManager&) = delete;
 
-        // 񵿱 ҽ ε   ޼
-        void QueueResourceLoading(std::shared_ptr<IResource> resource);
-        void ProcessLoadingQueue();
+        // 񵿱 ҽ ε   ޼ (dependencies    ε)
+        void QueueResourceLoading(ResourceKey key, std::shared_ptr<IResource> resource, LoadPriority priority,
+            std::span<const std::shared_ptr<IResource>> dependencies = {});
+
+        // ε  ҽ ޸  CLOCK Ͽ 
+        void TrackResident(ResourceKey key, const std::shared_ptr<IResource>& resource);
+
+        // ε  ҽ  Ͽ  (꿡 ݿ )
+        void TrackFailed(ResourceKey key, const std::shared_ptr<IResource>& resource);
+
+        // ĳÿ  Ʈ  뷮   
+        void UntrackResident(ResourceKey key, const ResourceCache::Entry& entry, const IResource& resource);
+
+        //  ü  ö  ؽó Ʈ Ͽ 
+        void RegisterStreaming(const std::shared_ptr<IResource>& resource);
+
+        // ٽ ε 纻   ü
+        struct ReloadRequest {
+            ResourceLoader::RequestId id;
+            ResourceKey key;
+            std::weak_ptr<IResource> target;
+            bool stale = false;     // ε ߿   ٲ - ü     ε
+        };
+        bool QueueReload(ResourceKey key);
+        void CompleteReload(const ResourceLoader::Completion& completion, const ReloadRequest& request);
+
+        //   - ó û ҽ Ŵ佺Ʈ ߰ϰ, ̸ û  ҽ    
+        void RecordRequest(ResourceKey key, const std::shared_ptr<IResource>& resource, LoadPriority priority,
+            std::optional<PreloadManifest::Entry> description);
 
-        // ҽ 
-        std::unordered_map<std::string, std::shared_ptr<IResource>> m_resources;
+        // Ŵ佺Ʈ ׸ ٽ û (ؼ   nullptr)
+        std::shared_ptr<IResource> RequestPreload(const PreloadManifest::Entry& entry, LoadPriority priority, ResourceKey& key);
 
-        // ε ť
-        struct LoadingTask {
+        // CLOCK ü 
+        enum class EvictResult {
+            Evicted,        // ŵ
+            Referenced,     // ֱ  ( Ʈ  ȸ    )
+            InUse,          // ܺο  
+            Gone            // ̹ ĳÿ 
+        };
+        EvictResult TryEvict(ResourceKey key, bool honorReferenceBit);
+
+        // ŸԺ CLOCK  (  )
+        struct ClockList {
+            std::vector<ResourceKey> keys;
+            std::unordered_set<ResourceKey> members;
+            size_t hand = 0;
+
+            void Insert(ResourceKey key);
+            void RemoveAtHand();
+        };
+
+        //  ü  ܺ   ҽ  ( Ʈ ).   ȯ
+        size_t SweepUnused(ClockList& list);
+
+        //  Ͽ ܺ   ҽ .   ȯ
+        size_t SweepFailed();
+
+        static constexpr size_t TypeCount = static_cast<size_t>(Type::Count);
+        static size_t TypeIndex(Type type) { return static_cast<size_t>(type); }
+
+        // ҽ  (ؽ Ű  ü ĳ)
+        ResourceCache m_cache;
+
+        // ε Ŀ Ǯ   û
+        struct LoadingRequest {
+            ResourceLoader::RequestId id;
+            ResourceKey key;
+        };
+        std::unique_ptr<ResourceLoader> m_loader;
+        std::unordered_map<const IResource*, LoadingRequest> m_loadingRequests;
+        std::unordered_map<const IResource*, ReloadRequest> m_reloadRequests;   // 纻 -> 
+
+        // 񵿱  б   ѱ Ϸ 
+        struct FileReadCompletion {
+            std::string path;
+            std::vector<uint8_t> data;
+            bool success = false;
+            std::shared_ptr<const FileReadCallback> callback;
+        };
+        std::unique_ptr<AsyncFileIO> m_fileIO;
+        tbb::concurrent_queue<FileReadCompletion> m_fileReads;
+
+        // ޸  ü 
+        std::array<size_t, TypeCount> m_memoryBudgets;
+        std::array<std::atomic<size_t>, TypeCount> m_memoryUsage{};
+        std::array<ClockList, TypeCount> m_clockLists;
+
+        // ε忡  ҽ - ũⰡ 0̶ δ з Ƿ ܺ    
+        ClockList m_failedList;
+
+        //  ü  ö  Ʈ ؽó (  )
+        std::vector<std::weak_ptr<TextureResource>> m_streamingTextures;
+
+        //  ε (  ,  ׷ ü )
+        std::unique_ptr<FileWatcher> m_fileWatcher;
+        ResourceDependencyGraph m_dependencies;
+
+        // ü   -       
+        static constexpr uint64_t RetireFrames = FRAME_BUFFER_COUNT + 1;
+        std::deque<std::pair<uint64_t, std::shared_ptr<IResource>>> m_retiredContents;
+        uint64_t m_frameCounter = 0;
+
+        //     (RequestResource  忡 ҸǷ m_levelMutex ȣ)
+        struct PreloadedResource {
             std::shared_ptr<IResource> resource;
-            std::future<bool> loadingFuture;
+            LoadPriority priority;
         };
-        std::queue<LoadingTask> m_loadingQueue;
+        struct LevelSession {
+            std::string name;
+            std::chrono::steady_clock::time_point start;
+            PreloadManifest manifest;                       // ̹ ǿ ó û 
+            std::vector<ResourceKey> recordedKeys;          // manifest ׸  
+            std::unordered_set<ResourceKey> recorded;
+            std::unordered_map<ResourceKey, PreloadedResource> preloaded;   //  û  ε
+            // ε尡  ҽ ->  RequestLoadDependencies û ҽ ( ϵ  Բ )
+            std::unordered_map<ResourceKey, std::vector<std::pair<ResourceKey, PreloadManifest::Entry>>> dependencies;
+            PreloadStats stats;
+        };
+        std::unique_ptr<LevelSession> m_level;
+        std::mutex m_levelMutex;
+        std::atomic<bool> m_levelRecording{ false };
+        std::string m_manifestDirectory = "PreloadManifest";
+        PreloadStats m_lastPreloadStats;
+
+        // Ŵ佺Ʈ ϴ  û   (  , ƴϸ nullptr)
+        static inline thread_local LevelSession* s_preloading = nullptr;
+
+        //  忡 RequestLoadDependencies   ҽ ( 0)
+        static inline thread_local ResourceKey s_dependencyOwner = 0;
+
+        // Ŵ佺Ʈ  û  - ٽ û  ִ ҽ ŸԸ (  )
+        template<typename T, typename... Args>
+        static std::optional<PreloadManifest::Entry> DescribeRequest(const std::string& path, const Args&... args) {
+            if constexpr (std::is_same_v<T, ShaderResource>) {
+                return DescribeShader(path, args...);
+            }
+            else if constexpr (std::is_same_v<T, TextureResource>) {
+                return DescribeTexture(path, args...);
+            }
+            else if constexpr ((std::is_same_v<T, ModelResource> || std::is_same_v<T, SoundResource> ||
+                std::is_same_v<T, MaterialResource>) && sizeof...(Args) == 0) {
+                return PreloadManifest::Entry{ T::ResourceType, path };
+            }
+            else {
+                return std::nullopt;
+            }
+        }
+
+        static PreloadManifest::Entry DescribeShader(const std::string& path,
+            ShaderResource::ShaderType type, const std::string& entryPoint);
+        static PreloadManifest::Entry DescribeShader(const std::string& path,
+            ShaderResource::ShaderType type, const std::string& entryPoint,
+            const ShaderKeywordSet& keywords, ShaderVariantKey variant);
+        static PreloadManifest::Entry DescribeTexture(const std::string& path,
+            TextureResource::LoadMode mode = TextureResource::LoadMode::Full);
 
 		// ̴ ҽ Ű 
         template<typename T>
-        std::string CreateResourceKey(const std::string& path,
+        static ResourceKey CreateResourceKey(const std::string& path,
             ShaderResource::ShaderType type, const std::string& entryPoint) {
-            if constexpr (std::is_same_v<T, ShaderResource>) {
-                return std::format("{}#{}#{}", path,
-                    static_cast<int>(type), entryPoint);
+            return ResourceKeyBuilder()
+                .Add(T::ResourceType)
+                .Add(path)
+                .Add(type)
+                .Add(entryPoint)
+                .Get();
+        }
+
+		// ̴  Ű  - Ű ϰ  Ʈũ Բ ݿ
+		template<typename T>
+        static ResourceKey CreateResourceKey(const std::string& path,
+            ShaderResource::ShaderType type, const std::string& entryPoint,
+            const ShaderKeywordSet& keywords, ShaderVariantKey variant) {
+            ResourceKeyBuilder builder;
+            builder.Add(T::ResourceType)
+                .Add(path)
+                .Add(type)
+                .Add(entryPoint)
+                .Add(keywords.Sanitize(variant));
+            for (const auto& name : keywords.GetNames()) {
+                builder.Add(name);
             }
-            return path;
+            return builder.Get();
         }
 
-		// ؽó ҽ Ű 
+		// ؽó ҽ Ű  - ü ε θ ĺ ( Ű )
 		template<typename T>
-        std::string CreateResourceKey(const std::string& path) {
-            if constexpr (std::is_same_v<T, TextureResource>) {
-                return path;
+        static ResourceKey CreateResourceKey(const std::string& path, TextureResource::LoadMode mode) {
+            if (mode == TextureResource::LoadMode::Full) {
+                return CreateResourceKey<T>(path);
             }
-			return path;
+            return ResourceKeyBuilder()
+                .Add(T::ResourceType)
+                .Add(path)
+                .Add(mode)
+                .Get();
+        }
+
+		// θ ĺǴ ҽ(ؽó ) Ű 
+		template<typename T>
+        static ResourceKey CreateResourceKey(const std::string& path) {
+            return ResourceKeyBuilder()
+                .Add(T::ResourceType)
+                .Add(path)
+                .Get();
         }
 
-        // ȭ  ؽ
-        mutable std::shared_mutex m_mutex;
+        // ε û   ؽ
         std::mutex m_loadingMutex;
 
         // ޸   Ҵ
@@ -110,6 +407,11 @@ namespace Resource
         return ResourceManager::Instance().RequestResource<T>(path, std::forward<Args>(args)...);
     }
 
+    template<typename T, typename... Args>
+    inline std::shared_ptr<T> RequestResource(LoadPriority priority, const std::string& path, Args&&... args) {
+        return ResourceManager::Instance().RequestResource<T>(priority, path, std::forward<Args>(args)...);
+    }
+
     inline void ReleaseResource(const std::string& path) {
         ResourceManager::Instance().ReleaseResource(path);
     }
@@ -0,0 +1,1055 @@
+#include "pch.h"
+#include "ResourceTools.h"
+#include "ResourceManager.h"
+#include "MaterialResource.h"
+#include "ShaderCache.h"
+#include "AudioTools.h"
+#include "Logger.h"
+
+namespace Resource
+{
+    namespace
+    {
+        using Clock = std::chrono::steady_clock;
+
+        struct LoadGraphNode {
+            std::string name;
+            double loadMs = 0.0;
+            std::vector<size_t> dependencies;   // ׻ ڱ⺸  ε ( )
+            bool fail = false;
+        };
+
+        struct LoadGraph {
+            std::vector<LoadGraphNode> nodes;
+            std::unordered_map<std::string, size_t> indices;
+            std::unique_ptr<std::atomic<uint32_t>[]> loadCounts;
+            std::atomic<size_t> orderViolations{ 0 };
+
+            void ResetCounts() {
+                for (size_t i = 0; i < nodes.size(); ++i) {
+                    loadCounts[i].store(0);
+                }
+            }
+        };
+
+        LoadGraph* s_graph = nullptr;
+
+        // ġũ ҽ -  ð  ڵ 䳻 , ׶ Է  Ready Ȯ
+        // δ "< λ>/< ̸>"  (ึ ٸ ĳ Ű)
+        class SyntheticResource : public IResource {
+        public:
+            static constexpr Type ResourceType = Type::Material;
+
+            explicit SyntheticResource(const std::string& path)
+                : IResource(ResourceType, path, path.substr(path.rfind('/') + 1))
+                , m_index(s_graph->indices.at(GetName()))
+                , m_prefix(path.substr(0, path.rfind('/') + 1)) {
+            }
+
+            std::vector<std::shared_ptr<IResource>> RequestLoadDependencies() override {
+                m_inputs.clear();
+                for (size_t dependency : s_graph->nodes[m_index].dependencies) {
+                    m_inputs.push_back(ResourceManager::Instance().RequestResource<SyntheticResource>(
+                        LoadPriority::Prefetch, m_prefix + s_graph->nodes[dependency].name));
+                }
+                return m_inputs;
+            }
+
+            // δ     (   Է Ȯθ)
+            void SetInputs(std::vector<std::shared_ptr<IResource>> inputs) { m_inputs = std::move(inputs); }
+
+            bool Load() override {
+                SetState(State::Loading);
+                s_graph->loadCounts[m_index].fetch_add(1);
+
+                for (const auto& input : m_inputs) {
+                    if (!input->IsReady()) {
+                        s_graph->orderViolations.fetch_add(1);
+                    }
+                }
+
+                const auto& node = s_graph->nodes[m_index];
+                const auto deadline = Clock::now() + std::chrono::duration<double, std::milli>(node.loadMs);
+                while (Clock::now() < deadline) {
+                    std::this_thread::yield();
+                }
+
+                SetState(node.fail ? State::Failed : State::Ready);
+                return !node.fail;
+            }
+
+            void Unload() override {
+                SetState(State::Unloaded);
+            }
+
+        private:
+            size_t m_index;
+            std::string m_prefix;
+            std::vector<std::shared_ptr<IResource>> m_inputs;
+        };
+
+        // ̴/ؽó -> ͸ ->  -> 
+        void BuildLevelGraph(LoadGraph& graph, size_t textureCount) {
+            std::mt19937 rng(7);
+            auto uniform = [&](double low, double high) { return std::uniform_real_distribution<double>(low, high)(rng); };
+            auto pick = [&](size_t first, size_t count) { return first + std::uniform_int_distribution<size_t>(0, count - 1)(rng); };
+
+            auto add = [&](std::string name, double loadMs, std::vector<size_t> dependencies) {
+                std::sort(dependencies.begin(), dependencies.end());
+                dependencies.erase(std::unique(dependencies.begin(), dependencies.end()), dependencies.end());
+                graph.indices[name] = graph.nodes.size();
+                graph.nodes.push_back({ std::move(name), loadMs, std::move(dependencies) });
+            };
+
+            const size_t shaderCount = 6;
+            const size_t materialCount = std::max<size_t>(1, textureCount / 2);
+            const size_t modelCount = std::max<size_t>(1, textureCount / 4);
+
+            const size_t firstShader = graph.nodes.size();
+            for (size_t i = 0; i < shaderCount; ++i) {
+                add(std::format("shader_{}", i), uniform(6.0, 10.0), {});
+            }
+
+            // ؽó ũ ̰ Ŀ     ɸ
+            const size_t firstTexture = graph.nodes.size();
+            for (size_t i = 0; i < textureCount; ++i) {
+                add(std::format("texture_{}", i), (i % 8 == 7) ? uniform(30.0, 40.0) : uniform(4.0, 16.0), {});
+            }
+
+            const size_t firstMaterial = graph.nodes.size();
+            for (size_t i = 0; i < materialCount; ++i) {
+                add(std::format("material_{}", i), uniform(1.0, 3.0), {
+                    pick(firstShader, shaderCount), pick(firstShader, shaderCount),
+                    pick(firstTexture, textureCount), pick(firstTexture, textureCount), pick(firstTexture, textureCount) });
+            }
+
+            const size_t firstModel = graph.nodes.size();
+            for (size_t i = 0; i < modelCount; ++i) {
+                add(std::format("model_{}", i), uniform(10.0, 20.0), {
+                    pick(firstMaterial, materialCount), pick(firstMaterial, materialCount) });
+            }
+
+            std::vector<size_t> models(modelCount);
+            std::iota(models.begin(), models.end(), firstModel);
+            add("level", 1.0, std::move(models));
+
+            graph.loadCounts = std::make_unique<std::atomic<uint32_t>[]>(graph.nodes.size());
+        }
+
+        std::vector<std::shared_ptr<SyntheticResource>> CreateDirect(const LoadGraph& graph, const std::string& prefix) {
+            std::vector<std::shared_ptr<SyntheticResource>> resources;
+            resources.reserve(graph.nodes.size());
+            for (const auto& node : graph.nodes) {
+                auto resource = std::make_shared<SyntheticResource>(prefix + node.name);
+                std::vector<std::shared_ptr<IResource>> inputs;
+                for (size_t dependency : node.dependencies) {
+                    inputs.push_back(resources[dependency]);
+                }
+                resource->SetInputs(std::move(inputs));
+                resources.push_back(std::move(resource));
+            }
+            return resources;
+        }
+
+        //  尡    ó Ϸ ó (  ٸ   ε   )
+        void WaitForGraph(const LoadGraph& graph, const std::string& prefix,
+            std::vector<std::shared_ptr<SyntheticResource>>& resources) {
+            auto& manager = ResourceManager::Instance();
+            resources.clear();
+            for (const auto& node : graph.nodes) {
+                resources.push_back(manager.RequestResource<SyntheticResource>(LoadPriority::Prefetch, prefix + node.name));
+            }
+
+            auto finished = [&]() {
+                return std::all_of(resources.begin(), resources.end(),
+                    [](const auto& resource) { return resource->IsReady() || resource->HasFailed(); });
+            };
+            while (!finished()) {
+                manager.ProcessLoadingQueue();
+                std::this_thread::yield();
+            }
+            manager.ProcessLoadingQueue();
+        }
+
+        void ReleaseGraph(const LoadGraph& graph, const std::string& prefix) {
+            for (const auto& node : graph.nodes) {
+                ResourceManager::Instance().ReleaseResource(prefix + node.name);
+            }
+        }
+
+        // ̴ ĳ  Ϸ - ޸ Ϸ #include "̸"  ϰ ȣ  
+        // Ʈڵ  + Ʈ + ũ +  ҽ Է  ׻ 
+        class CountingShaderCompiler : public IShaderCompiler {
+        public:
+            explicit CountingShaderCompiler(std::string version) : m_version(std::move(version)) {}
+
+            std::unordered_map<std::string, std::string> files;
+            std::atomic<size_t> compileCount{ 0 };
+
+            std::string GetVersion() const override { return m_version; }
+
+            bool Preprocess(const ShaderCompileRequest& request, PreprocessedShader& result, std::string& errors) override {
+                auto it = files.find(request.path);
+                if (it == files.end()) {
+                    errors = " : " + request.path;
+                    return false;
+                }
+
+                result = {};
+                std::istringstream lines(it->second);
+                std::string line;
+                while (std::getline(lines, line)) {
+                    constexpr std::string_view Include = "#include \"";
+                    if (line.starts_with(Include) && line.size() > Include.size() + 1) {
+                        const std::string name = line.substr(Include.size(), line.size() - Include.size() - 1);
+                        auto include = files.find(name);
+                        if (include == files.end()) {
+                            errors = "include : " + name;
+                            return false;
+                        }
+                        result.source += include->second;
+                        result.includes.push_back(name);
+                        continue;
+                    }
+                    result.source += line;
+                    result.source += '\n';
+                }
+                return true;
+            }
+
+            bool Compile(const ShaderCompileRequest& request, const PreprocessedShader& source,
+                std::vector<uint8_t>& bytecode, std::string&) override {
+                ++compileCount;
+                bytecode = BuildBytecode(request, source);
+                return true;
+            }
+
+            std::vector<uint8_t> BuildBytecode(const ShaderCompileRequest& request, const PreprocessedShader& source) const {
+                std::string image = m_version + '|' + request.entryPoint + '|' + request.target;
+                for (const auto& [name, value] : request.defines) {
+                    image += '|' + name + '=' + value;
+                }
+                image += '|' + source.source;
+                return { image.begin(), image.end() };
+            }
+
+        private:
+            std::string m_version;
+        };
+
+        //  Ʈ ǵ帮  üũ (  񱳿)
+        uint64_t Checksum(std::span<const uint8_t> data) {
+            uint64_t sum = 0;
+            size_t i = 0;
+            for (; i + sizeof(uint64_t) <= data.size(); i += sizeof(uint64_t)) {
+                uint64_t word;
+                std::memcpy(&word, data.data() + i, sizeof(word));
+                sum = (sum ^ word) * 0x100000001b3ull;
+            }
+            for (; i < data.size(); ++i) {
+                sum = (sum ^ data[i]) * 0x100000001b3ull;
+            }
+            return sum;
+        }
+    }
+
+    ResourceTools::LoadGraphBenchmarkResult ResourceTools::RunLoadGraphBenchmark(size_t textureCount, int iterations)
+    {
+        LoadGraphBenchmarkResult result;
+        iterations = std::max(iterations, 1);
+
+        LoadGraph graph;
+        BuildLevelGraph(graph, std::max<size_t>(textureCount, 4));
+        s_graph = &graph;
+
+        // Ӱ  = Է   ʰ   + ڱ ε ð ִ
+        std::vector<double> finish(graph.nodes.size(), 0.0);
+        std::vector<uint32_t> depth(graph.nodes.size(), 0);
+        uint32_t maxDepth = 0;
+        for (size_t i = 0; i < graph.nodes.size(); ++i) {
+            const auto& node = graph.nodes[i];
+            double start = 0.0;
+            for (size_t dependency : node.dependencies) {
+                start = std::max(start, finish[dependency]);
+                depth[i] = std::max(depth[i], depth[dependency] + 1);
+            }
+            finish[i] = start + node.loadMs;
+            maxDepth = std::max(maxDepth, depth[i]);
+
+            result.totalWorkMs += node.loadMs;
+            result.edgeCount += node.dependencies.size();
+            result.criticalPathMs = std::max(result.criticalPathMs, finish[i]);
+        }
+        result.resourceCount = graph.nodes.size();
+
+        Logger::Instance().Info("=== ε ׷ ġũ: ҽ {},  {}, {}ܰ ({}ȸ ) ===",
+            result.resourceCount, result.edgeCount, maxDepth + 1, iterations);
+
+        auto checkExactlyOnce = [&](const char* label) {
+            for (size_t i = 0; i < graph.nodes.size(); ++i) {
+                if (graph.loadCounts[i].load() != 1) {
+                    Logger::Instance().Error("{}: {} ε Ƚ {}", label, graph.nodes[i].name, graph.loadCounts[i].load());
+                    ++result.violations;
+                }
+            }
+        };
+
+        // 1.  忡  
+        {
+            graph.ResetCounts();
+            const auto start = Clock::now();
+            auto resources = CreateDirect(graph, "synthetic/serial/");
+            for (auto& resource : resources) {
+                resource->Load();
+            }
+            result.serialMs = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+            checkExactlyOnce("");
+        }
+
+        // 2.   ܰ躰 ûϰ    ٸ (Է ϴ  )
+        {
+            ResourceLoader loader;
+            result.workerCount = loader.GetWorkerCount();
+
+            double totalMs = 0.0;
+            for (int iteration = 0; iteration < iterations; ++iteration) {
+                graph.ResetCounts();
+                const auto start = Clock::now();
+                auto resources = CreateDirect(graph, std::format("synthetic/staged{}/", iteration));
+
+                for (uint32_t stage = 0; stage <= maxDepth; ++stage) {
+                    size_t outstanding = 0;
+                    for (size_t i = 0; i < resources.size(); ++i) {
+                        if (depth[i] == stage && loader.Enqueue(resources[i], LoadPriority::VisibleNow) != ResourceLoader::InvalidRequest) {
+                            ++outstanding;
+                        }
+                    }
+
+                    ResourceLoader::Completion completion;
+                    while (outstanding > 0) {
+                        if (loader.PopCompletion(completion)) {
+                            --outstanding;
+                        }
+                        else {
+                            std::this_thread::yield();
+                        }
+                    }
+                }
+                totalMs += std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+                checkExactlyOnce("ܰ躰");
+            }
+            result.stagedMs = totalMs / iterations;
+        }
+
+        // 3.  ϳ û -    ResourceManager δ DAG ٸ
+        {
+            double totalMs = 0.0;
+            std::vector<std::shared_ptr<SyntheticResource>> resources;
+            for (int iteration = 0; iteration < iterations; ++iteration) {
+                graph.ResetCounts();
+                const std::string prefix = std::format("synthetic/graph{}/", iteration);
+
+                const auto start = Clock::now();
+                auto level = ResourceManager::Instance().RequestResource<SyntheticResource>(
+                    LoadPriority::VisibleNow, prefix + "level");
+                while (!level->IsReady() && !level->HasFailed()) {
+                    ResourceManager::Instance().ProcessLoadingQueue();
+                    std::this_thread::yield();
+                }
+                totalMs += std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+
+                WaitForGraph(graph, prefix, resources);
+                checkExactlyOnce("DAG");
+                if (!level->IsReady()) {
+                    Logger::Instance().Error("DAG:  ε ");
+                    ++result.violations;
+                }
+
+                level.reset();
+                resources.clear();
+                ReleaseGraph(graph, prefix);
+            }
+            result.graphMs = totalMs / iterations;
+        }
+
+        // 4. ؽó ϳ н  ؽó  ҽ Load  ϴ Ȯ
+        {
+            const size_t failing = graph.indices.at("texture_0");
+            graph.nodes[failing].fail = true;
+            graph.ResetCounts();
+
+            std::vector<bool> expectFailed(graph.nodes.size(), false);
+            for (size_t i = 0; i < graph.nodes.size(); ++i) {
+                expectFailed[i] = graph.nodes[i].fail || std::any_of(graph.nodes[i].dependencies.begin(),
+                    graph.nodes[i].dependencies.end(), [&](size_t dependency) { return expectFailed[dependency]; });
+            }
+
+            const std::string prefix = "synthetic/fail/";
+            ResourceManager::Instance().RequestResource<SyntheticResource>(LoadPriority::VisibleNow, prefix + "level");
+
+            std::vector<std::shared_ptr<SyntheticResource>> resources;
+            WaitForGraph(graph, prefix, resources);
+
+            for (size_t i = 0; i < graph.nodes.size(); ++i) {
+                const uint32_t loads = graph.loadCounts[i].load();
+                const bool skipped = expectFailed[i] && i != failing;
+                if (resources[i]->HasFailed() != expectFailed[i] || loads != (skipped ? 0u : 1u)) {
+                    Logger::Instance().Error(" : {} ( {},  {}, ε {}ȸ)", graph.nodes[i].name,
+                        resources[i]->HasFailed(), expectFailed[i], loads);
+                    ++result.violations;
+                }
+                if (skipped && loads == 0) {
+                    ++result.propagatedFailures;
+                }
+            }
+
+            resources.clear();
+            ReleaseGraph(graph, prefix);
+            graph.nodes[failing].fail = false;
+        }
+
+        // 5.  - ĳÿ   Enqueue  Է а ƴ϶ , θ ٸ ȯ 
+        {
+            graph.ResetCounts();
+            ResourceLoader loader;
+            auto resources = CreateDirect(graph, "synthetic/reserve/");
+            const size_t material = graph.indices.at("material_0");
+            const auto& inputIndices = graph.nodes[material].dependencies;
+
+            // ٸ 尡  Է ĳÿ  ͸ Է Enqueue   
+            std::vector<std::shared_ptr<IResource>> inputs;
+            for (size_t input : inputIndices) {
+                loader.Reserve(resources[input].get());
+                inputs.push_back(resources[input]);
+            }
+            loader.Enqueue(resources[material], LoadPriority::VisibleNow, inputs);
+            for (size_t input : inputIndices) {
+                loader.Enqueue(resources[input], LoadPriority::Background);
+            }
+
+            auto first = std::make_shared<SyntheticResource>("synthetic/cycle/shader_0");
+            auto second = std::make_shared<SyntheticResource>("synthetic/cycle/shader_1");
+            loader.Reserve(first.get());
+            loader.Reserve(second.get());
+            const std::shared_ptr<IResource> firstInput[] = { first };
+            const std::shared_ptr<IResource> secondInput[] = { second };
+            loader.Enqueue(second, LoadPriority::VisibleNow, firstInput);
+            loader.Enqueue(first, LoadPriority::VisibleNow, secondInput);
+
+            size_t outstanding = inputIndices.size() + 3;
+            size_t failures = 0;
+            ResourceLoader::Completion completion;
+            while (outstanding > 0) {
+                if (!loader.PopCompletion(completion)) {
+                    std::this_thread::yield();
+                    continue;
+                }
+                --outstanding;
+                failures += !completion.success;
+            }
+
+            uint32_t loads = 0;
+            for (size_t i = 0; i < graph.nodes.size(); ++i) {
+                loads += graph.loadCounts[i].load();
+            }
+            if (!resources[material]->IsReady() || failures != 2 || loads != inputIndices.size() + 1 ||
+                !first->HasFailed() || !second->HasFailed()) {
+                Logger::Instance().Error(": ͸ {},  {} ( 2), ε {}ȸ ( {}), ȯ  {}/{}",
+                    resources[material]->IsReady() ? "Ready" : "ε  ", failures, loads, inputIndices.size() + 1,
+                    first->HasFailed(), second->HasFailed());
+                ++result.violations;
+            }
+        }
+
+        result.violations += graph.orderViolations.load();
+        s_graph = nullptr;
+
+        const double bound = std::max(result.criticalPathMs, result.totalWorkMs / std::max<size_t>(result.workerCount, 1));
+        Logger::Instance().Info("۾  {:.1f}ms, Ӱ  {:.1f}ms,  {:.1f}ms (Ŀ {})",
+            result.totalWorkMs, result.criticalPathMs, bound, result.workerCount);
+        Logger::Instance().Info(": {:.1f}ms", result.serialMs);
+        Logger::Instance().Info("ܰ躰 : {:.1f}ms", result.stagedMs);
+        Logger::Instance().Info(" DAG: {:.1f}ms (ܰ躰  {:.2f}x,   {:.0f}%)",
+            result.graphMs, result.stagedMs / result.graphMs, 100.0 * bound / result.graphMs);
+        Logger::Instance().Info(" : texture_0  -> {} Load  ", result.propagatedFailures);
+        Logger::Instance().Info(" : {}", result.violations);
+
+        return result;
+    }
+
+    ResourceTools::FileReadBenchmarkResult ResourceTools::RunFileReadBenchmark(const std::string& directory,
+        uint32_t queueDepth, int iterations)
+    {
+        FileReadBenchmarkResult result;
+        result.queueDepth = queueDepth;
+        iterations = std::max(iterations, 1);
+
+        struct FileEntry {
+            std::string path;
+            uint64_t size = 0;
+            uint64_t checksum = 0;
+        };
+        std::vector<FileEntry> files;
+
+        std::error_code ec;
+        for (const auto& entry : std::filesystem::recursive_directory_iterator(directory, ec)) {
+            if (!entry.is_regular_file()) continue;
+            const uint64_t size = entry.file_size();
+            if (size == 0 || size > std::numeric_limits<uint32_t>::max()) continue;
+            files.push_back({ entry.path().string(), size });
+            result.totalBytes += size;
+        }
+        result.fileCount = files.size();
+
+        if (files.empty()) {
+            Logger::Instance().Error("  : {}", directory);
+            return result;
+        }
+
+        Logger::Instance().Info("===  б ġũ: {} ( {}, {:.1f}MB, ť  {}, {}ȸ ) ===",
+            directory, result.fileCount, result.totalBytes / (1024.0 * 1024.0), queueDepth, iterations);
+
+        // 1.  忡 ifstream ʷ (ù ݺ üũ ذ )
+        {
+            std::vector<uint8_t> buffer;
+            double totalMs = 0.0;
+            for (int iteration = 0; iteration < iterations; ++iteration) {
+                const auto start = Clock::now();
+                for (auto& file : files) {
+                    buffer.resize(static_cast<size_t>(file.size));
+                    std::ifstream in(file.path, std::ios::binary);
+                    if (!in.read(reinterpret_cast<char*>(buffer.data()), buffer.size())) {
+                        ++result.violations;
+                        continue;
+                    }
+
+                    const uint64_t checksum = Checksum(buffer);
+                    if (iteration == 0) {
+                        file.checksum = checksum;
+                    }
+                    else if (checksum != file.checksum) {
+                        ++result.violations;
+                    }
+                }
+                totalMs += std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+            }
+            result.blockingMs = totalMs / iterations;
+        }
+
+        // 2. AsyncFileIO -    ϰ  ݹ 
+        auto runAsync = [&](AsyncFileIO::Backend backend) -> double {
+            AsyncFileIO io(backend, queueDepth);
+            if (io.GetBackend() != backend) {
+                return 0.0;
+            }
+
+            std::vector<std::vector<uint8_t>> buffers(files.size());
+            for (size_t i = 0; i < files.size(); ++i) {
+                if (files[i].size > io.GetStagingSize() / 4) {
+                    buffers[i].resize(static_cast<size_t>(files[i].size));
+                }
+            }
+
+            double totalMs = 0.0;
+            for (int iteration = 0; iteration < iterations; ++iteration) {
+                std::atomic<size_t> remaining{ files.size() };
+                std::atomic<size_t> mismatches{ 0 };
+                std::promise<void> done;
+
+                std::vector<AsyncFileIO::ReadRequest> requests;
+                requests.reserve(files.size());
+                for (size_t i = 0; i < files.size(); ++i) {
+                    requests.push_back({ files[i].path, 0, static_cast<uint32_t>(files[i].size),
+                        buffers[i].empty() ? nullptr : buffers[i].data(),
+                        [&, i](const AsyncFileIO::ReadResult& read) {
+                            if (!read.success || read.data.size() != files[i].size || Checksum(read.data) != files[i].checksum) {
+                                mismatches.fetch_add(1);
+                            }
+                            if (remaining.fetch_sub(1) == 1) {
+                                done.set_value();
+                            }
+                        } });
+                }
+
+                const auto start = Clock::now();
+                if (io.Submit(std::move(requests)) == AsyncFileIO::InvalidRequest) {
+                    ++result.violations;
+                    return 0.0;
+                }
+                done.get_future().wait();
+                totalMs += std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+                result.violations += mismatches.load();
+            }
+            return totalMs / iterations;
+        };
+
+        result.threadPoolMs = runAsync(AsyncFileIO::Backend::ThreadPool);
+        result.ioRingMs = AsyncFileIO::IsIoRingSupported() ? runAsync(AsyncFileIO::Backend::IoRing) : 0.0;
+
+        // 3. ResourceManager::ReadFilesAsync -  ó ProcessLoadingQueue  ݹ 
+        //        ϳ  е ݹ  Ȯ
+        {
+            auto& manager = ResourceManager::Instance();
+            const std::string missingPath = (std::filesystem::path(directory) / "__missing_file_io_bench__").string();
+
+            std::vector<std::string> paths;
+            paths.reserve(files.size() + 1);
+            std::unordered_map<std::string, size_t> indices;
+            for (size_t i = 0; i < files.size(); ++i) {
+                paths.push_back(files[i].path);
+                indices.emplace(files[i].path, i);
+            }
+            paths.push_back(missingPath);
+
+            const std::thread::id mainThread = std::this_thread::get_id();
+            double totalMs = 0.0;
+            for (int iteration = 0; iteration < iterations; ++iteration) {
+                std::vector<uint32_t> callbacks(files.size(), 0);
+                size_t received = 0;
+                size_t missingReports = 0;
+                size_t reordered = 0;
+                bool draining = false;
+
+                const auto start = Clock::now();
+                manager.ReadFilesAsync(paths, [&](const std::string& path, std::vector<uint8_t>&& data, bool success) {
+                    if (!draining || std::this_thread::get_id() != mainThread) {
+                        ++result.violations;    // ProcessLoadingQueue ̳ ٸ 忡 ȣ
+                    }
+
+                    auto it = indices.find(path);
+                    if (it == indices.end()) {
+                        missingReports += path == missingPath && !success;
+                        result.violations += path != missingPath || success;
+                    }
+                    else {
+                        const auto& file = files[it->second];
+                        ++callbacks[it->second];
+                        reordered += it->second != received;
+                        if (!success || data.size() != file.size || Checksum(data) != file.checksum) {
+                            ++result.violations;
+                        }
+                    }
+                    ++received;
+                });
+
+                while (received < paths.size()) {
+                    draining = true;
+                    manager.ProcessLoadingQueue();
+                    draining = false;
+                    std::this_thread::yield();
+                }
+                totalMs += std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+
+                //  ݺ  ʰ  ߺ ݹ鵵 Ƴ
+                draining = true;
+                manager.ProcessLoadingQueue();
+                draining = false;
+
+                const size_t wrongCounts = static_cast<size_t>(std::count_if(callbacks.begin(), callbacks.end(),
+                    [](uint32_t count) { return count != 1; }));
+                if (wrongCounts > 0 || missingReports != 1 || received != paths.size()) {
+                    Logger::Instance().Error("ReadFilesAsync: ݹ Ƚ 1 ƴ  {},     {}ȸ, ݹ {}/{}",
+                        wrongCounts, missingReports, received, paths.size());
+                    result.violations += wrongCounts + (missingReports != 1);
+                }
+                result.reorderedCompletions = reordered;
+            }
+            result.managerMs = totalMs / iterations;
+        }
+
+        auto report = [&](const char* label, double ms) {
+            if (ms <= 0.0) {
+                Logger::Instance().Info("{}:   ", label);
+                return;
+            }
+            Logger::Instance().Info("{}: {:.1f}ms ({:.0f}MB/s, {:.0f} /s, ifstream  {:.2f}x)", label, ms,
+                result.totalBytes / (ms * 1000.0 * 1.048576), result.fileCount * 1000.0 / ms, result.blockingMs / ms);
+        };
+        report("ifstream ", result.blockingMs);
+        report(" Ǯ", result.threadPoolMs);
+        report("IoRing", result.ioRingMs);
+        report("ReadFilesAsync", result.managerMs);
+        Logger::Instance().Info("ReadFilesAsync Ϸ : û  ٸ ڸ {}/{}", result.reorderedCompletions, result.fileCount);
+        Logger::Instance().Info(" : {}", result.violations);
+
+        return result;
+    }
+
+    ResourceTools::MaterialSortBenchmarkResult ResourceTools::RunMaterialSortBenchmark(size_t materialCount,
+        size_t drawCount, int iterations)
+    {
+        using BlendMode = MaterialResource::BlendMode;
+
+        MaterialSortBenchmarkResult result;
+        materialCount = std::clamp<size_t>(materialCount, 1, UINT16_MAX);
+        result.materialCount = materialCount;
+        result.drawCount = drawCount;
+        iterations = std::max(iterations, 1);
+
+        // ͸ 16  ϳ, 2 ؽó  ϳ  ϴ 
+        std::mt19937 rng(11);
+        const size_t pipelineCount = std::max<size_t>(materialCount / 16, 1);
+        const size_t textureSetCount = std::max<size_t>(materialCount / 2, 1);
+
+        struct SyntheticMaterial {
+            BlendMode blend;
+            uint64_t stateKey;
+        };
+        std::vector<SyntheticMaterial> materials(materialCount);
+        for (size_t i = 0; i < materialCount; ++i) {
+            const auto pipeline = static_cast<uint16_t>(std::uniform_int_distribution<size_t>(0, pipelineCount - 1)(rng));
+            const auto textureSet = static_cast<uint16_t>(std::uniform_int_distribution<size_t>(0, textureSetCount - 1)(rng));
+            materials[i].blend = (i % 10 == 9) ? BlendMode::AlphaBlend : BlendMode::Opaque;
+            materials[i].stateKey = MaterialResource::MakeStateKey(pipeline, textureSet, static_cast<uint16_t>(i));
+        }
+
+        struct Draw {
+            uint32_t material;
+            float depth;
+        };
+        std::vector<Draw> draws(drawCount);
+        for (auto& draw : draws) {
+            draw.material = std::uniform_int_distribution<uint32_t>(0, static_cast<uint32_t>(materialCount - 1))(rng);
+            draw.depth = std::uniform_real_distribution<float>(0.0f, 1.0f)(rng);
+        }
+
+        // order  ׸    
+        auto countChanges = [&](const std::vector<uint32_t>& order, int column) {
+            uint64_t previous = ~0ull;
+            for (uint32_t index : order) {
+                const uint64_t state = materials[draws[index].material].stateKey;
+                if (previous == ~0ull || MaterialResource::GetPipelineId(state) != MaterialResource::GetPipelineId(previous)) {
+                    ++result.pipelineChanges[column];
+                }
+                if (previous == ~0ull || MaterialResource::GetTextureSetId(state) != MaterialResource::GetTextureSetId(previous)) {
+                    ++result.textureChanges[column];
+                }
+                if (previous == ~0ull || MaterialResource::GetMaterialId(state) != MaterialResource::GetMaterialId(previous)) {
+                    ++result.constantChanges[column];
+                }
+                previous = state;
+            }
+        };
+
+        std::vector<uint32_t> submitted(drawCount);
+        std::iota(submitted.begin(), submitted.end(), 0u);
+        countChanges(submitted, 0);
+
+        //  - Ű ο ȣ Բ  (  ϴ ۾)
+        std::vector<std::pair<uint64_t, uint32_t>> keys(drawCount);
+        std::vector<uint32_t> sorted(drawCount);
+        double totalMs = 0.0;
+        for (int iteration = 0; iteration < iterations; ++iteration) {
+            const auto start = Clock::now();
+            for (uint32_t i = 0; i < drawCount; ++i) {
+                const auto& material = materials[draws[i].material];
+                keys[i] = { MaterialResource::MakeDrawSortKey(material.blend, material.stateKey, draws[i].depth), i };
+            }
+            std::sort(keys.begin(), keys.end());
+            for (size_t i = 0; i < drawCount; ++i) {
+                sorted[i] = keys[i].second;
+            }
+            totalMs += std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+        }
+        result.sortMs = totalMs / iterations;
+        countChanges(sorted, 1);
+
+        //  -  ,  ȿ PSO  ,  ڿ 
+        std::unordered_set<uint16_t> finishedPipelines;
+        bool seenTransparent = false;
+        float previousDepth = 2.0f;
+        uint16_t currentPipeline = 0;
+        for (size_t i = 0; i < drawCount; ++i) {
+            const auto& draw = draws[sorted[i]];
+            const auto& material = materials[draw.material];
+            if (material.blend == BlendMode::Opaque) {
+                if (seenTransparent) {
+                    ++result.violations;
+                }
+                const uint16_t pipeline = MaterialResource::GetPipelineId(material.stateKey);
+                if (i > 0 && pipeline != currentPipeline) {
+                    if (!finishedPipelines.insert(currentPipeline).second || finishedPipelines.contains(pipeline)) {
+                        ++result.violations;
+                    }
+                }
+                currentPipeline = pipeline;
+            }
+            else {
+                seenTransparent = true;
+                // ̴ 14Ʈ ȭǹǷ    
+                if (draw.depth > previousDepth + 1.0f / 16383.0f) {
+                    ++result.violations;
+                }
+                previousDepth = draw.depth;
+            }
+        }
+
+        Logger::Instance().Info("=== ͸  ġũ: ͸ {} ( {}, ؽó  {}), ο {} ===",
+            materialCount, pipelineCount, textureSetCount, drawCount);
+        Logger::Instance().Info("PSO : {} -> {}", result.pipelineChanges[0], result.pipelineChanges[1]);
+        Logger::Instance().Info("ؽó ̺ : {} -> {}", result.textureChanges[0], result.textureChanges[1]);
+        Logger::Instance().Info("͸  : {} -> {}", result.constantChanges[0], result.constantChanges[1]);
+        Logger::Instance().Info(" : {:.3f}ms/ ({:.1f}ns/ο, {}ȸ )",
+            result.sortMs, drawCount > 0 ? result.sortMs * 1e6 / drawCount : 0.0, iterations);
+        Logger::Instance().Info(" : {}", result.violations);
+
+        return result;
+    }
+
+    ResourceTools::PreloadBenchmarkResult ResourceTools::RunPreloadBenchmark(size_t soundCount, double setupMs)
+    {
+        PreloadBenchmarkResult result;
+        soundCount = std::max<size_t>(soundCount, 1);
+        result.resourceCount = soundCount;
+
+        auto& manager = ResourceManager::Instance();
+        const auto directory = std::filesystem::temp_directory_path() / "PreloadBench";
+        std::error_code ec;
+        std::filesystem::remove_all(directory, ec);
+        std::filesystem::create_directories(directory, ec);
+
+        // 0.3~2.3 ׷ 16Ʈ -   ũ û  ü ڵ
+        std::vector<std::string> paths;
+        std::vector<float> samples;
+        for (size_t i = 0; i < soundCount; ++i) {
+            const uint32_t frames = 48000 * (3 + static_cast<uint32_t>(i % 21)) / 10;
+            samples.resize(size_t(frames) * 2);
+            const float frequency = 110.0f + 10.0f * static_cast<float>(i);
+            for (uint32_t f = 0; f < frames; ++f) {
+                const float value = 0.5f * std::sin(6.2831853f * frequency * f / 48000.0f);
+                samples[f * 2] = value;
+                samples[f * 2 + 1] = -value;
+            }
+
+            auto path = (directory / std::format("sound{:03}.wav", i)).generic_string();
+            if (!Audio::AudioTools::WriteWave(path, 48000, 2, 16, samples)) {
+                Logger::Instance().Error("׽Ʈ 带   : {}", path);
+                ++result.violations;
+                return result;
+            }
+            paths.push_back(std::move(path));
+        }
+
+        const std::string previousDirectory = manager.GetManifestDirectory();
+        manager.SetManifestDirectory((directory / "Manifest").generic_string());
+
+        auto pump = [&](double ms) {
+            const auto deadline = Clock::now() + std::chrono::duration<double, std::milli>(ms);
+            while (Clock::now() < deadline) {
+                manager.ProcessLoadingQueue();
+                std::this_thread::yield();
+            }
+        };
+
+        //   䳻 - û غ  ٸ ̻  ۾ 1ms
+        auto runLevel = [&](const std::string& level) {
+            manager.BeginLevel(level);
+            pump(setupMs);
+
+            double stallMs = 0.0;
+            std::vector<std::shared_ptr<SoundResource>> sounds;
+            for (const auto& path : paths) {
+                const auto start = Clock::now();
+                auto sound = manager.RequestResource<SoundResource>(path);
+                while (sound && !sound->IsReady() && !sound->HasFailed()) {
+                    manager.ProcessLoadingQueue();
+                    std::this_thread::yield();
+                }
+                stallMs += std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+                if (!sound || !sound->IsReady()) {
+                    ++result.violations;
+                }
+                sounds.push_back(std::move(sound));
+                pump(1.0);
+            }
+
+            manager.EndLevel();
+            sounds.clear();
+            for (const auto& path : paths) {
+                manager.ReleaseResource(path);
+            }
+            return stallMs;
+        };
+
+        result.coldStallMs = runLevel("bench");
+        result.baselineStallMs = runLevel("baseline");
+
+        // ϵ Ŵ佺Ʈ û  ״ Ȯ
+        PreloadManifest manifest;
+        manifest.Load(manager.GetManifestPath("bench"));
+        if (manifest.GetEntries().size() != paths.size()) {
+            ++result.violations;
+        }
+        for (size_t i = 0; i < std::min(paths.size(), manifest.GetEntries().size()); ++i) {
+            if (manifest.GetEntries()[i].path != paths[i] || manifest.GetEntries()[i].size == 0) {
+                ++result.violations;
+            }
+        }
+
+        result.preloadStallMs = runLevel("bench");
+        const auto stats = manager.GetPreloadStats();
+        result.readyOnRequest = stats.readyOnRequest;
+        if (stats.preloaded != soundCount || stats.used != soundCount || stats.unused != 0) {
+            ++result.violations;
+        }
+
+        manager.SetManifestDirectory(previousDirectory);
+        std::filesystem::remove_all(directory, ec);
+
+        Logger::Instance().Info("=== ε ġũ:  {},  غ {:.0f}ms ===", soundCount, setupMs);
+        Logger::Instance().Info("ù :  ð {:.1f}ms", result.coldStallMs);
+        Logger::Instance().Info("Ŵ佺Ʈ :  ð {:.1f}ms", result.baselineStallMs);
+        Logger::Instance().Info("Ŵ佺Ʈ ε:  ð {:.1f}ms (û  غ {}/{})",
+            result.preloadStallMs, result.readyOnRequest, soundCount);
+        Logger::Instance().Info(" : {}", result.violations);
+
+        return result;
+    }
+
+    ResourceTools::ShaderCacheCheckResult ResourceTools::RunShaderCacheCheck()
+    {
+        ShaderCacheCheckResult result;
+        auto check = [&](bool ok, std::string_view what) {
+            ++result.checks;
+            if (!ok) {
+                ++result.violations;
+                Logger::Instance().Error(" : {}", what);
+            }
+        };
+
+        Logger::Instance().Info("=== ̴ ĳ  ( Ϸ) ===");
+
+        auto& cache = ShaderCache::Instance();
+        const auto directory = std::filesystem::temp_directory_path() / "ShaderCacheCheck";
+        std::error_code ec;
+        std::filesystem::remove_all(directory, ec);
+
+        auto makeCompiler = [](std::string version) {
+            auto compiler = std::make_unique<CountingShaderCompiler>(std::move(version));
+            compiler->files["test.hlsl"] = "#include \"common.hlsli\"\nfloat4 main() : SV_Target { return Tint; }\n";
+            compiler->files["common.hlsli"] = "static const float4 Tint = float4(1, 0, 0, 1);\n";
+            compiler->files["other.hlsli"] = "static const float4 Tint = float4(1, 0, 0, 1);\n";
+            return compiler;
+        };
+
+        auto owned = makeCompiler("stub-1");
+        CountingShaderCompiler* compiler = owned.get();
+        cache.Initialize(directory, std::move(owned));
+
+        ShaderCompileRequest request;
+        request.path = "test.hlsl";
+        request.entryPoint = "main";
+        request.target = "ps_5_1";
+        request.defines = { { "USE_FOG", "1" } };
+
+        // û ϳ ϰ Ϸ ҷȴ(̽) Ȯ
+        auto expect = [&](bool compiled, std::string_view what) {
+            const size_t before = compiler->compileCount.load();
+            std::vector<uint8_t> bytecode;
+            std::string errors;
+            const bool success = cache.GetOrCompile(request, bytecode, errors);
+            const size_t compiles = compiler->compileCount.load() - before;
+            result.compiles += compiles;
+
+            check(success && compiles == (compiled ? 1u : 0u),
+                std::format("{} ({})", what, compiled ? "ؾ " : "ؾ "));
+
+            // ̵ ̽  Ʈڵ  Է   ƾ 
+            PreprocessedShader source;
+            compiler->Preprocess(request, source, errors);
+            check(bytecode == compiler->BuildBytecode(request, source), std::format("{} - Ʈڵ", what));
+        };
+
+        //  û ĳ  
+        auto entryPath = [&]() {
+            PreprocessedShader source;
+            std::string errors;
+            compiler->Preprocess(request, source, errors);
+            return cache.GetEntryPath(ShaderCache::ComputeKey(request, source, compiler->GetVersion()));
+        };
+
+        auto rewriteEntry = [&](const std::function<void(std::vector<uint8_t>&)>& edit) {
+            const auto path = entryPath();
+            std::vector<uint8_t> bytes;
+            {
+                std::ifstream file(path, std::ios::binary);
+                bytes.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+            }
+            check(bytes.size() > sizeof(ShaderCache::FileHeader), "ĳ  ϵ");
+            edit(bytes);
+            std::ofstream file(path, std::ios::binary | std::ios::trunc);
+            file.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+        };
+
+        // 1. ù û ̽,  û 
+        expect(true, "ù û");
+        expect(false, " û");
+
+        // 2. ջ/߸ ĳ  źϰ ٽ  
+        rewriteEntry([](std::vector<uint8_t>& bytes) { bytes.back() ^= 0xFF; });
+        expect(true, "Ʈڵ尡 ջ ");
+        expect(false, "ٽ ϵ ");
+
+        rewriteEntry([](std::vector<uint8_t>& bytes) { bytes.resize(sizeof(ShaderCache::FileHeader) + (bytes.size() - sizeof(ShaderCache::FileHeader)) / 2); });
+        expect(true, "Ʈڵ尡 ߸ ");
+
+        rewriteEntry([](std::vector<uint8_t>& bytes) { bytes.resize(sizeof(ShaderCache::FileHeader) / 2); });
+        expect(true, " ߸ ");
+
+        rewriteEntry([](std::vector<uint8_t>& bytes) { bytes[0] ^= 0xFF; });
+        expect(true, " ٸ ");
+        expect(false, "   û");
+
+        // 3. Է ٲ ٽ , ǵ  ׸ ״ 
+        const std::string originalSource = compiler->files["test.hlsl"];
+        compiler->files["test.hlsl"] += "// ּ ߰\n";
+        expect(true, "ҽ ");
+        expect(false, " ҽ ٽ û");
+        compiler->files["test.hlsl"] = originalSource;
+        expect(false, "ҽ ǵ");
+
+        const std::string originalInclude = compiler->files["common.hlsli"];
+        compiler->files["common.hlsli"] = "static const float4 Tint = float4(0, 1, 0, 1);\n";
+        expect(true, "include  ");
+        compiler->files["common.hlsli"] = originalInclude;
+
+        //   include ϸ ٸ ( ε   ޶)
+        compiler->files["test.hlsl"] = "#include \"other.hlsli\"\nfloat4 main() : SV_Target { return Tint; }\n";
+        expect(true, "include  ");
+        compiler->files["test.hlsl"] = originalSource;
+
+        request.defines = { { "USE_FOG", "0" } };
+        expect(true, "ũ  ");
+        request.defines = { { "USE_FOG", "1" }, { "USE_SHADOW", "1" } };
+        expect(true, "ũ ߰");
+        request.defines = { { "USE_FOG", "1" } };
+        expect(false, "ũθ ǵ");
+
+        request.target = "ps_6_0";
+        expect(true, "Ÿ ");
+        request.target = "ps_5_1";
+
+        // 4. Ϸ  ٲ  ׸  ȿȭ
+        owned = makeCompiler("stub-2");
+        compiler = owned.get();
+        cache.Initialize(directory, std::move(owned));
+        expect(true, "Ϸ  ");
+        expect(false, "   û");
+
+        //   ĳÿ  
+        {
+            ShaderCompileRequest missing = request;
+            missing.path = "missing.hlsl";
+            std::vector<uint8_t> bytecode;
+            std::string errors;
+            check(!cache.GetOrCompile(missing, bytecode, errors) && !errors.empty(), "  ");
+        }
+
+        cache.Clear();
+        cache.Initialize(directory, nullptr);
+        std::filesystem::remove_all(directory, ec);
+
+        Logger::Instance().Info(" {},  {}ȸ,  {}", result.checks, result.compiles, result.violations);
+        return result;
+    }
+}
@@ -0,0 +1,87 @@
+#pragma once
+#include "pch.h"
+
+namespace Resource
+{
+    // ҽ ε  / 
+    class ResourceTools {
+    public:
+        struct LoadGraphBenchmarkResult {
+            size_t resourceCount = 0;
+            size_t edgeCount = 0;
+            size_t workerCount = 0;
+            double totalWorkMs = 0.0;           //  ҽ ε ð 
+            double criticalPathMs = 0.0;        //    罽
+            double serialMs = 0.0;              //  忡  
+            double stagedMs = 0.0;              // ܰ躰 ûϰ    ٸ ( )
+            double graphMs = 0.0;               //  DAG ٸ (ResourceManager )
+            size_t propagatedFailures = 0;      //   ࿡ Load   ó 
+            size_t violations = 0;              // ߺ ε, Էº  ε,   /
+        };
+
+        // ̴/ؽó -> ͸ ->  ->   ռ ׷  ε ð 
+        // ε  ðŭ ڵ 䳻 .  ؽó ϳ н ĵ Ȯϰ,
+        // ุ  Է ٸ û θ ٸ ȯ û  /ϴ Ȯ
+        static LoadGraphBenchmarkResult RunLoadGraphBenchmark(size_t textureCount = 48, int iterations = 3);
+
+        struct FileReadBenchmarkResult {
+            size_t fileCount = 0;
+            uint64_t totalBytes = 0;
+            uint32_t queueDepth = 0;
+            double blockingMs = 0.0;            // ifstream  Ͼ
+            double threadPoolMs = 0.0;          // AsyncFileIO  Ǯ 鿣
+            double ioRingMs = 0.0;              // AsyncFileIO IoRing 鿣 (   0)
+            double managerMs = 0.0;             // ResourceManager::ReadFilesAsync (ݹ ProcessLoadingQueue)
+            size_t reorderedCompletions = 0;    // ReadFilesAsync ݹ û  ٸ ڸ  
+            size_t violations = 0;              // б , ũ/ ġ, ݹ /ߺ/   ȣ
+        };
+
+        // directory Ʒ   ° д ð  (ù ݺ OS ĳð   )
+        //   ¡ ۷, ū  ̸  ۷ ٷ 
+        // ResourceManager::ReadFilesAsync   ϳ      ݹ鵵 Ȯ
+        static FileReadBenchmarkResult RunFileReadBenchmark(const std::string& directory,
+            uint32_t queueDepth = 64, int iterations = 3);
+
+        struct MaterialSortBenchmarkResult {
+            size_t materialCount = 0;
+            size_t drawCount = 0;
+            double sortMs = 0.0;                //  Ű  +  (Ӵ)
+            //   ״ /     
+            size_t pipelineChanges[2] = {};
+            size_t textureChanges[2] = {};
+            size_t constantChanges[2] = {};
+            size_t violations = 0;              //   ,  PSO 湮,   
+        };
+
+        // ռ ͸(/ؽó  , 10% )  ο 
+        // MaterialResource::MakeDrawSortKey   پ     
+        static MaterialSortBenchmarkResult RunMaterialSortBenchmark(size_t materialCount = 512,
+            size_t drawCount = 20000, int iterations = 20);
+
+        struct PreloadBenchmarkResult {
+            size_t resourceCount = 0;
+            double coldStallMs = 0.0;           // ù  (Ŵ佺Ʈ , ϸ)
+            double baselineStallMs = 0.0;       // Ŵ佺Ʈ ,  ĳð  
+            double preloadStallMs = 0.0;        // Ŵ佺Ʈ ̸ û
+            size_t readyOnRequest = 0;          // ε ǿ û  ̹ غ 
+            size_t violations = 0;              // ε , Ŵ佺Ʈ / ġ, ̻ ε
+        };
+
+        // ̰ ٸ WAV soundCount      
+        //    setupMs  ٸ ʱȭ 䳻   带 ϳ ûϰ غ  ٸ
+        // ð( ð) Ŵ佺Ʈ /  
+        static PreloadBenchmarkResult RunPreloadBenchmark(size_t soundCount = 64, double setupMs = 50.0);
+
+        struct ShaderCacheCheckResult {
+            size_t checks = 0;
+            size_t compiles = 0;                //  Ϸ   
+            size_t violations = 0;              // ؾ   , ٽ ؾ   , Ʈڵ ġ
+        };
+
+        // ȣ    Ϸ ShaderCache  (D3D Ϸ  ӽ ͸ )
+        // - ù û ̽,  û 
+        // - ջǰų ߸ ĳ  źϰ ٽ 
+        // - ҽ, include /, ũ, Ϸ  ٲ ٽ 
+        static ShaderCacheCheckResult RunShaderCacheCheck();
+    };
+}
@@ -0,0 +1,205 @@
+#include "pch.h"
+#include "SceneQueryService.h"
+#include "PhysicsObject.h"
+#include "MemoryManager.h"
+#include "TaskSystem.h"
+
+namespace
+{
+	// ۾ ϳ ô   ( ϳ  ũʶ ʹ ߰  й   ŭ)
+	constexpr size_t QueryGrainSize = 32;
+
+	PxQueryFilterData MakeFilter(CollisionGroup mask, PxQueryFlags extraFlags)
+	{
+		// ⺻ :  word0    word0(ڽ ׷) ġ 
+		return PxQueryFilterData(PxFilterData(static_cast<PxU32>(mask), 0, 0, 0),
+			PxQueryFlag::eSTATIC | PxQueryFlag::eDYNAMIC | extraFlags);
+	}
+
+	// ̰ 0̰ų NaN  ȭ  Ƿ false (PhysX ѱ ߸  )
+	bool NormalizeDirection(PxVec3& direction)
+	{
+		return direction.normalize() > 1e-6f;
+	}
+
+	//  Ҵڿ count ڸ. Ҵڰ ų   ڶ nullptr
+	template<typename T>
+	T* AllocateFrame(size_t count)
+	{
+		const size_t bytes = sizeof(T) * count;
+		auto* allocator = Memory::MemoryManager::Instance().GetAllocator(Memory::MemoryManager::Domain::Frame);
+		if (!allocator || bytes > allocator->GetTotalMemory() - allocator->GetUsedMemory()) {
+			return nullptr;
+		}
+		return static_cast<T*>(allocator->Allocate(bytes, alignof(T)).ptr);
+	}
+
+	void FillActor(SceneQueryService::Hit& hit, PxRigidActor* actor)
+	{
+		hit.actor = actor;
+		hit.object = actor ? static_cast<PhysicsObject*>(actor->userData) : nullptr;
+	}
+}
+
+SceneQueryService::Ticket SceneQueryService::Raycast(const PxVec3& origin, const PxVec3& direction, float maxDistance,
+	CollisionGroup mask, bool anyHit)
+{
+	Query query;
+	query.type = Type::Raycast;
+	query.pose = PxTransform(origin);
+	query.direction = direction;
+	if (!NormalizeDirection(query.direction)) {
+		query.maxHits = 0;
+	}
+	query.maxDistance = maxDistance;
+	query.filter = MakeFilter(mask, anyHit ? PxQueryFlags(PxQueryFlag::eANY_HIT) : PxQueryFlags());
+	return Push(std::move(query));
+}
+
+SceneQueryService::Ticket SceneQueryService::Sweep(const PxGeometry& geometry, const PxTransform& pose,
+	const PxVec3& direction, float maxDistance, CollisionGroup mask)
+{
+	Query query;
+	query.type = Type::Sweep;
+	query.geometry.storeAny(geometry);
+	query.pose = pose;
+	query.direction = direction;
+	if (!NormalizeDirection(query.direction)) {
+		query.maxHits = 0;
+	}
+	query.maxDistance = maxDistance;
+	query.filter = MakeFilter(mask, PxQueryFlags());
+	return Push(std::move(query));
+}
+
+SceneQueryService::Ticket SceneQueryService::Overlap(const PxGeometry& geometry, const PxTransform& pose,
+	CollisionGroup mask, uint32_t maxHits)
+{
+	Query query;
+	query.type = Type::Overlap;
+	query.geometry.storeAny(geometry);
+	query.pose = pose;
+	query.maxHits = std::max(maxHits, 1u);
+	//       
+	query.filter = MakeFilter(mask, PxQueryFlag::eNO_BLOCK);
+	return Push(std::move(query));
+}
+
+SceneQueryService::Ticket SceneQueryService::Push(Query query)
+{
+	query.firstHit = m_pendingHits;
+	m_pendingHits += query.maxHits;
+
+	const Ticket ticket{ m_pendingBatch, static_cast<uint32_t>(m_pending.size()) };
+	m_pending.push_back(std::move(query));
+	return ticket;
+}
+
+void SceneQueryService::Execute(PxScene* scene, bool parallel)
+{
+	const auto start = std::chrono::steady_clock::now();
+
+	//  ť   ű  ġ  (  ⼭ )
+	std::swap(m_executed, m_pending);
+	m_pending.clear();
+	m_executedBatch = m_pendingBatch++;
+	const uint32_t hitCapacity = m_pendingHits;
+	m_pendingHits = 0;
+
+	const size_t count = m_executed.size();
+	m_hitCounts.assign(count, 0);
+	m_hits = nullptr;
+	if (count == 0 || !scene) {
+		m_executeMs = 0.0;
+		return;
+	}
+
+	//   -  ڸ  Ƿ Ŀ ȭ  
+	//  ӽ ۵  ڸ(firstHit maxHits) Ƿ ۾̳  Ҵ 
+	m_hits = AllocateFrame<Hit>(hitCapacity);
+	if (!m_hits) {
+		m_fallbackHits.resize(hitCapacity);
+		m_hits = m_fallbackHits.data();
+	}
+	PxOverlapHit* overlapHits = AllocateFrame<PxOverlapHit>(hitCapacity);
+	if (!overlapHits) {
+		m_fallbackOverlapHits.resize(hitCapacity);
+		overlapHits = m_fallbackOverlapHits.data();
+	}
+
+	if (parallel && count > QueryGrainSize) {
+		TaskSystem::Instance().Execute([&] {
+			tbb::parallel_for(tbb::blocked_range<size_t>(0, count, QueryGrainSize),
+				[&](const tbb::blocked_range<size_t>& range) {
+					for (size_t i = range.begin(); i != range.end(); ++i) {
+						const Query& query = m_executed[i];
+						m_hitCounts[i] = Run(scene, query, m_hits + query.firstHit, overlapHits + query.firstHit);
+					}
+				});
+		}, TaskSystem::Priority::High);
+	}
+	else {
+		for (size_t i = 0; i < count; ++i) {
+			const Query& query = m_executed[i];
+			m_hitCounts[i] = Run(scene, query, m_hits + query.firstHit, overlapHits + query.firstHit);
+		}
+	}
+
+	m_executeMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+uint32_t SceneQueryService::Run(PxScene* scene, const Query& query, Hit* hits,
+	PxOverlapHit* overlapHits) const
+{
+	if (query.maxHits == 0) {
+		return 0;
+	}
+
+	switch (query.type) {
+	case Type::Raycast: {
+		PxRaycastBuffer buffer;
+		if (!scene->raycast(query.pose.p, query.direction, query.maxDistance, buffer,
+			PxHitFlag::ePOSITION | PxHitFlag::eNORMAL, query.filter) || !buffer.hasBlock) {
+			return 0;
+		}
+		FillActor(hits[0], buffer.block.actor);
+		hits[0].position = buffer.block.position;
+		hits[0].normal = buffer.block.normal;
+		hits[0].distance = buffer.block.distance;
+		return 1;
+	}
+	case Type::Sweep: {
+		PxSweepBuffer buffer;
+		if (!scene->sweep(query.geometry.any(), query.pose, query.direction, query.maxDistance, buffer,
+			PxHitFlag::ePOSITION | PxHitFlag::eNORMAL, query.filter) || !buffer.hasBlock) {
+			return 0;
+		}
+		FillActor(hits[0], buffer.block.actor);
+		hits[0].position = buffer.block.position;
+		hits[0].normal = buffer.block.normal;
+		hits[0].distance = buffer.block.distance;
+		return 1;
+	}
+	case Type::Overlap: {
+		PxOverlapBuffer buffer(overlapHits, query.maxHits);
+		scene->overlap(query.geometry.any(), query.pose, buffer, query.filter);
+		const uint32_t count = std::min(buffer.getNbTouches(), query.maxHits);
+		for (uint32_t i = 0; i < count; ++i) {
+			hits[i] = Hit();
+			FillActor(hits[i], buffer.getTouch(i).actor);
+		}
+		return count;
+	}
+	default:
+		return 0;
+	}
+}
+
+SceneQueryService::Result SceneQueryService::GetResult(Ticket ticket) const
+{
+	if (ticket.batch != m_executedBatch || ticket.index >= m_executed.size() || !m_hits) {
+		return {};
+	}
+	const Query& query = m_executed[ticket.index];
+	return { std::span<const Hit>(m_hits + query.firstHit, m_hitCounts[ticket.index]), query.type };
+}
@@ -0,0 +1,97 @@
+#pragma once
+#include "PhysicsTypes.h"
+class PhysicsObject;
+
+// ϰ   (ĳƮ, , )
+// -  ڵ  ߿  ׾ ΰ ǥ  (ױ  忡)
+// - PhysicsEngine    Execute TaskSystem Ŀ  Ѳ 
+//      fetchResults ¸ Ƿ ̸    ܰ ĵ 
+// -   Ҵڿ .  Execute , ׸ BeginFrameMemory    ȿ
+class SceneQueryService
+{
+public:
+	enum class Type : uint8_t {
+		Raycast,
+		Sweep,
+		Overlap
+	};
+
+	//  ġ ȣ + ġ  . ٸ ġ ǥδ    
+	struct Ticket {
+		uint32_t batch = 0;
+		uint32_t index = UINT32_MAX;
+	};
+
+	struct Hit {
+		PhysicsObject* object = nullptr;    //  userData (  ü ƴϸ nullptr)
+		PxRigidActor* actor = nullptr;
+		PxVec3 position = PxVec3(0.0f);     //  ġ/ 
+		PxVec3 normal = PxVec3(0.0f);
+		float distance = 0.0f;
+	};
+
+	// ĳƮ/  (anyHit̸ ó ã)  ϳ
+	//    (PhysX ã , Ÿ ׻ 0)
+	struct Result {
+		std::span<const Hit> hits;
+		Type type = Type::Raycast;
+
+		bool HasHit() const { return !hits.empty(); }
+		//    Ƿ ׻ nullptr - hits  ȸ
+		const Hit* GetClosest() const { return hits.empty() || type == Type::Overlap ? nullptr : &hits.front(); }
+	};
+
+	// mask:   ִ ׷ ( CollisionGroup Ʈ ġ )
+	// anyHit̸     ó ã Ϳ  (þ Ȯó  ˸  )
+	// direction ̰ 0̸  ʰ   (Sweep )
+	Ticket Raycast(const PxVec3& origin, const PxVec3& direction, float maxDistance,
+		CollisionGroup mask, bool anyHit = false);
+
+	// geometry pose direction maxDistanceŭ о     
+	Ticket Sweep(const PxGeometry& geometry, const PxTransform& pose, const PxVec3& direction, float maxDistance,
+		CollisionGroup mask);
+
+	// pose  geometry ġ  ִ maxHits ( )
+	Ticket Overlap(const PxGeometry& geometry, const PxTransform& pose, CollisionGroup mask, uint32_t maxHits = 16);
+
+	//   ϰ ť . parallel false ȣ 忡 ʷ  ()
+	void Execute(PxScene* scene, bool parallel = true);
+
+	//  Execute  (ٸ ġ ǥ  )
+	Result GetResult(Ticket ticket) const;
+
+	size_t GetPendingCount() const { return m_pending.size(); }
+	size_t GetExecutedCount() const { return m_executed.size(); }
+	double GetExecuteMs() const { return m_executeMs; }
+
+private:
+	struct Query {
+		Type type = Type::Raycast;
+		PxGeometryHolder geometry;
+		PxTransform pose = PxTransform(PxIdentity);     // ĳƮ p 
+		PxVec3 direction = PxVec3(0.0f);
+		float maxDistance = 0.0f;
+		PxQueryFilterData filter;
+		uint32_t firstHit = 0;                          //  ۿ   ڸ
+		uint32_t maxHits = 1;                           // 0̸  ߸Ǿ  ʴ 
+	};
+
+	Ticket Push(Query query);
+
+	//    ڱ ڸ     ȯ
+	// overlapHits  ӽ ۿ   ڸ (maxHits)
+	uint32_t Run(PxScene* scene, const Query& query, Hit* hits, PxOverlapHit* overlapHits) const;
+
+	std::vector<Query> m_pending;
+	uint32_t m_pendingHits = 0;
+	uint32_t m_pendingBatch = 1;
+
+	//  Execute
+	std::vector<Query> m_executed;
+	std::vector<uint32_t> m_hitCounts;
+	uint32_t m_executedBatch = 0;
+	Hit* m_hits = nullptr;
+	std::vector<Hit> m_fallbackHits;        //  Ҵڰ ų ڶ 
+	std::vector<PxOverlapHit> m_fallbackOverlapHits;
+	double m_executeMs = 0.0;
+};
@@ -0,0 +1,195 @@
+#include "pch.h"
+#include "ShaderCache.h"
+#include "ResourceCache.h"
+#include "Logger.h"
+
+namespace Resource
+{
+    namespace
+    {
+        uint64_t Checksum(std::span<const uint8_t> bytes)
+        {
+            return ResourceKeyBuilder()
+                .Add(std::string_view(reinterpret_cast<const char*>(bytes.data()), bytes.size()))
+                .Get();
+        }
+    }
+
+    ShaderCache& ShaderCache::Instance()
+    {
+        static ShaderCache instance;
+        return instance;
+    }
+
+    void ShaderCache::Initialize(const std::filesystem::path& directory, std::unique_ptr<IShaderCompiler> compiler)
+    {
+        m_directory = directory;
+        m_compiler = std::move(compiler);
+        m_compilerVersion = m_compiler ? m_compiler->GetVersion() : std::string();
+
+        std::error_code ec;
+        std::filesystem::create_directories(m_directory, ec);
+        if (ec) {
+            Logger::Instance().Warning("̴ ĳ ͸  : {} - {}",
+                m_directory.string(), ec.message());
+        }
+
+        Logger::Instance().Info("̴ ĳ ʱȭ: {} ({})", m_directory.string(), m_compilerVersion);
+    }
+
+    bool ShaderCache::GetOrCompile(const ShaderCompileRequest& request,
+        std::vector<uint8_t>& bytecode, std::string& errors, std::vector<std::string>* includes)
+    {
+        if (!m_compiler) {
+            errors = "̴ Ϸ  ʾҽϴ.";
+            return false;
+        }
+
+        // Ű   ó (#include ٲ Ű ޶)
+        PreprocessedShader source;
+        if (!m_compiler->Preprocess(request, source, errors)) {
+            return false;
+        }
+
+        const Key key = ComputeKey(request, source, m_compilerVersion);
+        if (includes) {
+            *includes = source.includes;
+        }
+
+        if (ReadEntry(key, bytecode)) {
+            ++m_hits;
+            Logger::Instance().Debug("̴ ĳ : {} ({}, {:016x})", request.path, request.entryPoint, key);
+            return true;
+        }
+
+        ++m_misses;
+        if (!m_compiler->Compile(request, source, bytecode, errors)) {
+            return false;
+        }
+
+        //  д  ࿡ ٽ  ̹Ƿ ε  ó
+        if (!WriteEntry(key, bytecode)) {
+            ++m_writeFailures;
+            Logger::Instance().Warning("̴ ĳ  : {}", GetEntryPath(key).string());
+        }
+        return true;
+    }
+
+    void ShaderCache::Clear()
+    {
+        std::error_code ec;
+        for (const auto& entry : std::filesystem::directory_iterator(m_directory, ec)) {
+            if (entry.path().extension() == ".cso") {
+                std::filesystem::remove(entry.path(), ec);
+            }
+        }
+    }
+
+    ShaderCache::Key ShaderCache::ComputeKey(const ShaderCompileRequest& request,
+        const PreprocessedShader& source, std::string_view compilerVersion)
+    {
+        ResourceKeyBuilder builder;
+        builder.Add(compilerVersion)
+            .Add(request.entryPoint)
+            .Add(request.target)
+            .Add(request.flags)
+            .Add(request.defines.size());
+
+        for (const auto& [name, value] : request.defines) {
+            builder.Add(name).Add(value);
+        }
+
+        builder.Add(source.source)
+            .Add(source.includes.size());
+
+        for (const auto& include : source.includes) {
+            builder.Add(include);
+        }
+        return builder.Get();
+    }
+
+    std::filesystem::path ShaderCache::GetEntryPath(Key key) const
+    {
+        return m_directory / std::format("{:016x}.cso", key);
+    }
+
+    ShaderCache::Stats ShaderCache::GetStats() const
+    {
+        Stats stats;
+        stats.hits = m_hits.load();
+        stats.misses = m_misses.load();
+        stats.writeFailures = m_writeFailures.load();
+        return stats;
+    }
+
+    bool ShaderCache::ReadEntry(Key key, std::vector<uint8_t>& bytecode) const
+    {
+        std::ifstream file(GetEntryPath(key), std::ios::binary | std::ios::ate);
+        if (!file) {
+            return false;
+        }
+
+        const uint64_t fileSize = static_cast<uint64_t>(file.tellg());
+        if (fileSize < sizeof(FileHeader)) {
+            return false;
+        }
+        file.seekg(0);
+
+        FileHeader header{};
+        file.read(reinterpret_cast<char*>(&header), sizeof(header));
+        if (!file || header.magic != Magic || header.version != Version || header.key != key ||
+            header.bytecodeSize != fileSize - sizeof(FileHeader)) {
+            return false;
+        }
+
+        std::vector<uint8_t> data(static_cast<size_t>(header.bytecodeSize));
+        file.read(reinterpret_cast<char*>(data.data()), data.size());
+        if (!file || Checksum(data) != header.checksum) {
+            Logger::Instance().Warning("ջ ̴ ĳ : {}", GetEntryPath(key).string());
+            return false;
+        }
+
+        bytecode = std::move(data);
+        return true;
+    }
+
+    bool ShaderCache::WriteEntry(Key key, const std::vector<uint8_t>& bytecode) const
+    {
+        const auto path = GetEntryPath(key);
+
+        // ӽ Ͽ   ̸ ٲ㼭, д      ʵ 
+        // ( Ű ÿ ϴ Ŀ ӽ  ġ ʰ  ID )
+        auto tempPath = path;
+        tempPath += std::format(".{}.tmp", std::hash<std::thread::id>{}(std::this_thread::get_id()));
+
+        FileHeader header{};
+        header.magic = Magic;
+        header.version = Version;
+        header.key = key;
+        header.bytecodeSize = bytecode.size();
+        header.checksum = Checksum(bytecode);
+
+        {
+            std::ofstream file(tempPath, std::ios::binary | std::ios::trunc);
+            if (!file) {
+                return false;
+            }
+            file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+            file.write(reinterpret_cast<const char*>(bytecode.data()), bytecode.size());
+            if (!file) {
+                file.close();
+                std::error_code ec;
+                std::filesystem::remove(tempPath, ec);
+                return false;
+            }
+        }
+
+        std::error_code ec;
+        std::filesystem::rename(tempPath, path, ec);
+        if (ec) {
+            std::filesystem::remove(tempPath, ec);
+            return false;
+        }
+        return true;
+    }
+}
@@ -0,0 +1,73 @@
+#pragma once
+#include "pch.h"
+#include "ShaderCompiler.h"
+
+namespace Resource
+{
+    // ϵ ̴ Ʈڵ ũ ĳ
+    // - Ű: ó ҽ + include  + Ʈ + Ÿ + ÷ + ũ + Ϸ  64Ʈ ؽ
+    // - ϸ  Ʈڵ常 а Ϸ ȣ  (ó Ű 꿡 ʿ)
+    // - ĳ  ջǾų Ű ٸ ̽ ϰ ٽ  
+    class ShaderCache {
+    public:
+        using Key = uint64_t;
+
+        static constexpr uint32_t Magic = 0x31434853;  // "SHC1"
+        static constexpr uint32_t Version = 1;
+
+        // ĳ   (ڿ Ʈڵ尡 ̾)
+        struct FileHeader {
+            uint32_t magic;
+            uint32_t version;
+            uint64_t key;
+            uint64_t bytecodeSize;
+            uint64_t checksum;
+        };
+        static_assert(sizeof(FileHeader) == 32);
+
+        struct Stats {
+            size_t hits = 0;
+            size_t misses = 0;
+            size_t writeFailures = 0;
+        };
+
+        static ShaderCache& Instance();
+
+        // ĳ ͸ Ϸ  (ε   ȣ)
+        void Initialize(const std::filesystem::path& directory, std::unique_ptr<IShaderCompiler> compiler);
+
+        // ĳÿ Ʈڵ带 ã,    
+        // includes  ó     ä ( ε )
+        //  ε Ŀ ÿ ȣ 
+        bool GetOrCompile(const ShaderCompileRequest& request,
+            std::vector<uint8_t>& bytecode, std::string& errors,
+            std::vector<std::string>* includes = nullptr);
+
+        // ĳ   
+        void Clear();
+
+        static Key ComputeKey(const ShaderCompileRequest& request,
+            const PreprocessedShader& source, std::string_view compilerVersion);
+
+        std::filesystem::path GetEntryPath(Key key) const;
+        Stats GetStats() const;
+
+    private:
+        ShaderCache() = default;
+        ~ShaderCache() = default;
+
+        ShaderCache(const ShaderCache&) = delete;
+        ShaderCache& operator=(const ShaderCache&) = delete;
+
+        bool ReadEntry(Key key, std::vector<uint8_t>& bytecode) const;
+        bool WriteEntry(Key key, const std::vector<uint8_t>& bytecode) const;
+
+        std::filesystem::path m_directory;
+        std::unique_ptr<IShaderCompiler> m_compiler;
+        std::string m_compilerVersion;
+
+        std::atomic<size_t> m_hits{ 0 };
+        std::atomic<size_t> m_misses{ 0 };
+        mutable std::atomic<size_t> m_writeFailures{ 0 };
+    };
+}
@@ -0,0 +1,38 @@
+#pragma once
+#include "pch.h"
+
+namespace Resource
+{
+    // ̴  û (̴  Ÿ  ÷ )
+    struct ShaderCompileRequest {
+        std::string path;
+        std::string entryPoint;
+        std::string target;
+        uint32_t flags = 0;
+        std::vector<std::pair<std::string, std::string>> defines;  // ó ũ (̸, )
+    };
+
+    // ũο #include   ҽ
+    struct PreprocessedShader {
+        std::string source;
+        std::vector<std::string> includes;  //     ( )
+    };
+
+    // ̴ Ϸ ߻ȭ - ĳ  Ư Ϸ(D3D)  ʵ и
+    // ε Ŀ ÿ ȣ  Ƿ   ؾ 
+    class IShaderCompiler {
+    public:
+        virtual ~IShaderCompiler() = default;
+
+        // Ϸ  - ٲ ĳõ Ʈڵ带  ȿȭ
+        virtual std::string GetVersion() const = 0;
+
+        // ó  (Ϻ ξ )
+        virtual bool Preprocess(const ShaderCompileRequest& request,
+            PreprocessedShader& result, std::string& errors) = 0;
+
+        // ó ҽ Ʈڵ 
+        virtual bool Compile(const ShaderCompileRequest& request, const PreprocessedShader& source,
+            std::vector<uint8_t>& bytecode, std::string& errors) = 0;
+    };
+}
@@ -0,0 +1,78 @@
+#pragma once
+#include "pch.h"
+
+namespace Resource
+{
+    //  Ű Ʈũ (Ʈ i =  i° Ű)
+    using ShaderVariantKey = uint32_t;
+
+    // ̴   Ű 
+    // -  Ű  1 ũη ǵǾ #if б
+    // -   Ʈ ġ̹Ƿ     ٲ 
+    class ShaderKeywordSet {
+    public:
+        static constexpr size_t MaxKeywords = sizeof(ShaderVariantKey) * 8;
+
+        ShaderKeywordSet() = default;
+
+        ShaderKeywordSet(std::initializer_list<std::string_view> keywords) {
+            for (auto keyword : keywords) {
+                Declare(keyword);
+            }
+        }
+
+        // Ű  - ̹   Ʈ ȯ
+        ShaderVariantKey Declare(std::string_view keyword) {
+            if (auto mask = GetMask(keyword)) {
+                return *mask;
+            }
+            if (m_keywords.size() >= MaxKeywords) {
+                throw std::length_error("̴ Ű尡 ʹ ϴ.");
+            }
+            m_keywords.emplace_back(keyword);
+            return ShaderVariantKey(1) << (m_keywords.size() - 1);
+        }
+
+        std::optional<ShaderVariantKey> GetMask(std::string_view keyword) const {
+            for (size_t i = 0; i < m_keywords.size(); ++i) {
+                if (m_keywords[i] == keyword) {
+                    return ShaderVariantKey(1) << i;
+                }
+            }
+            return std::nullopt;
+        }
+
+        // Ű ̸  Ű  (  Ű )
+        ShaderVariantKey MakeKey(std::initializer_list<std::string_view> enabled) const {
+            ShaderVariantKey key = 0;
+            for (auto keyword : enabled) {
+                key |= GetMask(keyword).value_or(0);
+            }
+            return key;
+        }
+
+        //  Ű忡 شϴ Ʈ 
+        ShaderVariantKey Sanitize(ShaderVariantKey key) const {
+            return m_keywords.size() >= MaxKeywords ? key
+                : key & ((ShaderVariantKey(1) << m_keywords.size()) - 1);
+        }
+
+        //  Ű شϴ ó ũ (̸, )
+        std::vector<std::pair<std::string, std::string>> GetDefines(ShaderVariantKey key) const {
+            std::vector<std::pair<std::string, std::string>> defines;
+            for (size_t i = 0; i < m_keywords.size(); ++i) {
+                if (key & (ShaderVariantKey(1) << i)) {
+                    defines.emplace_back(m_keywords[i], "1");
+                }
+            }
+            return defines;
+        }
+
+        size_t GetCount() const { return m_keywords.size(); }
+        const std::string& GetName(size_t index) const { return m_keywords[index]; }
+        const std::vector<std::string>& GetNames() const { return m_keywords; }
+
+    private:
+        std::vector<std::string> m_keywords;
+    };
+}
@@ -0,0 +1,84 @@
+#include "pch.h"
+#include "ShaderPermutation.h"
+#include "ResourceManager.h"
+
+namespace Resource
+{
+    ShaderPermutation::ShaderPermutation(std::string path, ShaderResource::ShaderType type, std::string entryPoint,
+        ShaderKeywordSet keywords, ShaderVariantKey fallback)
+        : m_path(std::move(path))
+        , m_type(type)
+        , m_entryPoint(std::move(entryPoint))
+        , m_keywords(std::move(keywords))
+        , m_fallback(m_keywords.Sanitize(fallback))
+    {
+    }
+
+    bool ShaderPermutation::LoadFallback()
+    {
+        auto shader = Request(m_fallback, LoadPriority::VisibleNow);
+        return shader && ResourceManager::Instance().WaitForLoading(shader);
+    }
+
+    void ShaderPermutation::Prewarm(std::span<const ShaderVariantKey> variants, LoadPriority priority)
+    {
+        for (auto variant : variants) {
+            Request(variant, priority);
+        }
+    }
+
+    std::shared_ptr<ShaderResource> ShaderPermutation::Get(ShaderVariantKey variant)
+    {
+        variant = m_keywords.Sanitize(variant);
+
+        auto shader = Request(variant, LoadPriority::VisibleNow);
+        if (shader && shader->IsReady()) {
+            return shader;
+        }
+
+        // غ   û   鼭   
+        std::shared_ptr<ShaderResource> best;
+        int bestBits = -1;
+        for (const auto& [key, candidate] : m_variants) {
+            if ((key & ~variant) != 0 || !candidate->IsReady()) continue;
+
+            const int bits = std::popcount(key);
+            if (bits > bestBits) {
+                best = candidate;
+                bestBits = bits;
+            }
+        }
+
+        if (!best) {
+            auto it = m_variants.find(m_fallback);
+            if (it != m_variants.end() && it->second->IsReady()) {
+                best = it->second;
+            }
+        }
+        return best;
+    }
+
+    bool ShaderPermutation::IsReady(ShaderVariantKey variant) const
+    {
+        auto it = m_variants.find(m_keywords.Sanitize(variant));
+        return it != m_variants.end() && it->second->IsReady();
+    }
+
+    std::shared_ptr<ShaderResource> ShaderPermutation::Request(ShaderVariantKey variant, LoadPriority priority)
+    {
+        variant = m_keywords.Sanitize(variant);
+
+        auto it = m_variants.find(variant);
+        if (it != m_variants.end()) {
+            return it->second;
+        }
+
+        // ó   ε Ŀ Ǯ  û ( Ű ĳõ ҽ )
+        auto shader = ResourceManager::Instance().RequestResource<ShaderResource>(
+            priority, m_path, m_type, m_entryPoint, m_keywords, variant);
+        if (shader) {
+            m_variants.emplace(variant, shader);
+        }
+        return shader;
+    }
+}
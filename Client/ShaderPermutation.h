@@ -0,0 +1,47 @@
+#pragma once
+#include "pch.h"
+#include "ShaderResource.h"
+#include "ShaderKeywords.h"
+#include "ResourceLoader.h"
+
+namespace Resource
+{
+    //  ̴( + Ʈ) Ű  
+    // - ʿ  Prewarm ε Ŀ Ǯ ķ ̸ 
+    // - ο  Get  : غ    û ϰ ü  ȯ
+    // -   
+    class ShaderPermutation {
+    public:
+        ShaderPermutation(std::string path, ShaderResource::ShaderType type, std::string entryPoint,
+            ShaderKeywordSet keywords, ShaderVariantKey fallback = 0);
+
+        const ShaderKeywordSet& GetKeywords() const { return m_keywords; }
+        ShaderVariantKey GetFallback() const { return m_fallback; }
+
+        // ü  ε   ٸ (ù     ȣ)
+        bool LoadFallback();
+
+        //  ׶忡  ϵ û
+        void Prewarm(std::span<const ShaderVariantKey> variants, LoadPriority priority = LoadPriority::Prefetch);
+
+        // غ  ȯ. ̸ ε ûϰ غ  
+        // û Ű κ̸鼭 Ű尡   ( ü ) ȯ
+        std::shared_ptr<ShaderResource> Get(ShaderVariantKey variant);
+
+        // û  غǾ (  false)
+        bool IsReady(ShaderVariantKey variant) const;
+
+        size_t GetVariantCount() const { return m_variants.size(); }
+
+    private:
+        std::shared_ptr<ShaderResource> Request(ShaderVariantKey variant, LoadPriority priority);
+
+        std::string m_path;
+        ShaderResource::ShaderType m_type;
+        std::string m_entryPoint;
+        ShaderKeywordSet m_keywords;
+        ShaderVariantKey m_fallback;
+
+        std::unordered_map<ShaderVariantKey, std::shared_ptr<ShaderResource>> m_variants;
+    };
+}
@@ -2,6 +2,8 @@
 #include "IResource.h"
 #include "pch.h"
 #include "Logger.h"
+#include "ShaderCache.h"
+#include "ShaderKeywords.h"
 
 namespace Resource
 {
@@ -16,6 +18,8 @@ namespace Resource
             Hull
         };
 
+        static constexpr Type ResourceType = Type::Shader;
+
         ShaderResource(const std::string& path, ShaderType type, const std::string& entryPoint)
             : IResource(Type::Shader, path, std::filesystem::path(path).filename().string())
             , m_shaderType(type)
@@ -25,6 +29,14 @@ namespace Resource
                 static_cast<int>(type));
         }
 
+        // Ű  -  Ű带 ũη ؼ 
+        ShaderResource(const std::string& path, ShaderType type, const std::string& entryPoint,
+            const ShaderKeywordSet& keywords, ShaderVariantKey variant)
+            : ShaderResource(path, type, entryPoint) {
+            m_variant = keywords.Sanitize(variant);
+            m_defines = keywords.GetDefines(m_variant);
+        }
+
         ~ShaderResource() override {
             Unload();
         }
@@ -37,31 +49,25 @@ namespace Resource
             UINT compileFlags = 0;
             IFDEBUG(compileFlags |= D3DCOMPILE_DEBUG | D3DCOMPILE_SKIP_OPTIMIZATION);
 
-            ComPtr<ID3DBlob> errorBlob = nullptr;
-            HRESULT hr = D3DCompileFromFile(
-                std::wstring(GetPath().begin(), GetPath().end()).c_str(),
-                nullptr,
-                D3D_COMPILE_STANDARD_FILE_INCLUDE,
-                m_entryPoint.c_str(),
-                GetShaderTarget().c_str(),
-                compileFlags,
-                0,
-                &m_shaderBlob,
-                &errorBlob);
-
-            if (FAILED(hr)) {
+            // ĳÿ  ó  Ʈڵ尡    
+            ShaderCompileRequest request{ GetPath(), m_entryPoint, GetShaderTarget(), compileFlags, m_defines };
+            std::vector<uint8_t> bytecode;
+            std::string errorMsg;
+
+            if (!ShaderCache::Instance().GetOrCompile(request, bytecode, errorMsg, &m_includes) ||
+                FAILED(D3DCreateBlob(bytecode.size(), &m_shaderBlob))) {
                 SetState(State::Failed);
-                std::string errorMsg = errorBlob ?
-                    static_cast<const char*>(errorBlob->GetBufferPointer()) :
-                    "Unknown error";
-                Logger::Instance().Error("̴  : {} - {}", GetPath(), errorMsg);
+                Logger::Instance().Error("̴  : {} - {}", GetPath(),
+                    errorMsg.empty() ? "Unknown error" : errorMsg);
                 return false;
             }
+            std::memcpy(m_shaderBlob->GetBufferPointer(), bytecode.data(), bytecode.size());
 
             SetState(State::Ready);
             SetSize(m_shaderBlob->GetBufferSize());
 
-            Logger::Instance().Info("̴ ε Ϸ: {} ({}bytes)", GetName(), GetSize());
+            Logger::Instance().Info("̴ ε Ϸ: {} {}  {:#x} ({}bytes)",
+                GetName(), m_entryPoint, m_variant, GetSize());
             return true;
         }
 
@@ -73,9 +79,34 @@ namespace Resource
             }
         }
 
+        std::shared_ptr<IResource> CreateReloadCopy() const override {
+            auto copy = std::make_shared<ShaderResource>(GetPath(), m_shaderType, m_entryPoint);
+            copy->m_variant = m_variant;
+            copy->m_defines = m_defines;
+            return copy;
+        }
+
+        bool SwapContents(IResource& source) override {
+            auto* other = dynamic_cast<ShaderResource*>(&source);
+            if (!other) return false;
+
+            m_shaderBlob.Swap(other->m_shaderBlob);
+            m_includes.swap(other->m_includes);
+            SwapBase(*other);
+            return true;
+        }
+
+        // ̴ ϰ #include  
+        std::vector<std::string> GetDependencies() const override {
+            std::vector<std::string> files = m_includes;
+            files.push_back(GetPath());
+            return files;
+        }
+
         ID3DBlob* GetShaderBlob() const { return m_shaderBlob.Get(); }
         const std::string& GetEntryPoint() const { return m_entryPoint; }
         ShaderType GetShaderType() const { return m_shaderType; }
+        ShaderVariantKey GetVariant() const { return m_variant; }
 
     private:
         std::string GetShaderTarget() const {
@@ -93,6 +124,9 @@ namespace Resource
 
         ShaderType m_shaderType;
         std::string m_entryPoint;
+        ShaderVariantKey m_variant = 0;
+        std::vector<std::pair<std::string, std::string>> m_defines;
+        std::vector<std::string> m_includes;
         ComPtr<ID3DBlob> m_shaderBlob;
     };
 }
\ No newline at end of file
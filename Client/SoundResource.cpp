@@ -0,0 +1,237 @@
+#include "pch.h"
+#include "SoundResource.h"
+
+namespace Resource
+{
+    namespace
+    {
+        constexpr uint16_t WaveFormatPcm = 0x0001;
+        constexpr uint16_t WaveFormatFloat = 0x0003;
+        constexpr uint16_t WaveFormatExtensible = 0xFFFE;
+
+        template<typename T>
+        T ReadLE(const uint8_t* p) {
+            T value;
+            std::memcpy(&value, p, sizeof(T));
+            return value;
+        }
+
+        bool IsChunk(const uint8_t* p, const char (&id)[5]) {
+            return std::memcmp(p, id, 4) == 0;
+        }
+    }
+
+    bool SoundResource::ParseWave(std::span<const uint8_t> bytes, WaveInfo& info, std::string& error)
+    {
+        info = {};
+        if (bytes.size() < 12 || !IsChunk(bytes.data(), "RIFF") || !IsChunk(bytes.data() + 8, "WAVE")) {
+            error = "RIFF/WAVE  ƴմϴ";
+            return false;
+        }
+
+        bool hasFormat = false;
+        size_t offset = 12;
+        while (offset + 8 <= bytes.size()) {
+            const uint8_t* chunk = bytes.data() + offset;
+            const uint32_t chunkSize = ReadLE<uint32_t>(chunk + 4);
+            const size_t bodyOffset = offset + 8;
+            const size_t available = std::min<size_t>(chunkSize, bytes.size() - bodyOffset);
+
+            if (IsChunk(chunk, "fmt ")) {
+                if (available < 16) {
+                    error = "fmt ûũ ʹ ªϴ";
+                    return false;
+                }
+                const uint8_t* body = chunk + 8;
+                uint16_t tag = ReadLE<uint16_t>(body);
+                info.format.channels = ReadLE<uint16_t>(body + 2);
+                info.format.sampleRate = ReadLE<uint32_t>(body + 4);
+                const uint16_t blockAlign = ReadLE<uint16_t>(body + 12);
+                info.format.bitsPerSample = ReadLE<uint16_t>(body + 14);
+
+                // WAVE_FORMAT_EXTENSIBLE  GUID  2Ʈ  
+                if (tag == WaveFormatExtensible) {
+                    if (available < 40) {
+                        error = "Ȯ fmt ûũ ʹ ªϴ";
+                        return false;
+                    }
+                    tag = ReadLE<uint16_t>(body + 24);
+                }
+
+                if (tag == WaveFormatPcm) {
+                    info.format.encoding = Encoding::Pcm;
+                    if (info.format.bitsPerSample != 8 && info.format.bitsPerSample != 16 &&
+                        info.format.bitsPerSample != 24 && info.format.bitsPerSample != 32) {
+                        error = std::format(" ʴ PCM Ʈ : {}", info.format.bitsPerSample);
+                        return false;
+                    }
+                }
+                else if (tag == WaveFormatFloat) {
+                    info.format.encoding = Encoding::Float;
+                    if (info.format.bitsPerSample != 32) {
+                        error = std::format(" ʴ float Ʈ : {}", info.format.bitsPerSample);
+                        return false;
+                    }
+                }
+                else {
+                    error = std::format(" ʴ WAV : 0x{:04X}", tag);
+                    return false;
+                }
+
+                if (info.format.channels < 1 || info.format.channels > 2) {
+                    error = std::format("/׷ մϴ (ä {})", info.format.channels);
+                    return false;
+                }
+                if (info.format.sampleRate == 0 || blockAlign != info.format.GetFrameSize()) {
+                    error = "fmt ûũ ÷Ʈ/  ߸";
+                    return false;
+                }
+                hasFormat = true;
+            }
+            else if (IsChunk(chunk, "data")) {
+                if (!hasFormat) {
+                    error = "data ûũ fmt ûũ տ ֽϴ";
+                    return false;
+                }
+                // ߸    ӱ
+                info.dataOffset = bodyOffset;
+                info.dataSize = available / info.format.GetFrameSize() * info.format.GetFrameSize();
+                return true;
+            }
+
+            // ûũ 2Ʈ  ä
+            offset = bodyOffset + chunkSize + (chunkSize & 1);
+        }
+
+        error = hasFormat ? "data ûũ ϴ" : "fmt ûũ ϴ";
+        return false;
+    }
+
+    void SoundResource::ConvertToFloat(const uint8_t* source, const Format& format, uint32_t frames, float* destination)
+    {
+        const size_t count = size_t(frames) * format.channels;
+
+        if (format.encoding == Encoding::Float) {
+            std::memcpy(destination, source, count * sizeof(float));
+            return;
+        }
+
+        switch (format.bitsPerSample) {
+        case 8:
+            for (size_t i = 0; i < count; ++i) {
+                destination[i] = (float(source[i]) - 128.0f) * (1.0f / 128.0f);
+            }
+            break;
+        case 16:
+            for (size_t i = 0; i < count; ++i) {
+                destination[i] = float(ReadLE<int16_t>(source + i * 2)) * (1.0f / 32768.0f);
+            }
+            break;
+        case 24:
+            for (size_t i = 0; i < count; ++i) {
+                const uint8_t* p = source + i * 3;
+                //  Ʈ  ȣ Ȯ
+                const int32_t value = int32_t(uint32_t(p[0]) << 8 | uint32_t(p[1]) << 16 | uint32_t(p[2]) << 24) >> 8;
+                destination[i] = float(value) * (1.0f / 8388608.0f);
+            }
+            break;
+        case 32:
+            for (size_t i = 0; i < count; ++i) {
+                destination[i] = float(double(ReadLE<int32_t>(source + i * 4)) * (1.0 / 2147483648.0));
+            }
+            break;
+        }
+    }
+
+    bool SoundResource::Load()
+    {
+        if (IsReady()) return true;
+
+        SetState(State::Loading);
+
+        try {
+            // Ű ,   
+            std::span<const uint8_t> bytes;
+            if ((m_packaged = ArchiveManager::Instance().Find(GetPath()))) {
+                bytes = m_packaged.bytes;
+            }
+            else if (m_mapped.Open(GetPath())) {
+                bytes = m_mapped.GetBytes();
+            }
+            else {
+                throw std::runtime_error("   ϴ");
+            }
+
+            WaveInfo info;
+            std::string error;
+            if (!ParseWave(bytes, info, error)) {
+                throw std::runtime_error(error);
+            }
+
+            m_format = info.format;
+            m_frameCount = info.dataSize / m_format.GetFrameSize();
+            m_data = bytes.data() + info.dataOffset;
+
+            const size_t decodedSize = m_frameCount * m_format.channels * sizeof(float);
+            m_streaming = decodedSize > StreamingThreshold;
+
+            if (!m_streaming) {
+                //  ڵϰ  
+                m_samples.resize(m_frameCount * m_format.channels);
+                ConvertToFloat(m_data, m_format, static_cast<uint32_t>(m_frameCount), m_samples.data());
+                m_data = nullptr;
+                m_packaged = {};
+                m_mapped.Close();
+                SetSize(decodedSize);
+            }
+            else {
+                //    ŭ ޸𸮸 Ƿ ũ  ۰ 
+                SetSize(sizeof(*this));
+            }
+
+            SetState(State::Ready);
+            Logger::Instance().Info(" ε Ϸ: {} ({}Hz, {}ch, {}Ʈ, {:.2f}, {})",
+                GetName(), m_format.sampleRate, m_format.channels, m_format.bitsPerSample,
+                GetDuration(), m_streaming ? "Ʈ" : "");
+            return true;
+        }
+        catch (const std::exception& e) {
+            Unload();
+            SetState(State::Failed);
+            Logger::Instance().Error(" ε : {} - {}", GetPath(), e.what());
+            return false;
+        }
+    }
+
+    void SoundResource::Unload()
+    {
+        if (m_frameCount == 0 && !m_mapped.IsOpen() && !m_packaged) return;
+
+        m_samples.clear();
+        m_samples.shrink_to_fit();
+        m_data = nullptr;
+        m_packaged = {};
+        m_mapped.Close();
+        m_frameCount = 0;
+        m_streaming = false;
+        SetSize(0);
+
+        SetState(State::Unloaded);
+        Logger::Instance().Debug(" ε: {}", GetName());
+    }
+
+    uint32_t SoundResource::Decode(uint64_t frame, uint32_t frames, float* destination) const
+    {
+        if (frame >= m_frameCount) return 0;
+        frames = static_cast<uint32_t>(std::min<uint64_t>(frames, m_frameCount - frame));
+
+        if (!m_streaming) {
+            std::memcpy(destination, m_samples.data() + frame * m_format.channels,
+                size_t(frames) * m_format.channels * sizeof(float));
+        }
+        else {
+            ConvertToFloat(m_data + frame * m_format.GetFrameSize(), m_format, frames, destination);
+        }
+        return frames;
+    }
+}
@@ -0,0 +1,91 @@
+#pragma once
+#include "pch.h"
+#include "IResource.h"
+#include "ArchiveManager.h"
+#include "MappedFile.h"
+#include "Logger.h"
+
+namespace Resource
+{
+    //  - WAV (PCM 8/16/24/32Ʈ , 32Ʈ float, /׷)
+    // - ª Ҹ(ȿ) ε   float ڵ 
+    // -  Ҹ(, ȯ)  θ  ΰ Ʈ 尡 Decode ݾ Ǯ  ۿ ä
+    // - ͼ 尡 д ߿  ٲ  ǹǷ  ε  
+    class SoundResource : public IResource {
+    public:
+        static constexpr Type ResourceType = Type::Sound;
+
+        // ڵ ũⰡ ̺ ũ Ʈ (48kHz ׷ float  2.7)
+        static constexpr size_t StreamingThreshold = 1024 * 1024;
+
+        enum class Encoding : uint8_t {
+            Pcm,        // ȣ ִ  (8Ʈ ȣ )
+            Float
+        };
+
+        struct Format {
+            uint32_t sampleRate = 0;
+            uint16_t channels = 0;
+            uint16_t bitsPerSample = 0;
+            Encoding encoding = Encoding::Pcm;
+
+            uint32_t GetFrameSize() const { return channels * (bitsPerSample / 8u); }
+        };
+
+        //  ȿ data ûũ ġ
+        struct WaveInfo {
+            Format format;
+            size_t dataOffset = 0;
+            size_t dataSize = 0;
+        };
+
+        explicit SoundResource(const std::string& path)
+            : IResource(Type::Sound, path, std::filesystem::path(path).filename().string())
+        {
+            Logger::Instance().Debug(" ҽ : {}", GetName());
+        }
+
+        ~SoundResource() override {
+            Unload();
+        }
+
+        bool Load() override;
+        void Unload() override;
+
+        // RIFF/WAVE  ؼ (fmt, data ûũ   ûũ ǳʶ)
+        static bool ParseWave(std::span<const uint8_t> bytes, WaveInfo& info, std::string& error);
+
+        //  ȯ - frames  interleaved float ( [-1, 1) ȭ)
+        static void ConvertToFloat(const uint8_t* source, const Format& format, uint32_t frames, float* destination);
+
+        const Format& GetFormat() const { return m_format; }
+        uint32_t GetChannels() const { return m_format.channels; }
+        uint32_t GetSampleRate() const { return m_format.sampleRate; }
+        uint64_t GetFrameCount() const { return m_frameCount; }
+        double GetDuration() const {
+            return m_format.sampleRate ? double(m_frameCount) / m_format.sampleRate : 0.0;
+        }
+
+        bool IsStreaming() const { return m_streaming; }
+
+        //   (interleaved float, Ʈ̸  )
+        std::span<const float> GetSamples() const { return m_samples; }
+
+        // frame ִ frames interleaved float ڵϰ  ڵ   ȯ
+        // /Ʈ  .  忡 ÿ ȣص 
+        // Ʈ ʹ ε  ó   ũ IO ϾǷ ͼ 忡 ȣ  
+        uint32_t Decode(uint64_t frame, uint32_t frames, float* destination) const;
+
+    private:
+        Format m_format;
+        uint64_t m_frameCount = 0;
+        bool m_streaming = false;
+
+        std::vector<float> m_samples;
+
+        // Ʈ  (Ű ׸ Ǵ  )
+        AssetData m_packaged;
+        MappedFile m_mapped;
+        const uint8_t* m_data = nullptr;
+    };
+}
@@ -0,0 +1,72 @@
+#include "pch.h"
+#include "TaskSystem.h"
+#include "Logger.h"
+
+TaskSystem& TaskSystem::Instance()
+{
+    static TaskSystem instance;
+    return instance;
+}
+
+bool TaskSystem::Initialize(uint32_t threadCount)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_initialized.load(std::memory_order_relaxed)) {
+        return true;
+    }
+
+    const uint32_t hardwareThreads = std::max(std::thread::hardware_concurrency(), 1u);
+    m_concurrency = threadCount ? std::min(threadCount, hardwareThreads) : hardwareThreads;
+
+    // μ ü TBB    (  parallel_for )
+    m_control = std::make_unique<tbb::global_control>(
+        tbb::global_control::max_allowed_parallelism, m_concurrency);
+
+    constexpr tbb::task_arena::priority priorities[] = {
+        tbb::task_arena::priority::low,
+        tbb::task_arena::priority::normal,
+        tbb::task_arena::priority::high
+    };
+    for (size_t i = 0; i < m_arenas.size(); ++i) {
+        //   ü       Ŀ  Ǯ Ƿ    
+        m_arenas[i] = std::make_unique<tbb::task_arena>(static_cast<int>(m_concurrency), 1u, priorities[i]);
+        m_arenas[i]->initialize();
+    }
+
+    m_initialized.store(true, std::memory_order_release);
+    Logger::Instance().Info("۾ ý ʱȭ:   {} (Ŀ {})", m_concurrency, GetWorkerCount());
+    return true;
+}
+
+void TaskSystem::Shutdown()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (!m_initialized.load(std::memory_order_relaxed)) {
+        return;
+    }
+
+    // ð  ۾ ⸦ ٸ Ƿ ϴ (  )  ؾ 
+    for (auto& arena : m_arenas) {
+        arena.reset();
+    }
+    m_control.reset();
+    m_initialized.store(false, std::memory_order_release);
+}
+
+tbb::task_arena& TaskSystem::GetArena(Priority priority)
+{
+    if (!IsInitialized()) {
+        Initialize();
+    }
+    return *m_arenas[static_cast<size_t>(priority)];
+}
+
+const char* TaskSystem::GetPriorityName(Priority priority)
+{
+    switch (priority) {
+    case Priority::Low:     return "";
+    case Priority::Normal:  return "";
+    case Priority::High:    return "";
+    default:                return "  ";
+    }
+}
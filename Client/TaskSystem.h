@@ -0,0 +1,61 @@
+#pragma once
+#include "pch.h"
+
+//   TBB ۾ 
+// - 켱 task_arena ϳ TBB Ŀ Ǯ   (    Ŀ   )
+// - ü    global_control   ϹǷ  ų  ۿ parallel_for ҷ
+//   ھ   尡 ÿ  
+// - (TbbCpuDispatcher), ҽ    ۾    ⿡ 
+class TaskSystem {
+public:
+    enum class Priority {
+        Low,        // ׶  (޽/ؽó ŷ )
+        Normal,
+        High,       //  ȿ  ϴ  ( )
+        Count
+    };
+
+    static TaskSystem& Instance();
+
+    // threadCount:  带     (0̸ ϵ  )
+    // ó GetArena   忡   ȣ. ȣ  ⺻ ʱȭ
+    bool Initialize(uint32_t threadCount = 0);
+    void Shutdown();
+
+    bool IsInitialized() const { return m_initialized.load(std::memory_order_acquire); }
+
+    uint32_t GetConcurrency() const { return m_concurrency; }
+
+    //   Ŀ  (    ڸ )
+    uint32_t GetWorkerCount() const { return std::max(m_concurrency, 2u) - 1; }
+
+    tbb::task_arena& GetArena(Priority priority = Priority::Normal);
+
+    // ȣ 尡   f  (ȿ θ parallel_for   Ŀ )
+    template<typename F>
+    auto Execute(F&& f, Priority priority = Priority::Normal) {
+        return GetArena(priority).execute(std::forward<F>(f));
+    }
+
+    // ٸ ʰ  Ŀ ñ
+    template<typename F>
+    void Enqueue(F&& f, Priority priority = Priority::Normal) {
+        GetArena(priority).enqueue(std::forward<F>(f));
+    }
+
+    static const char* GetPriorityName(Priority priority);
+
+private:
+    TaskSystem() = default;
+    ~TaskSystem() { Shutdown(); }
+
+    TaskSystem(const TaskSystem&) = delete;
+    TaskSystem& operator=(const TaskSystem&) = delete;
+
+    std::mutex m_mutex;
+    std::atomic<bool> m_initialized = false;
+    uint32_t m_concurrency = 0;
+
+    std::unique_ptr<tbb::global_control> m_control;
+    std::array<std::unique_ptr<tbb::task_arena>, static_cast<size_t>(Priority::Count)> m_arenas;
+};
@@ -0,0 +1,21 @@
+#include "pch.h"
+#include "TbbCpuDispatcher.h"
+
+TbbCpuDispatcher::TbbCpuDispatcher(TaskSystem::Priority priority, uint32_t workerCount)
+	: m_arena(TaskSystem::Instance().GetArena(priority))
+	, m_priority(priority)
+{
+	const uint32_t available = TaskSystem::Instance().GetWorkerCount();
+	m_workerCount = workerCount ? std::min(workerCount, available) : available;
+}
+
+void TbbCpuDispatcher::submitTask(PxBaseTask& task)
+{
+	// Ŀ 忡  ۾ ѱ    ̹Ƿ ٸ  ϰ  ھ   
+	// release ڿ ۾   Ƿ  ȣ
+	PxBaseTask* pending = &task;
+	m_arena.enqueue([pending] {
+		pending->run();
+		pending->release();
+	});
+}
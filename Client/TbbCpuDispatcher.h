@@ -0,0 +1,27 @@
+#pragma once
+#include "PhysicsTypes.h"
+#include "TaskSystem.h"
+
+// PhysX ۾ TaskSystem TBB   ó
+// PxDefaultCpuDispatcheró  带  Ƿ  ٸ  ۾  Ŀ  
+// PhysX ۾ 켱  ó  (켱) 
+class TbbCpuDispatcher : public PxCpuDispatcher
+{
+public:
+	// workerCount: PhysX ˷  Ŀ  (0̸  Ŀ ). PhysX    ۾ 
+	explicit TbbCpuDispatcher(TaskSystem::Priority priority = TaskSystem::Priority::High, uint32_t workerCount = 0);
+
+	void submitTask(PxBaseTask& task) override;
+	uint32_t getWorkerCount() const override { return m_workerCount; }
+
+	TaskSystem::Priority GetPriority() const { return m_priority; }
+
+protected:
+	//  Ļ ó   ۾    (PhysicsEngine::SetDispatcher ġ)
+	tbb::task_arena& GetArena() const { return m_arena; }
+
+private:
+	tbb::task_arena& m_arena;
+	TaskSystem::Priority m_priority;
+	uint32_t m_workerCount;
+};
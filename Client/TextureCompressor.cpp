@@ -0,0 +1,783 @@
+#include "pch.h"
+#include "TextureCompressor.h"
+
+namespace Resource
+{
+    namespace TextureCompressor
+    {
+        namespace
+        {
+            constexpr size_t BlockPixels = 16;
+
+            //  16ȼ äκ (SSE 4ȼ x 4)
+            struct BlockChannels {
+                alignas(16) float values[4][BlockPixels];
+            };
+
+            void LoadChannels(const uint8_t* pixels, BlockChannels& block)
+            {
+                for (size_t i = 0; i < BlockPixels; ++i) {
+                    for (int k = 0; k < 4; ++k) {
+                        block.values[k][i] = pixels[i * 4 + k];
+                    }
+                }
+            }
+
+            // ּ  (л  ŵ ݺ). channels äθ 
+            void ComputePrincipalAxis(const BlockChannels& block, int channels, float mean[4], float axis[4])
+            {
+                for (int k = 0; k < 4; ++k) {
+                    mean[k] = 0.0f;
+                    axis[k] = 0.0f;
+                }
+                for (int k = 0; k < channels; ++k) {
+                    for (size_t i = 0; i < BlockPixels; ++i) {
+                        mean[k] += block.values[k][i];
+                    }
+                    mean[k] /= BlockPixels;
+                }
+
+                float covariance[4][4] = {};
+                for (size_t i = 0; i < BlockPixels; ++i) {
+                    float d[4];
+                    for (int k = 0; k < channels; ++k) {
+                        d[k] = block.values[k][i] - mean[k];
+                    }
+                    for (int a = 0; a < channels; ++a) {
+                        for (int b = a; b < channels; ++b) {
+                            covariance[a][b] += d[a] * d[b];
+                        }
+                    }
+                }
+                for (int a = 0; a < channels; ++a) {
+                    for (int b = 0; b < a; ++b) {
+                        covariance[a][b] = covariance[b][a];
+                    }
+                }
+
+                //  л ū ä ⿡  (1 ϸ Ī  0 ͷ   )
+                int largest = 0;
+                for (int k = 1; k < channels; ++k) {
+                    if (covariance[k][k] > covariance[largest][largest]) largest = k;
+                }
+                float v[4] = {};
+                for (int k = 0; k < channels; ++k) {
+                    v[k] = covariance[largest][k];
+                }
+
+                for (int iteration = 0; iteration < 8; ++iteration) {
+                    float next[4] = {};
+                    for (int a = 0; a < channels; ++a) {
+                        for (int b = 0; b < channels; ++b) {
+                            next[a] += covariance[a][b] * v[b];
+                        }
+                    }
+                    float length = 0.0f;
+                    for (int k = 0; k < channels; ++k) {
+                        length = std::max(length, std::abs(next[k]));
+                    }
+                    if (length <= 0.0f) break;
+                    for (int k = 0; k < channels; ++k) {
+                        v[k] = next[k] / length;
+                    }
+                }
+
+                float lengthSq = 0.0f;
+                for (int k = 0; k < channels; ++k) {
+                    lengthSq += v[k] * v[k];
+                }
+                if (lengthSq > 0.0f) {
+                    const float inverse = 1.0f / std::sqrt(lengthSq);
+                    for (int k = 0; k < channels; ++k) {
+                        axis[k] = v[k] * inverse;
+                    }
+                }
+            }
+
+            //     [minT, maxT]
+            void ProjectRange(const BlockChannels& block, int channels, const float mean[4], const float axis[4],
+                float& minT, float& maxT)
+            {
+                minT = FLT_MAX;
+                maxT = -FLT_MAX;
+                for (size_t i = 0; i < BlockPixels; ++i) {
+                    float t = 0.0f;
+                    for (int k = 0; k < channels; ++k) {
+                        t += (block.values[k][i] - mean[k]) * axis[k];
+                    }
+                    minT = std::min(minT, t);
+                    maxT = std::max(maxT, t);
+                }
+            }
+
+            // ȷƮ   ׸ - 4ȼ SSE  ȷƮ ׸ 
+            // palette[p][k]: p ׸ k ä. ȯ   
+            float FindIndices(const BlockChannels& block, int channels, const float (*palette)[4], int paletteSize,
+                uint8_t indices[BlockPixels])
+            {
+                __m128 total = _mm_setzero_ps();
+                for (int group = 0; group < 4; ++group) {
+                    __m128 values[4];
+                    for (int k = 0; k < channels; ++k) {
+                        values[k] = _mm_load_ps(block.values[k] + group * 4);
+                    }
+
+                    __m128 best = _mm_set1_ps(FLT_MAX);
+                    __m128i bestIndex = _mm_setzero_si128();
+                    for (int p = 0; p < paletteSize; ++p) {
+                        __m128 distance = _mm_setzero_ps();
+                        for (int k = 0; k < channels; ++k) {
+                            const __m128 d = _mm_sub_ps(values[k], _mm_set1_ps(palette[p][k]));
+                            distance = _mm_add_ps(distance, _mm_mul_ps(d, d));
+                        }
+                        const __m128i closer = _mm_castps_si128(_mm_cmplt_ps(distance, best));
+                        bestIndex = _mm_or_si128(_mm_and_si128(closer, _mm_set1_epi32(p)), _mm_andnot_si128(closer, bestIndex));
+                        best = _mm_min_ps(best, distance);
+                    }
+                    total = _mm_add_ps(total, best);
+
+                    alignas(16) int32_t lanes[4];
+                    _mm_store_si128(reinterpret_cast<__m128i*>(lanes), bestIndex);
+                    for (int lane = 0; lane < 4; ++lane) {
+                        indices[group * 4 + lane] = static_cast<uint8_t>(lanes[lane]);
+                    }
+                }
+
+                alignas(16) float sums[4];
+                _mm_store_ps(sums, total);
+                return sums[0] + sums[1] + sums[2] + sums[3];
+            }
+
+            // ε    ּ   (weights[i]: i ε  1 )
+            bool SolveEndpoints(const BlockChannels& block, int channels, const uint8_t indices[BlockPixels],
+                const float* weights, float endpoint0[4], float endpoint1[4])
+            {
+                float aa = 0.0f, bb = 0.0f, ab = 0.0f;
+                float ax[4] = {}, bx[4] = {};
+                for (size_t i = 0; i < BlockPixels; ++i) {
+                    const float beta = weights[indices[i]];
+                    const float alpha = 1.0f - beta;
+                    aa += alpha * alpha;
+                    bb += beta * beta;
+                    ab += alpha * beta;
+                    for (int k = 0; k < channels; ++k) {
+                        ax[k] += alpha * block.values[k][i];
+                        bx[k] += beta * block.values[k][i];
+                    }
+                }
+
+                const float determinant = aa * bb - ab * ab;
+                if (std::abs(determinant) < 1e-6f) return false;
+
+                const float inverse = 1.0f / determinant;
+                for (int k = 0; k < channels; ++k) {
+                    endpoint0[k] = std::clamp((ax[k] * bb - bx[k] * ab) * inverse, 0.0f, 255.0f);
+                    endpoint1[k] = std::clamp((bx[k] * aa - ax[k] * ab) * inverse, 0.0f, 255.0f);
+                }
+                return true;
+            }
+
+            //-------------------------------------------------------------------------------------
+            // BC1
+
+            uint16_t To565(const float color[3])
+            {
+                const int r = std::clamp(static_cast<int>(color[0] * 31.0f / 255.0f + 0.5f), 0, 31);
+                const int g = std::clamp(static_cast<int>(color[1] * 63.0f / 255.0f + 0.5f), 0, 63);
+                const int b = std::clamp(static_cast<int>(color[2] * 31.0f / 255.0f + 0.5f), 0, 31);
+                return static_cast<uint16_t>((r << 11) | (g << 5) | b);
+            }
+
+            // ڴ   ȷƮ (c0 > c1̸ 4, ƴϸ 3 + )
+            void BC1Palette(uint16_t c0, uint16_t c1, int palette[4][4])
+            {
+                const uint16_t colors[2] = { c0, c1 };
+                for (int e = 0; e < 2; ++e) {
+                    const int r = (colors[e] >> 11) & 31;
+                    const int g = (colors[e] >> 5) & 63;
+                    const int b = colors[e] & 31;
+                    palette[e][0] = (r << 3) | (r >> 2);
+                    palette[e][1] = (g << 2) | (g >> 4);
+                    palette[e][2] = (b << 3) | (b >> 2);
+                    palette[e][3] = 255;
+                }
+                for (int k = 0; k < 3; ++k) {
+                    if (c0 > c1) {
+                        palette[2][k] = (2 * palette[0][k] + palette[1][k]) / 3;
+                        palette[3][k] = (palette[0][k] + 2 * palette[1][k]) / 3;
+                    }
+                    else {
+                        palette[2][k] = (palette[0][k] + palette[1][k]) / 2;
+                        palette[3][k] = 0;
+                    }
+                }
+                palette[2][3] = 255;
+                palette[3][3] = c0 > c1 ? 255 : 0;
+            }
+
+            // ܻ Ͽ - 2:1 (ȷƮ 2) ǥ     (bits: 5 Ǵ 6)
+            //  ׳ ݿøϸ 565 ȭ  äδ ִ 4 
+            struct SingleColorTable {
+                uint8_t endpoints[256][2];
+
+                explicit SingleColorTable(int bits) {
+                    const int levels = 1 << bits;
+                    for (int value = 0; value < 256; ++value) {
+                        int bestError = std::numeric_limits<int>::max();
+                        for (int a = 0; a < levels; ++a) {
+                            for (int b = 0; b < levels; ++b) {
+                                const int ea = bits == 5 ? (a << 3) | (a >> 2) : (a << 2) | (a >> 4);
+                                const int eb = bits == 5 ? (b << 3) | (b >> 2) : (b << 2) | (b >> 4);
+                                const int error = std::abs((2 * ea + eb) / 3 - value);
+                                if (error < bestError) {
+                                    bestError = error;
+                                    endpoints[value][0] = static_cast<uint8_t>(a);
+                                    endpoints[value][1] = static_cast<uint8_t>(b);
+                                }
+                            }
+                        }
+                    }
+                }
+            };
+
+            void CompressSolidBC1(const uint8_t* color, uint8_t* block)
+            {
+                static const SingleColorTable table5(5);
+                static const SingleColorTable table6(6);
+
+                uint16_t c0 = static_cast<uint16_t>((table5.endpoints[color[0]][0] << 11) |
+                    (table6.endpoints[color[1]][0] << 5) | table5.endpoints[color[2]][0]);
+                uint16_t c1 = static_cast<uint16_t>((table5.endpoints[color[0]][1] << 11) |
+                    (table6.endpoints[color[1]][1] << 5) | table5.endpoints[color[2]][1]);
+
+                // ȷƮ 2 c0 > c1  2:1  -  ݴ ٲٰ 3(1:2) 
+                uint32_t indices = 0xAAAAAAAA;
+                if (c0 < c1) {
+                    std::swap(c0, c1);
+                    indices = 0xFFFFFFFF;
+                }
+                else if (c0 == c1) {
+                    indices = 0;
+                }
+
+                std::memcpy(block, &c0, 2);
+                std::memcpy(block + 2, &c1, 2);
+                std::memcpy(block + 4, &indices, 4);
+            }
+
+            // 4  ε  (c0 < c1̸  ٲ). ȯ 
+            float FitBC1(const BlockChannels& block, uint16_t& c0, uint16_t& c1, uint32_t& packed)
+            {
+                if (c0 < c1) std::swap(c0, c1);
+
+                int palette[4][4];
+                BC1Palette(c0, c1, palette);
+
+                // c0 == c1̸ 3  3  - 0 
+                const int paletteSize = c0 == c1 ? 1 : 4;
+                float floatPalette[4][4];
+                for (int p = 0; p < 4; ++p) {
+                    for (int k = 0; k < 4; ++k) {
+                        floatPalette[p][k] = static_cast<float>(palette[p][k]);
+                    }
+                }
+
+                uint8_t indices[BlockPixels];
+                const float error = FindIndices(block, 3, floatPalette, paletteSize, indices);
+
+                packed = 0;
+                for (size_t i = 0; i < BlockPixels; ++i) {
+                    packed |= static_cast<uint32_t>(indices[i]) << (i * 2);
+                }
+                return error;
+            }
+
+            void CompressBC1(const uint8_t* pixels, uint8_t* block)
+            {
+                bool solid = true;
+                for (size_t i = 1; i < BlockPixels && solid; ++i) {
+                    solid = std::memcmp(pixels, pixels + i * 4, 3) == 0;
+                }
+                if (solid) {
+                    CompressSolidBC1(pixels, block);
+                    return;
+                }
+
+                BlockChannels channels;
+                LoadChannels(pixels, channels);
+
+                float mean[4], axis[4];
+                ComputePrincipalAxis(channels, 3, mean, axis);
+
+                float minT, maxT;
+                ProjectRange(channels, 3, mean, axis, minT, maxT);
+
+                //    1/16ŭ  -  ȭ   鿡  
+                const float inset = (maxT - minT) / 16.0f;
+                float endpoint0[3], endpoint1[3];
+                for (int k = 0; k < 3; ++k) {
+                    endpoint0[k] = std::clamp(mean[k] + axis[k] * (maxT - inset), 0.0f, 255.0f);
+                    endpoint1[k] = std::clamp(mean[k] + axis[k] * (minT + inset), 0.0f, 255.0f);
+                }
+
+                uint16_t c0 = To565(endpoint0);
+                uint16_t c1 = To565(endpoint1);
+                uint32_t indices = 0;
+                float error = FitBC1(channels, c0, c1, indices);
+
+                // ּ    ٵ (ε 0/1/2/3 =  1  0, 1, 1/3, 2/3)
+                static constexpr float Weights[4] = { 0.0f, 1.0f, 1.0f / 3.0f, 2.0f / 3.0f };
+                if (c0 != c1) {
+                    uint8_t unpacked[BlockPixels];
+                    for (size_t i = 0; i < BlockPixels; ++i) {
+                        unpacked[i] = (indices >> (i * 2)) & 3;
+                    }
+
+                    float refined0[4], refined1[4];
+                    if (SolveEndpoints(channels, 3, unpacked, Weights, refined0, refined1)) {
+                        uint16_t r0 = To565(refined0);
+                        uint16_t r1 = To565(refined1);
+                        uint32_t refinedIndices = 0;
+                        const float refinedError = FitBC1(channels, r0, r1, refinedIndices);
+                        if (refinedError < error) {
+                            c0 = r0;
+                            c1 = r1;
+                            indices = refinedIndices;
+                        }
+                    }
+                }
+
+                std::memcpy(block, &c0, 2);
+                std::memcpy(block + 2, &c1, 2);
+                std::memcpy(block + 4, &indices, 4);
+            }
+
+            void DecompressBC1(const uint8_t* block, uint8_t* pixels)
+            {
+                uint16_t c0, c1;
+                uint32_t indices;
+                std::memcpy(&c0, block, 2);
+                std::memcpy(&c1, block + 2, 2);
+                std::memcpy(&indices, block + 4, 4);
+
+                int palette[4][4];
+                BC1Palette(c0, c1, palette);
+                for (size_t i = 0; i < BlockPixels; ++i) {
+                    const int index = (indices >> (i * 2)) & 3;
+                    for (int k = 0; k < 4; ++k) {
+                        pixels[i * 4 + k] = static_cast<uint8_t>(palette[index][k]);
+                    }
+                }
+            }
+
+            //-------------------------------------------------------------------------------------
+            // BC4 (BC3 , BC5  äε  )
+
+            // r0 > r1̸ 8ܰ, ƴϸ 6ܰ + 0/255
+            void BC4Palette(uint8_t r0, uint8_t r1, int palette[8])
+            {
+                palette[0] = r0;
+                palette[1] = r1;
+                if (r0 > r1) {
+                    for (int k = 1; k <= 6; ++k) {
+                        palette[k + 1] = ((7 - k) * r0 + k * r1 + 3) / 7;
+                    }
+                }
+                else {
+                    for (int k = 1; k <= 4; ++k) {
+                        palette[k + 1] = ((5 - k) * r0 + k * r1 + 2) / 5;
+                    }
+                    palette[6] = 0;
+                    palette[7] = 255;
+                }
+            }
+
+            void CompressBC4(const uint8_t* pixels, int channel, uint8_t* block)
+            {
+                BlockChannels values;
+                uint8_t minValue = 255;
+                uint8_t maxValue = 0;
+                for (size_t i = 0; i < BlockPixels; ++i) {
+                    const uint8_t v = pixels[i * 4 + channel];
+                    values.values[0][i] = v;
+                    minValue = std::min(minValue, v);
+                    maxValue = std::max(maxValue, v);
+                }
+
+                //  ̸ 6ܰ  0 (r0 == r1)
+                const uint8_t r0 = maxValue;
+                const uint8_t r1 = minValue;
+
+                int palette[8];
+                BC4Palette(r0, r1, palette);
+                float floatPalette[8][4] = {};
+                for (int p = 0; p < 8; ++p) {
+                    floatPalette[p][0] = static_cast<float>(palette[p]);
+                }
+
+                uint8_t indices[BlockPixels];
+                FindIndices(values, 1, floatPalette, r0 > r1 ? 8 : 1, indices);
+
+                uint64_t packed = 0;
+                for (size_t i = 0; i < BlockPixels; ++i) {
+                    packed |= static_cast<uint64_t>(indices[i]) << (i * 3);
+                }
+                block[0] = r0;
+                block[1] = r1;
+                for (int b = 0; b < 6; ++b) {
+                    block[2 + b] = static_cast<uint8_t>(packed >> (b * 8));
+                }
+            }
+
+            void DecompressBC4(const uint8_t* block, int channel, uint8_t* pixels)
+            {
+                int palette[8];
+                BC4Palette(block[0], block[1], palette);
+
+                uint64_t packed = 0;
+                for (int b = 0; b < 6; ++b) {
+                    packed |= static_cast<uint64_t>(block[2 + b]) << (b * 8);
+                }
+                for (size_t i = 0; i < BlockPixels; ++i) {
+                    pixels[i * 4 + channel] = static_cast<uint8_t>(palette[(packed >> (i * 3)) & 7]);
+                }
+            }
+
+            //-------------------------------------------------------------------------------------
+            // BC7  6 -  RGBA 7Ʈ +  pƮ, ε 4Ʈ
+
+            constexpr int BC7Weights[16] = { 0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64 };
+
+            struct BC7Endpoint {
+                uint8_t value[4];   // 7Ʈ
+                uint8_t pbit;
+
+                int Expand(int k) const { return (value[k] << 1) | pbit; }
+            };
+
+            // pƮ    ȭ   
+            BC7Endpoint QuantizeBC7(const float color[4])
+            {
+                BC7Endpoint best{};
+                float bestError = FLT_MAX;
+                for (uint8_t pbit = 0; pbit < 2; ++pbit) {
+                    BC7Endpoint candidate{};
+                    candidate.pbit = pbit;
+                    float error = 0.0f;
+                    for (int k = 0; k < 4; ++k) {
+                        candidate.value[k] = static_cast<uint8_t>(std::clamp(
+                            static_cast<int>((color[k] - pbit) * 0.5f + 0.5f), 0, 127));
+                        const float d = color[k] - candidate.Expand(k);
+                        error += d * d;
+                    }
+                    if (error < bestError) {
+                        bestError = error;
+                        best = candidate;
+                    }
+                }
+                return best;
+            }
+
+            void BC7Palette(const BC7Endpoint& e0, const BC7Endpoint& e1, int palette[16][4])
+            {
+                for (int p = 0; p < 16; ++p) {
+                    for (int k = 0; k < 4; ++k) {
+                        palette[p][k] = ((64 - BC7Weights[p]) * e0.Expand(k) + BC7Weights[p] * e1.Expand(k) + 32) >> 6;
+                    }
+                }
+            }
+
+            float FitBC7(const BlockChannels& block, const BC7Endpoint& e0, const BC7Endpoint& e1, uint8_t indices[BlockPixels])
+            {
+                int palette[16][4];
+                BC7Palette(e0, e1, palette);
+                float floatPalette[16][4];
+                for (int p = 0; p < 16; ++p) {
+                    for (int k = 0; k < 4; ++k) {
+                        floatPalette[p][k] = static_cast<float>(palette[p][k]);
+                    }
+                }
+                return FindIndices(block, 4, floatPalette, 16, indices);
+            }
+
+            // 128Ʈ  Ʈ ä
+            class BitWriter {
+            public:
+                explicit BitWriter(uint8_t* block) : m_block(block) { std::memset(block, 0, 16); }
+
+                void Write(uint32_t value, int bits) {
+                    for (int b = 0; b < bits; ++b, ++m_position) {
+                        m_block[m_position >> 3] |= static_cast<uint8_t>(((value >> b) & 1) << (m_position & 7));
+                    }
+                }
+
+            private:
+                uint8_t* m_block;
+                int m_position = 0;
+            };
+
+            class BitReader {
+            public:
+                explicit BitReader(const uint8_t* block) : m_block(block) {}
+
+                uint32_t Read(int bits) {
+                    uint32_t value = 0;
+                    for (int b = 0; b < bits; ++b, ++m_position) {
+                        value |= static_cast<uint32_t>((m_block[m_position >> 3] >> (m_position & 7)) & 1) << b;
+                    }
+                    return value;
+                }
+
+            private:
+                const uint8_t* m_block;
+                int m_position = 0;
+            };
+
+            void CompressBC7(const uint8_t* pixels, uint8_t* block)
+            {
+                BlockChannels channels;
+                LoadChannels(pixels, channels);
+
+                float mean[4], axis[4];
+                ComputePrincipalAxis(channels, 4, mean, axis);
+
+                float minT, maxT;
+                ProjectRange(channels, 4, mean, axis, minT, maxT);
+
+                float endpoint0[4], endpoint1[4];
+                for (int k = 0; k < 4; ++k) {
+                    endpoint0[k] = std::clamp(mean[k] + axis[k] * minT, 0.0f, 255.0f);
+                    endpoint1[k] = std::clamp(mean[k] + axis[k] * maxT, 0.0f, 255.0f);
+                }
+
+                BC7Endpoint e0 = QuantizeBC7(endpoint0);
+                BC7Endpoint e1 = QuantizeBC7(endpoint1);
+                uint8_t indices[BlockPixels];
+                float error = FitBC7(channels, e0, e1, indices);
+
+                // ּ    ٵ
+                float weights[16];
+                for (int p = 0; p < 16; ++p) {
+                    weights[p] = BC7Weights[p] / 64.0f;
+                }
+                float refined0[4], refined1[4];
+                if (SolveEndpoints(channels, 4, indices, weights, refined0, refined1)) {
+                    const BC7Endpoint r0 = QuantizeBC7(refined0);
+                    const BC7Endpoint r1 = QuantizeBC7(refined1);
+                    uint8_t refinedIndices[BlockPixels];
+                    const float refinedError = FitBC7(channels, r0, r1, refinedIndices);
+                    if (refinedError < error) {
+                        e0 = r0;
+                        e1 = r1;
+                        std::memcpy(indices, refinedIndices, sizeof(indices));
+                    }
+                }
+
+                // 0 ȼ ε ֻ Ʈ 0̾  (3Ʈ ) - ƴϸ  ٲٰ ε 
+                if (indices[0] & 8) {
+                    std::swap(e0, e1);
+                    for (auto& index : indices) {
+                        index = static_cast<uint8_t>(15 - index);
+                    }
+                }
+
+                BitWriter writer(block);
+                writer.Write(1u << 6, 7);               //  6
+                for (int k = 0; k < 4; ++k) {
+                    writer.Write(e0.value[k], 7);
+                    writer.Write(e1.value[k], 7);
+                }
+                writer.Write(e0.pbit, 1);
+                writer.Write(e1.pbit, 1);
+                writer.Write(indices[0], 3);
+                for (size_t i = 1; i < BlockPixels; ++i) {
+                    writer.Write(indices[i], 4);
+                }
+            }
+
+            void DecompressBC7(const uint8_t* block, uint8_t* pixels)
+            {
+                BitReader reader(block);
+                if (reader.Read(7) != (1u << 6)) {
+                    //  6 ƴ -    ä
+                    for (size_t i = 0; i < BlockPixels; ++i) {
+                        pixels[i * 4 + 0] = 255;
+                        pixels[i * 4 + 1] = 0;
+                        pixels[i * 4 + 2] = 255;
+                        pixels[i * 4 + 3] = 255;
+                    }
+                    return;
+                }
+
+                BC7Endpoint e0{}, e1{};
+                for (int k = 0; k < 4; ++k) {
+                    e0.value[k] = static_cast<uint8_t>(reader.Read(7));
+                    e1.value[k] = static_cast<uint8_t>(reader.Read(7));
+                }
+                e0.pbit = static_cast<uint8_t>(reader.Read(1));
+                e1.pbit = static_cast<uint8_t>(reader.Read(1));
+
+                int palette[16][4];
+                BC7Palette(e0, e1, palette);
+                for (size_t i = 0; i < BlockPixels; ++i) {
+                    const uint32_t index = reader.Read(i == 0 ? 3 : 4);
+                    for (int k = 0; k < 4; ++k) {
+                        pixels[i * 4 + k] = static_cast<uint8_t>(palette[index][k]);
+                    }
+                }
+            }
+        }
+
+        size_t BytesPerBlock(Format format)
+        {
+            return format == Format::BC1 || format == Format::BC4 ? 8 : 16;
+        }
+
+        DXGI_FORMAT ToDXGIFormat(Format format, bool srgb)
+        {
+            switch (format) {
+            case Format::BC1: return srgb ? DXGI_FORMAT_BC1_UNORM_SRGB : DXGI_FORMAT_BC1_UNORM;
+            case Format::BC3: return srgb ? DXGI_FORMAT_BC3_UNORM_SRGB : DXGI_FORMAT_BC3_UNORM;
+            case Format::BC4: return DXGI_FORMAT_BC4_UNORM;
+            case Format::BC5: return DXGI_FORMAT_BC5_UNORM;
+            case Format::BC7: return srgb ? DXGI_FORMAT_BC7_UNORM_SRGB : DXGI_FORMAT_BC7_UNORM;
+            }
+            return DXGI_FORMAT_UNKNOWN;
+        }
+
+        bool IsColorFormat(Format format)
+        {
+            return format != Format::BC4 && format != Format::BC5;
+        }
+
+        const char* GetFormatName(Format format)
+        {
+            switch (format) {
+            case Format::BC1: return "BC1";
+            case Format::BC3: return "BC3";
+            case Format::BC4: return "BC4";
+            case Format::BC5: return "BC5";
+            case Format::BC7: return "BC7";
+            }
+            return "?";
+        }
+
+        std::optional<Format> ParseFormat(std::string_view name)
+        {
+            static constexpr Format Formats[] = { Format::BC1, Format::BC3, Format::BC4, Format::BC5, Format::BC7 };
+            for (Format format : Formats) {
+                const std::string_view formatName = GetFormatName(format);
+                if (name.size() == formatName.size() &&
+                    std::equal(name.begin(), name.end(), formatName.begin(),
+                        [](char a, char b) { return std::toupper(static_cast<unsigned char>(a)) == b; })) {
+                    return format;
+                }
+            }
+            return std::nullopt;
+        }
+
+        void CompressBlock(Format format, const uint8_t* pixels, uint8_t* block)
+        {
+            switch (format) {
+            case Format::BC1:
+                CompressBC1(pixels, block);
+                break;
+            case Format::BC3:
+                CompressBC4(pixels, 3, block);
+                CompressBC1(pixels, block + 8);
+                break;
+            case Format::BC4:
+                CompressBC4(pixels, 0, block);
+                break;
+            case Format::BC5:
+                CompressBC4(pixels, 0, block);
+                CompressBC4(pixels, 1, block + 8);
+                break;
+            case Format::BC7:
+                CompressBC7(pixels, block);
+                break;
+            }
+        }
+
+        void DecompressBlock(Format format, const uint8_t* block, uint8_t* pixels)
+        {
+            switch (format) {
+            case Format::BC1:
+                DecompressBC1(block, pixels);
+                break;
+            case Format::BC3:
+                DecompressBC1(block + 8, pixels);
+                DecompressBC4(block, 3, pixels);
+                break;
+            case Format::BC4:
+            case Format::BC5:
+                // ø   (R, G, 0, 1)
+                for (size_t i = 0; i < BlockPixels; ++i) {
+                    pixels[i * 4 + 1] = 0;
+                    pixels[i * 4 + 2] = 0;
+                    pixels[i * 4 + 3] = 255;
+                }
+                DecompressBC4(block, 0, pixels);
+                if (format == Format::BC5) {
+                    DecompressBC4(block + 8, 1, pixels);
+                }
+                break;
+            case Format::BC7:
+                DecompressBC7(block, pixels);
+                break;
+            }
+        }
+
+        std::vector<uint8_t> Compress(Format format, const TextureProcessing::Image& image)
+        {
+            const size_t blocksWide = std::max<size_t>(1, (image.width + 3) / 4);
+            const size_t blocksHigh = std::max<size_t>(1, (image.height + 3) / 4);
+            const size_t blockBytes = BytesPerBlock(format);
+
+            std::vector<uint8_t> blocks(blocksWide * blocksHigh * blockBytes);
+            if (image.width == 0 || image.height == 0) return blocks;
+
+            tbb::parallel_for(size_t(0), blocksHigh, [&](size_t by) {
+                uint8_t pixels[BlockPixels * 4];
+                for (size_t bx = 0; bx < blocksWide; ++bx) {
+                    for (uint32_t y = 0; y < 4; ++y) {
+                        const uint32_t sy = std::min<uint32_t>(static_cast<uint32_t>(by * 4 + y), image.height - 1);
+                        for (uint32_t x = 0; x < 4; ++x) {
+                            const uint32_t sx = std::min<uint32_t>(static_cast<uint32_t>(bx * 4 + x), image.width - 1);
+                            std::memcpy(pixels + (y * 4 + x) * 4, image.GetPixel(sx, sy), 4);
+                        }
+                    }
+                    CompressBlock(format, pixels, blocks.data() + (by * blocksWide + bx) * blockBytes);
+                }
+            });
+            return blocks;
+        }
+
+        TextureProcessing::Image Decompress(Format format, std::span<const uint8_t> blocks, uint32_t width, uint32_t height)
+        {
+            TextureProcessing::Image image;
+            image.width = width;
+            image.height = height;
+            image.pixels.resize(image.GetRowPitch() * height);
+
+            const size_t blocksWide = std::max<size_t>(1, (width + 3) / 4);
+            const size_t blocksHigh = std::max<size_t>(1, (height + 3) / 4);
+            const size_t blockBytes = BytesPerBlock(format);
+            if (blocks.size() < blocksWide * blocksHigh * blockBytes) return {};
+
+            tbb::parallel_for(size_t(0), blocksHigh, [&](size_t by) {
+                uint8_t pixels[BlockPixels * 4];
+                for (size_t bx = 0; bx < blocksWide; ++bx) {
+                    DecompressBlock(format, blocks.data() + (by * blocksWide + bx) * blockBytes, pixels);
+                    for (uint32_t y = 0; y < 4 && by * 4 + y < height; ++y) {
+                        for (uint32_t x = 0; x < 4 && bx * 4 + x < width; ++x) {
+                            std::memcpy(image.pixels.data() + (by * 4 + y) * image.GetRowPitch() + (bx * 4 + x) * 4,
+                                pixels + (y * 4 + x) * 4, 4);
+                        }
+                    }
+                }
+            });
+            return image;
+        }
+    }
+}
@@ -0,0 +1,41 @@
+#pragma once
+#include "pch.h"
+#include "TextureProcessing.h"
+
+namespace Resource
+{
+    // BC   ڴ/ڴ (GPU   )
+    // - 4x4 ϸ ּ   , SSE 16ȼ x ȷƮ Ÿ    ε  
+    //   ּ    ٵ (   ä)
+    // - ϳ ̹Ƿ Compress     ó
+    // - BC7  6(  RGBA, 4Ʈ ε)  - ڴ  6 ؼ
+    namespace TextureCompressor
+    {
+        enum class Format : uint8_t {
+            BC1,    // RGB, 8Ʈ ( )
+            BC3,    // RGB +  , 16Ʈ
+            BC4,    // R  ä, 8Ʈ
+            BC5,    // RG  ä ( ), 16Ʈ
+            BC7     // RGBA ǰ, 16Ʈ
+        };
+
+        size_t BytesPerBlock(Format format);
+        DXGI_FORMAT ToDXGIFormat(Format format, bool srgb);
+
+        //   (BC4/BC5  ؽó sRGB ȯ  )
+        bool IsColorFormat(Format format);
+
+        const char* GetFormatName(Format format);
+        std::optional<Format> ParseFormat(std::string_view name);
+
+        // pixels: 4x4 RGBA8 ( 켱 64Ʈ), block: BytesPerBlock Ʈ
+        void CompressBlock(Format format, const uint8_t* pixels, uint8_t* block);
+        void DecompressBlock(Format format, const uint8_t* block, uint8_t* pixels);
+
+        // ̹ ü - ڸ   / ݺؼ ä
+        //  TextureFormat::GetSurfaceInfo  ġ (  )
+        std::vector<uint8_t> Compress(Format format, const TextureProcessing::Image& image);
+        TextureProcessing::Image Decompress(Format format, std::span<const uint8_t> blocks,
+            uint32_t width, uint32_t height);
+    }
+}
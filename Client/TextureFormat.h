@@ -0,0 +1,37 @@
+#pragma once
+#include "pch.h"
+
+namespace Resource
+{
+    // DXGI ˺ ũ  ƿƼ (GPU   )
+    namespace TextureFormat
+    {
+        // ȼ Ʈ  (   հ,    0)
+        size_t BitsPerPixel(DXGI_FORMAT format);
+
+        // BC1~BC7    
+        bool IsBlockCompressed(DXGI_FORMAT format);
+
+        // 4x4 ϴ Ʈ  (   ƴϸ 0)
+        size_t BytesPerBlock(DXGI_FORMAT format);
+
+        //  긮ҽ( ϳ, ̽ ϳ)  ġ ü ũ
+        struct SurfaceInfo {
+            size_t rowPitch = 0;    //  (    ) Ʈ 
+            size_t rowCount = 0;    // ( ) 
+            size_t slicePitch = 0;  // ü Ʈ 
+        };
+        SurfaceInfo GetSurfaceInfo(DXGI_FORMAT format, size_t width, size_t height);
+
+        //     
+        inline uint64_t MipDimension(uint64_t size, uint32_t mip) {
+            return std::max<uint64_t>(1, size >> mip);
+        }
+
+        // ü  üΰ 迭/̸  ؽó ޸ ũ
+        size_t ComputeTextureSize(DXGI_FORMAT format, uint64_t width, uint32_t height,
+            uint32_t depthOrArraySize, uint32_t mipLevels, bool isVolume = false);
+
+        size_t ComputeTextureSize(const D3D12_RESOURCE_DESC& desc);
+    }
+}
@@ -0,0 +1,227 @@
+#include "pch.h"
+#include "TextureProcessing.h"
+
+namespace Resource
+{
+    namespace TextureProcessing
+    {
+        namespace
+        {
+            //  -> sRGB ǥ ũ (ο  Ⱑ Ŀ 8Ʈ ξ ؾ )
+            constexpr int LinearTableSize = 16384;
+
+            struct ConversionTables {
+                std::array<float, 256> toLinear;
+                std::array<uint8_t, LinearTableSize + 1> toSrgb;
+
+                ConversionTables() {
+                    for (int i = 0; i < 256; ++i) {
+                        const double c = i / 255.0;
+                        toLinear[i] = static_cast<float>(c <= 0.04045 ? c / 12.92 : std::pow((c + 0.055) / 1.055, 2.4));
+                    }
+                    for (int i = 0; i <= LinearTableSize; ++i) {
+                        const double l = static_cast<double>(i) / LinearTableSize;
+                        const double c = l <= 0.0031308 ? l * 12.92 : 1.055 * std::pow(l, 1.0 / 2.4) - 0.055;
+                        toSrgb[i] = static_cast<uint8_t>(std::clamp(c * 255.0 + 0.5, 0.0, 255.0));
+                    }
+                }
+            };
+
+            const ConversionTables& GetTables()
+            {
+                static const ConversionTables tables;
+                return tables;
+            }
+
+            //     -  ȼ  ȼ ִ 4
+            struct Taps {
+                uint32_t index[4];
+                float weight[4];
+            };
+
+            std::vector<Taps> BuildTaps(uint32_t sourceSize, uint32_t targetSize)
+            {
+                std::vector<Taps> taps(targetSize);
+                const double scale = static_cast<double>(sourceSize) / targetSize;
+
+                for (uint32_t x = 0; x < targetSize; ++x) {
+                    const double begin = x * scale;
+                    const double end = (x + 1) * scale;
+
+                    Taps& t = taps[x];
+                    int count = 0;
+                    for (uint32_t s = static_cast<uint32_t>(begin); s < end && s < sourceSize && count < 4; ++s, ++count) {
+                        const double coverage = std::min<double>(end, s + 1.0) - std::max<double>(begin, s);
+                        t.index[count] = s;
+                        t.weight[count] = static_cast<float>(coverage / scale);
+                    }
+                    for (; count < 4; ++count) {
+                        t.index[count] = t.index[0];
+                        t.weight[count] = 0.0f;
+                    }
+                }
+                return taps;
+            }
+
+            // εҼ RGBA (, İ  ̸  )
+            using FloatImage = std::vector<__m128>;
+
+            FloatImage ToFloat(const Image& image, bool srgb, bool premultiply)
+            {
+                const auto& tables = GetTables();
+                FloatImage result(static_cast<size_t>(image.width) * image.height);
+
+                tbb::parallel_for(size_t(0), size_t(image.height), [&](size_t y) {
+                    const uint8_t* row = image.pixels.data() + y * image.GetRowPitch();
+                    __m128* out = result.data() + y * image.width;
+                    for (uint32_t x = 0; x < image.width; ++x) {
+                        const uint8_t* p = row + x * 4;
+                        const float a = p[3] / 255.0f;
+                        __m128 color = srgb
+                            ? _mm_setr_ps(tables.toLinear[p[0]], tables.toLinear[p[1]], tables.toLinear[p[2]], 1.0f)
+                            : _mm_setr_ps(p[0] / 255.0f, p[1] / 255.0f, p[2] / 255.0f, 1.0f);
+                        // (r, g, b, 1) * (a, a, a, a)̸  äε a 
+                        out[x] = _mm_mul_ps(color, premultiply ? _mm_set1_ps(a) : _mm_setr_ps(1.0f, 1.0f, 1.0f, a));
+                    }
+                });
+                return result;
+            }
+
+            Image ToImage(const FloatImage& pixels, uint32_t width, uint32_t height, bool srgb, bool premultiplied)
+            {
+                const auto& tables = GetTables();
+                Image image;
+                image.width = width;
+                image.height = height;
+                image.pixels.resize(image.GetRowPitch() * height);
+
+                tbb::parallel_for(size_t(0), size_t(height), [&](size_t y) {
+                    const __m128* row = pixels.data() + y * width;
+                    uint8_t* out = image.pixels.data() + y * image.GetRowPitch();
+                    for (uint32_t x = 0; x < width; ++x) {
+                        __m128 color = _mm_min_ps(_mm_max_ps(row[x], _mm_setzero_ps()), _mm_set1_ps(1.0f));
+
+                        alignas(16) float c[4];
+                        _mm_store_ps(c, color);
+                        if (premultiplied && c[3] > 0.0f) {
+                            const float inverse = 1.0f / c[3];
+                            c[0] = std::min(c[0] * inverse, 1.0f);
+                            c[1] = std::min(c[1] * inverse, 1.0f);
+                            c[2] = std::min(c[2] * inverse, 1.0f);
+                        }
+
+                        for (int k = 0; k < 3; ++k) {
+                            out[x * 4 + k] = srgb
+                                ? tables.toSrgb[static_cast<int>(c[k] * LinearTableSize + 0.5f)]
+                                : static_cast<uint8_t>(c[k] * 255.0f + 0.5f);
+                        }
+                        out[x * 4 + 3] = static_cast<uint8_t>(c[3] * 255.0f + 0.5f);
+                    }
+                });
+                return image;
+            }
+
+            //  ->  и ڽ 
+            FloatImage Downsample(const FloatImage& source, uint32_t width, uint32_t height,
+                uint32_t targetWidth, uint32_t targetHeight)
+            {
+                const auto horizontal = BuildTaps(width, targetWidth);
+                const auto vertical = BuildTaps(height, targetHeight);
+
+                FloatImage temp(static_cast<size_t>(targetWidth) * height);
+                tbb::parallel_for(size_t(0), size_t(height), [&](size_t y) {
+                    const __m128* row = source.data() + y * width;
+                    __m128* out = temp.data() + y * targetWidth;
+                    for (uint32_t x = 0; x < targetWidth; ++x) {
+                        const Taps& t = horizontal[x];
+                        __m128 sum = _mm_mul_ps(row[t.index[0]], _mm_set1_ps(t.weight[0]));
+                        sum = _mm_add_ps(sum, _mm_mul_ps(row[t.index[1]], _mm_set1_ps(t.weight[1])));
+                        sum = _mm_add_ps(sum, _mm_mul_ps(row[t.index[2]], _mm_set1_ps(t.weight[2])));
+                        sum = _mm_add_ps(sum, _mm_mul_ps(row[t.index[3]], _mm_set1_ps(t.weight[3])));
+                        out[x] = sum;
+                    }
+                });
+
+                FloatImage result(static_cast<size_t>(targetWidth) * targetHeight);
+                tbb::parallel_for(size_t(0), size_t(targetHeight), [&](size_t y) {
+                    const Taps& t = vertical[y];
+                    const __m128* rows[4];
+                    __m128 weights[4];
+                    for (int k = 0; k < 4; ++k) {
+                        rows[k] = temp.data() + static_cast<size_t>(t.index[k]) * targetWidth;
+                        weights[k] = _mm_set1_ps(t.weight[k]);
+                    }
+
+                    __m128* out = result.data() + y * targetWidth;
+                    for (uint32_t x = 0; x < targetWidth; ++x) {
+                        __m128 sum = _mm_mul_ps(rows[0][x], weights[0]);
+                        sum = _mm_add_ps(sum, _mm_mul_ps(rows[1][x], weights[1]));
+                        sum = _mm_add_ps(sum, _mm_mul_ps(rows[2][x], weights[2]));
+                        sum = _mm_add_ps(sum, _mm_mul_ps(rows[3][x], weights[3]));
+                        out[x] = sum;
+                    }
+                });
+                return result;
+            }
+        }
+
+        bool HasAlpha(const Image& image)
+        {
+            for (size_t i = 3; i < image.pixels.size(); i += 4) {
+                if (image.pixels[i] != 255) return true;
+            }
+            return false;
+        }
+
+        uint32_t FullMipCount(uint32_t width, uint32_t height)
+        {
+            uint32_t largest = std::max(width, height);
+            uint32_t count = 1;
+            while (largest > 1) {
+                largest >>= 1;
+                ++count;
+            }
+            return count;
+        }
+
+        std::vector<Image> GenerateMips(const Image& source, bool srgb, uint32_t mipCount)
+        {
+            std::vector<Image> mips;
+            if (source.width == 0 || source.height == 0) return mips;
+
+            const uint32_t maxMips = FullMipCount(source.width, source.height);
+            mipCount = mipCount == 0 ? maxMips : std::min(mipCount, maxMips);
+
+            mips.reserve(mipCount);
+            mips.push_back(source);
+            if (mipCount == 1) return mips;
+
+            const bool premultiply = HasAlpha(source);
+            FloatImage current = ToFloat(source, srgb, premultiply);
+            uint32_t width = source.width;
+            uint32_t height = source.height;
+
+            for (uint32_t mip = 1; mip < mipCount; ++mip) {
+                const uint32_t targetWidth = std::max(width / 2, 1u);
+                const uint32_t targetHeight = std::max(height / 2, 1u);
+
+                current = Downsample(current, width, height, targetWidth, targetHeight);
+                width = targetWidth;
+                height = targetHeight;
+
+                mips.push_back(ToImage(current, width, height, srgb, premultiply));
+            }
+            return mips;
+        }
+
+        float SrgbToLinear(uint8_t value)
+        {
+            return GetTables().toLinear[value];
+        }
+
+        uint8_t LinearToSrgb(float value)
+        {
+            return GetTables().toSrgb[static_cast<int>(std::clamp(value, 0.0f, 1.0f) * LinearTableSize + 0.5f)];
+        }
+    }
+}
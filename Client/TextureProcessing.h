@@ -0,0 +1,36 @@
+#pragma once
+#include "pch.h"
+
+namespace Resource
+{
+    // ؽó ŷ CPU ̹ ó (GPU   )
+    namespace TextureProcessing
+    {
+        // RGBA8,    
+        struct Image {
+            uint32_t width = 0;
+            uint32_t height = 0;
+            std::vector<uint8_t> pixels;
+
+            size_t GetRowPitch() const { return static_cast<size_t>(width) * 4; }
+            const uint8_t* GetPixel(uint32_t x, uint32_t y) const { return pixels.data() + y * GetRowPitch() + x * 4; }
+        };
+
+        // İ 255 ƴ ȼ ִ
+        bool HasAlpha(const Image& image);
+
+        // 1x1  
+        uint32_t FullMipCount(uint32_t width, uint32_t height);
+
+        //  ü (0  纻). mipCount 0̸ 1x1
+        // - srgb̸   ٲ ͸  ٽ sRGB (Ĵ ׻ )
+        // - İ  ̸  ķ ͸ؼ  ȼ   ʰ 
+        // - ڽ ͸ SSE / и . Ȧ ũ ȼ  ŭ ġ 
+        // -   ٷ   εҼ   8Ʈ ݿø   
+        std::vector<Image> GenerateMips(const Image& source, bool srgb, uint32_t mipCount = 0);
+
+        // sRGB 8Ʈ <->  [0, 1]
+        float SrgbToLinear(uint8_t value);
+        uint8_t LinearToSrgb(float value);
+    }
+}
@@ -1,2 +1,292 @@
 #include "pch.h"
 #include "TextureResource.h"
+#include "ResourceManager.h"
+
+namespace Resource
+{
+    bool TextureResource::LoadMipTail(ID3D12Device* device, ID3D12CommandQueue* cmdQueue)
+    {
+        //   о  ġ ؼ (Ű  , ƴϸ  պκи )
+        AssetData source = ArchiveManager::Instance().Find(GetPath());
+        std::optional<DDS::Layout> layout;
+
+        if (source) {
+            layout = DDS::ParseHeader(source.bytes, source.size());
+        }
+        else {
+            //  ũ б  Բ  (ª ̸  ŭ ؼ)
+            std::vector<uint8_t> header(DDS::MaxHeaderSize);
+            const auto status = ResourceManager::Instance().GetFileIO().Read(
+                GetPath(), 0, static_cast<uint32_t>(header.size()), header.data());
+            if (!status.success) {
+                throw std::runtime_error("ؽó  ã  ϴ.");
+            }
+            header.resize(status.bytesRead);
+            layout = DDS::ParseHeader(header, status.fileSize);
+        }
+
+        // 2D 迭 ƴϰų  ϳ̸ Ʈ ̵  - ü ε 
+        if (!layout || layout->dimension != D3D12_RESOURCE_DIMENSION_TEXTURE2D || layout->mipCount < 2) {
+            Logger::Instance().Debug("Ʈ Ұ, ü ε: {}", GetName());
+            return false;
+        }
+
+        // ü  ü  ҽ  (޸𸮴 ó ü ũ )
+        auto desc = CD3DX12_RESOURCE_DESC::Tex2D(
+            layout->format,
+            layout->width,
+            layout->height,
+            static_cast<UINT16>(layout->arraySize),
+            static_cast<UINT16>(layout->mipCount));
+
+        ComPtr<ID3D12Resource> texture;
+        CD3DX12_HEAP_PROPERTIES heapProps(D3D12_HEAP_TYPE_DEFAULT);
+        ThrowIfFailed(device->CreateCommittedResource(
+            &heapProps,
+            D3D12_HEAP_FLAG_NONE,
+            &desc,
+            D3D12_RESOURCE_STATE_COPY_DEST,
+            nullptr,
+            IID_PPV_ARGS(&texture)));
+
+        const uint32_t tailMip = layout->GetFirstMipWithin(StreamingTailDimension);
+
+        {
+            std::lock_guard<std::mutex> lock(m_streamMutex);
+            m_texture.Swap(texture);
+            m_layout = std::move(layout);
+            m_source = std::move(source);
+        }
+
+        //    ٷ ø Ϸ  (ũⰡ ۾ ε 带   )
+        UploadMips(tailMip, m_layout->mipCount, false).wait();
+
+        {
+            std::lock_guard<std::mutex> lock(m_streamMutex);
+            m_streamState.Reset(m_layout->mipCount, tailMip);
+        }
+
+        SetSize(TextureFormat::ComputeTextureSize(m_texture->GetDesc()));
+        SetState(State::Ready);
+
+        Logger::Instance().Info("ؽó Ʈ : {} ({}x{},  {}/{} ,  {}bytes)",
+            GetName(), m_layout->width, m_layout->height,
+            m_layout->mipCount - tailMip, m_layout->mipCount, m_layout->GetMipTailSize(tailMip));
+
+        return true;
+    }
+
+    std::future<void> TextureResource::UploadMips(uint32_t firstMip, uint32_t endMip, bool resident)
+    {
+        const auto& layout = *m_layout;
+        auto* device = GraphicsDevice::Instance().GetDevice();
+        auto* cmdQueue = GraphicsDevice::Instance().GetCommandQueue();
+
+        DirectX::ResourceUploadBatch resourceUpload(device);
+        resourceUpload.Begin();
+
+        if (resident) {
+            resourceUpload.Transition(m_texture.Get(),
+                D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE, D3D12_RESOURCE_STATE_COPY_DEST);
+        }
+
+        // ̽ [firstMip, endMip)  ӵ 긮ҽ̹Ƿ   ø
+        // (Upload ߰ ۷ ϹǷ scratch ȣ   )
+        std::vector<uint8_t> scratch;
+        std::vector<D3D12_SUBRESOURCE_DATA> subresources(endMip - firstMip);
+
+        for (uint32_t slice = 0; slice < layout.arraySize; ++slice) {
+            const auto& first = layout.GetSubresource(firstMip, slice);
+            const auto& last = layout.GetSubresource(endMip - 1, slice);
+            const uint64_t rangeSize = last.offset + last.size - first.offset;
+
+            auto bytes = ReadSource(first.offset, rangeSize, scratch);
+
+            for (uint32_t mip = firstMip; mip < endMip; ++mip) {
+                const auto& sub = layout.GetSubresource(mip, slice);
+                auto& data = subresources[mip - firstMip];
+                data.pData = bytes.data() + (sub.offset - first.offset);
+                data.RowPitch = static_cast<LONG_PTR>(sub.rowPitch);
+                data.SlicePitch = static_cast<LONG_PTR>(sub.slicePitch);
+            }
+
+            resourceUpload.Upload(m_texture.Get(),
+                D3D12CalcSubresource(firstMip, slice, 0, layout.mipCount, layout.arraySize),
+                subresources.data(),
+                static_cast<UINT>(subresources.size()));
+        }
+
+        resourceUpload.Transition(m_texture.Get(),
+            D3D12_RESOURCE_STATE_COPY_DEST, D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE);
+
+        return resourceUpload.End(cmdQueue);
+    }
+
+    std::span<const uint8_t> TextureResource::ReadSource(uint64_t offset, uint64_t size, std::vector<uint8_t>& scratch) const
+    {
+        // Ű  ؽó ε Ʈ ״ 
+        if (m_source) {
+            return std::span<const uint8_t>(m_source.bytes).subspan(
+                static_cast<size_t>(offset), static_cast<size_t>(size));
+        }
+
+        scratch.resize(static_cast<size_t>(size));
+
+        const auto status = ResourceManager::Instance().GetFileIO().Read(
+            GetPath(), offset, static_cast<uint32_t>(scratch.size()), scratch.data());
+        if (!status.success || status.bytesRead != scratch.size()) {
+            throw std::runtime_error("ؽó  ͸   ϴ.");
+        }
+        return scratch;
+    }
+
+    bool TextureResource::SwapContents(IResource& source)
+    {
+        auto* other = dynamic_cast<TextureResource*>(&source);
+        if (!other) return false;
+
+        //      ε尡  ϰ ü 
+        std::scoped_lock lock(m_streamMutex, other->m_streamMutex);
+        for (auto* texture : { this, other }) {
+            if (texture->m_pendingUpload.valid()) {
+                texture->m_pendingUpload.wait();
+                texture->m_pendingUpload = {};
+                texture->m_streamState.Abort();
+            }
+        }
+
+        //  ؽó  û ػ󵵱 ٽ Ʈ
+        const uint32_t requestedMip = m_streamState.GetRequestedMip();
+
+        m_texture.Swap(other->m_texture);
+        std::swap(m_layout, other->m_layout);
+        std::swap(m_source, other->m_source);
+        std::swap(m_streamState, other->m_streamState);
+        if (m_layout) {
+            m_streamState.Request(requestedMip);
+        }
+        SwapBase(*other);
+        return true;
+    }
+
+    void TextureResource::RequestMip(uint32_t mip)
+    {
+        std::lock_guard<std::mutex> lock(m_streamMutex);
+        m_streamState.Request(mip);
+    }
+
+    void TextureResource::RequestScreenSize(float screenPixels)
+    {
+        std::lock_guard<std::mutex> lock(m_streamMutex);
+        if (!m_layout) return;  // Ʈ ʴ ؽó ̹ ü  
+
+        const uint32_t dimension = std::max(m_layout->width, m_layout->height);
+        m_streamState.Request(MipStreamState::GetMipForScreenSize(dimension, screenPixels));
+    }
+
+    bool TextureResource::UpdateStreaming(bool canStartUpload)
+    {
+        std::lock_guard<std::mutex> lock(m_streamMutex);
+        if (!m_layout || !m_texture) return false;
+
+        //   ε尡    ݿ
+        if (m_pendingUpload.valid()) {
+            if (m_pendingUpload.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+                return false;
+            }
+
+            const uint32_t mip = m_streamState.GetInflightMip();
+            try {
+                m_pendingUpload.get();
+                m_streamState.Complete(mip);
+                Logger::Instance().Debug("ؽó  : {} ( {})", GetName(), mip);
+            }
+            catch (const std::exception& e) {
+                m_streamState.Abort();
+                Logger::Instance().Error("ؽó  ε : {} ( {}) - {}", GetName(), mip, e.what());
+            }
+        }
+
+        if (!canStartUpload) return false;
+
+        //    ܰ辿  ػ󵵷 ø
+        const uint32_t next = m_streamState.BeginNext();
+        if (next == MipStreamState::NoMip) return false;
+
+        try {
+            m_pendingUpload = UploadMips(next, next + 1, true);
+            return true;
+        }
+        catch (const std::exception& e) {
+            m_streamState.Abort();
+            Logger::Instance().Error("ؽó  ε  : {} ( {}) - {}", GetName(), next, e.what());
+            return false;
+        }
+    }
+
+    bool TextureResource::IsStreaming() const
+    {
+        // ε Ŀ LoadMipTail m_layout ϴ   尡   
+        std::lock_guard<std::mutex> lock(m_streamMutex);
+        return m_layout.has_value();
+    }
+
+    uint32_t TextureResource::GetResidentMip() const
+    {
+        std::lock_guard<std::mutex> lock(m_streamMutex);
+        return m_layout ? m_streamState.GetResidentMip() : 0;
+    }
+
+    bool TextureResource::IsFullyResident() const
+    {
+        std::lock_guard<std::mutex> lock(m_streamMutex);
+        return !m_layout || m_streamState.IsFullyResident();
+    }
+
+    D3D12_SHADER_RESOURCE_VIEW_DESC TextureResource::GetSrvDesc() const
+    {
+        std::lock_guard<std::mutex> lock(m_streamMutex);
+
+        D3D12_SHADER_RESOURCE_VIEW_DESC srvDesc = {};
+        srvDesc.Shader4ComponentMapping = D3D12_DEFAULT_SHADER_4_COMPONENT_MAPPING;
+        if (!m_texture) return srvDesc;
+
+        const auto desc = m_texture->GetDesc();
+        srvDesc.Format = desc.Format;
+
+        const float minLod = m_layout ? m_streamState.GetMinLodClamp() : 0.0f;
+        const bool isCube = m_layout && m_layout->isCube;
+
+        if (isCube) {
+            srvDesc.ViewDimension = D3D12_SRV_DIMENSION_TEXTURECUBE;
+            srvDesc.TextureCube.MipLevels = desc.MipLevels;
+            srvDesc.TextureCube.ResourceMinLODClamp = minLod;
+        }
+        else if (desc.DepthOrArraySize > 1) {
+            srvDesc.ViewDimension = D3D12_SRV_DIMENSION_TEXTURE2DARRAY;
+            srvDesc.Texture2DArray.MipLevels = desc.MipLevels;
+            srvDesc.Texture2DArray.ArraySize = desc.DepthOrArraySize;
+            srvDesc.Texture2DArray.ResourceMinLODClamp = minLod;
+        }
+        else {
+            srvDesc.ViewDimension = D3D12_SRV_DIMENSION_TEXTURE2D;
+            srvDesc.Texture2D.MipLevels = desc.MipLevels;
+            srvDesc.Texture2D.ResourceMinLODClamp = minLod;
+        }
+        return srvDesc;
+    }
+
+    void TextureResource::ReleaseStreaming()
+    {
+        std::lock_guard<std::mutex> lock(m_streamMutex);
+
+        // GPU   ҽ  ʵ 
+        if (m_pendingUpload.valid()) {
+            m_pendingUpload.wait();
+            m_pendingUpload = {};
+        }
+        m_layout.reset();
+        m_source = {};
+        m_streamState = {};
+    }
+}
@@ -2,16 +2,31 @@
 #include "pch.h"
 #include "IResource.h"
 #include "GraphicsDevice.h"
+#include "TextureFormat.h"
+#include "ArchiveManager.h"
+#include "DDSHeader.h"
+#include "MipStreamState.h"
 #include "Logger.h"
 
 namespace Resource
 {
     class TextureResource : public IResource {
     public:
-        explicit TextureResource(const std::string& path)
+        static constexpr Type ResourceType = Type::Texture;
+
+        enum class LoadMode {
+            Full,       // ü  ü   ε
+            Streaming   //  Ӻ ø  û  Ʈ
+        };
+
+        // Ʈ 忡 ó ø   ִ ũ
+        static constexpr uint32_t StreamingTailDimension = 128;
+
+        explicit TextureResource(const std::string& path, LoadMode mode = LoadMode::Full)
             : IResource(Type::Texture, path,
                 std::filesystem::path(path).filename().string())
             , m_texture(nullptr)
+            , m_mode(mode)
         {
             Logger::Instance().Debug("ؽó ҽ : {}", GetName());
         }
@@ -35,28 +50,47 @@ namespace Resource
             }
 
             try {
+                // Ʈ :  Ӹ  ø ٷ   · ȯ
+                // (Ʈ   ؽó Ʒ ü ε )
+                if (m_mode == LoadMode::Streaming && LoadMipTail(device, cmdQueue)) {
+                    return true;
+                }
+
                 // ҽ ε ġ 
                 DirectX::ResourceUploadBatch resourceUpload(device);
 
                 // ε 
                 resourceUpload.Begin();
 
-                //   ȯ
-                std::wstring widePath(GetPath().begin(), GetPath().end());
-
-                //    Ȯ
-                if (!std::filesystem::exists(GetPath())) {
-                    throw std::runtime_error("ؽó  ã  ϴ.");
-                }
-
                 // ؽó ε (ӽ  Ͽ ϵ )
                 ComPtr<ID3D12Resource> textureResource;
-                ThrowIfFailed(DirectX::CreateDDSTextureFromFile(
-                    device,
-                    resourceUpload,
-                    widePath.c_str(),
-                    textureResource.GetAddressOf()
-                ));
+
+                // Ʈ Ű  ε Ʈ ٷ ε
+                if (auto asset = ArchiveManager::Instance().Find(GetPath())) {
+                    ThrowIfFailed(DirectX::CreateDDSTextureFromMemory(
+                        device,
+                        resourceUpload,
+                        asset.data(),
+                        asset.size(),
+                        textureResource.GetAddressOf()
+                    ));
+                }
+                else {
+                    //   ȯ
+                    const std::wstring widePath = std::filesystem::path(GetPath()).wstring();
+
+                    //    Ȯ
+                    if (!std::filesystem::exists(GetPath())) {
+                        throw std::runtime_error("ؽó  ã  ϴ.");
+                    }
+
+                    ThrowIfFailed(DirectX::CreateDDSTextureFromFile(
+                        device,
+                        resourceUpload,
+                        widePath.c_str(),
+                        textureResource.GetAddressOf()
+                    ));
+                }
 
                 // ε Ϸ 
                 auto uploadResult = resourceUpload.End(cmdQueue);
@@ -70,10 +104,9 @@ namespace Resource
                 // ҽ 
                 m_texture.Swap(textureResource);
 
-                // ũ  
+                // ũ   (,  ü, 迭 ũ ݿ)
                 auto desc = m_texture->GetDesc();
-                SetSize(static_cast<size_t>(desc.Width * desc.Height *
-                    GetBytesPerPixel(desc.Format)));
+                SetSize(TextureFormat::ComputeTextureSize(desc));
 
                 SetState(State::Ready);
                 Logger::Instance().Info("ؽó ε Ϸ: {} ({}x{}, {}bytes)",
@@ -90,6 +123,9 @@ namespace Resource
         }
 
         void Unload() override {
+            //    ε尡   
+            ReleaseStreaming();
+
             if (m_texture) {
                 m_texture.Reset();
                 SetState(State::Unloaded);
@@ -97,28 +133,53 @@ namespace Resource
             }
         }
 
+        std::shared_ptr<IResource> CreateReloadCopy() const override {
+            return std::make_shared<TextureResource>(GetPath(), m_mode);
+        }
+
+        bool SwapContents(IResource& source) override;
+
         ID3D12Resource* GetTexture() const { return m_texture.Get(); }
 
         D3D12_RESOURCE_DESC GetDesc() const {
             return m_texture ? m_texture->GetDesc() : D3D12_RESOURCE_DESC{};
         }
 
+        // Ʈ  ( 忡 ȣ)
+        LoadMode GetLoadMode() const { return m_mode; }
+        bool IsStreaming() const;
+
+        // ʿ   ػ  û -  UpdateStreaming  ܰ辿 ö
+        void RequestMip(uint32_t mip);
+
+        // ȭ鿡 screenPixels ȼ  ׷  ʿ  û (׸ ʿ   ȣ)
+        void RequestScreenSize(float screenPixels);
+
+        //  ε带 ݿϰ, canStartUpload̸   ε 
+        //  ε带  true
+        bool UpdateStreaming(bool canStartUpload = true);
+
+        //     ػ  (  ٲ SRV ٽ  )
+        uint32_t GetResidentMip() const;
+        bool IsFullyResident() const;
+
+        //     ʵ MinLOD  SRV 
+        D3D12_SHADER_RESOURCE_VIEW_DESC GetSrvDesc() const;
+
     private:
-        size_t GetBytesPerPixel(DXGI_FORMAT format) const {
-            switch (format) {
-            case DXGI_FORMAT_R8G8B8A8_UNORM:
-            case DXGI_FORMAT_R8G8B8A8_UNORM_SRGB:
-                return 4;
-            case DXGI_FORMAT_B8G8R8A8_UNORM:
-            case DXGI_FORMAT_B8G8R8A8_UNORM_SRGB:
-                return 4;
-            case DXGI_FORMAT_R32G32B32A32_FLOAT:
-                return 16;
-            default:
-                return 4;
-            }
-        }
+        bool LoadMipTail(ID3D12Device* device, ID3D12CommandQueue* cmdQueue);
+        std::future<void> UploadMips(uint32_t firstMip, uint32_t endMip, bool resident);
+        std::span<const uint8_t> ReadSource(uint64_t offset, uint64_t size, std::vector<uint8_t>& scratch) const;
+        void ReleaseStreaming();
 
         ComPtr<ID3D12Resource> m_texture;
+        LoadMode m_mode;
+
+        // Ʈ 
+        mutable std::mutex m_streamMutex;
+        std::optional<DDS::Layout> m_layout;
+        AssetData m_source;                 // Ű    ( Ͽ  б)
+        MipStreamState m_streamState;
+        std::future<void> m_pendingUpload;
     };
 }
\ No newline at end of file
@@ -0,0 +1,503 @@
+#include "pch.h"
+#include "TextureTools.h"
+#include "DDSHeader.h"
+#include "MipStreamState.h"
+#include "TextureFormat.h"
+#include "ArchiveManager.h"
+#include "Logger.h"
+
+namespace Resource
+{
+    bool TextureTools::DecodeImage(const std::string& path, TextureProcessing::Image& image)
+    {
+        //   COM ʱȭ  忡 Ҹ  
+        const HRESULT comResult = CoInitializeEx(nullptr, COINIT_MULTITHREADED);
+        const bool uninitialize = SUCCEEDED(comResult);
+
+        bool decoded = false;
+        {
+            ComPtr<IWICImagingFactory> factory;
+            ComPtr<IWICBitmapDecoder> decoder;
+            ComPtr<IWICStream> stream;
+            const AssetData asset = ArchiveManager::Instance().Find(path);
+
+            HRESULT hr = CoCreateInstance(CLSID_WICImagingFactory, nullptr, CLSCTX_INPROC_SERVER, IID_PPV_ARGS(&factory));
+            if (SUCCEEDED(hr)) {
+                if (asset) {
+                    hr = factory->CreateStream(&stream);
+                    if (SUCCEEDED(hr)) {
+                        hr = stream->InitializeFromMemory(const_cast<BYTE*>(asset.data()), static_cast<DWORD>(asset.size()));
+                    }
+                    if (SUCCEEDED(hr)) {
+                        hr = factory->CreateDecoderFromStream(stream.Get(), nullptr, WICDecodeMetadataCacheOnDemand, &decoder);
+                    }
+                }
+                else {
+                    const std::wstring widePath = std::filesystem::path(path).wstring();
+                    hr = factory->CreateDecoderFromFilename(widePath.c_str(), nullptr, GENERIC_READ,
+                        WICDecodeMetadataCacheOnDemand, &decoder);
+                }
+            }
+
+            ComPtr<IWICBitmapFrameDecode> frame;
+            ComPtr<IWICFormatConverter> converter;
+            UINT width = 0, height = 0;
+            if (SUCCEEDED(hr)) hr = decoder->GetFrame(0, &frame);
+            if (SUCCEEDED(hr)) hr = frame->GetSize(&width, &height);
+            if (SUCCEEDED(hr)) hr = factory->CreateFormatConverter(&converter);
+            if (SUCCEEDED(hr)) {
+                hr = converter->Initialize(frame.Get(), GUID_WICPixelFormat32bppRGBA, WICBitmapDitherTypeNone,
+                    nullptr, 0.0, WICBitmapPaletteTypeCustom);
+            }
+            if (SUCCEEDED(hr)) {
+                image.width = width;
+                image.height = height;
+                image.pixels.resize(image.GetRowPitch() * height);
+                hr = converter->CopyPixels(nullptr, static_cast<UINT>(image.GetRowPitch()),
+                    static_cast<UINT>(image.pixels.size()), image.pixels.data());
+            }
+
+            decoded = SUCCEEDED(hr) && width > 0 && height > 0;
+            if (!decoded) {
+                Logger::Instance().Error("̹ ڵ : {} (0x{:08X})", path, static_cast<uint32_t>(hr));
+            }
+        }
+
+        if (uninitialize) {
+            CoUninitialize();
+        }
+        return decoded;
+    }
+
+    bool TextureTools::CookTexture(const std::string& sourcePath, const std::string& outputPath,
+        std::optional<TextureCompressor::Format> format)
+    {
+        using Clock = std::chrono::steady_clock;
+        const auto start = Clock::now();
+
+        TextureProcessing::Image source;
+        if (!DecodeImage(sourcePath, source)) {
+            return false;
+        }
+
+        const TextureCompressor::Format selected = format.value_or(
+            TextureProcessing::HasAlpha(source) ? TextureCompressor::Format::BC3 : TextureCompressor::Format::BC1);
+        const bool srgb = TextureCompressor::IsColorFormat(selected);
+
+        const auto mips = TextureProcessing::GenerateMips(source, srgb);
+        const auto bytes = BuildDDS(mips, selected, srgb);
+
+        std::filesystem::path output = outputPath;
+        if (output.empty()) {
+            output = std::filesystem::path(sourcePath).replace_extension(".dds");
+        }
+
+        std::error_code ec;
+        if (output.has_parent_path()) {
+            std::filesystem::create_directories(output.parent_path(), ec);
+        }
+
+        // ε  ؽó     ʵ ӽ Ͽ  ü
+        auto tempPath = output;
+        tempPath += ".tmp";
+        {
+            std::ofstream file(tempPath, std::ios::binary | std::ios::trunc);
+            file.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+            if (!file) {
+                file.close();
+                std::filesystem::remove(tempPath, ec);
+                Logger::Instance().Error("ؽó  : {}", output.string());
+                return false;
+            }
+        }
+        std::filesystem::rename(tempPath, output, ec);
+        if (ec) {
+            std::filesystem::remove(tempPath, ec);
+            Logger::Instance().Error("ؽó  : {} ({})", output.string(), ec.message());
+            return false;
+        }
+
+        const double elapsedMs = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+        Logger::Instance().Info("=== ؽó ŷ: {} -> {} ({:.1f}ms) ===", sourcePath, output.string(), elapsedMs);
+        Logger::Instance().Info("{}x{},  {}, {}{}, {} bytes (RGBA8  {:.1f}%)",
+            source.width, source.height, mips.size(), TextureCompressor::GetFormatName(selected), srgb ? " sRGB" : "",
+            bytes.size(), 100.0 * bytes.size() / std::max<size_t>(1,
+                TextureFormat::ComputeTextureSize(DXGI_FORMAT_R8G8B8A8_UNORM, source.width, source.height, 1,
+                    static_cast<uint32_t>(mips.size()))));
+        return true;
+    }
+
+    std::vector<uint8_t> TextureTools::BuildDDS(const std::vector<TextureProcessing::Image>& mips,
+        TextureCompressor::Format format, bool srgb)
+    {
+        if (mips.empty()) return {};
+
+        std::vector<uint8_t> bytes = DDS::CreateHeader(TextureCompressor::ToDXGIFormat(format, srgb),
+            mips[0].width, mips[0].height, static_cast<uint32_t>(mips.size()));
+        for (const auto& mip : mips) {
+            const auto blocks = TextureCompressor::Compress(format, mip);
+            bytes.insert(bytes.end(), blocks.begin(), blocks.end());
+        }
+        return bytes;
+    }
+
+    TextureTools::CompressionBenchmarkResult TextureTools::RunCompressionBenchmark(const std::string& sourcePath,
+        uint32_t size, int iterations)
+    {
+        CompressionBenchmarkResult result;
+
+        TextureProcessing::Image source;
+        if (sourcePath.empty()) {
+            source = CreateTestImage(size);
+        }
+        else if (!DecodeImage(sourcePath, source)) {
+            return result;
+        }
+        iterations = std::max(iterations, 1);
+
+        result.width = source.width;
+        result.height = source.height;
+
+        Logger::Instance().Info("=== ؽó  ġũ: {} ({}x{}, {}ȸ ) ===",
+            sourcePath.empty() ? "׽Ʈ ̹" : sourcePath, source.width, source.height, iterations);
+
+        using Clock = std::chrono::steady_clock;
+        std::vector<TextureProcessing::Image> mips;
+        auto start = Clock::now();
+        for (int i = 0; i < iterations; ++i) {
+            mips = TextureProcessing::GenerateMips(source, true);
+        }
+        result.mipMs = std::chrono::duration<double, std::milli>(Clock::now() - start).count() / iterations;
+        result.mipCount = static_cast<uint32_t>(mips.size());
+
+        size_t totalPixels = 0;
+        for (const auto& mip : mips) {
+            totalPixels += static_cast<size_t>(mip.width) * mip.height;
+        }
+        const size_t rgbaBytes = TextureFormat::ComputeTextureSize(DXGI_FORMAT_R8G8B8A8_UNORM,
+            source.width, source.height, 1, result.mipCount);
+
+        Logger::Instance().Info("  (sRGB): {}, {:.1f}ms ({:.1f} Mȼ/s)", result.mipCount, result.mipMs,
+            totalPixels / (result.mipMs * 1000.0));
+
+        static constexpr TextureCompressor::Format Formats[] = {
+            TextureCompressor::Format::BC1, TextureCompressor::Format::BC3, TextureCompressor::Format::BC4,
+            TextureCompressor::Format::BC5, TextureCompressor::Format::BC7 };
+
+        for (const auto format : Formats) {
+            FormatBenchmark bench;
+            bench.format = format;
+
+            std::vector<uint8_t> dds;
+            start = Clock::now();
+            for (int i = 0; i < iterations; ++i) {
+                dds = BuildDDS(mips, format, TextureCompressor::IsColorFormat(format));
+            }
+            bench.compressMs = std::chrono::duration<double, std::milli>(Clock::now() - start).count() / iterations;
+            bench.mpixelsPerSec = totalPixels / (bench.compressMs * 1000.0);
+
+            // δ  ؼ  ٽ о  ġ  ũⰡ ´ Ȯ
+            const auto layout = DDS::ParseHeader(dds, dds.size());
+            if (!layout || layout->mipCount != result.mipCount ||
+                layout->subresources.back().offset + layout->subresources.back().size != dds.size()) {
+                ++result.violations;
+                continue;
+            }
+            bench.compressedBytes = dds.size() - layout->dataOffset;
+            bench.ratio = static_cast<double>(rgbaBytes) / std::max<size_t>(bench.compressedBytes, 1);
+
+            //  0 ȭ -   äθ 
+            const auto& top = layout->GetSubresource(0, 0);
+            const auto decoded = TextureCompressor::Decompress(format,
+                std::span(dds).subspan(static_cast<size_t>(top.offset), static_cast<size_t>(top.size)),
+                source.width, source.height);
+
+            const int channels = format == TextureCompressor::Format::BC4 ? 1
+                : format == TextureCompressor::Format::BC5 ? 2
+                : format == TextureCompressor::Format::BC1 ? 3 : 4;
+            double squaredError = 0.0;
+            for (size_t i = 0; i < source.pixels.size(); i += 4) {
+                for (int k = 0; k < channels; ++k) {
+                    const double d = static_cast<double>(source.pixels[i + k]) - decoded.pixels[i + k];
+                    squaredError += d * d;
+                }
+            }
+            const double mse = squaredError / (static_cast<double>(source.width) * source.height * channels);
+            bench.psnr = mse > 0.0 ? 10.0 * std::log10(255.0 * 255.0 / mse) : 99.0;
+
+            Logger::Instance().Info("{}: {:.1f}ms ({:.1f} Mȼ/s), {} bytes (RGBA8 1/{:.1f}), PSNR {:.2f}dB",
+                TextureCompressor::GetFormatName(format), bench.compressMs, bench.mpixelsPerSec,
+                bench.compressedBytes, bench.ratio, bench.psnr);
+            result.formats.push_back(bench);
+        }
+
+        if (result.violations > 0) {
+            Logger::Instance().Error("DDS ġ   {}", result.violations);
+        }
+        return result;
+    }
+
+    namespace
+    {
+        // DX10 Ȯ   DDS  ( ). fourCC 0̸ 32Ʈ RGBA
+        std::vector<uint8_t> CreateLegacyHeader(uint32_t width, uint32_t height, uint32_t mipCount,
+            uint32_t fourCC, uint32_t caps2 = 0)
+        {
+            DDS::Header dds = {};
+            dds.size = sizeof(DDS::Header);
+            dds.flags = 0x1 | 0x2 | 0x4 | 0x1000 | (mipCount > 1 ? 0x20000 : 0);
+            dds.height = height;
+            dds.width = width;
+            dds.depth = 1;
+            dds.mipMapCount = mipCount;
+            dds.pixelFormat.size = sizeof(DDS::PixelFormat);
+            if (fourCC != 0) {
+                dds.pixelFormat.flags = 0x4;
+                dds.pixelFormat.fourCC = fourCC;
+            }
+            else {
+                dds.pixelFormat.flags = 0x40 | 0x1;
+                dds.pixelFormat.rgbBitCount = 32;
+                dds.pixelFormat.rBitMask = 0x000000ff;
+                dds.pixelFormat.gBitMask = 0x0000ff00;
+                dds.pixelFormat.bBitMask = 0x00ff0000;
+                dds.pixelFormat.aBitMask = 0xff000000;
+            }
+            dds.caps = 0x1000 | (mipCount > 1 ? 0x8 | 0x400000 : 0);
+            dds.caps2 = caps2;
+
+            std::vector<uint8_t> bytes(sizeof(uint32_t) + sizeof(dds));
+            std::memcpy(bytes.data(), &DDS::Magic, sizeof(uint32_t));
+            std::memcpy(bytes.data() + sizeof(uint32_t), &dds, sizeof(dds));
+            return bytes;
+        }
+
+        //  /  ϳ ũ (ParseHeader  )
+        uint64_t ExpectedMipSize(uint32_t width, uint32_t height, uint32_t mip, uint32_t blockBytes, bool compressed)
+        {
+            const uint64_t w = std::max(width >> mip, 1u);
+            const uint64_t h = std::max(height >> mip, 1u);
+            return compressed ? ((w + 3) / 4) * ((h + 3) / 4) * blockBytes : w * h * blockBytes;
+        }
+    }
+
+    TextureTools::StreamingCheckResult TextureTools::RunStreamingCheck()
+    {
+        StreamingCheckResult result;
+        auto check = [&](bool ok, std::string_view what) {
+            ++result.checks;
+            if (!ok) {
+                ++result.violations;
+                Logger::Instance().Error(" : {}", what);
+            }
+        };
+
+        Logger::Instance().Info("=== ؽó Ʈ  (GPU ) ===");
+
+        // 1.   (DXT1 512x256,  10) - ̽ ϳ   
+        {
+            constexpr uint32_t Width = 512, Height = 256, Mips = 10;
+            const auto header = CreateLegacyHeader(Width, Height, Mips, 0x31545844);   // "DXT1"
+
+            uint64_t fileSize = header.size();
+            for (uint32_t mip = 0; mip < Mips; ++mip) {
+                fileSize += ExpectedMipSize(Width, Height, mip, 8, true);
+            }
+
+            const auto layout = DDS::ParseHeader(header, fileSize);
+            check(layout.has_value(), "  ؼ");
+            if (layout) {
+                check(layout->format == DXGI_FORMAT_BC1_UNORM, "   (DXT1 -> BC1)");
+                check(layout->dimension == D3D12_RESOURCE_DIMENSION_TEXTURE2D && layout->arraySize == 1 && !layout->isCube,
+                    "  2D  ̽");
+                check(layout->dataOffset == header.size() && layout->mipCount == Mips, "   ۰  ");
+
+                uint64_t offset = layout->dataOffset;
+                bool offsetsMatch = layout->subresources.size() == Mips;
+                for (uint32_t mip = 0; offsetsMatch && mip < Mips; ++mip) {
+                    const auto& sub = layout->GetSubresource(mip, 0);
+                    const uint64_t size = ExpectedMipSize(Width, Height, mip, 8, true);
+                    offsetsMatch = sub.offset == offset && sub.size == size &&
+                        sub.width == std::max(Width >> mip, 1u) && sub.height == std::max(Height >> mip, 1u);
+                    offset += size;
+                }
+                check(offsetsMatch && offset == fileSize, "   /ũ");
+
+                // 128    128x64
+                check(layout->GetFirstMipWithin(128) == 2, "   (128 )");
+                check(layout->GetMipTailSize(2) == fileSize - layout->GetSubresource(2, 0).offset, "  ũ");
+            }
+
+            // ߸ Է: Ͱ  Ʈ ڶų  ü ª
+            check(!DDS::ParseHeader(header, fileSize - 1), "߸  ź");
+            check(!DDS::ParseHeader(std::span(header).first(100), fileSize), "ª  ź");
+
+            // ջ :  ٸų   ũ  ͺ 
+            auto badMagic = header;
+            badMagic[0] = 'X';
+            check(!DDS::ParseHeader(badMagic, fileSize), "߸  ź");
+            check(!DDS::ParseHeader(CreateLegacyHeader(Width, Height, Mips + 1, 0x31545844), fileSize * 2),
+                "  ʰ ź");
+        }
+
+        // 2.   ť (RGBA8 64x64,  7) - 鸶  ü ü ̾
+        {
+            constexpr uint32_t Size = 64, Mips = 7;
+            const auto header = CreateLegacyHeader(Size, Size, Mips, 0, 0x200 | 0xFC00);
+
+            uint64_t faceSize = 0;
+            for (uint32_t mip = 0; mip < Mips; ++mip) {
+                faceSize += ExpectedMipSize(Size, Size, mip, 4, false);
+            }
+            const uint64_t fileSize = header.size() + faceSize * 6;
+
+            const auto layout = DDS::ParseHeader(header, fileSize);
+            check(layout && layout->isCube && layout->arraySize == 6 && layout->format == DXGI_FORMAT_R8G8B8A8_UNORM,
+                "  ť ؼ");
+            if (layout && layout->arraySize == 6) {
+                check(layout->GetSubresource(0, 5).offset == header.size() + faceSize * 5 &&
+                    layout->GetSubresource(Mips - 1, 5).offset + 4 == fileSize, "ť  ");
+                check(layout->GetMipTailSize(0) == faceSize * 6, "ť ü ũ");
+            }
+
+            check(!DDS::ParseHeader(CreateLegacyHeader(Size, Size, Mips, 0, 0x200 | 0x400), fileSize),
+                "Ϻ 鸸 ִ ť ź");
+        }
+
+        // 3. DX10  (BC7 256x256,  9) 迭 ؽó
+        {
+            constexpr uint32_t Size = 256, Mips = 9;
+            auto header = DDS::CreateHeader(DXGI_FORMAT_BC7_UNORM, Size, Size, Mips);
+
+            uint64_t sliceSize = 0;
+            for (uint32_t mip = 0; mip < Mips; ++mip) {
+                sliceSize += ExpectedMipSize(Size, Size, mip, 16, true);
+            }
+
+            const auto layout = DDS::ParseHeader(header, header.size() + sliceSize);
+            check(layout && layout->format == DXGI_FORMAT_BC7_UNORM && layout->dataOffset == DDS::MaxHeaderSize &&
+                layout->mipCount == Mips && layout->arraySize == 1, "DX10  ؼ");
+
+            // DX10 Ȯ ߸ Է (⺻  )
+            check(!DDS::ParseHeader(std::span(header).first(sizeof(uint32_t) + sizeof(DDS::Header)),
+                header.size() + sliceSize), "DX10 Ȯ ߸  ź");
+
+            // arraySize 3 ٲ 迭 ؽó - 긮ҽ slice * mipCount + mip 
+            constexpr size_t ArraySizeOffset = sizeof(uint32_t) + sizeof(DDS::Header) + offsetof(DDS::HeaderDX10, arraySize);
+            const uint32_t arraySize = 3;
+            std::memcpy(header.data() + ArraySizeOffset, &arraySize, sizeof(arraySize));
+
+            const uint64_t arrayFileSize = header.size() + sliceSize * arraySize;
+            const auto array = DDS::ParseHeader(header, arrayFileSize);
+            check(array && array->arraySize == arraySize && array->subresources.size() == Mips * arraySize,
+                "DX10 迭 ؼ");
+            if (array && array->arraySize == arraySize) {
+                check(array->GetSubresource(0, 2).offset == DDS::MaxHeaderSize + sliceSize * 2 &&
+                    array->GetSubresource(3, 1).offset == array->GetSubresource(0, 1).offset +
+                    ExpectedMipSize(Size, Size, 0, 16, true) + ExpectedMipSize(Size, Size, 1, 16, true) +
+                    ExpectedMipSize(Size, Size, 2, 16, true), "DX10 迭 ̽/ ");
+            }
+            check(!DDS::ParseHeader(header, arrayFileSize - 1), "߸ 迭  ź");
+        }
+
+        // 4.  Ʈ   ( 10,  2 )
+        {
+            constexpr uint32_t None = MipStreamState::NoMip;
+            MipStreamState state;
+            state.Reset(10, 2);
+            check(state.GetResidentMip() == 2 && state.GetRequestedMip() == 2 && !state.HasPendingWork(),
+                "ʱ ´  ");
+            check(state.BeginNext() == None, "û  ε ");
+
+            state.Request(0);
+            check(state.HasPendingWork() && state.BeginNext() == 1, "û   ܰ  Ӻ ε");
+            check(state.BeginNext() == None && state.IsStreaming(), "ε ߿    ");
+
+            state.Complete(0);
+            check(state.GetResidentMip() == 2 && state.GetInflightMip() == 1, "  ƴ  Ϸ ");
+            state.Complete(1);
+            check(state.GetResidentMip() == 1 && !state.IsStreaming() && state.GetMinLodClamp() == 1.0f,
+                "Ϸ  ֿ MinLOD");
+
+            check(state.BeginNext() == 0, "  ε");
+            state.Abort();
+            check(state.GetResidentMip() == 1 && !state.IsStreaming() && state.HasPendingWork(), "    ");
+            check(state.BeginNext() == 0, "  õ");
+            state.Complete(0);
+            check(state.IsFullyResident() && !state.HasPendingWork() && state.BeginNext() == None, "ü ");
+
+            // û 絵 ̹ ö    (޸𸮴 ó ü ũ  )
+            state.Request(5);
+            check(state.GetResidentMip() == 0 && state.BeginNext() == None, "û 絵  ");
+
+            // 缳 (ε/  ٽ ε) -   ε嵵 
+            state.Reset(10, 2);
+            state.Request(None);
+            check(state.GetRequestedMip() == 9 && state.BeginNext() == None, "  û   ");
+            state.Request(1);
+            check(state.BeginNext() == 1, "缳  ٽ Ʈ");
+            state.Reset(10, 2);
+            check(state.GetInflightMip() == None && state.GetResidentMip() == 2, "缳   ε带 ");
+
+            MipStreamState empty;
+            empty.Request(0);
+            check(empty.BeginNext() == None, "  ´ û ");
+        }
+
+        // 5. ȭ ũ⺰   - ؼ ȼ  ʴ   ػ
+        {
+            check(MipStreamState::GetMipForScreenSize(2048, 256.0f) == 3, "2048 ؽó 256ȼ ->  3");
+            check(MipStreamState::GetMipForScreenSize(2048, 300.0f) == 2, "2048 ؽó 300ȼ ->  2");
+            check(MipStreamState::GetMipForScreenSize(2048, 4096.0f) == 0, "ȮǸ  0");
+            check(MipStreamState::GetMipForScreenSize(2048, 0.0f) == MipStreamState::NoMip, "    ");
+        }
+
+        Logger::Instance().Info(" {},  {}", result.checks, result.violations);
+        return result;
+    }
+
+    TextureProcessing::Image TextureTools::CreateTestImage(uint32_t size)
+    {
+        TextureProcessing::Image image;
+        image.width = size;
+        image.height = size;
+        image.pixels.resize(image.GetRowPitch() * size);
+
+        std::mt19937 random(12345);
+        std::uniform_int_distribution<int> noise(-24, 24);
+
+        //  : ε巯 ׶̼,  : üĿ, Ʒ:    . Ĵ 밢 ׶̼
+        for (uint32_t y = 0; y < size; ++y) {
+            for (uint32_t x = 0; x < size; ++x) {
+                uint8_t* p = image.pixels.data() + y * image.GetRowPitch() + x * 4;
+                const float u = static_cast<float>(x) / size;
+                const float v = static_cast<float>(y) / size;
+
+                int r, g, b;
+                if (v < 0.5f && u < 0.5f) {
+                    r = static_cast<int>(u * 2.0f * 255.0f);
+                    g = static_cast<int>(v * 2.0f * 255.0f);
+                    b = static_cast<int>((1.0f - u) * 200.0f);
+                }
+                else if (v < 0.5f) {
+                    const bool odd = ((x / 16) + (y / 16)) & 1;
+                    r = odd ? 230 : 30;
+                    g = odd ? 200 : 60;
+                    b = odd ? 40 : 180;
+                }
+                else {
+                    const float band = std::sin(u * 40.0f) * 0.5f + 0.5f;
+                    r = static_cast<int>(band * 220.0f) + noise(random);
+                    g = static_cast<int>((1.0f - band) * 180.0f) + noise(random);
+                    b = static_cast<int>(v * 255.0f) + noise(random);
+                }
+
+                p[0] = static_cast<uint8_t>(std::clamp(r, 0, 255));
+                p[1] = static_cast<uint8_t>(std::clamp(g, 0, 255));
+                p[2] = static_cast<uint8_t>(std::clamp(b, 0, 255));
+                p[3] = static_cast<uint8_t>(std::clamp(static_cast<int>((u + v) * 0.5f * 255.0f), 0, 255));
+            }
+        }
+        return image;
+    }
+}
@@ -0,0 +1,60 @@
+#pragma once
+#include "pch.h"
+#include "TextureProcessing.h"
+#include "TextureCompressor.h"
+
+namespace Resource
+{
+    //  ؽó ŷ ( ̹ ->  ü -> BC  DDS) ġũ 
+    //  DDS DX10 Ȯ   TextureResource ״ ε
+    class TextureTools {
+    public:
+        // WIC PNG/JPG/BMP/TGA  RGBA8 ڵ (Ʈ Ű )
+        static bool DecodeImage(const std::string& path, TextureProcessing::Image& image);
+
+        // format    BC3/BC1 .   sRGB   _SRGB  
+        // outputPath     Ȯڸ .dds ٲ 
+        static bool CookTexture(const std::string& sourcePath, const std::string& outputPath = {},
+            std::optional<TextureCompressor::Format> format = std::nullopt);
+
+        //  ü ؼ DDS  ̹ ( +  0)
+        static std::vector<uint8_t> BuildDDS(const std::vector<TextureProcessing::Image>& mips,
+            TextureCompressor::Format format, bool srgb);
+
+        struct FormatBenchmark {
+            TextureCompressor::Format format = TextureCompressor::Format::BC1;
+            double compressMs = 0.0;        //  ü ü
+            double mpixelsPerSec = 0.0;
+            size_t compressedBytes = 0;
+            double ratio = 0.0;             // RGBA8 
+            double psnr = 0.0;              //  0,   äθ (dB)
+        };
+
+        struct CompressionBenchmarkResult {
+            uint32_t width = 0;
+            uint32_t height = 0;
+            uint32_t mipCount = 0;
+            double mipMs = 0.0;
+            std::vector<FormatBenchmark> formats;
+            size_t violations = 0;          // DDS  ٽ ؼ  ũ/ġ   
+        };
+
+        //  BC   ó ȭ 
+        // sourcePath   ׶̼/üĿ//İ  size x size ̹ 
+        static CompressionBenchmarkResult RunCompressionBenchmark(const std::string& sourcePath,
+            uint32_t size = 2048, int iterations = 3);
+
+        struct StreamingCheckResult {
+            size_t checks = 0;
+            size_t violations = 0;
+        };
+
+        // GPU  Ʈ   
+        // - ޸𸮿  DDS ParseHeader Ȯ (/DX10 , ߸ Է, /迭 )
+        // - MipStreamState û/ε/Ϸ//缳 ̿ ȭ ũ⺰  
+        static StreamingCheckResult RunStreamingCheck();
+
+    private:
+        static TextureProcessing::Image CreateTestImage(uint32_t size);
+    };
+}
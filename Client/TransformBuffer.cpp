@@ -0,0 +1,210 @@
+#include "pch.h"
+#include "TransformBuffer.h"
+
+void TransformBuffer::Channels::Push(const PxTransform& pose)
+{
+	px.push_back(pose.p.x);
+	py.push_back(pose.p.y);
+	pz.push_back(pose.p.z);
+	qx.push_back(pose.q.x);
+	qy.push_back(pose.q.y);
+	qz.push_back(pose.q.z);
+	qw.push_back(pose.q.w);
+}
+
+void TransformBuffer::Channels::Set(uint32_t slot, const PxTransform& pose)
+{
+	px[slot] = pose.p.x;
+	py[slot] = pose.p.y;
+	pz[slot] = pose.p.z;
+	qx[slot] = pose.q.x;
+	qy[slot] = pose.q.y;
+	qz[slot] = pose.q.z;
+	qw[slot] = pose.q.w;
+}
+
+PxTransform TransformBuffer::Channels::Get(uint32_t slot) const
+{
+	return PxTransform(PxVec3(px[slot], py[slot], pz[slot]), PxQuat(qx[slot], qy[slot], qz[slot], qw[slot]));
+}
+
+uint32_t TransformBuffer::Add(const PxTransform& pose)
+{
+	const uint32_t slot = static_cast<uint32_t>(m_lastMoved.size());
+	m_current.Push(pose);
+	m_previous.Push(pose);
+	m_lastMoved.push_back(0);
+
+	m_matrices.emplace_back();
+	m_dirtyMark.push_back(0);
+
+	// ù UpdateMatrices    ֵ ٷ 
+	const PxMat44 matrix(pose);
+	for (int row = 0; row < 4; ++row) {
+		for (int column = 0; column < 4; ++column) {
+			m_matrices[slot].m[row][column] = matrix[row][column];
+		}
+	}
+	return slot;
+}
+
+void TransformBuffer::Write(uint32_t slot, const PxTransform& pose)
+{
+	//  ܿ  ʾҾ  °    ġ̹Ƿ ״ о 
+	m_previous.px[slot] = m_current.px[slot];
+	m_previous.py[slot] = m_current.py[slot];
+	m_previous.pz[slot] = m_current.pz[slot];
+	m_previous.qx[slot] = m_current.qx[slot];
+	m_previous.qy[slot] = m_current.qy[slot];
+	m_previous.qz[slot] = m_current.qz[slot];
+	m_previous.qw[slot] = m_current.qw[slot];
+	m_current.Set(slot, pose);
+
+	m_lastMoved[slot] = m_step;
+	MarkDirty(slot);
+}
+
+void TransformBuffer::MarkDirty(uint32_t slot)
+{
+	if (!m_dirtyMark[slot]) {
+		m_dirtyMark[slot] = 1;
+		m_dirty.push_back(slot);
+	}
+}
+
+PxTransform TransformBuffer::GetCurrent(uint32_t slot) const
+{
+	return m_current.Get(slot);
+}
+
+PxTransform TransformBuffer::GetPrevious(uint32_t slot) const
+{
+	return m_lastMoved[slot] == m_step ? m_previous.Get(slot) : m_current.Get(slot);
+}
+
+PxTransform TransformBuffer::GetInterpolated(uint32_t slot, float alpha) const
+{
+	const PxTransform previous = GetPrevious(slot);
+	const PxTransform current = m_current.Get(slot);
+
+	//    ȸ Ƿ ȭ    (ȣ ݴ ª )
+	const PxQuat target = previous.q.dot(current.q) < 0.0f ? -current.q : current.q;
+	const PxQuat rotation = previous.q * (1.0f - alpha) + target * alpha;
+	return PxTransform(previous.p + (current.p - previous.p) * alpha, rotation.getNormalized());
+}
+
+void TransformBuffer::UpdateMatrices(float alpha)
+{
+	const size_t count = m_dirty.size();
+	if (count == 0) {
+		return;
+	}
+
+	const __m128 zero = _mm_setzero_ps();
+	const __m128 one = _mm_set1_ps(1.0f);
+	const __m128 two = _mm_set1_ps(2.0f);
+	const __m128 signMask = _mm_set1_ps(-0.0f);
+
+	for (size_t i = 0; i < count; i += 4) {
+		// 4  Ǵ     ݺ (    )
+		uint32_t s[4];
+		for (size_t k = 0; k < 4; ++k) {
+			s[k] = m_dirty[std::min(i + k, count - 1)];
+		}
+		auto gather = [&](const std::vector<float>& channel) {
+			return _mm_setr_ps(channel[s[0]], channel[s[1]], channel[s[2]], channel[s[3]]);
+		};
+
+		const __m128 weight = _mm_setr_ps(GetWeight(s[0], alpha), GetWeight(s[1], alpha),
+			GetWeight(s[2], alpha), GetWeight(s[3], alpha));
+
+		// ġ -  
+		const __m128 ppx = gather(m_previous.px), ppy = gather(m_previous.py), ppz = gather(m_previous.pz);
+		const __m128 px = _mm_add_ps(ppx, _mm_mul_ps(_mm_sub_ps(gather(m_current.px), ppx), weight));
+		const __m128 py = _mm_add_ps(ppy, _mm_mul_ps(_mm_sub_ps(gather(m_current.py), ppy), weight));
+		const __m128 pz = _mm_add_ps(ppz, _mm_mul_ps(_mm_sub_ps(gather(m_current.pz), ppz), weight));
+
+		// ȸ - ȭ   (   ȸ ȣ  ª )
+		const __m128 pqx = gather(m_previous.qx), pqy = gather(m_previous.qy);
+		const __m128 pqz = gather(m_previous.qz), pqw = gather(m_previous.qw);
+		__m128 cqx = gather(m_current.qx), cqy = gather(m_current.qy);
+		__m128 cqz = gather(m_current.qz), cqw = gather(m_current.qw);
+
+		const __m128 dot = _mm_add_ps(_mm_add_ps(_mm_mul_ps(pqx, cqx), _mm_mul_ps(pqy, cqy)),
+			_mm_add_ps(_mm_mul_ps(pqz, cqz), _mm_mul_ps(pqw, cqw)));
+		const __m128 flip = _mm_and_ps(dot, signMask);
+		cqx = _mm_xor_ps(cqx, flip);
+		cqy = _mm_xor_ps(cqy, flip);
+		cqz = _mm_xor_ps(cqz, flip);
+		cqw = _mm_xor_ps(cqw, flip);
+
+		__m128 qx = _mm_add_ps(pqx, _mm_mul_ps(_mm_sub_ps(cqx, pqx), weight));
+		__m128 qy = _mm_add_ps(pqy, _mm_mul_ps(_mm_sub_ps(cqy, pqy), weight));
+		__m128 qz = _mm_add_ps(pqz, _mm_mul_ps(_mm_sub_ps(cqz, pqz), weight));
+		__m128 qw = _mm_add_ps(pqw, _mm_mul_ps(_mm_sub_ps(cqw, pqw), weight));
+
+		const __m128 lengthSquared = _mm_add_ps(_mm_add_ps(_mm_mul_ps(qx, qx), _mm_mul_ps(qy, qy)),
+			_mm_add_ps(_mm_mul_ps(qz, qz), _mm_mul_ps(qw, qw)));
+		const __m128 inverseLength = _mm_div_ps(one, _mm_sqrt_ps(lengthSquared));
+		qx = _mm_mul_ps(qx, inverseLength);
+		qy = _mm_mul_ps(qy, inverseLength);
+		qz = _mm_mul_ps(qz, inverseLength);
+		qw = _mm_mul_ps(qw, inverseLength);
+
+		//  -> ȸ  (PxMat33(q)  ,  = PhysX )
+		const __m128 xx = _mm_mul_ps(qx, qx), yy = _mm_mul_ps(qy, qy), zz = _mm_mul_ps(qz, qz);
+		const __m128 xy = _mm_mul_ps(qx, qy), xz = _mm_mul_ps(qx, qz), yz = _mm_mul_ps(qy, qz);
+		const __m128 xw = _mm_mul_ps(qx, qw), yw = _mm_mul_ps(qy, qw), zw = _mm_mul_ps(qz, qw);
+
+		__m128 r00 = _mm_sub_ps(one, _mm_mul_ps(two, _mm_add_ps(yy, zz)));
+		__m128 r01 = _mm_mul_ps(two, _mm_add_ps(xy, zw));
+		__m128 r02 = _mm_mul_ps(two, _mm_sub_ps(xz, yw));
+		__m128 r03 = zero;
+
+		__m128 r10 = _mm_mul_ps(two, _mm_sub_ps(xy, zw));
+		__m128 r11 = _mm_sub_ps(one, _mm_mul_ps(two, _mm_add_ps(xx, zz)));
+		__m128 r12 = _mm_mul_ps(two, _mm_add_ps(yz, xw));
+		__m128 r13 = zero;
+
+		__m128 r20 = _mm_mul_ps(two, _mm_add_ps(xz, yw));
+		__m128 r21 = _mm_mul_ps(two, _mm_sub_ps(yz, xw));
+		__m128 r22 = _mm_sub_ps(one, _mm_mul_ps(two, _mm_add_ps(xx, yy)));
+		__m128 r23 = zero;
+
+		__m128 r30 = px, r31 = py, r32 = pz, r33 = one;
+
+		// к   ġϸ  ϳ  ϳ   
+		_MM_TRANSPOSE4_PS(r00, r01, r02, r03);
+		_MM_TRANSPOSE4_PS(r10, r11, r12, r13);
+		_MM_TRANSPOSE4_PS(r20, r21, r22, r23);
+		_MM_TRANSPOSE4_PS(r30, r31, r32, r33);
+
+		const __m128 rows[4][4] = {
+			{ r00, r10, r20, r30 },
+			{ r01, r11, r21, r31 },
+			{ r02, r12, r22, r32 },
+			{ r03, r13, r23, r33 }
+		};
+		for (size_t k = 0; k < 4; ++k) {
+			float* matrix = &m_matrices[s[k]].m[0][0];
+			_mm_store_ps(matrix + 0, rows[k][0]);
+			_mm_store_ps(matrix + 4, rows[k][1]);
+			_mm_store_ps(matrix + 8, rows[k][2]);
+			_mm_store_ps(matrix + 12, rows[k][3]);
+		}
+	}
+
+	//  ܿ  Ը  ( ӿ alpha ٲǷ)
+	//     · Ƿ ٽ   ״ 
+	size_t kept = 0;
+	for (size_t i = 0; i < count; ++i) {
+		const uint32_t slot = m_dirty[i];
+		if (m_lastMoved[slot] == m_step) {
+			m_dirty[kept++] = slot;
+		}
+		else {
+			m_dirtyMark[slot] = 0;
+		}
+	}
+	m_dirty.resize(kept);
+}
@@ -0,0 +1,62 @@
+#pragma once
+#include "PhysicsTypes.h"
+
+//  ü ȯ SoA  ( = PhysicsObject::GetTransformSlot)
+// - ġ/ȸ и  迭 ΰ  ¿    ¸ 
+// - ܸ PhysX active actors( ) WriteϹǷ  ü   
+// -  ĵ Ժ ĳϰ UpdateMatrices ֱٿ  Ը SSE 4 
+//      ·      Ͽ Ƿ  ü  뵵 
+class TransformBuffer
+{
+public:
+	//    ȣ ȯ (  =  , ĵ ٷ ä)
+	uint32_t Add(const PxTransform& pose);
+	size_t GetCount() const { return m_lastMoved.size(); }
+
+	//     ȣ. ̹ ܿ Write     
+	void BeginStep() { ++m_step; }
+
+	// ̹ ܿ     ( ´  · з). ܸ Դ  
+	void Write(uint32_t slot, const PxTransform& pose);
+
+	//         ( ܿ  ʾ  )
+	PxTransform GetCurrent(uint32_t slot) const;
+	PxTransform GetPrevious(uint32_t slot) const;
+
+	//  ¸ alpha [0, 1]  (ġ , ȸ ȭ  )
+	PxTransform GetInterpolated(uint32_t slot, float alpha) const;
+
+	//     alpha  ٽ 
+	void UpdateMatrices(float alpha);
+
+	//  켱   (XMMATRIX  ġ,   ġ)
+	const XMFLOAT4X4A& GetMatrix(uint32_t slot) const { return m_matrices[slot]; }
+
+	//  UpdateMatrices   
+	size_t GetDirtyCount() const { return m_dirty.size(); }
+
+private:
+	// к  迭
+	struct Channels {
+		std::vector<float> px, py, pz;
+		std::vector<float> qx, qy, qz, qw;
+
+		void Push(const PxTransform& pose);
+		void Set(uint32_t slot, const PxTransform& pose);
+		PxTransform Get(uint32_t slot) const;
+	};
+
+	//  ܿ  Ը ϰ    ״
+	float GetWeight(uint32_t slot, float alpha) const { return m_lastMoved[slot] == m_step ? alpha : 1.0f; }
+
+	void MarkDirty(uint32_t slot);
+
+	Channels m_current;
+	Channels m_previous;
+	std::vector<uint32_t> m_lastMoved;         //     ȣ
+	uint32_t m_step = 1;
+
+	std::vector<XMFLOAT4X4A> m_matrices;
+	std::vector<uint32_t> m_dirty;             //  ٽ  
+	std::vector<uint8_t> m_dirtyMark;          // m_dirty  ִ
+};
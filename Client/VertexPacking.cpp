@@ -0,0 +1,159 @@
+#include "pch.h"
+#include "VertexPacking.h"
+
+namespace Resource
+{
+    namespace VertexPacking
+    {
+        namespace
+        {
+            uint16_t QuantizeUnorm16(float value)
+            {
+                return static_cast<uint16_t>(std::clamp(value, 0.0f, 1.0f) * 65535.0f + 0.5f);
+            }
+
+            int16_t QuantizeSnorm16(float value)
+            {
+                return static_cast<int16_t>(std::lround(std::clamp(value, -1.0f, 1.0f) * 32767.0f));
+            }
+
+            uint8_t QuantizeUnorm8(float value)
+            {
+                return static_cast<uint8_t>(std::clamp(value, 0.0f, 1.0f) * 255.0f + 0.5f);
+            }
+
+            // ϵ SNORM ȯ  (-32768 -1 )
+            float DecodeSnorm16(int16_t value)
+            {
+                return std::max(float(value) / 32767.0f, -1.0f);
+            }
+
+            float SignNotZero(float value)
+            {
+                return value >= 0.0f ? 1.0f : -1.0f;
+            }
+        }
+
+        const D3D12_INPUT_ELEMENT_DESC InputLayout[4] = {
+            { "POSITION", 0, DXGI_FORMAT_R16G16B16A16_UNORM, 0, offsetof(PackedVertex, position),
+              D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0 },
+            { "NORMAL", 0, DXGI_FORMAT_R16G16_SNORM, 0, offsetof(PackedVertex, normal),
+              D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0 },
+            { "TEXCOORD", 0, DXGI_FORMAT_R16G16_FLOAT, 0, offsetof(PackedVertex, texCoord),
+              D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0 },
+            { "COLOR", 0, DXGI_FORMAT_R8G8B8A8_UNORM, 0, offsetof(PackedVertex, color),
+              D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0 }
+        };
+
+        Dequantization ComputeDequantization(const float boundsMin[3], const float boundsMax[3])
+        {
+            Dequantization result;
+            result.scale = { std::max(boundsMax[0] - boundsMin[0], 0.0f),
+                std::max(boundsMax[1] - boundsMin[1], 0.0f),
+                std::max(boundsMax[2] - boundsMin[2], 0.0f) };
+            result.offset = { boundsMin[0], boundsMin[1], boundsMin[2] };
+            return result;
+        }
+
+        float MaxPositionError(float extent)
+        {
+            //   float    
+            return extent / 65535.0f * 0.5f + std::abs(extent) * 1e-6f;
+        }
+
+        float MaxTexCoordError(float value)
+        {
+            // 0 ó half   (2^-24) 
+            return std::max(std::abs(value) * (1.0f / 2048.0f), 1.0f / 16777216.0f);
+        }
+
+        void EncodeOctahedral(const XMFLOAT3& normal, int16_t encoded[2])
+        {
+            const float length = std::abs(normal.x) + std::abs(normal.y) + std::abs(normal.z);
+            if (length <= 0.0f) {
+                encoded[0] = 0;
+                encoded[1] = 0;
+                return;
+            }
+
+            float x = normal.x / length;
+            float y = normal.y / length;
+
+            // Ʒ ݱ 밢 ٱ ﰢ 
+            if (normal.z < 0.0f) {
+                const float foldedX = (1.0f - std::abs(y)) * SignNotZero(x);
+                const float foldedY = (1.0f - std::abs(x)) * SignNotZero(y);
+                x = foldedX;
+                y = foldedY;
+            }
+
+            encoded[0] = QuantizeSnorm16(x);
+            encoded[1] = QuantizeSnorm16(y);
+        }
+
+        XMFLOAT3 DecodeOctahedral(const int16_t encoded[2])
+        {
+            float x = DecodeSnorm16(encoded[0]);
+            float y = DecodeSnorm16(encoded[1]);
+            const float z = 1.0f - std::abs(x) - std::abs(y);
+
+            const float t = std::max(-z, 0.0f);
+            x += x >= 0.0f ? -t : t;
+            y += y >= 0.0f ? -t : t;
+
+            XMFLOAT3 result(x, y, z);
+            XMStoreFloat3(&result, XMVector3Normalize(XMLoadFloat3(&result)));
+            return result;
+        }
+
+        PackedVertex Pack(const Vertex& vertex, const Dequantization& dequantization)
+        {
+            const auto& scale = dequantization.scale;
+            const auto& offset = dequantization.offset;
+
+            PackedVertex packed;
+            packed.position[0] = QuantizeUnorm16(scale.x > 0.0f ? (vertex.position.x - offset.x) / scale.x : 0.0f);
+            packed.position[1] = QuantizeUnorm16(scale.y > 0.0f ? (vertex.position.y - offset.y) / scale.y : 0.0f);
+            packed.position[2] = QuantizeUnorm16(scale.z > 0.0f ? (vertex.position.z - offset.z) / scale.z : 0.0f);
+            packed.position[3] = 0;
+
+            EncodeOctahedral(vertex.normal, packed.normal);
+
+            packed.texCoord[0] = PackedVector::XMConvertFloatToHalf(vertex.texCoord.x);
+            packed.texCoord[1] = PackedVector::XMConvertFloatToHalf(vertex.texCoord.y);
+
+            packed.color[0] = QuantizeUnorm8(vertex.color.x);
+            packed.color[1] = QuantizeUnorm8(vertex.color.y);
+            packed.color[2] = QuantizeUnorm8(vertex.color.z);
+            packed.color[3] = QuantizeUnorm8(vertex.color.w);
+            return packed;
+        }
+
+        void Pack(std::span<const Vertex> vertices, const Dequantization& dequantization, PackedVertex* packed)
+        {
+            for (size_t i = 0; i < vertices.size(); ++i) {
+                packed[i] = Pack(vertices[i], dequantization);
+            }
+        }
+
+        Vertex Unpack(const PackedVertex& packed, const Dequantization& dequantization)
+        {
+            const auto& scale = dequantization.scale;
+            const auto& offset = dequantization.offset;
+
+            Vertex vertex;
+            vertex.position = {
+                packed.position[0] / 65535.0f * scale.x + offset.x,
+                packed.position[1] / 65535.0f * scale.y + offset.y,
+                packed.position[2] / 65535.0f * scale.z + offset.z };
+            vertex.normal = DecodeOctahedral(packed.normal);
+            vertex.texCoord = {
+                PackedVector::XMConvertHalfToFloat(packed.texCoord[0]),
+                PackedVector::XMConvertHalfToFloat(packed.texCoord[1]) };
+            vertex.color = {
+                packed.color[0] / 255.0f, packed.color[1] / 255.0f,
+                packed.color[2] / 255.0f, packed.color[3] / 255.0f };
+            return vertex;
+        }
+    }
+}
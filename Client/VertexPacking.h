@@ -0,0 +1,46 @@
+#pragma once
+#include "pch.h"
+
+namespace Resource
+{
+    //   (Vertex 48 bytes -> 20 bytes)
+    //  ȯ Է Ⱑ ϰ ̴ ġ   ڵ常  (shaders.hlsl VSMainPacked)
+    struct PackedVertex {
+        uint16_t position[4];   // ޽   UNORM16 (w 0)
+        int16_t normal[2];      // 8ü ڵ SNORM16
+        uint16_t texCoord[2];   // half
+        uint8_t color[4];       // RGBA UNORM8
+    };
+    static_assert(sizeof(PackedVertex) == 20);
+
+    namespace VertexPacking
+    {
+        // ġ  - position = unorm * scale + offset (ObjectConstants ״ )
+        struct Dequantization {
+            XMFLOAT3 scale;
+            XMFLOAT3 offset;
+        };
+
+        Dequantization ComputeDequantization(const float boundsMin[3], const float boundsMax[3]);
+
+        // ڵ е   
+        // ġ: ึ ( ũ / 65535) / 2, UV: |uv| * 2^-11 (half  10Ʈ),
+        // : 1/510, : 16Ʈ 8ü   
+        float MaxPositionError(float extent);
+        float MaxTexCoordError(float value);
+        constexpr float MaxColorError = 1.0f / 510.0f;
+        constexpr float MaxNormalErrorDegrees = 0.01f;
+
+        void EncodeOctahedral(const XMFLOAT3& normal, int16_t encoded[2]);
+        XMFLOAT3 DecodeOctahedral(const int16_t encoded[2]);
+
+        PackedVertex Pack(const Vertex& vertex, const Dequantization& dequantization);
+        void Pack(std::span<const Vertex> vertices, const Dequantization& dequantization, PackedVertex* packed);
+
+        //  CPU ڵ (̴  )
+        Vertex Unpack(const PackedVertex& packed, const Dequantization& dequantization);
+
+        // PSO Է ̾ƿ
+        extern const D3D12_INPUT_ELEMENT_DESC InputLayout[4];
+    }
+}
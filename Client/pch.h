@@ -6,14 +6,23 @@
 #include <windows.h>
 #include <windowsx.h>
 #include <wrl.h>
+#include <shellapi.h>
 
 // DirectX  
 #include <d3d12.h>
 #include <dxgi1_6.h>
 #include <d3dcompiler.h>
+#include <d3d12shader.h>
 #include <DirectXMath.h>
+#include <DirectXPackedVector.h>
 #include <DirectXCollision.h>
 #include <DirectXColors.h>
+#include <immintrin.h>
+#include <wincodec.h>
+#include <ioringapi.h>
+#include <mmreg.h>
+#include <mmdeviceapi.h>
+#include <audioclient.h>
 #include "Util/d3dx12.h"
 #include "ResourceUploadBatch.h"
 #include "DDSTextureLoader.h"
@@ -29,6 +38,9 @@
 // TBB  
 #include "tbb/concurrent_queue.h"
 #include "tbb/concurrent_unordered_map.h"
+#include "tbb/parallel_for.h"
+#include "tbb/task_arena.h"
+#include "tbb/global_control.h"
 
 // STL 
 #include <iostream>
@@ -41,18 +53,27 @@
 #include <set>
 #include <unordered_set>
 #include <queue>
+#include <deque>
 #include <algorithm>
+#include <numeric>
+#include <random>
 #include <thread>
 #include <format>
 #include <fstream>
 #include <filesystem>
 #include <mutex>
 #include <shared_mutex>
+#include <condition_variable>
+#include <atomic>
 #include <chrono>
 
 #include <stdexcept>
 #include <cassert>
 #include <future>
+#include <optional>
+#include <span>
+#include <limits>
+#include <bit>
 #include <sstream>
 #include <functional>
 #include <source_location>
@@ -76,6 +97,8 @@ constexpr UINT CACHE_LINE_SIZE = 64;
 #pragma comment(lib, "d3d12.lib")
 #pragma comment(lib, "dxgi.lib")
 #pragma comment(lib, "d3dcompiler.lib")
+#pragma comment(lib, "dxguid.lib")
+#pragma comment(lib, "windowscodecs.lib")
 
 #ifdef _DEBUG
     #pragma comment(lib, "PhysX_64.lib")
@@ -172,6 +195,8 @@ struct ObjectConstants
     XMMATRIX worldMatrix;
     XMMATRIX viewMatrix;
     XMMATRIX projectionMatrix;
+    XMFLOAT4 positionScale;   //   ġ  (float  1, 0)
+    XMFLOAT4 positionOffset;
 };
 
 // Light   ü
@@ -4,6 +4,8 @@ cbuffer ObjectConstants : register(b0)
     matrix worldMatrix;
     matrix viewMatrix;
     matrix projectionMatrix;
+    float4 positionScale;   //   ġ  (VSMainPacked)
+    float4 positionOffset;
 }
 
 cbuffer LightConstants : register(b1)
@@ -14,6 +16,25 @@ cbuffer LightConstants : register(b1)
     float4 eyePosition;
 }
 
+// ͸  - MaterialResource ÷ ġ ä
+// ʱⰪ .mat Ͽ   ͸ غǱ  
+cbuffer MaterialConstants : register(b2)
+{
+    float4 baseColor = float4(1.0f, 1.0f, 1.0f, 1.0f);
+    float specularPower = 16.0f;
+    float specularIntensity = 0.5f;
+}
+
+// Ű  (Engine::InitializeShaders ,  1 ǵ)
+// USE_TEXTURE  : ؽó   (  )
+// USE_SPECULAR : ݻ籤 
+#ifndef USE_TEXTURE
+#define USE_TEXTURE 0
+#endif
+#ifndef USE_SPECULAR
+#define USE_SPECULAR 0
+#endif
+
 // ؽó ÷ 
 Texture2D g_texture : register(t0);
 SamplerState g_sampler : register(s0);
@@ -54,6 +75,36 @@ PSInput VSMain(VSInput input)
     return result;
 }
 
+//   (Resource::PackedVertex, 20 bytes)
+// UNORM/SNORM/half ȯ Է Ⱑ ó
+struct PackedVSInput
+{
+    float4 position : POSITION;     // ޽   UNORM16
+    float2 normal : NORMAL;         // 8ü ڵ SNORM16
+    float2 texCoord : TEXCOORD;     // half
+    float4 color : COLOR;           // UNORM8
+};
+
+// VertexPacking::DecodeOctahedral  
+float3 DecodeOctahedral(float2 encoded)
+{
+    float3 n = float3(encoded.x, encoded.y, 1.0f - abs(encoded.x) - abs(encoded.y));
+    float t = saturate(-n.z);
+    n.xy += (n.xy >= 0.0f) ? -t : t;
+    return normalize(n);
+}
+
+PSInput VSMainPacked(PackedVSInput input)
+{
+    VSInput decoded;
+    decoded.position = input.position.xyz * positionScale.xyz + positionOffset.xyz;
+    decoded.color = input.color;
+    decoded.normal = DecodeOctahedral(input.normal);
+    decoded.texCoord = input.texCoord;
+    
+    return VSMain(decoded);
+}
+
 float4 PSMain(PSInput input) : SV_TARGET
 {
     float3 normal = normalize(input.normal);
@@ -68,12 +119,21 @@ float4 PSMain(PSInput input) : SV_TARGET
     float3 diffuse = lightColor.rgb * lightColor.a * diffuseFactor; //   *   *  
     
     // ݻ籤
+#if USE_SPECULAR
     float3 reflection = reflect(-lightDir, normal); // ݻ籤 
-    float specularFactor = pow(max(dot(reflection, toEye), 0.0f) /*ݻ籤  */, 16.0f); //   
-    float3 specular = lightColor.rgb * lightColor.a * specularFactor * 0.5f;
+    float specularFactor = pow(max(dot(reflection, toEye), 0.0f) /*ݻ籤  */, specularPower); //   
+    float3 specular = lightColor.rgb * lightColor.a * specularFactor * specularIntensity;
+#else
+    float3 specular = float3(0.0f, 0.0f, 0.0f);
+#endif
     
     // ؽó  ø
+#if USE_TEXTURE
     float4 texColor = g_texture.Sample(g_sampler, input.texCoord);
+#else
+    float4 texColor = input.color;
+#endif
+    texColor *= baseColor;
     
     //    (ؽó   )
     float3 finalColor = texColor.rgb * (ambient + diffuse) + specular;